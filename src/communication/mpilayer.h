@@ -39,7 +39,10 @@ public:
         // reserve [100, 199], assuming there won't be more than 100
         // links between any two nodes.
         PATCH_LINK = 100,
-        PARALLEL_MEMORY_WRITER = 200
+        PARALLEL_MEMORY_WRITER = 200,
+        PARALLEL_SILO_WRITER = 201,
+        UPDATE_GROUP_MIGRATION = 300,
+        UPDATE_GROUP_NEIGHBOR_DISCOVERY = 301
     };
 
     typedef std::map<int, std::vector<MPI_Request> > RequestsMap;
@@ -378,7 +381,25 @@ public:
             comm);
     }
 
-    // fixme: add mpi_allreduce for minighost, add global reduction api for production code
+    /**
+     * Element-wise reduction of source over all ranks, the result is
+     * available on every rank.
+     */
+    template<typename T>
+    inline std::vector<T> allReduce(
+        const std::vector<T>& source,
+        MPI_Op op = MPI_SUM,
+        const MPI_Datatype& datatype = Typemaps::lookup<T>()) const
+    {
+        std::vector<T> result(source.size());
+        if (!source.empty()) {
+            MPI_Allreduce(
+                const_cast<T*>(&source.front()), &result.front(), source.size(), datatype, op, comm);
+        }
+        return result;
+    }
+
+    // fixme: add global reduction api for production code
 
     template<typename T>
     inline std::vector<T> gather(
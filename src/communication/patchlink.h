@@ -6,12 +6,36 @@
 
 #include <deque>
 #include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/misc/tracer.h>
 #include <libgeodecomp/storage/patchaccepter.h>
 #include <libgeodecomp/storage/patchprovider.h>
 #include <libgeodecomp/storage/serializationbuffer.h>
 
 namespace LibGeoDecomp {
 
+namespace PatchLinkHelpers {
+
+/**
+ * Cells can only be transmitted directly from/to a grid if the
+ * SerializationBuffer would store them verbatim (i.e. not for
+ * SoA or Boost.Serialization).
+ */
+template<typename CELL, typename ELEMENT>
+class SupportsZeroCopy
+{
+public:
+    typedef APITraits::FalseType Value;
+};
+
+template<typename CELL>
+class SupportsZeroCopy<CELL, CELL>
+{
+public:
+    typedef APITraits::TrueType Value;
+};
+
+}
+
 /**
  * PatchLink encapsulates the transmission of patches to and from
  * remote processes. PatchLink::Accepter takes the patches from a
@@ -26,7 +50,9 @@ public:
 
     typedef typename GRID_TYPE::CellType CellType;
     typedef typename SerializationBuffer<CellType>::BufferType BufferType;
+    typedef typename SerializationBuffer<CellType>::ElementType ElementType;
     typedef typename SerializationBuffer<CellType>::FixedSize FixedSize;
+    typedef typename PatchLinkHelpers::SupportsZeroCopy<CellType, ElementType>::Value SupportsZeroCopy;
 
     const static int DIM = GRID_TYPE::DIM;
 
@@ -38,22 +64,63 @@ public:
          * avoid collisions if more than two patchlinks per node-pair
          * are present, the tag parameter needs to be unique (for this
          * pair).
+         *
+         * depth sets the number of buffers in the ring of each link.
+         * An Accepter may then pack a patch while up to (depth - 1)
+         * previous transmissions are still in flight and a Provider
+         * will post receives for up to depth patches in advance.
+         * For cells of fixed size each buffer is bound to a
+         * persistent MPI request, which is reused for all
+         * transmissions.
+         *
+         * With zeroCopy set the Link will transmit the cells
+         * directly from the grid, using an MPI datatype built from
+         * the streaks of the region, instead of going through its
+         * buffers (see Accepter). This is only available for cells
+         * which the SerializationBuffer would store verbatim; the
+         * flag is ignored for all others.
+         *
+         * peer is the rank of the remote side. It only serves to
+         * identify the link in the timeline of the Tracer.
          */
         inline Link(
             const Region<DIM>& region,
+            int peer,
             int tag,
-            MPI_Comm communicator = MPI_COMM_WORLD) :
+            MPI_Comm communicator = MPI_COMM_WORLD,
+            std::size_t depth = 1,
+            bool zeroCopy = false) :
             lastNanoStep(0),
             stride(1),
-            mpiLayer(communicator),
+            peer(peer),
+            communicator(communicator),
+            zeroCopy(zeroCopy && SupportsZeroCopy()),
             region(region),
-            buffer(SerializationBuffer<CellType>::create(region)),
-            tag(tag)
+            buffers(
+                this->zeroCopy ? 1 : (std::max)(depth, std::size_t(1)),
+                this->zeroCopy ? BufferType() : SerializationBuffer<CellType>::create(region)),
+            requests(buffers.size(), MPI_REQUEST_NULL),
+            headerRequests(buffers.size(), MPI_REQUEST_NULL),
+            inFlight(buffers.size(), false),
+            tag(tag),
+            regionDatatype(MPI_DATATYPE_NULL),
+            regionDatatypeValid(false)
         {}
 
         virtual ~Link()
         {
             wait();
+
+            for (std::size_t i = 0; i < requests.size(); ++i) {
+                // only persistent requests remain after completion:
+                if (requests[i] != MPI_REQUEST_NULL) {
+                    MPI_Request_free(&requests[i]);
+                }
+            }
+
+            if (regionDatatype != MPI_DATATYPE_NULL) {
+                MPI_Type_free(&regionDatatype);
+            }
         }
 
         /**
@@ -72,21 +139,190 @@ public:
 
         inline void wait()
         {
-            mpiLayer.wait(tag);
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                waitSlot(i);
+            }
+        }
+
+        /**
+         * Many MPI implementations will only advance transmissions
+         * while the application is calling into the library.
+         * Testing the pending requests from time to time allows
+         * communication to overlap with calculation.
+         */
+        inline void test()
+        {
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                if (inFlight[i]) {
+                    int headerFlag;
+                    int flag;
+                    MPI_Test(&headerRequests[i], &headerFlag, MPI_STATUS_IGNORE);
+                    MPI_Test(&requests[i], &flag, MPI_STATUS_IGNORE);
+                    inFlight[i] = !(headerFlag && flag);
+                }
+            }
         }
 
         inline void cancel()
         {
-            mpiLayer.cancelAll();
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                cancelSlot(i);
+            }
         }
 
     protected:
         std::size_t lastNanoStep;
         long stride;
-        MPILayer mpiLayer;
+        int peer;
+        MPI_Comm communicator;
+        bool zeroCopy;
         Region<DIM> region;
-        BufferType buffer;
+        std::vector<BufferType> buffers;
+        // requests for the payload (persistent for fixed size cells)
+        // and the buffer size (only needed for variable size cells):
+        std::vector<MPI_Request> requests;
+        std::vector<MPI_Request> headerRequests;
+        std::vector<bool> inFlight;
         int tag;
+        // datatype describing the region within grids of the given
+        // bounding box, relative to the region's first cell:
+        MPI_Datatype regionDatatype;
+        CoordBox<DIM> regionDatatypeBox;
+        bool regionDatatypeValid;
+
+        inline void waitSlot(std::size_t slot)
+        {
+            if (inFlight[slot]) {
+                ScopedTrace trace("patchlink", "wait", peer);
+                MPI_Wait(&headerRequests[slot], MPI_STATUS_IGNORE);
+                MPI_Wait(&requests[slot], MPI_STATUS_IGNORE);
+                inFlight[slot] = false;
+                trace.setBytes(buffers[slot].empty() ? zeroCopyBytes() : payloadBytes(slot));
+            }
+        }
+
+        inline void cancelSlot(std::size_t slot)
+        {
+            if (!inFlight[slot]) {
+                return;
+            }
+
+            if (headerRequests[slot] != MPI_REQUEST_NULL) {
+                MPI_Cancel(&headerRequests[slot]);
+            }
+            if (requests[slot] != MPI_REQUEST_NULL) {
+                MPI_Cancel(&requests[slot]);
+            }
+        }
+
+        inline std::size_t payloadBytes(std::size_t slot) const
+        {
+            return buffers[slot].size() * sizeof(ElementType);
+        }
+
+        inline std::size_t zeroCopyBytes() const
+        {
+            return region.size() * sizeof(CellType);
+        }
+
+        inline ElementType *data(std::size_t slot)
+        {
+            if (buffers[slot].empty()) {
+                return 0;
+            }
+
+            return SerializationBuffer<CellType>::getData(buffers[slot]);
+        }
+
+        /**
+         * Returns the address of the region's first cell within the
+         * grid. Together with regionDatatype this describes all
+         * cells of the region. Returns 0 if the region can't be
+         * mapped onto the grid's storage (e.g. if a streak wraps
+         * around a periodic boundary), in which case callers need to
+         * fall back to the buffers.
+         */
+        inline CellType *zeroCopyAddress(const GRID_TYPE& grid, const MPI_Datatype& cellMPIDatatype)
+        {
+            return zeroCopyAddress(grid, cellMPIDatatype, SupportsZeroCopy());
+        }
+
+        inline CellType *zeroCopyAddress(
+            const GRID_TYPE& grid,
+            const MPI_Datatype& cellMPIDatatype,
+            APITraits::FalseType)
+        {
+            return 0;
+        }
+
+        inline CellType *zeroCopyAddress(
+            const GRID_TYPE& grid,
+            const MPI_Datatype& cellMPIDatatype,
+            APITraits::TrueType)
+        {
+            if (region.empty()) {
+                return 0;
+            }
+
+            // the Stepper swaps its grids, so we can't bind the
+            // datatype to absolute addresses, but the offsets remain
+            // valid for all grids with the same bounding box:
+            CoordBox<DIM> box = grid.boundingBox();
+            if (!regionDatatypeValid || !(box == regionDatatypeBox)) {
+                if (regionDatatype != MPI_DATATYPE_NULL) {
+                    MPI_Type_free(&regionDatatype);
+                }
+
+                regionDatatype = createRegionDatatype(grid, cellMPIDatatype);
+                regionDatatypeBox = box;
+                regionDatatypeValid = true;
+            }
+
+            if (regionDatatype == MPI_DATATYPE_NULL) {
+                return 0;
+            }
+
+            return const_cast<CellType*>(&grid[region.beginStreak()->origin]);
+        }
+
+        inline MPI_Datatype createRegionDatatype(const GRID_TYPE& grid, const MPI_Datatype& cellMPIDatatype)
+        {
+            const char *base = reinterpret_cast<const char*>(&grid[region.beginStreak()->origin]);
+            std::vector<int> lengths;
+            std::vector<MPI_Aint> displacements;
+
+            for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+                 i != region.endStreak();
+                 ++i) {
+                Coord<DIM> last = i->origin;
+                last.x() = i->endX - 1;
+                const CellType *first = &grid[i->origin];
+
+                if ((&grid[last] - first) != std::ptrdiff_t(i->length() - 1)) {
+                    return MPI_DATATYPE_NULL;
+                }
+
+                lengths << i->length();
+                displacements << MPI_Aint(reinterpret_cast<const char*>(first) - base);
+            }
+
+            MPI_Datatype ret;
+            MPI_Type_create_hindexed(
+                lengths.size(), &lengths[0], &displacements[0], cellMPIDatatype, &ret);
+            MPI_Type_commit(&ret);
+            return ret;
+        }
+
+        /**
+         * Lazily allocates the buffer which is only needed if a
+         * zero-copy Link can't map its region onto the grid.
+         */
+        inline void initFallbackBuffer()
+        {
+            if (buffers[0].empty()) {
+                buffers[0] = SerializationBuffer<CellType>::create(region);
+            }
+        }
     };
 
     class Accepter :
@@ -94,28 +330,55 @@ public:
         public PatchAccepter<GRID_TYPE>
     {
     public:
-        using Link::buffer;
+        using Link::buffers;
+        using Link::communicator;
+        using Link::data;
+        using Link::headerRequests;
+        using Link::inFlight;
         using Link::lastNanoStep;
-        using Link::mpiLayer;
+        using Link::initFallbackBuffer;
+        using Link::payloadBytes;
         using Link::region;
+        using Link::regionDatatype;
+        using Link::requests;
         using Link::stride;
         using Link::tag;
+        using Link::test;
         using Link::wait;
+        using Link::waitSlot;
+        using Link::zeroCopy;
+        using Link::zeroCopyAddress;
+        using Link::zeroCopyBytes;
         using PatchAccepter<GRID_TYPE>::checkNanoStepPut;
         using PatchAccepter<GRID_TYPE>::infinity;
         using PatchAccepter<GRID_TYPE>::pushRequest;
         using PatchAccepter<GRID_TYPE>::requestedNanoSteps;
 
+        /**
+         * A zero-copy Accepter sends the patch straight from the grid
+         * via a non-blocking request. The grid must not be modified
+         * before that transmission is complete, hence Steppers need
+         * to call release() after put() and before they touch the
+         * grid again.
+         */
         inline Accepter(
             const Region<DIM>& region,
             const int dest,
             const int tag,
             const MPI_Datatype& cellMPIDatatype,
-            MPI_Comm communicator = MPI_COMM_WORLD) :
-            Link(region, tag, communicator),
+            MPI_Comm communicator = MPI_COMM_WORLD,
+            std::size_t depth = 1,
+            bool zeroCopy = false) :
+            Link(region, dest, tag, communicator, depth, zeroCopy),
             dest(dest),
-            cellMPIDatatype(cellMPIDatatype)
-        {}
+            dataSizes(buffers.size(), 0),
+            cellMPIDatatype(cellMPIDatatype),
+            nextSlot(0)
+        {
+            if (!this->zeroCopy) {
+                initRequests(FixedSize());
+            }
+        }
 
         virtual void charge(std::size_t next, std::size_t last, std::size_t newStride)
         {
@@ -134,10 +397,23 @@ public:
                 return;
             }
 
-            wait();
-            GridVecConv::gridToVector(grid, &buffer, region);
-            sendHeader(FixedSize());
-            mpiLayer.send(&buffer[0], dest, buffer.size(), tag, cellMPIDatatype);
+            if (zeroCopy) {
+                waitSlot(0);
+                ScopedTrace trace("patchlink", "send", dest, zeroCopyBytes(), nanoStep);
+                sendZeroCopy(grid);
+                inFlight[0] = true;
+            } else {
+                // only the transmission which used this buffer (depth
+                // puts ago) needs to be complete:
+                waitSlot(nextSlot);
+                ScopedTrace trace("patchlink", "send", dest, 0, nanoStep);
+                GridVecConv::gridToVector(grid, &buffers[nextSlot], region);
+                // packing may resize the buffer for variable size cells:
+                trace.setBytes(payloadBytes(nextSlot));
+                send(nextSlot, FixedSize());
+                inFlight[nextSlot] = true;
+                nextSlot = (nextSlot + 1) % buffers.size();
+            }
 
             std::size_t nextNanoStep = (min)(requestedNanoSteps) + stride;
             if ((lastNanoStep == infinity()) ||
@@ -148,24 +424,68 @@ public:
             erase_min(requestedNanoSteps);
         }
 
+        /**
+         * Waits for the transmission which reads from the grid.
+         * Buffered transmissions may remain in flight.
+         */
+        virtual void release()
+        {
+            if (zeroCopy) {
+                waitSlot(0);
+            }
+        }
+
+        virtual void progress()
+        {
+            test();
+        }
+
     private:
         int dest;
-        int dataSize;
+        std::vector<int> dataSizes;
         MPI_Datatype cellMPIDatatype;
+        std::size_t nextSlot;
+
+        void initRequests(APITraits::TrueType)
+        {
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                MPI_Send_init(
+                    data(i), buffers[i].size(), cellMPIDatatype, dest, tag, communicator, &requests[i]);
+            }
+        }
 
-        void sendHeader(APITraits::TrueType)
+        void initRequests(APITraits::FalseType)
         {
-            // we don't need any header for fixed size buffers
+            // buffer sizes vary, so we can't use persistent requests
         }
 
-        void sendHeader(APITraits::FalseType)
+        void send(std::size_t slot, APITraits::TrueType)
         {
-            if (buffer.size() > INT_MAX) {
+            MPI_Start(&requests[slot]);
+        }
+
+        void send(std::size_t slot, APITraits::FalseType)
+        {
+            if (buffers[slot].size() > INT_MAX) {
                 throw std::invalid_argument("buffer size exceeds INT_MAX");
             }
 
-            dataSize = buffer.size();
-            mpiLayer.send(&dataSize, dest, 1, tag, MPI_INT);
+            dataSizes[slot] = buffers[slot].size();
+            MPI_Isend(&dataSizes[slot], 1, MPI_INT, dest, tag, communicator, &headerRequests[slot]);
+            MPI_Isend(data(slot), dataSizes[slot], cellMPIDatatype, dest, tag, communicator, &requests[slot]);
+        }
+
+        void sendZeroCopy(const GRID_TYPE& grid)
+        {
+            CellType *address = zeroCopyAddress(grid, cellMPIDatatype);
+            if (address) {
+                MPI_Isend(address, 1, regionDatatype, dest, tag, communicator, &requests[0]);
+                return;
+            }
+
+            initFallbackBuffer();
+            GridVecConv::gridToVector(grid, &buffers[0], region);
+            MPI_Isend(data(0), buffers[0].size(), cellMPIDatatype, dest, tag, communicator, &requests[0]);
         }
     };
 
@@ -174,36 +494,68 @@ public:
         public PatchProvider<GRID_TYPE>
     {
     public:
-        using Link::buffer;
+        using Link::buffers;
+        using Link::cancelSlot;
+        using Link::communicator;
+        using Link::data;
+        using Link::headerRequests;
+        using Link::inFlight;
         using Link::lastNanoStep;
-        using Link::mpiLayer;
+        using Link::payloadBytes;
         using Link::region;
+        using Link::requests;
         using Link::stride;
         using Link::tag;
+        using Link::test;
         using Link::wait;
+        using Link::waitSlot;
         using PatchProvider<GRID_TYPE>::checkNanoStepGet;
         using PatchProvider<GRID_TYPE>::infinity;
         using PatchProvider<GRID_TYPE>::storedNanoSteps;
         using PatchProvider<GRID_TYPE>::get;
 
+        /**
+         * For cells of variable size the Provider can't post the
+         * receive for the payload before the matching header has
+         * arrived, hence depth is ignored for those.
+         *
+         * Providers always receive into their buffers: the grid
+         * which the patch is destined for is only known once get()
+         * is being called, but receives need to be posted in advance
+         * so that zero-copy Accepters on the other side won't block.
+         */
         inline
         Provider(
             const Region<DIM>& region,
             int source,
             int tag,
             const MPI_Datatype& cellMPIDatatype,
-            MPI_Comm communicator = MPI_COMM_WORLD) :
-            Link(region, tag, communicator),
+            MPI_Comm communicator = MPI_COMM_WORLD,
+            std::size_t depth = 1) :
+            Link(region, source, tag, communicator, FixedSize() ? depth : 1),
             source(source),
             dataSize(0),
             cellMPIDatatype(cellMPIDatatype),
-            transmissionInFlight(false)
-        {}
+            oldestSlot(0),
+            pendingReceives(0),
+            lastReceivedNanoStep(0)
+        {
+            initRequests(FixedSize());
+        }
 
+        /**
+         * The sender has already issued the transmission for the
+         * oldest pending receive, all others would never be served.
+         */
         virtual void cleanup()
         {
-            if (transmissionInFlight) {
-                recvSecondPart(FixedSize());
+            if (pendingReceives == 0) {
+                return;
+            }
+
+            recvSecondPart(oldestSlot, FixedSize());
+            for (std::size_t i = 1; i < pendingReceives; ++i) {
+                cancelSlot((oldestSlot + i) % buffers.size());
             }
         }
 
@@ -211,6 +563,7 @@ public:
         {
             Link::charge(next, last, newStride);
             recv(next);
+            recvAhead();
         }
 
         virtual void get(
@@ -226,54 +579,97 @@ public:
             }
 
             checkNanoStepGet(nanoStep);
-            wait();
-            recvSecondPart(FixedSize());
-            transmissionInFlight = false;
+            ScopedTrace trace("patchlink", "recv", source, 0, nanoStep);
+            recvSecondPart(oldestSlot, FixedSize());
+            waitSlot(oldestSlot);
+            trace.setBytes(payloadBytes(oldestSlot));
+            GridVecConv::vectorToGrid(buffers[oldestSlot], grid, region);
 
-            GridVecConv::vectorToGrid(buffer, grid, region);
-
-            std::size_t nextNanoStep = (min)(storedNanoSteps) + stride;
-            if ((lastNanoStep == infinity()) ||
-                (nextNanoStep < lastNanoStep)) {
-                recv(nextNanoStep);
-            }
+            oldestSlot = (oldestSlot + 1) % buffers.size();
+            --pendingReceives;
 
             erase_min(storedNanoSteps);
+            recvAhead();
+        }
+
+        virtual void progress()
+        {
+            test();
         }
 
         void recv(const std::size_t nanoStep)
         {
+            if (pendingReceives == buffers.size()) {
+                throw std::logic_error("all receive buffers of PatchLink::Provider are in use");
+            }
+
+            std::size_t slot = (oldestSlot + pendingReceives) % buffers.size();
             storedNanoSteps << nanoStep;
-            recvFirstPart(FixedSize());
-            transmissionInFlight = true;
+            lastReceivedNanoStep = nanoStep;
+            recvFirstPart(slot, FixedSize());
+            inFlight[slot] = true;
+            ++pendingReceives;
         }
 
     private:
         int source;
         int dataSize;
         MPI_Datatype cellMPIDatatype;
-        bool transmissionInFlight;
+        std::size_t oldestSlot;
+        std::size_t pendingReceives;
+        std::size_t lastReceivedNanoStep;
+
+        /**
+         * posts receives for the following transmissions until all
+         * buffers are in use.
+         */
+        void recvAhead()
+        {
+            while (pendingReceives < buffers.size()) {
+                std::size_t nextNanoStep = lastReceivedNanoStep + stride;
+                if ((lastNanoStep != infinity()) &&
+                    (nextNanoStep >= lastNanoStep)) {
+                    return;
+                }
+
+                recv(nextNanoStep);
+            }
+        }
+
+        void initRequests(APITraits::TrueType)
+        {
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                MPI_Recv_init(
+                    data(i), buffers[i].size(), cellMPIDatatype, source, tag, communicator, &requests[i]);
+            }
+        }
 
-        void recvFirstPart(APITraits::TrueType)
+        void initRequests(APITraits::FalseType)
         {
-            mpiLayer.recv(&buffer[0], source, buffer.size(), tag, cellMPIDatatype);
+            // buffer sizes vary, so we can't use persistent requests
         }
 
-        void recvFirstPart(APITraits::FalseType)
+        void recvFirstPart(std::size_t slot, APITraits::TrueType)
         {
-            mpiLayer.recv(&dataSize, source, 1, tag, MPI_INT);
+            MPI_Start(&requests[slot]);
         }
 
-        void recvSecondPart(APITraits::TrueType)
+        void recvFirstPart(std::size_t slot, APITraits::FalseType)
+        {
+            MPI_Irecv(&dataSize, 1, MPI_INT, source, tag, communicator, &headerRequests[slot]);
+        }
+
+        void recvSecondPart(std::size_t slot, APITraits::TrueType)
         {
             // no second receive neccessary for fixed size payloads
         }
 
-        void recvSecondPart(APITraits::FalseType)
+        void recvSecondPart(std::size_t slot, APITraits::FalseType)
         {
-            buffer.resize(dataSize);
-            mpiLayer.recv(&buffer[0], source, dataSize, tag, cellMPIDatatype);
-            wait();
+            MPI_Wait(&headerRequests[slot], MPI_STATUS_IGNORE);
+            buffers[slot].resize(dataSize);
+            MPI_Irecv(data(slot), dataSize, cellMPIDatatype, source, tag, communicator, &requests[slot]);
+            MPI_Wait(&requests[slot], MPI_STATUS_IGNORE);
         }
     };
 
@@ -211,6 +211,24 @@ public:
         TS_ASSERT_EQUALS(expected, target);
     }
 
+    void testAllReduce()
+    {
+        MPILayer layer;
+        std::vector<double> values;
+        values << 1.5
+               << layer.rank();
+
+        std::vector<double> expected;
+        expected << 3.0
+                 << 1.0;
+        TS_ASSERT_EQUALS(expected, layer.allReduce(values));
+
+        expected.clear();
+        expected << 1.5
+                 << 1.0;
+        TS_ASSERT_EQUALS(expected, layer.allReduce(values, MPI_MAX));
+    }
+
     void testGatherV()
     {
         MPILayer layer;
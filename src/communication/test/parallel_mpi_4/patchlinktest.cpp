@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_PatchLinkTest_init = false;
+#include "/root/repo/src/communication/test/parallel_mpi_4/patchlinktest.h"
+
+static PatchLinkTest suite_PatchLinkTest;
+
+static CxxTest::List Tests_PatchLinkTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PatchLinkTest( "/root/repo/src/communication/test/parallel_mpi_4/patchlinktest.h", 37, "PatchLinkTest", suite_PatchLinkTest, Tests_PatchLinkTest );
+
+static class TestDescription_suite_PatchLinkTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testBasic() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 78, "testBasic" ) {}
+ void runTest() { suite_PatchLinkTest.testBasic(); }
+} testDescription_suite_PatchLinkTest_testBasic;
+
+static class TestDescription_suite_PatchLinkTest_testMultiple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testMultiple() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 122, "testMultiple" ) {}
+ void runTest() { suite_PatchLinkTest.testMultiple(); }
+} testDescription_suite_PatchLinkTest_testMultiple;
+
+static class TestDescription_suite_PatchLinkTest_testMultiple2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testMultiple2() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 169, "testMultiple2" ) {}
+ void runTest() { suite_PatchLinkTest.testMultiple2(); }
+} testDescription_suite_PatchLinkTest_testMultiple2;
+
+static class TestDescription_suite_PatchLinkTest_testRingBuffer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testRingBuffer() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 228, "testRingBuffer" ) {}
+ void runTest() { suite_PatchLinkTest.testRingBuffer(); }
+} testDescription_suite_PatchLinkTest_testRingBuffer;
+
+static class TestDescription_suite_PatchLinkTest_testZeroCopyAccepter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testZeroCopyAccepter() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 294, "testZeroCopyAccepter" ) {}
+ void runTest() { suite_PatchLinkTest.testZeroCopyAccepter(); }
+} testDescription_suite_PatchLinkTest_testZeroCopyAccepter;
+
+static class TestDescription_suite_PatchLinkTest_testZeroCopyFallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testZeroCopyFallback() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 353, "testZeroCopyFallback" ) {}
+ void runTest() { suite_PatchLinkTest.testZeroCopyFallback(); }
+} testDescription_suite_PatchLinkTest_testZeroCopyFallback;
+
+static class TestDescription_suite_PatchLinkTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testSoA() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 406, "testSoA" ) {}
+ void runTest() { suite_PatchLinkTest.testSoA(); }
+} testDescription_suite_PatchLinkTest_testSoA;
+
+static class TestDescription_suite_PatchLinkTest_testBoostSerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_PatchLinkTest_testBoostSerialization() : CxxTest::RealTestDescription( Tests_PatchLinkTest, suiteDescription_PatchLinkTest, 476, "testBoostSerialization" ) {}
+ void runTest() { suite_PatchLinkTest.testBoostSerialization(); }
+} testDescription_suite_PatchLinkTest_testBoostSerialization;
+
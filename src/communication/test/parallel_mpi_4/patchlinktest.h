@@ -202,6 +202,12 @@ public:
             for (int i = 0; i < mpiLayer->size() - 1; ++i) {
                 accepters[i]->put(mySendGrid, boundingRegion, boundingBox.dimensions, nanoStep, mpiLayer->rank());
             }
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                accepters[i]->release();
+            }
+            // once released, the grid may be modified without
+            // affecting the transmissions:
+            mySendGrid = zeroGrid;
 
             for (int i = 0; i < mpiLayer->size() - 1; ++i) {
                 std::size_t senderRank = i >= mpiLayer->rank() ? i + 1 : i;
@@ -219,6 +225,184 @@ public:
         }
     }
 
+    void testRingBuffer()
+    {
+        std::vector<boost::shared_ptr<PatchAccepterType> > accepters;
+        std::vector<boost::shared_ptr<PatchProviderType> > providers;
+        int stride = 3;
+        std::size_t depth = 3;
+        std::size_t maxNanoSteps = 60;
+        // separate tags as testMultiple2() leaves unserved receives behind
+
+        for (int i = 0; i < mpiLayer->size(); ++i) {
+            if (i != mpiLayer->rank()) {
+                accepters << boost::shared_ptr<PatchAccepterType>(
+                    new PatchAccepterType(
+                        region1,
+                        i,
+                        genTag(mpiLayer->rank(), i) + 1000,
+                        MPI_INT,
+                        MPI_COMM_WORLD,
+                        depth));
+
+                providers << boost::shared_ptr<PatchProviderType>(
+                    new PatchProviderType(
+                        region1,
+                        i,
+                        genTag(i, mpiLayer->rank()) + 1000,
+                        MPI_INT,
+                        MPI_COMM_WORLD,
+                        depth));
+            }
+        }
+
+        for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+            accepters[i]->charge(0, PatchAccepter<GridType>::infinity(), stride);
+            providers[i]->charge(0, PatchProvider<GridType>::infinity(), stride);
+        }
+
+        // send depth patches ahead before any of them is being
+        // received, all of them need to go to separate buffers:
+        std::size_t blockSize = depth * stride;
+        for (std::size_t block = 0; block < maxNanoSteps; block += blockSize) {
+            for (std::size_t nanoStep = block; nanoStep < (block + blockSize); nanoStep += stride) {
+                GridType mySendGrid = markGrid(region1, mpiLayer->rank() * 10000 + nanoStep * 100);
+
+                for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                    accepters[i]->put(mySendGrid, boundingRegion, boundingBox.dimensions, nanoStep, mpiLayer->rank());
+                }
+            }
+
+            for (std::size_t nanoStep = block; nanoStep < (block + blockSize); nanoStep += stride) {
+                for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                    std::size_t senderRank = i >= mpiLayer->rank() ? i + 1 : i;
+                    GridType expected = markGrid(region1, senderRank * 10000 + nanoStep * 100);
+                    GridType actual = zeroGrid;
+                    providers[i]->get(&actual, boundingRegion, boundingBox.dimensions, nanoStep, senderRank);
+
+                    TS_ASSERT_EQUALS(actual, expected);
+                }
+            }
+        }
+
+        for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+            accepters[i]->wait();
+            providers[i]->cancel();
+        }
+    }
+
+    void testZeroCopyAccepter()
+    {
+        std::vector<boost::shared_ptr<PatchAccepterType> > accepters;
+        std::vector<boost::shared_ptr<PatchProviderType> > providers;
+        int stride = 3;
+        std::size_t maxNanoSteps = 20;
+
+        for (int i = 0; i < mpiLayer->size(); ++i) {
+            if (i != mpiLayer->rank()) {
+                accepters << boost::shared_ptr<PatchAccepterType>(
+                    new PatchAccepterType(
+                        region1,
+                        i,
+                        genTag(mpiLayer->rank(), i) + 3000,
+                        MPI_INT,
+                        MPI_COMM_WORLD,
+                        1,
+                        true));
+
+                providers << boost::shared_ptr<PatchProviderType>(
+                    new PatchProviderType(
+                        region1,
+                        i,
+                        genTag(i, mpiLayer->rank()) + 3000,
+                        MPI_INT,
+                        MPI_COMM_WORLD,
+                        2));
+            }
+        }
+
+        for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+            accepters[i]->charge(0, maxNanoSteps, stride);
+            providers[i]->charge(0, maxNanoSteps, stride);
+        }
+
+        for (std::size_t nanoStep = 0; nanoStep < maxNanoSteps; nanoStep += stride) {
+            GridType mySendGrid = markGrid(region1, mpiLayer->rank() * 10000 + nanoStep * 100);
+
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                accepters[i]->put(mySendGrid, boundingRegion, boundingBox.dimensions, nanoStep, mpiLayer->rank());
+            }
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                accepters[i]->release();
+            }
+            // once released, the grid may be modified without
+            // affecting the transmissions:
+            mySendGrid = zeroGrid;
+
+            for (int i = 0; i < mpiLayer->size() - 1; ++i) {
+                std::size_t senderRank = i >= mpiLayer->rank() ? i + 1 : i;
+                GridType expected = markGrid(region1, senderRank * 10000 + nanoStep * 100);
+                GridType actual = zeroGrid;
+                providers[i]->get(&actual, boundingRegion, boundingBox.dimensions, nanoStep, senderRank);
+
+                TS_ASSERT_EQUALS(actual, expected);
+            }
+        }
+    }
+
+    void testZeroCopyFallback()
+    {
+        typedef DisplacedGrid<int, Topologies::Torus<2>::Topology, true> TorusGridType;
+        typedef PatchLink<TorusGridType>::Accepter TorusAccepterType;
+        typedef PatchLink<TorusGridType>::Provider TorusProviderType;
+
+        // the first streak wraps around the grid's boundary and can't
+        // be described by a datatype over the grid's storage. The
+        // zero-copy Accepter needs to yield the same result as the
+        // buffered one:
+        Region<2> region;
+        region << Streak<2>(Coord<2>(5, 1), 9);
+        region << Streak<2>(Coord<2>(0, 3), 3);
+
+        int sender = 0;
+        int receiver = 1;
+        std::size_t nanoStep = 5;
+
+        if (mpiLayer->rank() == sender) {
+            TorusGridType sendGrid(boundingBox, 0);
+            for (CoordBox<2>::Iterator i = boundingBox.begin(); i != boundingBox.end(); ++i) {
+                sendGrid[*i] = 1 + i->y() * 10 + i->x();
+            }
+
+            TorusAccepterType bufferedAccepter(region, receiver, tag, MPI_INT);
+            TorusAccepterType zeroCopyAccepter(region, receiver, tag + 1, MPI_INT, MPI_COMM_WORLD, 1, true);
+            bufferedAccepter.pushRequest(nanoStep);
+            zeroCopyAccepter.pushRequest(nanoStep);
+
+            bufferedAccepter.put(sendGrid, boundingRegion, boundingBox.dimensions, nanoStep, sender);
+            zeroCopyAccepter.put(sendGrid, boundingRegion, boundingBox.dimensions, nanoStep, sender);
+            zeroCopyAccepter.release();
+            bufferedAccepter.wait();
+        }
+
+        if (mpiLayer->rank() == receiver) {
+            TorusGridType zeroTorusGrid(boundingBox, 0);
+            TorusGridType expected = zeroTorusGrid;
+            TorusGridType actual = zeroTorusGrid;
+
+            TorusProviderType expectedProvider(region, sender, tag, MPI_INT);
+            expectedProvider.recv(nanoStep);
+            expectedProvider.get(&expected, boundingRegion, boundingBox.dimensions, nanoStep, receiver);
+
+            TorusProviderType actualProvider(region, sender, tag + 1, MPI_INT);
+            actualProvider.recv(nanoStep);
+            actualProvider.get(&actual, boundingRegion, boundingBox.dimensions, nanoStep, receiver);
+
+            TS_ASSERT_EQUALS(actual, expected);
+            TS_ASSERT_DIFFERS(actual, zeroTorusGrid);
+        }
+    }
+
     void testSoA()
     {
         Coord<3> dim(30, 20, 10);
@@ -10,7 +10,7 @@
 #include <libgeodecomp/io/asciiwriter.h>
 #include <libgeodecomp/io/simpleinitializer.h>
 #include <libgeodecomp/misc/apitraits.h>
-#include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/parallelization/openmpsimulator.h>
 #include <libgeodecomp/storage/unstructuredsoagrid.h>
 #include <libgeodecomp/io/sellsortingwriter.h>
 
@@ -33,6 +33,7 @@ class Cell
 public:
     class API :
         public APITraits::HasUpdateLineX,
+        public APITraits::HasMaskedUpdateLineX,
         public APITraits::HasSoA,
         public APITraits::HasUnstructuredTopology,
         public APITraits::HasPredefinedMPIDataType<double>,
@@ -58,7 +59,7 @@ public:
     template<typename HOOD_NEW, typename HOOD_OLD>
     static void updateLineX(HOOD_NEW& hoodNew, int indexEnd, HOOD_OLD& hoodOld, unsigned /* nanoStep */)
     {
-        for (int i = hoodOld.index(); i < indexEnd; ++i, ++hoodOld) {
+        for (int i = hoodOld.index(); i < (indexEnd / C); ++i, ++hoodOld) {
             ShortVec tmp;
             tmp.load_aligned(&hoodNew->sum() + i * C);
             for (const auto& j: hoodOld.weights(0)) {
@@ -68,7 +69,7 @@ public:
                 values.gather(&hoodOld->value(), j.first());
                 tmp += values * weights;
             }
-            tmp.store_aligned(&hoodNew->sum() + i * C);
+            hoodNew.store(&hoodNew->sum(), i * C, tmp);
         }
     }
 
@@ -206,7 +207,7 @@ void runSimulation(int argc, char *argv[])
     } else {
         init = new CellInitializerDiagonal(steps);
     }
-    SerialSimulator<Cell> sim(init);
+    OpenMPSimulator<Cell> sim(init);
     sim.addWriter(new TracingWriter<Cell>(outputFrequency, init->maxSteps()));
     if (SIGMA == 1) {
         sim.addWriter(new ASCIIWriter<Cell>("sum", &Cell::sum, outputFrequency));
@@ -2,9 +2,16 @@
 #define LIBGEODECOMP_GEOMETRY_ADJACENCY_H
 
 #include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/storage/csrmatrix.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <vector>
+
 namespace LibGeoDecomp {
 
 /**
@@ -27,6 +34,26 @@ public:
      */
     virtual void getNeighbors(int node, std::vector<int> *neighbors) const = 0;
 
+    /**
+     * Appends the neighbors of all given nodes to neighbors (unsorted
+     * and possibly with duplicates). Used by
+     * Region::expandWithAdjacency(). Implementations which can do
+     * better than one getNeighbors() call per node should override
+     * this.
+     */
+    virtual void gatherNeighbors(const Region<1>& nodes, std::vector<int> *neighbors) const
+    {
+        std::vector<int> buf;
+
+        for (Region<1>::StreakIterator i = nodes.beginStreak(); i != nodes.endStreak(); ++i) {
+            for (int x = i->origin.x(); x < i->endX; ++x) {
+                buf.clear();
+                getNeighbors(x, &buf);
+                neighbors->insert(neighbors->end(), buf.begin(), buf.end());
+            }
+        }
+    }
+
     /**
      * Retrieves the number of edges in the adjacency
      */
@@ -34,26 +61,64 @@ public:
 
 };
 
+/**
+ * Builds an undirected graph from the sparsity pattern of the given
+ * matrix: nodes i and j will be connected if A_ij != 0 or A_ji != 0.
+ * Rows are merged with the rows of the transposed matrix, so edges
+ * are inserted in order, which is what RegionBasedAdjacency is
+ * fastest with.
+ */
 template<typename ADJACENCY, typename T>
-boost::shared_ptr<ADJACENCY> MakeAdjacency(const std::map<Coord<2>, T>& weights)
+boost::shared_ptr<ADJACENCY> MakeAdjacency(const CSRMatrix<T>& weights)
 {
     boost::shared_ptr<ADJACENCY> result = boost::make_shared<ADJACENCY>();
+    CSRMatrix<T> transposed = weights.transposed();
+    int rows = (std::max)(weights.rows(), transposed.rows());
+    std::vector<int> neighbors;
 
-    for (typename std::map<Coord<2>, T>::const_iterator it = weights.begin();
-        it != weights.end(); ++it) {
+    for (int row = 0; row < rows; ++row) {
+        std::vector<int>::const_iterator begin1 = weights.columnIndices().begin();
+        std::vector<int>::const_iterator end1 = begin1;
+        if (row < weights.rows()) {
+            begin1 += weights.rowOffsets()[row];
+            end1   += weights.rowOffsets()[row + 1];
+        }
 
-        // ptscotch doesn't like edges from nodes to themselves
-        if (it->first.x() == it->first.y()) {
-            continue;
+        std::vector<int>::const_iterator begin2 = transposed.columnIndices().begin();
+        std::vector<int>::const_iterator end2 = begin2;
+        if (row < transposed.rows()) {
+            begin2 += transposed.rowOffsets()[row];
+            end2   += transposed.rowOffsets()[row + 1];
         }
 
-        result->insert(it->first.x(), it->first.y());
-        result->insert(it->first.y(), it->first.x());
+        neighbors.clear();
+        std::set_union(begin1, end1, begin2, end2, std::back_inserter(neighbors));
+
+        for (std::vector<int>::iterator i = neighbors.begin(); i != neighbors.end(); ++i) {
+            // ptscotch doesn't like edges from nodes to themselves
+            if (*i == row) {
+                continue;
+            }
+
+            result->insert(row, *i);
+        }
     }
 
     return result;
 }
 
+template<typename ADJACENCY, typename T>
+boost::shared_ptr<ADJACENCY> MakeAdjacency(const std::map<Coord<2>, T>& weights)
+{
+    int dim = 0;
+    for (typename std::map<Coord<2>, T>::const_iterator it = weights.begin();
+        it != weights.end(); ++it) {
+        dim = (std::max)(dim, (std::max)(it->first.x(), it->first.y()) + 1);
+    }
+
+    return MakeAdjacency<ADJACENCY>(CSRMatrix<T>::fromMap(dim, dim, weights));
+}
+
 }
 
 #endif
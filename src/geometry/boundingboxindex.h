@@ -0,0 +1,172 @@
+#ifndef LIBGEODECOMP_GEOMETRY_BOUNDINGBOXINDEX_H
+#define LIBGEODECOMP_GEOMETRY_BOUNDINGBOXINDEX_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * A static spatial index (a bounding volume hierarchy, similar to a
+ * bulk-loaded R-tree) over a set of CoordBoxes, e.g. the bounding
+ * boxes of all subdomains. query() returns the IDs of all boxes which
+ * intersect a given box in O(log n + k) instead of O(n).
+ */
+template<int DIM>
+class BoundingBoxIndex
+{
+public:
+    // boxes in a leaf are tested one by one
+    static const std::size_t MAX_LEAF_SIZE = 8;
+
+    explicit BoundingBoxIndex(const std::vector<CoordBox<DIM> >& boxes = std::vector<CoordBox<DIM> >()) :
+        boxes(boxes)
+    {
+        // empty boxes never intersect anything:
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (boxes[i].size() > 0) {
+                ids.push_back(i);
+            }
+        }
+
+        if (!ids.empty()) {
+            build(0, ids.size());
+        }
+    }
+
+    /**
+     * Returns the IDs (i.e. the positions in the vector passed to
+     * the c-tor) of all boxes which intersect box, in ascending
+     * order.
+     */
+    std::vector<std::size_t> query(const CoordBox<DIM>& box) const
+    {
+        std::vector<std::size_t> ret;
+        if (!nodes.empty()) {
+            query(0, box, &ret);
+        }
+
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+private:
+    class Node
+    {
+    public:
+        inline Node(const CoordBox<DIM>& boundingBox, std::size_t begin, std::size_t end) :
+            boundingBox(boundingBox),
+            begin(begin),
+            end(end),
+            left(0),
+            right(0)
+        {}
+
+        CoordBox<DIM> boundingBox;
+        // range of ids covered by this node
+        std::size_t begin;
+        std::size_t end;
+        // children, 0 denotes leaves (the root can't be a child)
+        std::size_t left;
+        std::size_t right;
+    };
+
+    /**
+     * Orders box IDs by the center of their boxes along a given
+     * dimension.
+     */
+    class CenterComparator
+    {
+    public:
+        inline CenterComparator(const std::vector<CoordBox<DIM> >& boxes, int dim) :
+            boxes(boxes),
+            dim(dim)
+        {}
+
+        inline bool operator()(std::size_t a, std::size_t b) const
+        {
+            return
+                (2 * boxes[a].origin[dim] + boxes[a].dimensions[dim]) <
+                (2 * boxes[b].origin[dim] + boxes[b].dimensions[dim]);
+        }
+
+    private:
+        const std::vector<CoordBox<DIM> >& boxes;
+        int dim;
+    };
+
+    std::vector<CoordBox<DIM> > boxes;
+    std::vector<std::size_t> ids;
+    std::vector<Node> nodes;
+
+    /**
+     * Creates the node for the IDs [begin, end) and returns its
+     * index. Inner nodes are split at the median along the longest
+     * extent of their bounding box.
+     */
+    std::size_t build(std::size_t begin, std::size_t end)
+    {
+        Coord<DIM> minCoord = boxes[ids[begin]].origin;
+        Coord<DIM> maxCoord = boxes[ids[begin]].origin + boxes[ids[begin]].dimensions;
+        for (std::size_t i = begin + 1; i < end; ++i) {
+            const CoordBox<DIM>& box = boxes[ids[i]];
+            minCoord = (minCoord.min)(box.origin);
+            maxCoord = (maxCoord.max)(box.origin + box.dimensions);
+        }
+
+        std::size_t index = nodes.size();
+        nodes.push_back(Node(CoordBox<DIM>(minCoord, maxCoord - minCoord), begin, end));
+        if ((end - begin) <= MAX_LEAF_SIZE) {
+            return index;
+        }
+
+        Coord<DIM> extent = maxCoord - minCoord;
+        int splitDim = 0;
+        for (int d = 1; d < DIM; ++d) {
+            if (extent[d] > extent[splitDim]) {
+                splitDim = d;
+            }
+        }
+
+        std::size_t middle = begin + (end - begin) / 2;
+        std::nth_element(
+            ids.begin() + begin,
+            ids.begin() + middle,
+            ids.begin() + end,
+            CenterComparator(boxes, splitDim));
+
+        // nodes may get reallocated while building the children:
+        std::size_t left = build(begin, middle);
+        std::size_t right = build(middle, end);
+        nodes[index].left = left;
+        nodes[index].right = right;
+
+        return index;
+    }
+
+    void query(std::size_t index, const CoordBox<DIM>& box, std::vector<std::size_t> *result) const
+    {
+        const Node& node = nodes[index];
+        if (!node.boundingBox.intersects(box)) {
+            return;
+        }
+
+        if (node.left == 0) {
+            for (std::size_t i = node.begin; i < node.end; ++i) {
+                if (boxes[ids[i]].intersects(box)) {
+                    result->push_back(ids[i]);
+                }
+            }
+            return;
+        }
+
+        query(node.left,  box, result);
+        query(node.right, box, result);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef LIBGEODECOMP_GEOMETRY_COSTMAP_H
+#define LIBGEODECOMP_GEOMETRY_COSTMAP_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/streak.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * CostMap accumulates measured update times of streaks on a coarse
+ * grid of blocks which covers the simulation box. From this it can
+ * estimate the time required to update any given cell, which is
+ * useful for partitioning models whose per-cell cost varies
+ * throughout the domain.
+ *
+ * Each block stores the total time and the total number of cells
+ * sampled so far, so maps of different ranks can be merged by simply
+ * adding them up. Blocks without any samples are assumed to be
+ * average.
+ */
+template<int DIM>
+class CostMap
+{
+public:
+    explicit CostMap(
+        const CoordBox<DIM>& box = CoordBox<DIM>(),
+        const Coord<DIM>& blockDimensions = defaultBlockDimensions()) :
+        box(box),
+        blockDimensions(blockDimensions)
+    {
+        for (int d = 0; d < DIM; ++d) {
+            if (blockDimensions[d] <= 0) {
+                throw std::invalid_argument("CostMap: block dimensions need to be positive");
+            }
+            numBlocks[d] = (box.dimensions[d] + blockDimensions[d] - 1) / blockDimensions[d];
+        }
+
+        mySeconds.resize(numBlocks.prod(), 0);
+        myCells.resize(numBlocks.prod(), 0);
+    }
+
+    /**
+     * Creates a map from previously accumulated block data, e.g. the
+     * sum of the maps of all ranks.
+     */
+    CostMap(
+        const CoordBox<DIM>& box,
+        const Coord<DIM>& blockDimensions,
+        const std::vector<double>& seconds,
+        const std::vector<double>& cells) :
+        box(box),
+        blockDimensions(blockDimensions),
+        mySeconds(seconds),
+        myCells(cells)
+    {
+        for (int d = 0; d < DIM; ++d) {
+            numBlocks[d] = (box.dimensions[d] + blockDimensions[d] - 1) / blockDimensions[d];
+        }
+
+        if ((seconds.size() != std::size_t(numBlocks.prod())) ||
+            (cells.size()   != std::size_t(numBlocks.prod()))) {
+            throw std::invalid_argument("CostMap: number of blocks doesn't match box");
+        }
+    }
+
+    /**
+     * Roughly 1000 cells per block.
+     */
+    static inline Coord<DIM> defaultBlockDimensions()
+    {
+        static const int edgeLengths[] = {1024, 32, 10};
+        return Coord<DIM>::diagonal(edgeLengths[DIM - 1]);
+    }
+
+    /**
+     * Records that updating streak took the given time. The time is
+     * distributed evenly among the streak's cells. Cells outside of
+     * the box are ignored. Safe to call from multiple OpenMP threads
+     * concurrently.
+     */
+    inline void addSample(const Streak<DIM>& streak, double seconds)
+    {
+        int length = streak.length();
+        if ((length <= 0) || mySeconds.empty()) {
+            return;
+        }
+
+        Coord<DIM> relativeOrigin = streak.origin - box.origin;
+        for (int d = 1; d < DIM; ++d) {
+            if ((relativeOrigin[d] < 0) || (relativeOrigin[d] >= box.dimensions[d])) {
+                return;
+            }
+        }
+
+        double secondsPerCell = (std::max)(seconds, 0.0) / length;
+        int x    = (std::max)(relativeOrigin.x(), 0);
+        int endX = (std::min)(relativeOrigin.x() + length, box.dimensions.x());
+
+        while (x < endX) {
+            relativeOrigin.x() = x;
+            std::size_t index = relativeBlockIndex(relativeOrigin);
+            int blockEndX = (x / blockDimensions.x() + 1) * blockDimensions.x();
+            int cells = (std::min)(blockEndX, endX) - x;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp atomic
+#endif
+            mySeconds[index] += secondsPerCell * cells;
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp atomic
+#endif
+            myCells[index] += cells;
+
+            x += cells;
+        }
+    }
+
+    /**
+     * Index of the block which contains coord. Coordinates outside of
+     * the box are mapped to the nearest block.
+     */
+    inline std::size_t blockIndex(const Coord<DIM>& coord) const
+    {
+        Coord<DIM> relativeCoord = coord - box.origin;
+        for (int d = 0; d < DIM; ++d) {
+            relativeCoord[d] = (std::max)(0, (std::min)(box.dimensions[d] - 1, relativeCoord[d]));
+        }
+
+        return relativeBlockIndex(relativeCoord);
+    }
+
+    /**
+     * Estimated time per cell for each block. Blocks without samples
+     * get the average of all samples, if there are no samples at all,
+     * each cell is assumed to cost 1.
+     */
+    inline std::vector<double> blockCosts() const
+    {
+        double totalSeconds = 0;
+        double totalCells = 0;
+        for (std::size_t i = 0; i < mySeconds.size(); ++i) {
+            totalSeconds += mySeconds[i];
+            totalCells   += myCells[i];
+        }
+        double average = (totalSeconds > 0) ? (totalSeconds / totalCells) : 1.0;
+
+        std::vector<double> ret(mySeconds.size(), average);
+        if (totalSeconds > 0) {
+            for (std::size_t i = 0; i < mySeconds.size(); ++i) {
+                if (myCells[i] > 0) {
+                    ret[i] = mySeconds[i] / myCells[i];
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * Estimated time per cell at coord. Use blockCosts() when
+     * querying many cells.
+     */
+    inline double cost(const Coord<DIM>& coord) const
+    {
+        if (mySeconds.empty()) {
+            return 1.0;
+        }
+
+        std::size_t index = blockIndex(coord);
+        if (myCells[index] > 0) {
+            return mySeconds[index] / myCells[index];
+        }
+
+        return blockCosts()[index];
+    }
+
+    inline CostMap& operator+=(const CostMap& other)
+    {
+        if ((box != other.box) || (blockDimensions != other.blockDimensions)) {
+            throw std::invalid_argument("CostMap: can't merge maps of different geometry");
+        }
+
+        for (std::size_t i = 0; i < mySeconds.size(); ++i) {
+            mySeconds[i] += other.mySeconds[i];
+            myCells[i]   += other.myCells[i];
+        }
+
+        return *this;
+    }
+
+    inline void clear()
+    {
+        std::fill(mySeconds.begin(), mySeconds.end(), 0);
+        std::fill(myCells.begin(),   myCells.end(),   0);
+    }
+
+    /**
+     * True if no cell has been sampled yet.
+     */
+    inline bool empty() const
+    {
+        return std::find_if(myCells.begin(), myCells.end(), isPositive) == myCells.end();
+    }
+
+    inline const CoordBox<DIM>& boundingBox() const
+    {
+        return box;
+    }
+
+    inline const Coord<DIM>& getBlockDimensions() const
+    {
+        return blockDimensions;
+    }
+
+    inline const std::vector<double>& seconds() const
+    {
+        return mySeconds;
+    }
+
+    inline const std::vector<double>& cells() const
+    {
+        return myCells;
+    }
+
+private:
+    CoordBox<DIM> box;
+    Coord<DIM> blockDimensions;
+    Coord<DIM> numBlocks;
+    std::vector<double> mySeconds;
+    std::vector<double> myCells;
+
+    inline std::size_t relativeBlockIndex(const Coord<DIM>& relativeCoord) const
+    {
+        Coord<DIM> block;
+        for (int d = 0; d < DIM; ++d) {
+            block[d] = relativeCoord[d] / blockDimensions[d];
+        }
+
+        return block.toIndex(numBlocks);
+    }
+
+    static inline bool isPositive(double value)
+    {
+        return value > 0;
+    }
+};
+
+}
+
+#endif
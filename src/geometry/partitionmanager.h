@@ -2,10 +2,12 @@
 #define LIBGEODECOMP_GEOMETRY_PARTITIONMANAGER_H
 
 #include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/boundingboxindex.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/region.h>
 
 #include <boost/shared_ptr.hpp>
+#include <stdexcept>
 
 namespace LibGeoDecomp {
 
@@ -68,45 +70,104 @@ public:
         fillOwnRegion();
     }
 
+    /**
+     * Computes the ghost zone fragments. Candidates for neighbors
+     * are those nodes whose bounding box (as given by
+     * newBoundingBoxes) intersects our expanded region. Their
+     * regions are then expanded locally to check whether they
+     * actually touch ours.
+     */
     inline void resetGhostZones(
         const std::vector<CoordBox<DIM> >& newBoundingBoxes)
     {
         boundingBoxes = newBoundingBoxes;
         CoordBox<DIM> ownBoundingBox = ownExpandedRegion().boundingBox();
+        std::vector<std::size_t> candidates =
+            BoundingBoxIndex<DIM>(boundingBoxes).query(ownBoundingBox);
+
+        for (std::vector<std::size_t>::iterator i = candidates.begin(); i != candidates.end(); ++i) {
+            if (*i == myRank) {
+                continue;
+            }
 
-        for (unsigned i = 0; i < boundingBoxes.size(); ++i) {
-            if ((i != myRank) &&
-                boundingBoxes[i].intersects(ownBoundingBox) &&
-                (!(getRegion(myRank, ghostZoneWidth) &
-                   getRegion(i,      0)).empty() ||
-                 !(getRegion(i,      ghostZoneWidth) &
-                   getRegion(myRank, 0)).empty())) {
-                intersect(i);
+            if (regions.count(*i) == 0) {
+                fillRegion(*i);
             }
+            intersect(*i, regions[*i]);
         }
 
-        // outgroup ghost zone fragments are computed a tad generous,
-        // an exact, greedy calculation would be more complicated
-        Region<DIM> outer = outerRim;
-        Region<DIM> inner = rim(getGhostZoneWidth());
-        for (typename RegionVecMap::iterator i = outerGhostZoneFragments.begin();
-             i != outerGhostZoneFragments.end();
+        fillOutgroupGhostZoneFragments();
+    }
+
+    /**
+     * Scalable alternative to resetGhostZones(const
+     * std::vector<CoordBox<DIM> >&), which doesn't need to expand
+     * the regions of other nodes: neighborExpansions maps each of
+     * our neighborCandidates() to the expansions of its region (in
+     * the order of getRegion()'s expansionWidth), as returned by
+     * exchangeRegions() on that node. The resulting ghost zone
+     * fragments are identical.
+     *
+     * Here newBoundingBoxes are the bounding boxes of the nodes'
+     * expanded regions (see neighborCandidates()).
+     */
+    inline void resetGhostZones(
+        const std::vector<CoordBox<DIM> >& newBoundingBoxes,
+        const RegionVecMap& neighborExpansions)
+    {
+        boundingBoxes = newBoundingBoxes;
+
+        for (typename RegionVecMap::const_iterator i = neighborExpansions.begin();
+             i != neighborExpansions.end();
              ++i) {
-            if (i->first != OUTGROUP) {
-                outer -= i->second.back();
+            if (i->second.size() != (getGhostZoneWidth() + 1)) {
+                throw std::invalid_argument("expected one region per expansion layer");
             }
+            intersect(i->first, i->second);
         }
-        for (typename RegionVecMap::iterator i = innerGhostZoneFragments.begin();
-             i != innerGhostZoneFragments.end();
-             ++i) {
-            if (i->first != OUTGROUP) {
-                inner -= i->second.back();
+
+        fillOutgroupGhostZoneFragments();
+    }
+
+    /**
+     * Returns the nodes with which we need to exchange regions for
+     * resetGhostZones(const std::vector<CoordBox<DIM> >&, const
+     * RegionVecMap&). expandedBoundingBoxes holds the bounding boxes
+     * of all nodes' expanded regions, which makes this relation
+     * symmetric.
+     */
+    inline std::vector<int> neighborCandidates(
+        const std::vector<CoordBox<DIM> >& expandedBoundingBoxes)
+    {
+        std::vector<std::size_t> candidates = BoundingBoxIndex<DIM>(expandedBoundingBoxes).query(
+            ownExpandedRegion().boundingBox());
+
+        std::vector<int> ret;
+        for (std::vector<std::size_t>::iterator i = candidates.begin(); i != candidates.end(); ++i) {
+            if (*i != myRank) {
+                ret.push_back(*i);
             }
         }
-        outerGhostZoneFragments[OUTGROUP] =
-            std::vector<Region<DIM> >(getGhostZoneWidth() + 1, outer);
-        innerGhostZoneFragments[OUTGROUP] =
-            std::vector<Region<DIM> >(getGhostZoneWidth() + 1, inner);
+
+        return ret;
+    }
+
+    /**
+     * Our region and its expansions, clipped to a candidate's
+     * expanded bounding box. That's all the candidate needs to know
+     * to compute its ghost zone fragments for us.
+     */
+    inline std::vector<Region<DIM> > exchangeRegions(const CoordBox<DIM>& candidateBoundingBox)
+    {
+        Region<DIM> clip;
+        clip << candidateBoundingBox;
+
+        std::vector<Region<DIM> > ret;
+        for (std::size_t i = 0; i <= getGhostZoneWidth(); ++i) {
+            ret.push_back(ownRegion(i) & clip);
+        }
+
+        return ret;
     }
 
     inline RegionVecMap& getOuterGhostZoneFragments()
@@ -210,6 +271,11 @@ public:
         return partition->getWeights();
     }
 
+    inline const std::vector<std::size_t>& getStartOffsets() const
+    {
+        return partition->getStartOffsets();
+    }
+
     const Adjacency& adjacency() const
     {
         return *partition->getAdjacency();
@@ -246,64 +312,99 @@ private:
         regionExpansion.resize(getGhostZoneWidth() + 1);
         regionExpansion[0] = partition->getRegion(node);
         for (std::size_t i = 1; i <= getGhostZoneWidth(); ++i) {
-            Region<DIM> expanded;
-            const Region<DIM>& reg = regionExpansion[i - 1];
-            expanded = reg.expandWithTopology(
-                1,
-                simulationArea.dimensions,
-                Topology(),
-                adjacency());
-            regionExpansion[i] = expanded;
+            regionExpansion[i] = expandOneLayer(regionExpansion[i - 1]);
         }
     }
 
     inline void fillOwnRegion()
     {
         fillRegion(myRank);
-        Region<DIM> surface(
-            ownRegion().expandWithTopology(
-                1,
-                simulationArea.dimensions,
-                Topology(),
-                adjacency()) - ownRegion());
-        Region<DIM> kernel(
-            ownRegion() -
-            surface.expandWithTopology(
-                getGhostZoneWidth(),
-                simulationArea.dimensions,
-                Topology(),
-                adjacency()));
+
+        // each layer of the surface expansion is derived from the
+        // previous one, the same goes for rims and inner sets below:
+        std::vector<Region<DIM> > surfaces(getGhostZoneWidth() + 1);
+        if (getGhostZoneWidth() > 0) {
+            surfaces[0] = ownRegion(1) - ownRegion();
+        } else {
+            surfaces[0] = expandOneLayer(ownRegion()) - ownRegion();
+        }
+        for (std::size_t i = 1; i <= getGhostZoneWidth(); ++i) {
+            surfaces[i] = expandOneLayer(surfaces[i - 1]);
+        }
+
+        Region<DIM> kernel(ownRegion() - surfaces.back());
         outerRim = ownExpandedRegion() - ownRegion();
         ownRims.resize(getGhostZoneWidth() + 1);
         ownInnerSets.resize(getGhostZoneWidth() + 1);
 
         ownRims.back() = ownRegion() - kernel;
         for (int i = getGhostZoneWidth() - 1; i >= 0; --i) {
-            ownRims[i] = ownRims[i + 1].expandWithTopology(
-                1, simulationArea.dimensions, Topology(), adjacency());
+            ownRims[i] = expandOneLayer(ownRims[i + 1]);
         }
 
         ownInnerSets.front() = ownRegion();
-        Region<DIM> minuend = surface.expandWithTopology(
-            1, simulationArea.dimensions, Topology(), adjacency());
         for (std::size_t i = 1; i <= getGhostZoneWidth(); ++i) {
-            ownInnerSets[i] = ownInnerSets[i - 1] - minuend;
-            minuend = minuend.expandWithTopology(1, simulationArea.dimensions, Topology(), adjacency());
+            ownInnerSets[i] = ownInnerSets[i - 1] - surfaces[i];
         }
 
         volatileKernel = ownInnerSets.back() & rim(0);
-        innerRim       = ownInnerSets.back() & rim(0);
+        innerRim       = volatileKernel;
+    }
+
+    inline void fillOutgroupGhostZoneFragments()
+    {
+        // outgroup ghost zone fragments are computed a tad generous,
+        // an exact, greedy calculation would be more complicated
+        Region<DIM> outer = outerRim;
+        Region<DIM> inner = rim(getGhostZoneWidth());
+        for (typename RegionVecMap::iterator i = outerGhostZoneFragments.begin();
+             i != outerGhostZoneFragments.end();
+             ++i) {
+            if (i->first != OUTGROUP) {
+                outer -= i->second.back();
+            }
+        }
+        for (typename RegionVecMap::iterator i = innerGhostZoneFragments.begin();
+             i != innerGhostZoneFragments.end();
+             ++i) {
+            if (i->first != OUTGROUP) {
+                inner -= i->second.back();
+            }
+        }
+        outerGhostZoneFragments[OUTGROUP] =
+            std::vector<Region<DIM> >(getGhostZoneWidth() + 1, outer);
+        innerGhostZoneFragments[OUTGROUP] =
+            std::vector<Region<DIM> >(getGhostZoneWidth() + 1, inner);
+    }
+
+    inline Region<DIM> expandOneLayer(const Region<DIM>& region)
+    {
+        return region.expandWithTopology(
+            1,
+            simulationArea.dimensions,
+            Topology(),
+            adjacency());
     }
 
-    inline void intersect(unsigned node)
+    /**
+     * Adds the ghost zone fragments shared with node, if any.
+     * nodeExpansions are node's region and its expansions, or at
+     * least those parts of them which may touch our region.
+     */
+    inline void intersect(int node, const std::vector<Region<DIM> >& nodeExpansions)
     {
+        if ((ownRegion(getGhostZoneWidth()) & nodeExpansions[0]).empty() &&
+            (nodeExpansions[getGhostZoneWidth()] & ownRegion(0)).empty()) {
+            return;
+        }
+
         std::vector<Region<DIM> >& outerGhosts = outerGhostZoneFragments[node];
         std::vector<Region<DIM> >& innerGhosts = innerGhostZoneFragments[node];
         outerGhosts.resize(getGhostZoneWidth() + 1);
         innerGhosts.resize(getGhostZoneWidth() + 1);
         for (unsigned i = 0; i <= getGhostZoneWidth(); ++i) {
-            outerGhosts[i] = getRegion(myRank, i) & getRegion(node, 0);
-            innerGhosts[i] = getRegion(myRank, 0) & getRegion(node, i);
+            outerGhosts[i] = ownRegion(i) & nodeExpansions[0];
+            innerGhosts[i] = ownRegion(0) & nodeExpansions[i];
         }
     }
 };
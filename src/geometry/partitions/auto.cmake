@@ -0,0 +1,19 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}hilbertpartition.cpp
+  ${RELATIVE_PATH}hindexingpartition.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}checkerboardingpartition.h
+  ${RELATIVE_PATH}distributedptscotchunstructuredpartition.h
+  ${RELATIVE_PATH}hilbertpartition.h
+  ${RELATIVE_PATH}hindexingpartition.h
+  ${RELATIVE_PATH}partition.h
+  ${RELATIVE_PATH}ptscotchpartition.h
+  ${RELATIVE_PATH}ptscotchunstructuredpartition.h
+  ${RELATIVE_PATH}recursivebisectionpartition.h
+  ${RELATIVE_PATH}scotchpartition.h
+  ${RELATIVE_PATH}spacefillingcurve.h
+  ${RELATIVE_PATH}stripingpartition.h
+  ${RELATIVE_PATH}unstructuredstripingpartition.h
+  ${RELATIVE_PATH}zcurvepartition.h
+)
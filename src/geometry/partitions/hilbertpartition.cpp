@@ -2,7 +2,7 @@
 
 namespace LibGeoDecomp {
 
-HilbertPartition::Form HilbertPartition::squareFormTransitions[4][4] = {
+HilbertPartition<2>::Form HilbertPartition<2>::squareFormTransitions[4][4] = {
     {LL_TO_UL, LL_TO_LR, LL_TO_LR, UR_TO_LR}, // LL_TO_LR
     {LL_TO_LR, LL_TO_UL, LL_TO_UL, UR_TO_UL}, // LL_TO_UL
     {UR_TO_UL, UR_TO_LR, UR_TO_LR, LL_TO_LR}, // UR_TO_LR
@@ -12,15 +12,74 @@ HilbertPartition::Form HilbertPartition::squareFormTransitions[4][4] = {
 // (sub-)sectors:
 // 01
 // 23
-int HilbertPartition::squareSectorTransitions[4][4] = {
+int HilbertPartition<2>::squareSectorTransitions[4][4] = {
     {2, 0, 1, 3}, // LL_TO_LR
     {2, 3, 1, 0}, // LL_TO_UL
     {1, 0, 2, 3}, // UR_TO_LR
     {1, 3, 2, 0}  // UR_TO_UL
 };
 
-boost::shared_ptr<Grid<std::vector<Coord<2> >, Topologies::Cube<3>::Topology> > HilbertPartition::squareCoordsCache;
-Coord<2> HilbertPartition::maxCachedDimensions;
-bool HilbertPartition::cachesInitialized = HilbertPartition::fillCaches();
+boost::shared_ptr<HilbertPartition<2>::CacheType> HilbertPartition<2>::squareCoordsCache;
+boost::shared_ptr<HilbertPartition<2>::RunCacheType> HilbertPartition<2>::squareRunsCache;
+Coord<2> HilbertPartition<2>::maxCachedDimensions;
+bool HilbertPartition<2>::cachesInitialized = HilbertPartition<2>::fillCaches();
+
+// A cube in state s is entered at the corner encoded by the bits of
+// (s / 3), like octants are, and left at the corner which differs
+// from the entry only in dimension (s % 3). The tables were derived from
+// the Gray code based transformation in Hamilton's paper.
+int HilbertPartition<3>::octantTransitions[24][8] = {
+    {0, 2, 6, 4, 5, 7, 3, 1}, // state  0
+    {0, 4, 5, 1, 3, 7, 6, 2}, // state  1
+    {0, 1, 3, 2, 6, 7, 5, 4}, // state  2
+    {1, 3, 7, 5, 4, 6, 2, 0}, // state  3
+    {1, 5, 4, 0, 2, 6, 7, 3}, // state  4
+    {1, 0, 2, 3, 7, 6, 4, 5}, // state  5
+    {2, 0, 4, 6, 7, 5, 1, 3}, // state  6
+    {2, 6, 7, 3, 1, 5, 4, 0}, // state  7
+    {2, 3, 1, 0, 4, 5, 7, 6}, // state  8
+    {3, 1, 5, 7, 6, 4, 0, 2}, // state  9
+    {3, 7, 6, 2, 0, 4, 5, 1}, // state 10
+    {3, 2, 0, 1, 5, 4, 6, 7}, // state 11
+    {4, 6, 2, 0, 1, 3, 7, 5}, // state 12
+    {4, 0, 1, 5, 7, 3, 2, 6}, // state 13
+    {4, 5, 7, 6, 2, 3, 1, 0}, // state 14
+    {5, 7, 3, 1, 0, 2, 6, 4}, // state 15
+    {5, 1, 0, 4, 6, 2, 3, 7}, // state 16
+    {5, 4, 6, 7, 3, 2, 0, 1}, // state 17
+    {6, 4, 0, 2, 3, 1, 5, 7}, // state 18
+    {6, 2, 3, 7, 5, 1, 0, 4}, // state 19
+    {6, 7, 5, 4, 0, 1, 3, 2}, // state 20
+    {7, 5, 1, 3, 2, 0, 4, 6}, // state 21
+    {7, 3, 2, 6, 4, 0, 1, 5}, // state 22
+    {7, 6, 4, 5, 1, 0, 2, 3}  // state 23
+};
+
+int HilbertPartition<3>::stateTransitions[24][8] = {
+    { 1,  2,  2, 18, 18, 17, 17, 10}, // state  0
+    { 2,  0,  0, 16, 16,  9,  9, 20}, // state  1
+    { 0,  1,  1, 11, 11, 19, 19, 15}, // state  2
+    { 4,  5,  5, 21, 21, 14, 14,  7}, // state  3
+    { 5,  3,  3, 13, 13,  6,  6, 23}, // state  4
+    { 3,  4,  4,  8,  8, 22, 22, 12}, // state  5
+    { 7,  8,  8, 12, 12, 23, 23,  4}, // state  6
+    { 8,  6,  6, 22, 22,  3,  3, 14}, // state  7
+    { 6,  7,  7,  5,  5, 13, 13, 21}, // state  8
+    {10, 11, 11, 15, 15, 20, 20,  1}, // state  9
+    {11,  9,  9, 19, 19,  0,  0, 17}, // state 10
+    { 9, 10, 10,  2,  2, 16, 16, 18}, // state 11
+    {13, 14, 14,  6,  6,  5,  5, 22}, // state 12
+    {14, 12, 12,  4,  4, 21, 21,  8}, // state 13
+    {12, 13, 13, 23, 23,  7,  7,  3}, // state 14
+    {16, 17, 17,  9,  9,  2,  2, 19}, // state 15
+    {17, 15, 15,  1,  1, 18, 18, 11}, // state 16
+    {15, 16, 16, 20, 20, 10, 10,  0}, // state 17
+    {19, 20, 20,  0,  0, 11, 11, 16}, // state 18
+    {20, 18, 18, 10, 10, 15, 15,  2}, // state 19
+    {18, 19, 19, 17, 17,  1,  1,  9}, // state 20
+    {22, 23, 23,  3,  3,  8,  8, 13}, // state 21
+    {23, 21, 21,  7,  7, 12, 12,  5}, // state 22
+    {21, 22, 22, 14, 14,  4,  4,  6}  // state 23
+};
 
 }
@@ -5,6 +5,7 @@
 #include <libgeodecomp/geometry/partitions/spacefillingcurve.h>
 #include <libgeodecomp/storage/grid.h>
 
+#include <algorithm>
 #include <boost/shared_ptr.hpp>
 #include <iostream>
 #include <sstream>
@@ -14,10 +15,17 @@ namespace LibGeoDecomp {
 
 /**
  * An implementation of Hilbert's space-filling curve (SFC). It's
- * limited to 2D and we suggest the use of the ZCurvePartition anyway
- * as it typically yields better results.
+ * available for 2D and 3D.
  */
-class HilbertPartition : public SpaceFillingCurve<2>
+template<int DIM>
+class HilbertPartition;
+
+/**
+ * The 2D Hilbert curve. We suggest the use of the ZCurvePartition
+ * anyway as it typically yields better results.
+ */
+template<>
+class HilbertPartition<2> : public SpaceFillingCurve<2>
 {
     friend class HilbertPartitionTest;
 private:
@@ -25,7 +33,9 @@ private:
 
 public:
     typedef Grid<std::vector<Coord<2> >, Topologies::Cube<3>::Topology> CacheType;
+    typedef Grid<RunVector, Topologies::Cube<3>::Topology> RunCacheType;
     static boost::shared_ptr<CacheType> squareCoordsCache;
+    static boost::shared_ptr<RunCacheType> squareRunsCache;
     static Form squareFormTransitions[4][4];
     static int squareSectorTransitions[4][4];
     static Coord<2> maxCachedDimensions;
@@ -250,29 +260,12 @@ public:
             unsigned newOffset = pos - accuSizes[newQuarter];
             Coord<2> newOrigin;
             Coord<2> newDimensions;
-
-            switch (squareSectorTransitions[form][newQuarter]) {
-            case 0:
-                newOrigin = origin;
-                newDimensions = halfDimensions;
-                break;
-            case 1:
-                newOrigin.x() = origin.x() + halfDimensions.x();
-                newOrigin.y() = origin.y();
-                newDimensions.x() = dimensions.x() - halfDimensions.x();
-                newDimensions.y() = halfDimensions.y();
-                break;
-            case 2:
-                newOrigin.x() = origin.x();
-                newOrigin.y() = origin.y() + halfDimensions.y();
-                newDimensions.x() = halfDimensions.x();
-                newDimensions.y() = dimensions.y() - halfDimensions.y();
-                break;
-            case 3:
-                newOrigin = origin + halfDimensions;
-                newDimensions = dimensions - halfDimensions;
-                break;
-            };
+            sectorGeometry(
+                squareSectorTransitions[form][newQuarter],
+                origin,
+                dimensions,
+                &newOrigin,
+                &newDimensions);
 
             Form newForm = squareFormTransitions[form][newQuarter];
             Square newSquare(newOrigin, newDimensions, 0, newForm);
@@ -327,11 +320,28 @@ public:
         return Iterator(origin);
     }
 
+    inline void setCosts(const CostMap<2>& costs)
+    {
+        this->cutByCost(begin(), end(), costs);
+    }
+
+    /**
+     * Emits the node's region streak by streak: squares fully
+     * covered by the node's section of the curve are added row-wise,
+     * partially covered squares are clipped via squareRunsCache or
+     * refined recursively.
+     */
     inline Region<2> getRegion(const std::size_t node) const
     {
-        return Region<2>(
-            (*this)[startOffsets[node + 0]],
-            (*this)[startOffsets[node + 1]]);
+        StreakVector streaks;
+        collectStreaks(
+            origin,
+            dimensions,
+            LL_TO_LR,
+            startOffsets[node + 0],
+            startOffsets[node + 1],
+            &streaks);
+        return toRegion(&streaks);
     }
 
 private:
@@ -340,10 +350,113 @@ private:
     Coord<2> origin;
     Coord<2> dimensions;
 
+    /**
+     * Computes the location of one of the four sub-squares (see
+     * squareSectorTransitions for the numbering of sectors).
+     */
+    static inline void sectorGeometry(
+        int sector,
+        const Coord<2>& origin,
+        const Coord<2>& dimensions,
+        Coord<2> *newOrigin,
+        Coord<2> *newDimensions)
+    {
+        Coord<2> halfDimensions = dimensions / 2;
+
+        switch (sector) {
+        case 0:
+            *newOrigin = origin;
+            *newDimensions = halfDimensions;
+            break;
+        case 1:
+            newOrigin->x() = origin.x() + halfDimensions.x();
+            newOrigin->y() = origin.y();
+            newDimensions->x() = dimensions.x() - halfDimensions.x();
+            newDimensions->y() = halfDimensions.y();
+            break;
+        case 2:
+            newOrigin->x() = origin.x();
+            newOrigin->y() = origin.y() + halfDimensions.y();
+            newDimensions->x() = halfDimensions.x();
+            newDimensions->y() = dimensions.y() - halfDimensions.y();
+            break;
+        case 3:
+            *newOrigin = origin + halfDimensions;
+            *newDimensions = dimensions - halfDimensions;
+            break;
+        default:
+            throw std::invalid_argument("illegal sector");
+        };
+    }
+
+    /**
+     * Adds the cells [begin, end) of the square's section of the
+     * curve to streaks. Positions are relative to the square's first
+     * cell.
+     */
+    static inline void collectStreaks(
+        const Coord<2>& squareOrigin,
+        const Coord<2>& squareDimensions,
+        const Form& form,
+        long begin,
+        long end,
+        StreakVector *streaks)
+    {
+        long size = squareDimensions.prod();
+        begin = (std::max)(begin, 0l);
+        end = (std::min)(end, size);
+        if (begin >= end) {
+            return;
+        }
+
+        if ((begin == 0) && (end == size)) {
+            addBox(squareOrigin, squareDimensions, streaks);
+            return;
+        }
+
+        if (Iterator::hasTrivialDimensions(squareDimensions)) {
+            addLine(squareOrigin, squareDimensions, begin, end, streaks);
+            return;
+        }
+
+        if ((squareDimensions.x() < maxCachedDimensions.x()) &&
+            (squareDimensions.y() < maxCachedDimensions.y())) {
+            Coord<3> c(squareDimensions.x(), squareDimensions.y(), form);
+            addRuns((*squareRunsCache)[c], squareOrigin, begin, end, streaks);
+            return;
+        }
+
+        long quarterOffset = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (quarterOffset >= end) {
+                break;
+            }
+
+            Coord<2> quarterOrigin;
+            Coord<2> quarterDimensions;
+            sectorGeometry(
+                squareSectorTransitions[form][i],
+                squareOrigin,
+                squareDimensions,
+                &quarterOrigin,
+                &quarterDimensions);
+
+            collectStreaks(
+                quarterOrigin,
+                quarterDimensions,
+                squareFormTransitions[form][i],
+                begin - quarterOffset,
+                end - quarterOffset,
+                streaks);
+            quarterOffset += quarterDimensions.prod();
+        }
+    }
+
     static inline bool fillCaches()
     {
         Coord<2> maxDim(17, 17);
         squareCoordsCache.reset(new CacheType(Coord<3>(maxDim.x(), maxDim.y(), 4)));
+        squareRunsCache.reset(new RunCacheType(Coord<3>(maxDim.x(), maxDim.y(), 4)));
 
         for (int y = 2; y < maxDim.y(); ++y) {
             maxCachedDimensions = Coord<2>(y, y);
@@ -358,6 +471,7 @@ private:
 
                     Coord<3> c(dimensions.x(), dimensions.y(), f);
                     (*squareCoordsCache)[c] = coords;
+                    (*squareRunsCache)[c] = toRuns(coords);
                 }
             }
         }
@@ -367,10 +481,354 @@ private:
     }
 };
 
+/**
+ * The 3D Hilbert curve. Cubes are split into octants, which are
+ * traversed in the order of the compact Hilbert index (see Hamilton,
+ * "Compact Hilbert Indices", 2006). Each cube carries a state which
+ * encodes the corner where the curve enters the cube and the
+ * principal direction of the traversal. For cubes with power-of-two
+ * edge lengths consecutive cells on the curve are neighbors.
+ */
+template<>
+class HilbertPartition<3> : public SpaceFillingCurve<3>
+{
+    friend class HilbertPartitionTest;
+public:
+    static const int NUM_STATES = 24;
+    static const int NUM_OCTANTS = 8;
+
+    // octantTransitions[s][i] is the i-th octant visited by a cube in
+    // state s. Bit d of an octant is set if it lies in the upper half
+    // of the cube in respect to dimension d. stateTransitions[s][i]
+    // is the state of that octant.
+    static int octantTransitions[NUM_STATES][NUM_OCTANTS];
+    static int stateTransitions[NUM_STATES][NUM_OCTANTS];
+
+    class Cube
+    {
+    public:
+        inline Cube(const Coord<3>& origin, const Coord<3> dimensions, unsigned octant, int state) :
+            origin(origin),
+            dimensions(dimensions),
+            octant(octant),
+            state(state)
+        {}
+
+        inline std::string toString() const
+        {
+            std::stringstream s;
+            s << "Cube(origin:" << origin << ", dimensions:" << dimensions << ", octant: " << octant << ", state: " << state << ")";
+            return s.str();
+        }
+
+        Coord<3> origin;
+        Coord<3> dimensions;
+        unsigned octant;
+        int state;
+    };
+
+    class Iterator : public SpaceFillingCurve<3>::Iterator
+    {
+    public:
+        using SpaceFillingCurve<3>::Iterator::cursor;
+        using SpaceFillingCurve<3>::Iterator::endReached;
+        using SpaceFillingCurve<3>::Iterator::hasTrivialDimensions;
+        using SpaceFillingCurve<3>::Iterator::sublevelState;
+
+        inline Iterator(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            unsigned pos = 0,
+            int state = 0) :
+            SpaceFillingCurve<3>::Iterator(origin, false)
+        {
+            cubeStack.push_back(Cube(origin, dimensions, 0, state));
+            digDown(pos);
+        }
+
+        inline explicit Iterator(const Coord<3>& origin) :
+            SpaceFillingCurve<3>::Iterator(origin, true)
+        {}
+
+        inline Iterator& operator++()
+        {
+            if (endReached) {
+                return *this;
+            }
+
+            if (--trivialCubeCounter > 0) {
+                cursor[trivialCubeDirDim]++;
+            } else {
+                digUpDown();
+            }
+            return *this;
+        }
+
+    private:
+        std::vector<Cube> cubeStack;
+        int trivialCubeDirDim;
+        unsigned trivialCubeCounter;
+
+        inline void digUpDown()
+        {
+            digUp();
+            if (endReached) {
+                return;
+            }
+            digDown(0);
+        }
+
+        inline void digDown(unsigned offset)
+        {
+            if (cubeStack.empty()) {
+                throw std::logic_error("cannot descend from empty cubes stack");
+            }
+
+            Cube currentCube = pop(cubeStack);
+            const Coord<3>& origin = currentCube.origin;
+            const Coord<3>& dimensions = currentCube.dimensions;
+
+            if ((int)offset >= dimensions.prod()) {
+                endReached = true;
+                cursor = origin;
+                return;
+            }
+            if (hasTrivialDimensions(dimensions)) {
+                digDownTrivial(origin, dimensions, offset);
+            } else {
+                digDownRecursion(offset, currentCube);
+            }
+        }
+
+        inline void digDownTrivial(
+            const Coord<3>& origin,
+            const Coord<3>& dimensions,
+            unsigned offset)
+        {
+            sublevelState = TRIVIAL;
+            cursor = origin;
+
+            trivialCubeDirDim = 0;
+            for (int i = 1; i < 3; ++i) {
+                if (dimensions[i] > 1) {
+                    trivialCubeDirDim = i;
+                }
+            }
+
+            trivialCubeCounter = dimensions[trivialCubeDirDim] - offset;
+            cursor[trivialCubeDirDim] += offset;
+        }
+
+        inline void digDownRecursion(unsigned offset, Cube currentCube)
+        {
+            unsigned accuSizes[NUM_OCTANTS + 1];
+            accumulateSizes(currentCube, accuSizes);
+
+            // upper_bound skips empty octants, which occur if an edge
+            // of the cube has length 1:
+            unsigned pos = offset + accuSizes[currentCube.octant];
+            unsigned newOctant = std::upper_bound(
+                accuSizes,
+                accuSizes + NUM_OCTANTS + 1,
+                pos) - accuSizes - 1;
+
+            if (newOctant >= NUM_OCTANTS) {
+                throw std::logic_error("offset too large?");
+            }
+
+            currentCube.octant = newOctant;
+            cubeStack.push_back(currentCube);
+
+            Coord<3> newOrigin;
+            Coord<3> newDimensions;
+            octantGeometry(
+                octantTransitions[currentCube.state][newOctant],
+                currentCube.origin,
+                currentCube.dimensions,
+                &newOrigin,
+                &newDimensions);
+
+            int newState = stateTransitions[currentCube.state][newOctant];
+            cubeStack.push_back(Cube(newOrigin, newDimensions, 0, newState));
+
+            digDown(pos - accuSizes[newOctant]);
+        }
+
+        inline void digUp()
+        {
+            while (!cubeStack.empty()) {
+                Cube& cube = cubeStack.back();
+                if (++cube.octant < NUM_OCTANTS) {
+                    // only return if any non-empty octants are left:
+                    unsigned accuSizes[NUM_OCTANTS + 1];
+                    accumulateSizes(cube, accuSizes);
+                    if (accuSizes[cube.octant] < accuSizes[NUM_OCTANTS]) {
+                        return;
+                    }
+                }
+                cubeStack.pop_back();
+            }
+            endReached = true;
+            cursor = origin;
+        }
+
+        // accuSizes[i] is the number of cells within the first i
+        // octants visited by the curve.
+        inline void accumulateSizes(const Cube& cube, unsigned *accuSizes) const
+        {
+            accuSizes[0] = 0;
+            for (int i = 0; i < NUM_OCTANTS; ++i) {
+                Coord<3> octantOrigin;
+                Coord<3> octantDimensions;
+                octantGeometry(
+                    octantTransitions[cube.state][i],
+                    cube.origin,
+                    cube.dimensions,
+                    &octantOrigin,
+                    &octantDimensions);
+                accuSizes[i + 1] = accuSizes[i] + octantDimensions.prod();
+            }
+        }
+    };
+
+    inline explicit HilbertPartition(
+        const Coord<3>& origin = Coord<3>(0, 0, 0),
+        const Coord<3>& dimensions = Coord<3>(0, 0, 0),
+        const long& offset = 0,
+        const std::vector<std::size_t>& weights = std::vector<std::size_t>(2),
+        const boost::shared_ptr<Adjacency>& /* unused: adjacency */ = boost::make_shared<RegionBasedAdjacency>()) :
+        SpaceFillingCurve<3>(offset, weights),
+        origin(origin),
+        dimensions(dimensions)
+    {}
+
+    inline Iterator operator[](unsigned i) const
+    {
+        return Iterator(origin, dimensions, i);
+    }
+
+    inline Iterator begin() const
+    {
+        return (*this)[0];
+    }
+
+    inline Iterator end() const
+    {
+        return Iterator(origin);
+    }
+
+    inline void setCosts(const CostMap<3>& costs)
+    {
+        this->cutByCost(begin(), end(), costs);
+    }
+
+    /**
+     * Emits the node's region streak by streak, just like
+     * HilbertPartition<2>::getRegion().
+     */
+    inline Region<3> getRegion(const std::size_t node) const
+    {
+        StreakVector streaks;
+        collectStreaks(
+            origin,
+            dimensions,
+            0,
+            startOffsets[node + 0],
+            startOffsets[node + 1],
+            &streaks);
+        return toRegion(&streaks);
+    }
+
+private:
+    using SpaceFillingCurve<3>::startOffsets;
+
+    Coord<3> origin;
+    Coord<3> dimensions;
+
+    /**
+     * Computes the location of an octant. Cubes are split at
+     * dimensions / 2, so lower octants may be empty.
+     */
+    static inline void octantGeometry(
+        int octant,
+        const Coord<3>& origin,
+        const Coord<3>& dimensions,
+        Coord<3> *newOrigin,
+        Coord<3> *newDimensions)
+    {
+        Coord<3> halfDimensions = dimensions / 2;
+
+        for (int d = 0; d < 3; ++d) {
+            if (octant & (1 << d)) {
+                (*newOrigin)[d] = origin[d] + halfDimensions[d];
+                (*newDimensions)[d] = dimensions[d] - halfDimensions[d];
+            } else {
+                (*newOrigin)[d] = origin[d];
+                (*newDimensions)[d] = halfDimensions[d];
+            }
+        }
+    }
+
+    /**
+     * Adds the cells [begin, end) of the cube's section of the curve
+     * to streaks. Positions are relative to the cube's first cell.
+     */
+    static inline void collectStreaks(
+        const Coord<3>& cubeOrigin,
+        const Coord<3>& cubeDimensions,
+        int state,
+        long begin,
+        long end,
+        StreakVector *streaks)
+    {
+        long size = cubeDimensions.prod();
+        begin = (std::max)(begin, 0l);
+        end = (std::min)(end, size);
+        if (begin >= end) {
+            return;
+        }
+
+        if ((begin == 0) && (end == size)) {
+            addBox(cubeOrigin, cubeDimensions, streaks);
+            return;
+        }
+
+        if (Iterator::hasTrivialDimensions(cubeDimensions)) {
+            addLine(cubeOrigin, cubeDimensions, begin, end, streaks);
+            return;
+        }
+
+        long octantOffset = 0;
+        for (int i = 0; i < NUM_OCTANTS; ++i) {
+            if (octantOffset >= end) {
+                break;
+            }
+
+            Coord<3> octantOrigin;
+            Coord<3> octantDimensions;
+            octantGeometry(
+                octantTransitions[state][i],
+                cubeOrigin,
+                cubeDimensions,
+                &octantOrigin,
+                &octantDimensions);
+
+            collectStreaks(
+                octantOrigin,
+                octantDimensions,
+                stateTransitions[state][i],
+                begin - octantOffset,
+                end - octantOffset,
+                streaks);
+            octantOffset += octantDimensions.prod();
+        }
+    }
+};
+
 template<typename _CharT, typename _Traits>
 std::basic_ostream<_CharT, _Traits>&
 operator<<(std::basic_ostream<_CharT, _Traits>& __os,
-           const typename HilbertPartition::Square& square)
+           const HilbertPartition<2>::Square& square)
 {
     __os << square.toString();
     return __os;
@@ -542,6 +542,11 @@ public:
         return Iterator(origin);
     }
 
+    inline void setCosts(const CostMap<2>& costs)
+    {
+        this->cutByCost(begin(), end(), costs);
+    }
+
     inline Region<2> getRegion(const std::size_t node) const
     {
         return Region<2>(
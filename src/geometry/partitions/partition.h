@@ -48,6 +48,16 @@ public:
         return weights;
     }
 
+    /**
+     * Position of each node's first cell in the order of this
+     * partition. The last entry marks the end of the last node's
+     * section.
+     */
+    inline const std::vector<std::size_t>& getStartOffsets() const
+    {
+        return startOffsets;
+    }
+
     virtual Region<DIM> getRegion(const std::size_t node) const = 0;
 
     virtual boost::shared_ptr<Adjacency> getAdjacency() const
@@ -2,8 +2,14 @@
 #define LIBGEODECOMP_GEOMETRY_PARTITIONS_SPACEFILLINGCURVE_H
 
 #include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/geometry/costmap.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/partitions/partition.h>
+#include <libgeodecomp/geometry/streak.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace LibGeoDecomp {
 
@@ -62,11 +68,258 @@ public:
         SpaceFillingCurveSublevelState sublevelState;
     };
 
+    /**
+     * A maximal section of a curve which runs along the x-axis,
+     * either in ascending or in descending order. offset is the
+     * position of the run's first cell on the curve. Runs allow us to
+     * cache the curve's shape at streak granularity.
+     */
+    class Run
+    {
+    public:
+        inline Run(const Coord<DIM>& start, unsigned offset) :
+            streak(start, start.x() + 1),
+            offset(offset),
+            descending(false)
+        {}
+
+        /**
+         * Extends the run by the next coordinate on the curve.
+         * Returns false if that coordinate doesn't continue the run.
+         */
+        inline bool append(const Coord<DIM>& next)
+        {
+            for (int d = 1; d < DIM; ++d) {
+                if (next[d] != streak.origin[d]) {
+                    return false;
+                }
+            }
+
+            if ((streak.length() == 1) && (next.x() == (streak.origin.x() - 1))) {
+                descending = true;
+            }
+
+            if (descending) {
+                if (next.x() != (streak.origin.x() - 1)) {
+                    return false;
+                }
+                --streak.origin.x();
+            } else {
+                if (next.x() != streak.endX) {
+                    return false;
+                }
+                ++streak.endX;
+            }
+
+            return true;
+        }
+
+        Streak<DIM> streak;
+        unsigned offset;
+        bool descending;
+    };
+
+    typedef std::vector<Run> RunVector;
+    typedef std::vector<Streak<DIM> > StreakVector;
+
     inline SpaceFillingCurve(
         const long& offset,
         const std::vector<std::size_t>& weights) :
         Partition<DIM>(offset, weights)
     {}
+
+    /**
+     * Moves the boundaries between the nodes' sections of the curve
+     * so that each node receives a share of the estimated update cost
+     * (instead of a share of the cells) which is proportional to its
+     * weight. The section covered by the partition as a whole remains
+     * unchanged, as do the weights.
+     */
+    virtual void setCosts(const CostMap<DIM>& costs) = 0;
+
+    /**
+     * Compresses a cached sequence of coordinates into runs.
+     */
+    static inline RunVector toRuns(const std::vector<Coord<DIM> >& coords)
+    {
+        RunVector ret;
+        for (std::size_t i = 0; i < coords.size(); ++i) {
+            if (ret.empty() || !ret.back().append(coords[i])) {
+                ret.push_back(Run(coords[i], i));
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * Adds those sections of runs which lie within [begin, end) on
+     * the curve to streaks. All runs are shifted by origin.
+     */
+    static inline void addRuns(
+        const RunVector& runs,
+        const Coord<DIM>& origin,
+        long begin,
+        long end,
+        StreakVector *streaks)
+    {
+        for (typename RunVector::const_iterator i = runs.begin(); i != runs.end(); ++i) {
+            long runBegin = i->offset;
+            if (runBegin >= end) {
+                break;
+            }
+            long runEnd = runBegin + i->streak.length();
+            if (runEnd <= begin) {
+                continue;
+            }
+
+            int skipHead = (std::max)(begin, runBegin) - runBegin;
+            int skipTail = runEnd - (std::min)(end, runEnd);
+            Streak<DIM> streak(i->streak.origin + origin, i->streak.endX + origin.x());
+            if (i->descending) {
+                std::swap(skipHead, skipTail);
+            }
+            streak.origin.x() += skipHead;
+            streak.endX -= skipTail;
+            streaks->push_back(streak);
+        }
+    }
+
+    /**
+     * Adds the cells [begin, end) of a line (i.e. a box with trivial
+     * dimensions, see Iterator::hasTrivialDimensions()) to streaks.
+     */
+    static inline void addLine(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        long begin,
+        long end,
+        StreakVector *streaks)
+    {
+        int dirDim = 0;
+        for (int d = 1; d < DIM; ++d) {
+            if (dimensions[d] > 1) {
+                dirDim = d;
+            }
+        }
+
+        if (dirDim == 0) {
+            streaks->push_back(Streak<DIM>(origin + unitCoord(0, begin), origin.x() + end));
+            return;
+        }
+
+        for (long i = begin; i < end; ++i) {
+            Coord<DIM> c = origin + unitCoord(dirDim, i);
+            streaks->push_back(Streak<DIM>(c, c.x() + 1));
+        }
+    }
+
+    /**
+     * Adds all rows of the box to streaks.
+     */
+    static inline void addBox(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        StreakVector *streaks)
+    {
+        CoordBox<DIM> box(origin, dimensions);
+        for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            streaks->push_back(*i);
+        }
+    }
+
+    /**
+     * Sorts streaks in the order of Region's storage so that the
+     * Region can be built by (cheap) appends.
+     */
+    static inline Region<DIM> toRegion(StreakVector *streaks)
+    {
+        std::sort(streaks->begin(), streaks->end(), compareStreaks);
+
+        Region<DIM> ret;
+        for (typename StreakVector::const_iterator i = streaks->begin(); i != streaks->end(); ++i) {
+            ret << *i;
+        }
+
+        return ret;
+    }
+
+protected:
+    using Partition<DIM>::weights;
+    using Partition<DIM>::startOffsets;
+
+    /**
+     * Implements setCosts() for curves which can be traversed cell by
+     * cell via [begin, end). Walks the curve twice: once to sum up
+     * the cost of the partition's section, once to cut it. A cell is
+     * assigned to the node whose share of the cost contains the
+     * cell's center.
+     */
+    template<typename ITERATOR>
+    void cutByCost(ITERATOR begin, const ITERATOR& end, const CostMap<DIM>& costs)
+    {
+        const std::size_t first = startOffsets.front();
+        const std::size_t last = startOffsets.back();
+        std::vector<double> blockCosts = costs.blockCosts();
+
+        ITERATOR cursor = begin;
+        std::size_t pos = 0;
+        for (; (pos < first) && (cursor != end); ++pos) {
+            ++cursor;
+        }
+        ITERATOR sectionBegin = cursor;
+
+        double totalCost = 0;
+        for (; (pos < last) && (cursor != end); ++pos, ++cursor) {
+            totalCost += blockCosts[costs.blockIndex(*cursor)];
+        }
+
+        double totalWeight = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            totalWeight += weights[i];
+        }
+        if ((totalCost <= 0) || (totalWeight <= 0)) {
+            return;
+        }
+
+        cursor = sectionBegin;
+        pos = first;
+        double accumulatedCost = 0;
+        double accumulatedWeight = 0;
+        for (std::size_t node = 0; node < (weights.size() - 1); ++node) {
+            accumulatedWeight += weights[node];
+            double target = totalCost * (accumulatedWeight / totalWeight);
+
+            for (; (pos < last) && (cursor != end); ++pos, ++cursor) {
+                double cost = blockCosts[costs.blockIndex(*cursor)];
+                if ((accumulatedCost + 0.5 * cost) > target) {
+                    break;
+                }
+                accumulatedCost += cost;
+            }
+
+            startOffsets[node + 1] = pos;
+        }
+    }
+
+private:
+    static inline Coord<DIM> unitCoord(int dim, long length)
+    {
+        Coord<DIM> ret;
+        ret[dim] = length;
+        return ret;
+    }
+
+    static inline bool compareStreaks(const Streak<DIM>& a, const Streak<DIM>& b)
+    {
+        for (int d = DIM - 1; d > 0; --d) {
+            if (a.origin[d] != b.origin[d]) {
+                return a.origin[d] < b.origin[d];
+            }
+        }
+
+        return a.origin.x() < b.origin.x();
+    }
 };
 
 }
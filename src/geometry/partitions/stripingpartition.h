@@ -53,6 +53,11 @@ public:
         return Iterator(origin, origin + endOffset, dimensions);
     }
 
+    void setCosts(const CostMap<DIM>& costs)
+    {
+        this->cutByCost(begin(), end(), costs);
+    }
+
     inline Region<DIM> getRegion(const std::size_t node) const
     {
         return Region<DIM>(
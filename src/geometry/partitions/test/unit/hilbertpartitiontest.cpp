@@ -0,0 +1,86 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HilbertPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/hilbertpartitiontest.h"
+
+static HilbertPartitionTest suite_HilbertPartitionTest;
+
+static CxxTest::List Tests_HilbertPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HilbertPartitionTest( "/root/repo/src/geometry/partitions/test/unit/hilbertpartitiontest.h", 12, "HilbertPartitionTest", suite_HilbertPartitionTest, Tests_HilbertPartitionTest );
+
+static class TestDescription_suite_HilbertPartitionTest_testFillRectangles : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testFillRectangles() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 41, "testFillRectangles" ) {}
+ void runTest() { suite_HilbertPartitionTest.testFillRectangles(); }
+} testDescription_suite_HilbertPartitionTest_testFillRectangles;
+
+static class TestDescription_suite_HilbertPartitionTest_testOperatorInc : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testOperatorInc() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 53, "testOperatorInc" ) {}
+ void runTest() { suite_HilbertPartitionTest.testOperatorInc(); }
+} testDescription_suite_HilbertPartitionTest_testOperatorInc;
+
+static class TestDescription_suite_HilbertPartitionTest_testLoop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testLoop() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 69, "testLoop" ) {}
+ void runTest() { suite_HilbertPartitionTest.testLoop(); }
+} testDescription_suite_HilbertPartitionTest_testLoop;
+
+static class TestDescription_suite_HilbertPartitionTest_testAsymmetric : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testAsymmetric() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 77, "testAsymmetric" ) {}
+ void runTest() { suite_HilbertPartitionTest.testAsymmetric(); }
+} testDescription_suite_HilbertPartitionTest_testAsymmetric;
+
+static class TestDescription_suite_HilbertPartitionTest_testSquareBracketsOperatorVersusIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testSquareBracketsOperatorVersusIteration() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 107, "testSquareBracketsOperatorVersusIteration" ) {}
+ void runTest() { suite_HilbertPartitionTest.testSquareBracketsOperatorVersusIteration(); }
+} testDescription_suite_HilbertPartitionTest_testSquareBracketsOperatorVersusIteration;
+
+static class TestDescription_suite_HilbertPartitionTest_testLarge : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testLarge() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 122, "testLarge" ) {}
+ void runTest() { suite_HilbertPartitionTest.testLarge(); }
+} testDescription_suite_HilbertPartitionTest_testLarge;
+
+static class TestDescription_suite_HilbertPartitionTest_testGetRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_testGetRegion() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 139, "testGetRegion" ) {}
+ void runTest() { suite_HilbertPartitionTest.testGetRegion(); }
+} testDescription_suite_HilbertPartitionTest_testGetRegion;
+
+static class TestDescription_suite_HilbertPartitionTest_test3dAdjacency : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_test3dAdjacency() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 152, "test3dAdjacency" ) {}
+ void runTest() { suite_HilbertPartitionTest.test3dAdjacency(); }
+} testDescription_suite_HilbertPartitionTest_test3dAdjacency;
+
+static class TestDescription_suite_HilbertPartitionTest_test3dSquareBracketsOperatorVersusIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HilbertPartitionTest_test3dSquareBracketsOperatorVersusIteration() : CxxTest::RealTestDescription( Tests_HilbertPartitionTest, suiteDescription_HilbertPartitionTest, 170, "test3dSquareBracketsOperatorVersusIteration" ) {}
+ void runTest() { suite_HilbertPartitionTest.test3dSquareBracketsOperatorVersusIteration(); }
+} testDescription_suite_HilbertPartitionTest_test3dSquareBracketsOperatorVersusIteration;
+
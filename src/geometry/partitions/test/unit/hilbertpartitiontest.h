@@ -1,6 +1,7 @@
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
 
 #include <boost/assign/std/vector.hpp>
+#include <cstdlib>
 #include <cxxtest/TestSuite.h>
 
 using namespace boost::assign;
@@ -15,7 +16,7 @@ public:
 
     void setUp()
     {
-        partition = HilbertPartition(Coord<2>(10, 20), Coord<2>(4, 4));
+        partition = HilbertPartition<2>(Coord<2>(10, 20), Coord<2>(4, 4));
         expected.clear();
         expected +=
             Coord<2>(10, 23),
@@ -42,7 +43,7 @@ public:
         CoordVector actual;
         for (int i = 0; i < 16; ++i)
             actual.push_back(
-                *HilbertPartition::Iterator(
+                *HilbertPartition<2>::Iterator(
                     Coord<2>(10, 20),
                     Coord<2>(4, 4),
                     i));
@@ -51,7 +52,7 @@ public:
 
     void testOperatorInc()
     {
-        HilbertPartition::Iterator i(Coord<2>(10, 10), Coord<2>(4, 4), 10);
+        HilbertPartition<2>::Iterator i(Coord<2>(10, 10), Coord<2>(4, 4), 10);
         TS_ASSERT_EQUALS(Coord<2>(13, 10), *i);
         ++i;
         TS_ASSERT_EQUALS(Coord<2>(13, 11), *i);
@@ -68,14 +69,14 @@ public:
     void testLoop()
     {
         CoordVector actual;
-        for (HilbertPartition::Iterator i = partition.begin(); i != partition.end(); ++i)
+        for (HilbertPartition<2>::Iterator i = partition.begin(); i != partition.end(); ++i)
             actual.push_back(*i);
         TS_ASSERT_EQUALS(actual, expected);
     }
 
     void testAsymmetric()
     {
-        partition = HilbertPartition(Coord<2>(10, 22), Coord<2>(5, 3));
+        partition = HilbertPartition<2>(Coord<2>(10, 22), Coord<2>(5, 3));
         // 45678
         // 32b9a
         // 01cde
@@ -96,7 +97,7 @@ public:
             Coord<2>(12, 24),
             Coord<2>(13, 24),
             Coord<2>(14, 24);
-        for (HilbertPartition::Iterator i = partition.begin();
+        for (HilbertPartition<2>::Iterator i = partition.begin();
              i != partition.end();
              ++i)
             actual.push_back(*i);
@@ -107,12 +108,12 @@ public:
     {
         Coord<2> offset(10, 20);
         Coord<2> dimensions(6, 35);
-        partition = HilbertPartition(offset, dimensions);
+        partition = HilbertPartition<2>(offset, dimensions);
         CoordVector expected;
         for (int i = 0; i < (dimensions.x()*dimensions.y()); ++i)
             expected += *partition[i];
         CoordVector actual;
-        for (HilbertPartition::Iterator i = partition.begin();
+        for (HilbertPartition<2>::Iterator i = partition.begin();
              i != partition.end(); ++i)
             actual.push_back(*i);
         TS_ASSERT_EQUALS(expected, actual);
@@ -122,21 +123,108 @@ public:
     {
         Coord<2> offset(10, 20);
         Coord<2> dimensions(600, 3500);
-        partition = HilbertPartition(offset, dimensions);
+        partition = HilbertPartition<2>(offset, dimensions);
         CoordVector expectedSorted;
         for (int x = offset.x(); x < (offset.x() + dimensions.x()); ++x)
             for (int y = offset.y(); y < (offset.y() + dimensions.y()); ++y)
                 expectedSorted += Coord<2>(x, y);
         sort(expectedSorted);
         CoordVector actual;
-        for (HilbertPartition::Iterator i = partition.begin(); i != partition.end(); ++i)
+        for (HilbertPartition<2>::Iterator i = partition.begin(); i != partition.end(); ++i)
             actual.push_back(*i);
         sort(actual);
         TS_ASSERT_EQUALS(expectedSorted, actual);
     }
 
+    void testGetRegion()
+    {
+        std::vector<std::size_t> weights;
+        weights << 100 << 1 << 3000 << 37 << 1862 << 10000 << 1000;
+        checkRegions(Coord<2>(10, 20), Coord<2>(50, 100), weights);
+        checkRegions(Coord<2>(0, 0), Coord<2>(16000, 1), weights);
+        checkRegions(Coord<2>(0, 0), Coord<2>(123, 130), weights);
+
+        checkRegions(Coord<3>(1, 2, 3), Coord<3>(30, 31, 29), weights);
+        checkRegions(Coord<3>(0, 0, 0), Coord<3>(3, 1000, 9), weights);
+        checkRegions(Coord<3>(0, 0, 0), Coord<3>(1, 128, 128), weights);
+    }
+
+    void test3dAdjacency()
+    {
+        for (int size = 1; size <= 16; size *= 2) {
+            HilbertPartition<3> partition(Coord<3>(1, 2, 3), Coord<3>::diagonal(size));
+            std::vector<Coord<3> > coords;
+            for (HilbertPartition<3>::Iterator i = partition.begin(); i != partition.end(); ++i) {
+                coords << *i;
+            }
+
+            TS_ASSERT_EQUALS(coords.size(), std::size_t(size * size * size));
+            TS_ASSERT_EQUALS(coords.front(), Coord<3>(1, 2, 3));
+            for (std::size_t i = 1; i < coords.size(); ++i) {
+                Coord<3> delta = coords[i] - coords[i - 1];
+                TS_ASSERT_EQUALS(1, std::abs(delta.x()) + std::abs(delta.y()) + std::abs(delta.z()));
+            }
+        }
+    }
+
+    void test3dSquareBracketsOperatorVersusIteration()
+    {
+        Coord<3> offset(10, 20, 30);
+        Coord<3> dimensions(6, 35, 13);
+        HilbertPartition<3> partition(offset, dimensions);
+
+        std::vector<Coord<3> > expected;
+        CoordBox<3> box(offset, dimensions);
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            expected << *i;
+        }
+
+        std::vector<Coord<3> > actual1;
+        for (int i = 0; i < dimensions.prod(); ++i) {
+            actual1 << *partition[i];
+        }
+
+        std::vector<Coord<3> > actual2;
+        for (HilbertPartition<3>::Iterator i = partition.begin(); i != partition.end(); ++i) {
+            actual2 << *i;
+        }
+
+        TS_ASSERT_EQUALS(actual1, actual2);
+
+        sort(actual2);
+        sort(expected);
+        TS_ASSERT_EQUALS(expected, actual2);
+    }
+
+    template<int DIM>
+    void checkRegions(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        std::vector<std::size_t> weights)
+    {
+        // remainder ensures that all cells get assigned:
+        std::size_t remainder = dimensions.prod() - (std::min)(sum(weights), std::size_t(dimensions.prod()));
+        weights << remainder;
+        HilbertPartition<DIM> partition(origin, dimensions, 0, weights);
+        Region<DIM> whole;
+
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<DIM> expected(partition[start], partition[start + weights[i]]);
+            Region<DIM> actual = partition.getRegion(i);
+            TS_ASSERT_EQUALS(expected, actual);
+
+            whole += actual;
+            start += weights[i];
+        }
+
+        Region<DIM> expectedWhole;
+        expectedWhole << CoordBox<DIM>(origin, dimensions);
+        TS_ASSERT_EQUALS(expectedWhole, whole);
+    }
+
 private:
-    HilbertPartition partition;
+    HilbertPartition<2> partition;
     CoordVector expected, actual;
 };
 
@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HIndexingPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/hindexingpartitiontest.h"
+
+static HIndexingPartitionTest suite_HIndexingPartitionTest;
+
+static CxxTest::List Tests_HIndexingPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HIndexingPartitionTest( "/root/repo/src/geometry/partitions/test/unit/hindexingpartitiontest.h", 13, "HIndexingPartitionTest", suite_HIndexingPartitionTest, Tests_HIndexingPartitionTest );
+
+static class TestDescription_suite_HIndexingPartitionTest_testFillRectangles : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testFillRectangles() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 18, "testFillRectangles" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testFillRectangles(); }
+} testDescription_suite_HIndexingPartitionTest_testFillRectangles;
+
+static class TestDescription_suite_HIndexingPartitionTest_testBeginEnd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testBeginEnd() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 62, "testBeginEnd" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testBeginEnd(); }
+} testDescription_suite_HIndexingPartitionTest_testBeginEnd;
+
+static class TestDescription_suite_HIndexingPartitionTest_testTriangleLengthTrivial : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testTriangleLengthTrivial() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 93, "testTriangleLengthTrivial" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testTriangleLengthTrivial(); }
+} testDescription_suite_HIndexingPartitionTest_testTriangleLengthTrivial;
+
+static class TestDescription_suite_HIndexingPartitionTest_testTriangleLengthRecursive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testTriangleLengthRecursive() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 111, "testTriangleLengthRecursive" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testTriangleLengthRecursive(); }
+} testDescription_suite_HIndexingPartitionTest_testTriangleLengthRecursive;
+
+static class TestDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorSimple() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 126, "testSquareBracketsOperatorSimple" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testSquareBracketsOperatorSimple(); }
+} testDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorSimple;
+
+static class TestDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorLarge : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorLarge() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 145, "testSquareBracketsOperatorLarge" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testSquareBracketsOperatorLarge(); }
+} testDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorLarge;
+
+static class TestDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorForPartialIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorForPartialIteration() : CxxTest::RealTestDescription( Tests_HIndexingPartitionTest, suiteDescription_HIndexingPartitionTest, 165, "testSquareBracketsOperatorForPartialIteration" ) {}
+ void runTest() { suite_HIndexingPartitionTest.testSquareBracketsOperatorForPartialIteration(); }
+} testDescription_suite_HIndexingPartitionTest_testSquareBracketsOperatorForPartialIteration;
+
@@ -0,0 +1,57 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RecursiveBisectionPartitionTest_init = false;
+#include "/root/repo/src/geometry/partitions/test/unit/recursivebisectionpartitiontest.h"
+
+static RecursiveBisectionPartitionTest suite_RecursiveBisectionPartitionTest;
+
+static CxxTest::List Tests_RecursiveBisectionPartitionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RecursiveBisectionPartitionTest( "/root/repo/src/geometry/partitions/test/unit/recursivebisectionpartitiontest.h", 11, "RecursiveBisectionPartitionTest", suite_RecursiveBisectionPartitionTest, Tests_RecursiveBisectionPartitionTest );
+
+static class TestDescription_suite_RecursiveBisectionPartitionTest_testSearchNodeCuboid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RecursiveBisectionPartitionTest_testSearchNodeCuboid() : CxxTest::RealTestDescription( Tests_RecursiveBisectionPartitionTest, suiteDescription_RecursiveBisectionPartitionTest, 14, "testSearchNodeCuboid" ) {}
+ void runTest() { suite_RecursiveBisectionPartitionTest.testSearchNodeCuboid(); }
+} testDescription_suite_RecursiveBisectionPartitionTest_testSearchNodeCuboid;
+
+static class TestDescription_suite_RecursiveBisectionPartitionTest_testGetRegion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RecursiveBisectionPartitionTest_testGetRegion() : CxxTest::RealTestDescription( Tests_RecursiveBisectionPartitionTest, suiteDescription_RecursiveBisectionPartitionTest, 36, "testGetRegion" ) {}
+ void runTest() { suite_RecursiveBisectionPartitionTest.testGetRegion(); }
+} testDescription_suite_RecursiveBisectionPartitionTest_testGetRegion;
+
+static class TestDescription_suite_RecursiveBisectionPartitionTest_testDimWeights : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RecursiveBisectionPartitionTest_testDimWeights() : CxxTest::RealTestDescription( Tests_RecursiveBisectionPartitionTest, suiteDescription_RecursiveBisectionPartitionTest, 76, "testDimWeights" ) {}
+ void runTest() { suite_RecursiveBisectionPartitionTest.testDimWeights(); }
+} testDescription_suite_RecursiveBisectionPartitionTest_testDimWeights;
+
+static class TestDescription_suite_RecursiveBisectionPartitionTest_testDegradedDimensions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RecursiveBisectionPartitionTest_testDegradedDimensions() : CxxTest::RealTestDescription( Tests_RecursiveBisectionPartitionTest, suiteDescription_RecursiveBisectionPartitionTest, 89, "testDegradedDimensions" ) {}
+ void runTest() { suite_RecursiveBisectionPartitionTest.testDegradedDimensions(); }
+} testDescription_suite_RecursiveBisectionPartitionTest_testDegradedDimensions;
+
@@ -100,6 +100,32 @@ public:
         TS_ASSERT_EQUALS(expected, actual);
     }
 
+    void testSetCosts()
+    {
+        std::vector<std::size_t> weights;
+        weights << 20 << 20;
+        StripingPartition<2> p(Coord<2>(), Coord<2>(10, 4), 0, weights);
+        CostMap<2> costs(CoordBox<2>(Coord<2>(), Coord<2>(10, 4)), Coord<2>(5, 1));
+
+        // unsampled maps assume uniform costs:
+        p.setCosts(costs);
+        TS_ASSERT_EQUALS(Region<2>(p[0], p[20]), p.getRegion(0));
+
+        // first row is 40 times as costly as the remainder, so
+        // node 0 should get less than 1/2 row:
+        costs.addSample(Streak<2>(Coord<2>(0, 0), 10), 40.0);
+        for (int y = 1; y < 4; ++y) {
+            costs.addSample(Streak<2>(Coord<2>(0, y), 10), 1.0);
+        }
+        p.setCosts(costs);
+
+        Region<2> expected;
+        expected << Streak<2>(Coord<2>(0, 0), 5);
+        TS_ASSERT_EQUALS(expected, p.getRegion(0));
+        TS_ASSERT_EQUALS(Region<2>(p[5], p[40]), p.getRegion(1));
+        TS_ASSERT_EQUALS(weights, p.getWeights());
+    }
+
 private:
     CoordVector  expected;
 };
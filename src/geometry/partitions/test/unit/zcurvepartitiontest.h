@@ -171,6 +171,84 @@ public:
         largeTest(Coord<3>(50, 8, 8));
     }
 
+    void testGetRegion()
+    {
+        std::vector<std::size_t> weights2D;
+        weights2D << 100 << 1 << 3000 << 37 << 1862;
+        checkRegions(Coord<2>(10, 20), Coord<2>(50, 100), weights2D);
+        checkRegions(Coord<2>(0, 0), Coord<2>(5000, 1), weights2D);
+
+        std::vector<std::size_t> weights3D;
+        weights3D << 1000 << 7 << 3200 << 20000 << 2793;
+        checkRegions(Coord<3>(1, 2, 3), Coord<3>(30, 31, 29), weights3D);
+        checkRegions(Coord<3>(0, 0, 0), Coord<3>(3, 1000, 9), weights3D);
+    }
+
+    void testSetCosts()
+    {
+        // the lower left quarter is 10 times as costly as the rest:
+        CoordBox<2> box(Coord<2>(10, 20), Coord<2>(64, 64));
+        CostMap<2> costs(box, Coord<2>(8, 8));
+        for (CoordBox<2>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
+            Streak<2> streak = *i;
+            streak.endX = 42;
+            costs.addSample(streak, (streak.origin.y() < 52) ? 320.0 : 32.0);
+            streak.origin.x() = 42;
+            streak.endX = 74;
+            costs.addSample(streak, 32.0);
+        }
+
+        std::vector<std::size_t> weights;
+        weights << 1000 << 1000 << 2000 << 96;
+        ZCurvePartition<2> partition(box.origin, box.dimensions, 0, weights);
+        partition.setCosts(costs);
+
+        double totalCost = 1024 * 10.0 + 3 * 1024 * 1.0;
+        double totalWeight = sum(weights);
+        Region<2> whole;
+
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<2> region = partition.getRegion(i);
+            double cost = 0;
+            for (Region<2>::Iterator j = region.begin(); j != region.end(); ++j) {
+                cost += costs.cost(*j);
+            }
+
+            TS_ASSERT_DELTA(totalCost * weights[i] / totalWeight, cost, 10.0);
+            whole += region;
+        }
+
+        TS_ASSERT_EQUALS(Region<2>() << box, whole);
+        TS_ASSERT_EQUALS(weights, partition.getWeights());
+    }
+
+    template<int DIM>
+    void checkRegions(
+        const Coord<DIM>& origin,
+        const Coord<DIM>& dimensions,
+        std::vector<std::size_t> weights)
+    {
+        // remainder ensures that all cells get assigned:
+        std::size_t remainder = dimensions.prod() - (std::min)(sum(weights), std::size_t(dimensions.prod()));
+        weights << remainder;
+        ZCurvePartition<DIM> partition(origin, dimensions, 0, weights);
+        Region<DIM> whole;
+
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            Region<DIM> expected(partition[start], partition[start + weights[i]]);
+            Region<DIM> actual = partition.getRegion(i);
+            TS_ASSERT_EQUALS(expected, actual);
+
+            whole += actual;
+            start += weights[i];
+        }
+
+        Region<DIM> expectedWhole;
+        expectedWhole << CoordBox<DIM>(origin, dimensions);
+        TS_ASSERT_EQUALS(expectedWhole, whole);
+    }
+
 
 private:
     ZCurvePartition<2> partition;
@@ -6,6 +6,7 @@
 #include <libgeodecomp/geometry/topologies.h>
 #include <libgeodecomp/storage/grid.h>
 
+#include <algorithm>
 #include <bitset>
 #include <boost/shared_ptr.hpp>
 #include <sstream>
@@ -29,6 +30,10 @@ public:
     typedef std::vector<Coord<DIM> > CoordVector;
     typedef Grid<CoordVector, typename Topologies::Cube<DIM>::Topology> CacheType;
     typedef boost::shared_ptr<CacheType> Cache;
+    typedef typename SpaceFillingCurve<DIM>::RunVector RunVector;
+    typedef typename SpaceFillingCurve<DIM>::StreakVector StreakVector;
+    typedef Grid<RunVector, typename Topologies::Cube<DIM>::Topology> RunCacheType;
+    typedef boost::shared_ptr<RunCacheType> RunCache;
     typedef typename Topologies::Cube<DIM>::Topology Topology;
 
     class Square
@@ -283,7 +288,11 @@ public:
         SpaceFillingCurve<DIM>(offset, weights),
         origin(origin),
         dimensions(dimensions)
-    {}
+    {
+        // static members of class templates are only initialized if
+        // they're referenced, so this ensures the caches get filled:
+        (void)cachesInitialized;
+    }
 
     inline Iterator operator[](unsigned i) const
     {
@@ -300,11 +309,27 @@ public:
         return Iterator(origin);
     }
 
+    inline void setCosts(const CostMap<DIM>& costs)
+    {
+        this->cutByCost(begin(), end(), costs);
+    }
+
+    /**
+     * Builds the region from whole streaks instead of walking the
+     * curve cell by cell: squares which lie completely inside the
+     * node's section of the curve are added row-wise, and only the
+     * squares cut by the section's ends are refined further.
+     */
     inline Region<DIM> getRegion(const std::size_t node) const
     {
-        return Region<DIM>(
-            (*this)[startOffsets[node + 0]],
-            (*this)[startOffsets[node + 1]]);
+        StreakVector streaks;
+        collectStreaks(
+            origin,
+            dimensions,
+            startOffsets[node + 0],
+            startOffsets[node + 1],
+            &streaks);
+        return SpaceFillingCurve<DIM>::toRegion(&streaks);
     }
 
     static inline bool fillCaches()
@@ -313,18 +338,21 @@ public:
         // DIM^2 is a trick to keep the cache small if DIM is large.
         Coord<DIM> maxDim = Coord<DIM>::diagonal(68 / DIM / DIM);
         ZCurvePartition<DIM>::coordsCache.reset(
-            Grid<CoordVector, Topologies::Cube<DIM> >(maxDim));
+            new CacheType(maxDim));
+        ZCurvePartition<DIM>::runsCache.reset(
+            new RunCacheType(maxDim));
 
         CoordBox<DIM> box(Coord<DIM>(), maxDim);
         for (typename CoordBox<DIM>::Iterator iter = box.begin(); iter != box.end(); ++iter) {
             Coord<DIM> dim = *iter;
-            if (!hasTrivialDimensions(dim)) {
+            if (!Iterator::hasTrivialDimensions(dim)) {
                 CoordVector coords;
                 Iterator end((Coord<DIM>()));
                 for (Iterator i(Coord<DIM>(), dim, 0); i != end; ++i) {
                     coords.push_back(*i);
                 }
                 (*coordsCache)[dim] = coords;
+                (*runsCache)[dim] = SpaceFillingCurve<DIM>::toRuns(coords);
             }
         }
 
@@ -336,16 +364,80 @@ private:
     using SpaceFillingCurve<DIM>::startOffsets;
 
     static Cache coordsCache;
+    static RunCache runsCache;
     static Coord<DIMENSIONS> maxCachedDimensions;
     static bool cachesInitialized;
 
     Coord<DIM> origin;
     Coord<DIM> dimensions;
+
+    /**
+     * Adds the cells [begin, end) of the square's section of the
+     * curve to streaks. Positions are relative to the square's first
+     * cell and mirror Iterator's traversal.
+     */
+    static inline void collectStreaks(
+        const Coord<DIM>& squareOrigin,
+        const Coord<DIM>& squareDimensions,
+        long begin,
+        long end,
+        StreakVector *streaks)
+    {
+        long size = squareDimensions.prod();
+        begin = (std::max)(begin, 0l);
+        end = (std::min)(end, size);
+        if (begin >= end) {
+            return;
+        }
+
+        if ((begin == 0) && (end == size)) {
+            SpaceFillingCurve<DIM>::addBox(squareOrigin, squareDimensions, streaks);
+            return;
+        }
+
+        if (Iterator::hasTrivialDimensions(squareDimensions)) {
+            SpaceFillingCurve<DIM>::addLine(squareOrigin, squareDimensions, begin, end, streaks);
+            return;
+        }
+
+        bool cached = true;
+        for (int d = 0; d < DIM; ++d) {
+            cached &= squareDimensions[d] < maxCachedDimensions[d];
+        }
+        if (cached) {
+            SpaceFillingCurve<DIM>::addRuns((*runsCache)[squareDimensions], squareOrigin, begin, end, streaks);
+            return;
+        }
+
+        Coord<DIM> halfDimensions = squareDimensions / 2;
+        Coord<DIM> remainingDimensions = squareDimensions - halfDimensions;
+        long quadrantOffset = 0;
+
+        for (int i = 0; i < Iterator::NUM_QUADRANTS; ++i) {
+            if (quadrantOffset >= end) {
+                break;
+            }
+
+            std::bitset<DIM> quadrantShift(i);
+            Coord<DIM> quadrantOrigin = squareOrigin;
+            Coord<DIM> quadrantDim;
+            for (int d = 0; d < DIM; ++d) {
+                quadrantDim[d] = quadrantShift[d]? remainingDimensions[d] : halfDimensions[d];
+                quadrantOrigin[d] += quadrantShift[d]? halfDimensions[d] : 0;
+            }
+
+            collectStreaks(quadrantOrigin, quadrantDim, begin - quadrantOffset, end - quadrantOffset, streaks);
+            quadrantOffset += quadrantDim.prod();
+        }
+    }
 };
 
 template<int DIM>
 typename ZCurvePartition<DIM>::Cache ZCurvePartition<DIM>::coordsCache;
 
+template<int DIM>
+typename ZCurvePartition<DIM>::RunCache ZCurvePartition<DIM>::runsCache;
+
 template<int DIM>
 Coord<DIM> ZCurvePartition<DIM>::maxCachedDimensions;
 
@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_GEOMETRY_REGION_H
 #define LIBGEODECOMP_GEOMETRY_REGION_H
 
+#include <libgeodecomp/config.h>
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/regionstreakiterator.h>
 #include <libgeodecomp/geometry/streak.h>
@@ -8,6 +9,12 @@
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/storage/selector.h>
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
+#include <climits>
+
 namespace LibGeoDecomp {
 
 template<typename CELL_TYPE, int DIM>
@@ -658,27 +665,37 @@ public:
 
     /**
      * Expands the region in each dimension d by radii[d] cells.
+     * Large Regions are cut into chunks along the outermost
+     * dimension which are expanded concurrently.
      */
     inline Region expand(const Coord<DIM>& radii) const
     {
-        using std::swap;
-        Region accumulator;
-        Region buffer;
-
-        // expansion in X dimension is a simple 1-pass operation:
-        for (StreakIterator i = beginStreak(); i != endStreak(); ++i) {
-            Streak<DIM> streak = *i;
-            streak.origin[0] -= radii[0];
-            streak.endX += radii[0];
-            accumulator << streak;
+        std::vector<int> cuts = chunkBoundaries();
+        if (cuts.empty()) {
+            return expandStreaks(beginStreak(), endStreak(), radii);
         }
 
-        // expand into other dimensions, one after another
-        for (int d = 1; d < DIM; ++d) {
-            expandInOneDimension(d, radii[d], accumulator, buffer);
+        int radius = (std::max)(radii[DIM - 1], 0);
+        std::vector<Region> chunks(cuts.size() - 1);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < int(chunks.size()); ++i) {
+            // planes within the chunk may be reached from input
+            // planes up to radius away:
+            Region expanded = expandStreaks(
+                streakIteratorAtCut(cuts, i + 0, -radius),
+                streakIteratorAtCut(cuts, i + 1,  radius),
+                radii);
+
+            StreakIterator end = expanded.streakIteratorAtCut(cuts, i + 1);
+            for (StreakIterator j = expanded.streakIteratorAtCut(cuts, i); j != end; ++j) {
+                chunks[i] << *j;
+            }
         }
 
-        return accumulator;
+        return concatenate(chunks);
     }
 
     /**
@@ -731,7 +748,13 @@ public:
 
     /**
      * does the same as expand, but reads adjacent indices out of
-     * an adjacency list
+     * an adjacency list. Per pass the neighbors of all newly added
+     * indices are gathered into a flat array, sorted and deduplicated
+     * and then loaded as Streaks, which is much cheaper than testing
+     * and inserting them one by one. Gathering is delegated to
+     * Adjacency::gatherNeighbors(), so implementations with a faster
+     * bulk lookup (e.g. CSRAdjacency) are used even if the adjacency
+     * is only known via a reference to its base class.
      */
     template<typename ADJACENCY>
     inline Region expandWithAdjacency(
@@ -742,34 +765,28 @@ public:
         Region<1> ret = *this;
         Region<1> newCoords = *this;
 
-        // neighbors vector is defined outside of the loop to avoid reallocations
+        // defined outside of the loop to avoid reallocations
         std::vector<int> neighbors;
 
-        for (unsigned pass = 0; pass < width; ++pass) {
-            Region add;
-
-            // walk over all indices and remember adjacent neighbors
-            // this is done in a separate pass to ensure that
-            // containers are changed while iterating them.
-            for (RegionStreakIterator<DIM, Region<DIM> > streak = newCoords.beginStreak();
-                 streak != newCoords.endStreak();
-                 ++streak) {
-                for (int x = streak->origin.x(); x < streak->endX; ++x) {
-                    neighbors.clear();
-                    adjacency.getNeighbors(x, &neighbors);
-
-                    for (std::vector<int>::const_iterator i = neighbors.begin(); i != neighbors.end(); ++i) {
-                        Coord<DIM> c(*i);
-                        if (ret.count(c) == 0) {
-                            add << c;
-                        }
-                    }
+        for (unsigned pass = 0; (pass < width) && !newCoords.empty(); ++pass) {
+            neighbors.clear();
+            adjacency.gatherNeighbors(newCoords, &neighbors);
+            sortAndRemoveDuplicates(&neighbors);
+
+            Region<1> add;
+            std::vector<int>::const_iterator i = neighbors.begin();
+            while (i != neighbors.end()) {
+                int origin = *i;
+                int endX = origin + 1;
+                for (++i; (i != neighbors.end()) && (*i == endX); ++i) {
+                    ++endX;
                 }
+
+                add << Streak<1>(Coord<1>(origin), endX);
             }
 
-            ret += add;
-            using std::swap;
-            swap(add, newCoords);
+            newCoords = add - ret;
+            ret += newCoords;
         }
 
         return ret;
@@ -912,62 +929,13 @@ public:
      */
     inline Region operator-(const Region& other) const
     {
-        using std::max;
-        using std::min;
-        Region ret;
-        // these conditionals are less a shortcut but more a guarantee
-        // that the derefernce below will succeed:
-        if (this->empty()) {
-            return ret;
-        }
+        // this is less a shortcut but more a guarantee that the
+        // dereference in subtractStreaks() will succeed:
         if (other.empty()) {
             return *this;
         }
 
-        StreakIterator myIter = beginStreak();
-        StreakIterator otherIter = other.beginStreak();
-
-        StreakIterator myEnd = endStreak();
-        StreakIterator otherEnd = other.endStreak();
-
-        Streak<DIM> cursor = *myIter;
-
-        for (;;) {
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(cursor, *otherIter)) {
-                int intersectionOriginX = max(cursor.origin.x(), otherIter->origin.x());
-                int intersectionEndX = min(cursor.endX, otherIter->endX);
-
-                ret << Streak<DIM>(cursor.origin, intersectionOriginX);
-                cursor.origin.x() = intersectionEndX;
-            }
-
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(cursor, *otherIter)) {
-                ret << cursor;
-                ++myIter;
-
-                if (myIter == myEnd) {
-                    break;
-                } else {
-                    cursor = *myIter;
-                }
-            } else {
-                ++otherIter;
-                if (otherIter == otherEnd) {
-                    break;
-                }
-            }
-        }
-
-        // don't loose the remainder
-        ret << cursor;
-        if (myIter != myEnd) {
-            ++myIter;
-            for (; myIter != myEnd; ++myIter) {
-                ret << *myIter;
-            }
-        }
-
-        return ret;
+        return combine(other, &Region::subtractStreaks);
     }
 
     inline void operator&=(const Region& other)
@@ -981,36 +949,7 @@ public:
      */
     inline Region operator&(const Region& other) const
     {
-        using std::max;
-        using std::min;
-        Region ret;
-        StreakIterator myIter = beginStreak();
-        StreakIterator otherIter = other.beginStreak();
-
-        StreakIterator myEnd = endStreak();
-        StreakIterator otherEnd = other.endStreak();
-
-        for (;;) {
-            if ((myIter == myEnd) ||
-                (otherIter == otherEnd)) {
-                break;
-            }
-
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(*myIter, *otherIter)) {
-                Streak<DIM> intersection = *myIter;
-                intersection.origin.x() = max(myIter->origin.x(), otherIter->origin.x());
-                intersection.endX = min(myIter->endX, otherIter->endX);
-                ret << intersection;
-            }
-
-            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(*myIter, *otherIter)) {
-                ++myIter;
-            } else {
-                ++otherIter;
-            }
-        }
-
-        return ret;
+        return combine(other, &Region::intersectStreaks);
     }
 
     inline void operator+=(const Region& other)
@@ -1078,14 +1017,7 @@ public:
         }
 
         // else: normal merge
-        Region ret;
-
-        merge2way(
-            ret,
-            this->beginStreak(), this->endStreak(),
-            other.beginStreak(), other.endStreak());
-
-        return ret;
+        return combine(other, &Region::merge2way);
     }
 
     inline std::vector<Streak<DIM> > toVector() const
@@ -1340,6 +1272,315 @@ private:
     mutable std::size_t mySize;
     mutable bool geometryCacheTainted;
 
+    /**
+     * Signature of the streak-wise set operations below. These
+     * operate on ranges so they can be applied to chunks of Regions.
+     */
+    typedef void (*StreakOperation)(
+        Region& ret,
+        const StreakIterator& beginA, const StreakIterator& endA,
+        const StreakIterator& beginB, const StreakIterator& endB);
+
+    /**
+     * Minimum number of elements per chunk worth a thread of its own
+     * when sorting.
+     */
+    static const std::size_t MIN_ELEMENTS_PER_SORT_CHUNK = 1 << 16;
+
+    /**
+     * Sorts the IDs and removes duplicates. Large arrays are sorted
+     * chunk-wise in parallel, followed by a tree of parallel merges.
+     */
+    static inline void sortAndRemoveDuplicates(std::vector<int> *ids)
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        std::size_t chunks = (std::min)(
+            std::size_t(omp_get_max_threads()),
+            ids->size() / MIN_ELEMENTS_PER_SORT_CHUNK);
+
+        if ((chunks > 1) && !omp_in_parallel()) {
+            std::vector<std::vector<int>::iterator> cuts;
+            for (std::size_t i = 0; i <= chunks; ++i) {
+                cuts << ids->begin() + ids->size() * i / chunks;
+            }
+
+#pragma omp parallel for schedule(static, 1)
+            for (int i = 0; i < int(chunks); ++i) {
+                std::sort(cuts[i], cuts[i + 1]);
+            }
+
+            for (std::size_t stride = 1; stride < chunks; stride *= 2) {
+#pragma omp parallel for schedule(static, 1)
+                for (int i = 0; i < int(chunks - stride); i += int(2 * stride)) {
+                    std::inplace_merge(
+                        cuts[i],
+                        cuts[i + stride],
+                        cuts[(std::min)(i + 2 * stride, chunks)]);
+                }
+            }
+        } else {
+            std::sort(ids->begin(), ids->end());
+        }
+#else
+        std::sort(ids->begin(), ids->end());
+#endif
+
+        ids->erase(std::unique(ids->begin(), ids->end()), ids->end());
+    }
+
+    /**
+     * Minimum number of Streaks per chunk worth a thread of its own.
+     */
+    static const std::size_t MIN_STREAKS_PER_CHUNK = 4096;
+
+    /**
+     * Yields the coordinates along the outermost dimension at which
+     * this Region should be cut into chunks for multi-threaded
+     * processing. Chunk i comprises all Streaks whose outermost
+     * coordinate c satisfies cuts[i] <= c < cuts[i + 1]. An empty
+     * vector means the Region should be processed in one go: either
+     * it's too small, we're lacking threads, or we're already
+     * running within a parallel section.
+     */
+    inline std::vector<int> chunkBoundaries() const
+    {
+        std::vector<int> ret;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        if ((DIM < 2) || (numStreaks() < (2 * MIN_STREAKS_PER_CHUNK)) || omp_in_parallel()) {
+            return ret;
+        }
+
+        std::size_t threads = omp_get_max_threads();
+        if (threads < 2) {
+            return ret;
+        }
+
+        // a couple of chunks per thread will even out the load:
+        std::size_t chunks = (std::min)(4 * threads, numStreaks() / MIN_STREAKS_PER_CHUNK);
+        chunks = (std::min)(chunks, numPlanes());
+
+        ret << INT_MIN;
+        for (std::size_t i = 1; i < chunks; ++i) {
+            int cut = indices[DIM - 1][i * numPlanes() / chunks].first;
+            if (cut > ret.back()) {
+                ret << cut;
+            }
+        }
+        ret << INT_MAX;
+
+        if (ret.size() < 3) {
+            ret.clear();
+        }
+#endif
+
+        return ret;
+    }
+
+    /**
+     * Returns an iterator to the first Streak whose outermost
+     * coordinate is equal to or greater than cuts[index] + offset.
+     * The first and last cut act as sentinels.
+     */
+    inline StreakIterator streakIteratorAtCut(
+        const std::vector<int>& cuts,
+        std::size_t index,
+        int offset = 0) const
+    {
+        if (index == 0) {
+            return beginStreak();
+        }
+        if (index == (cuts.size() - 1)) {
+            return endStreak();
+        }
+
+        IndexVectorType::const_iterator plane = std::lower_bound(
+            indices[DIM - 1].begin(),
+            indices[DIM - 1].end(),
+            IntPair(cuts[index] + offset, 0),
+            RegionHelpers::RegionCommonHelper::pairCompareFirst);
+
+        return planeStreakIterator(plane - indices[DIM - 1].begin());
+    }
+
+    /**
+     * Applies op to this and other, chunk by chunk if the larger
+     * Region is big enough.
+     */
+    inline Region combine(const Region& other, StreakOperation op) const
+    {
+        const Region& larger = (numStreaks() >= other.numStreaks()) ? *this : other;
+        std::vector<int> cuts = larger.chunkBoundaries();
+
+        if (cuts.empty()) {
+            Region ret;
+            op(ret, beginStreak(), endStreak(), other.beginStreak(), other.endStreak());
+            return ret;
+        }
+
+        std::vector<Region> chunks(cuts.size() - 1);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < int(chunks.size()); ++i) {
+            op(chunks[i],
+               streakIteratorAtCut(cuts, i + 0),
+               streakIteratorAtCut(cuts, i + 1),
+               other.streakIteratorAtCut(cuts, i + 0),
+               other.streakIteratorAtCut(cuts, i + 1));
+        }
+
+        return concatenate(chunks);
+    }
+
+    /**
+     * Splices Regions together whose outermost coordinates are
+     * disjoint and ascending. Instead of inserting each Streak, the
+     * index vectors are appended with their offsets adjusted.
+     */
+    static inline Region concatenate(const std::vector<Region>& chunks)
+    {
+        Region ret;
+
+        for (int d = 0; d < DIM; ++d) {
+            std::size_t size = 0;
+            for (typename std::vector<Region>::const_iterator i = chunks.begin(); i != chunks.end(); ++i) {
+                size += i->indices[d].size();
+            }
+            ret.indices[d].reserve(size);
+        }
+
+        for (typename std::vector<Region>::const_iterator i = chunks.begin(); i != chunks.end(); ++i) {
+            for (int d = DIM - 1; d > 0; --d) {
+                int offset = ret.indices[d - 1].size();
+
+                for (IndexVectorType::const_iterator j = i->indices[d].begin(); j != i->indices[d].end(); ++j) {
+                    ret.indices[d] << IntPair(j->first, j->second + offset);
+                }
+            }
+
+            ret.indices[0].insert(ret.indices[0].end(), i->indices[0].begin(), i->indices[0].end());
+        }
+
+        ret.geometryCacheTainted = true;
+        return ret;
+    }
+
+    static inline Region expandStreaks(
+        const StreakIterator& begin,
+        const StreakIterator& end,
+        const Coord<DIM>& radii)
+    {
+        Region accumulator;
+        Region buffer;
+
+        // expansion in X dimension is a simple 1-pass operation:
+        for (StreakIterator i = begin; i != end; ++i) {
+            Streak<DIM> streak = *i;
+            streak.origin[0] -= radii[0];
+            streak.endX += radii[0];
+            accumulator << streak;
+        }
+
+        // expand into other dimensions, one after another
+        for (int d = 1; d < DIM; ++d) {
+            expandInOneDimension(d, radii[d], accumulator, buffer);
+        }
+
+        return accumulator;
+    }
+
+    static inline void subtractStreaks(
+        Region& ret,
+        const StreakIterator& beginA, const StreakIterator& endA,
+        const StreakIterator& beginB, const StreakIterator& endB)
+    {
+        using std::max;
+        using std::min;
+
+        if (beginA == endA) {
+            return;
+        }
+        if (beginB == endB) {
+            for (StreakIterator i = beginA; i != endA; ++i) {
+                ret << *i;
+            }
+            return;
+        }
+
+        StreakIterator myIter = beginA;
+        StreakIterator otherIter = beginB;
+
+        Streak<DIM> cursor = *myIter;
+
+        for (;;) {
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(cursor, *otherIter)) {
+                int intersectionOriginX = max(cursor.origin.x(), otherIter->origin.x());
+                int intersectionEndX = min(cursor.endX, otherIter->endX);
+
+                ret << Streak<DIM>(cursor.origin, intersectionOriginX);
+                cursor.origin.x() = intersectionEndX;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(cursor, *otherIter)) {
+                ret << cursor;
+                ++myIter;
+
+                if (myIter == endA) {
+                    break;
+                } else {
+                    cursor = *myIter;
+                }
+            } else {
+                ++otherIter;
+                if (otherIter == endB) {
+                    break;
+                }
+            }
+        }
+
+        // don't loose the remainder
+        ret << cursor;
+        if (myIter != endA) {
+            ++myIter;
+            for (; myIter != endA; ++myIter) {
+                ret << *myIter;
+            }
+        }
+    }
+
+    static inline void intersectStreaks(
+        Region& ret,
+        const StreakIterator& beginA, const StreakIterator& endA,
+        const StreakIterator& beginB, const StreakIterator& endB)
+    {
+        using std::max;
+        using std::min;
+        StreakIterator myIter = beginA;
+        StreakIterator otherIter = beginB;
+
+        for (;;) {
+            if ((myIter == endA) ||
+                (otherIter == endB)) {
+                break;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::intersects(*myIter, *otherIter)) {
+                Streak<DIM> intersection = *myIter;
+                intersection.origin.x() = max(myIter->origin.x(), otherIter->origin.x());
+                intersection.endX = min(myIter->endX, otherIter->endX);
+                ret << intersection;
+            }
+
+            if (RegionHelpers::RegionIntersectHelper<DIM - 1>::lessThan(*myIter, *otherIter)) {
+                ++myIter;
+            } else {
+                ++otherIter;
+            }
+        }
+    }
+
 #define LIBGEODECOMP_REGION_ADVANCE_ITERATOR(ITERATOR, END)     \
             if (*ITERATOR != lastInsert) {         \
                 ret << *ITERATOR;                  \
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BoundingBoxIndexTest_init = false;
+#include "/root/repo/src/geometry/test/unit/boundingboxindextest.h"
+
+static BoundingBoxIndexTest suite_BoundingBoxIndexTest;
+
+static CxxTest::List Tests_BoundingBoxIndexTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BoundingBoxIndexTest( "/root/repo/src/geometry/test/unit/boundingboxindextest.h", 11, "BoundingBoxIndexTest", suite_BoundingBoxIndexTest, Tests_BoundingBoxIndexTest );
+
+static class TestDescription_suite_BoundingBoxIndexTest_testEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoundingBoxIndexTest_testEmpty() : CxxTest::RealTestDescription( Tests_BoundingBoxIndexTest, suiteDescription_BoundingBoxIndexTest, 14, "testEmpty" ) {}
+ void runTest() { suite_BoundingBoxIndexTest.testEmpty(); }
+} testDescription_suite_BoundingBoxIndexTest_testEmpty;
+
+static class TestDescription_suite_BoundingBoxIndexTest_testSimple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoundingBoxIndexTest_testSimple() : CxxTest::RealTestDescription( Tests_BoundingBoxIndexTest, suiteDescription_BoundingBoxIndexTest, 20, "testSimple" ) {}
+ void runTest() { suite_BoundingBoxIndexTest.testSimple(); }
+} testDescription_suite_BoundingBoxIndexTest_testSimple;
+
+static class TestDescription_suite_BoundingBoxIndexTest_testAgainstBruteForce : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoundingBoxIndexTest_testAgainstBruteForce() : CxxTest::RealTestDescription( Tests_BoundingBoxIndexTest, suiteDescription_BoundingBoxIndexTest, 43, "testAgainstBruteForce" ) {}
+ void runTest() { suite_BoundingBoxIndexTest.testAgainstBruteForce(); }
+} testDescription_suite_BoundingBoxIndexTest_testAgainstBruteForce;
+
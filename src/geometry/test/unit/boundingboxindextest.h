@@ -0,0 +1,74 @@
+#include <libgeodecomp/geometry/boundingboxindex.h>
+#include <libgeodecomp/misc/random.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class BoundingBoxIndexTest : public CxxTest::TestSuite
+{
+public:
+    void testEmpty()
+    {
+        BoundingBoxIndex<2> index;
+        TS_ASSERT(index.query(CoordBox<2>(Coord<2>(0, 0), Coord<2>(10, 10))).empty());
+    }
+
+    void testSimple()
+    {
+        std::vector<CoordBox<2> > boxes;
+        boxes << CoordBox<2>(Coord<2>( 0,  0), Coord<2>(10, 10))
+              << CoordBox<2>(Coord<2>(10,  0), Coord<2>(10, 10))
+              << CoordBox<2>(Coord<2>( 5,  5), Coord<2>( 0,  0))
+              << CoordBox<2>(Coord<2>( 0, 10), Coord<2>(20, 10));
+        BoundingBoxIndex<2> index(boxes);
+
+        std::vector<std::size_t> expected;
+        expected << 0 << 1;
+        TS_ASSERT_EQUALS(expected, index.query(CoordBox<2>(Coord<2>(9, 0), Coord<2>(2, 10))));
+
+        expected.clear();
+        expected << 1 << 3;
+        TS_ASSERT_EQUALS(expected, index.query(CoordBox<2>(Coord<2>(15, 9), Coord<2>(1, 2))));
+
+        // empty boxes never intersect:
+        expected.clear();
+        expected << 0;
+        TS_ASSERT_EQUALS(expected, index.query(CoordBox<2>(Coord<2>(5, 5), Coord<2>(1, 1))));
+    }
+
+    void testAgainstBruteForce()
+    {
+        std::vector<CoordBox<3> > boxes;
+        for (int i = 0; i < 1000; ++i) {
+            boxes << randomBox();
+        }
+        BoundingBoxIndex<3> index(boxes);
+
+        for (int i = 0; i < 200; ++i) {
+            CoordBox<3> query = randomBox();
+
+            std::vector<std::size_t> expected;
+            for (std::size_t j = 0; j < boxes.size(); ++j) {
+                if (boxes[j].intersects(query)) {
+                    expected << j;
+                }
+            }
+
+            TS_ASSERT_EQUALS(expected, index.query(query));
+        }
+    }
+
+private:
+    CoordBox<3> randomBox()
+    {
+        Coord<3> origin(Random::gen_u(200), Random::gen_u(200), Random::gen_u(200));
+        Coord<3> dimensions(Random::gen_u(30), Random::gen_u(30), Random::gen_u(30));
+        return CoordBox<3>(origin, dimensions);
+    }
+};
+
+}
@@ -0,0 +1,104 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CoordBoxTest_init = false;
+#include "/root/repo/src/geometry/test/unit/coordboxtest.h"
+
+static CoordBoxTest suite_CoordBoxTest;
+
+static CxxTest::List Tests_CoordBoxTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CoordBoxTest( "/root/repo/src/geometry/test/unit/coordboxtest.h", 12, "CoordBoxTest", suite_CoordBoxTest, Tests_CoordBoxTest );
+
+static class TestDescription_suite_CoordBoxTest_testConstructor1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testConstructor1() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 23, "testConstructor1" ) {}
+ void runTest() { suite_CoordBoxTest.testConstructor1(); }
+} testDescription_suite_CoordBoxTest_testConstructor1;
+
+static class TestDescription_suite_CoordBoxTest_testConstructor2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testConstructor2() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 30, "testConstructor2" ) {}
+ void runTest() { suite_CoordBoxTest.testConstructor2(); }
+} testDescription_suite_CoordBoxTest_testConstructor2;
+
+static class TestDescription_suite_CoordBoxTest_testInBounds : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testInBounds() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 38, "testInBounds" ) {}
+ void runTest() { suite_CoordBoxTest.testInBounds(); }
+} testDescription_suite_CoordBoxTest_testInBounds;
+
+static class TestDescription_suite_CoordBoxTest_testSize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testSize() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 65, "testSize" ) {}
+ void runTest() { suite_CoordBoxTest.testSize(); }
+} testDescription_suite_CoordBoxTest_testSize;
+
+static class TestDescription_suite_CoordBoxTest_testIntersects : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIntersects() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 74, "testIntersects" ) {}
+ void runTest() { suite_CoordBoxTest.testIntersects(); }
+} testDescription_suite_CoordBoxTest_testIntersects;
+
+static class TestDescription_suite_CoordBoxTest_testIterator1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIterator1D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 101, "testIterator1D" ) {}
+ void runTest() { suite_CoordBoxTest.testIterator1D(); }
+} testDescription_suite_CoordBoxTest_testIterator1D;
+
+static class TestDescription_suite_CoordBoxTest_testIterator2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIterator2D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 117, "testIterator2D" ) {}
+ void runTest() { suite_CoordBoxTest.testIterator2D(); }
+} testDescription_suite_CoordBoxTest_testIterator2D;
+
+static class TestDescription_suite_CoordBoxTest_testIterator3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testIterator3D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 137, "testIterator3D" ) {}
+ void runTest() { suite_CoordBoxTest.testIterator3D(); }
+} testDescription_suite_CoordBoxTest_testIterator3D;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator1D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator1D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 159, "testStreakIterator1D" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator1D(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator1D;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator2D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 175, "testStreakIterator2D" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator2D(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator2D;
+
+static class TestDescription_suite_CoordBoxTest_testStreakIterator3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testStreakIterator3D() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 193, "testStreakIterator3D" ) {}
+ void runTest() { suite_CoordBoxTest.testStreakIterator3D(); }
+} testDescription_suite_CoordBoxTest_testStreakIterator3D;
+
+static class TestDescription_suite_CoordBoxTest_testEmptyIteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordBoxTest_testEmptyIteration() : CxxTest::RealTestDescription( Tests_CoordBoxTest, suiteDescription_CoordBoxTest, 213, "testEmptyIteration" ) {}
+ void runTest() { suite_CoordBoxTest.testEmptyIteration(); }
+} testDescription_suite_CoordBoxTest_testEmptyIteration;
+
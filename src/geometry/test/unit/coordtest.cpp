@@ -0,0 +1,200 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CoordTest_init = false;
+#include "/root/repo/src/geometry/test/unit/coordtest.h"
+
+static CoordTest suite_CoordTest;
+
+static CxxTest::List Tests_CoordTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CoordTest( "/root/repo/src/geometry/test/unit/coordtest.h", 23, "CoordTest", suite_CoordTest, Tests_CoordTest );
+
+static class TestDescription_suite_CoordTest_testDefaultConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testDefaultConstructor() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 46, "testDefaultConstructor" ) {}
+ void runTest() { suite_CoordTest.testDefaultConstructor(); }
+} testDescription_suite_CoordTest_testDefaultConstructor;
+
+static class TestDescription_suite_CoordTest_testConstructFromFixedCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testConstructFromFixedCoord() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 53, "testConstructFromFixedCoord" ) {}
+ void runTest() { suite_CoordTest.testConstructFromFixedCoord(); }
+} testDescription_suite_CoordTest_testConstructFromFixedCoord;
+
+static class TestDescription_suite_CoordTest_testEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testEqual() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 61, "testEqual" ) {}
+ void runTest() { suite_CoordTest.testEqual(); }
+} testDescription_suite_CoordTest_testEqual;
+
+static class TestDescription_suite_CoordTest_testNotEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testNotEqual() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 84, "testNotEqual" ) {}
+ void runTest() { suite_CoordTest.testNotEqual(); }
+} testDescription_suite_CoordTest_testNotEqual;
+
+static class TestDescription_suite_CoordTest_testAdd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testAdd() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 94, "testAdd" ) {}
+ void runTest() { suite_CoordTest.testAdd(); }
+} testDescription_suite_CoordTest_testAdd;
+
+static class TestDescription_suite_CoordTest_testScale : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testScale() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 113, "testScale" ) {}
+ void runTest() { suite_CoordTest.testScale(); }
+} testDescription_suite_CoordTest_testScale;
+
+static class TestDescription_suite_CoordTest_testScaleWithCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testScaleWithCoord() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 135, "testScaleWithCoord" ) {}
+ void runTest() { suite_CoordTest.testScaleWithCoord(); }
+} testDescription_suite_CoordTest_testScaleWithCoord;
+
+static class TestDescription_suite_CoordTest_testBinaryMinus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testBinaryMinus() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 148, "testBinaryMinus" ) {}
+ void runTest() { suite_CoordTest.testBinaryMinus(); }
+} testDescription_suite_CoordTest_testBinaryMinus;
+
+static class TestDescription_suite_CoordTest_testUnaryMinus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testUnaryMinus() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 155, "testUnaryMinus" ) {}
+ void runTest() { suite_CoordTest.testUnaryMinus(); }
+} testDescription_suite_CoordTest_testUnaryMinus;
+
+static class TestDescription_suite_CoordTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_test3D() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 161, "test3D" ) {}
+ void runTest() { suite_CoordTest.test3D(); }
+} testDescription_suite_CoordTest_test3D;
+
+static class TestDescription_suite_CoordTest_testLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testLess() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 191, "testLess" ) {}
+ void runTest() { suite_CoordTest.testLess(); }
+} testDescription_suite_CoordTest_testLess;
+
+static class TestDescription_suite_CoordTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testToString() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 201, "testToString" ) {}
+ void runTest() { suite_CoordTest.testToString(); }
+} testDescription_suite_CoordTest_testToString;
+
+static class TestDescription_suite_CoordTest_testOperatorLessLess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testOperatorLessLess() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 207, "testOperatorLessLess" ) {}
+ void runTest() { suite_CoordTest.testOperatorLessLess(); }
+} testDescription_suite_CoordTest_testOperatorLessLess;
+
+static class TestDescription_suite_CoordTest_testElement : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testElement() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 215, "testElement" ) {}
+ void runTest() { suite_CoordTest.testElement(); }
+} testDescription_suite_CoordTest_testElement;
+
+static class TestDescription_suite_CoordTest_testCoordDiagonal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testCoordDiagonal() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 230, "testCoordDiagonal" ) {}
+ void runTest() { suite_CoordTest.testCoordDiagonal(); }
+} testDescription_suite_CoordTest_testCoordDiagonal;
+
+static class TestDescription_suite_CoordTest_testIndexToCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testIndexToCoord() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 237, "testIndexToCoord" ) {}
+ void runTest() { suite_CoordTest.testIndexToCoord(); }
+} testDescription_suite_CoordTest_testIndexToCoord;
+
+static class TestDescription_suite_CoordTest_testToIndex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testToIndex() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 244, "testToIndex" ) {}
+ void runTest() { suite_CoordTest.testToIndex(); }
+} testDescription_suite_CoordTest_testToIndex;
+
+static class TestDescription_suite_CoordTest_testProd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testProd() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 257, "testProd" ) {}
+ void runTest() { suite_CoordTest.testProd(); }
+} testDescription_suite_CoordTest_testProd;
+
+static class TestDescription_suite_CoordTest_testMax : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testMax() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 266, "testMax" ) {}
+ void runTest() { suite_CoordTest.testMax(); }
+} testDescription_suite_CoordTest_testMax;
+
+static class TestDescription_suite_CoordTest_testMin : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testMin() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 278, "testMin" ) {}
+ void runTest() { suite_CoordTest.testMin(); }
+} testDescription_suite_CoordTest_testMin;
+
+static class TestDescription_suite_CoordTest_testMaxElement : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testMaxElement() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 290, "testMaxElement" ) {}
+ void runTest() { suite_CoordTest.testMaxElement(); }
+} testDescription_suite_CoordTest_testMaxElement;
+
+static class TestDescription_suite_CoordTest_testMinElement : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testMinElement() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 303, "testMinElement" ) {}
+ void runTest() { suite_CoordTest.testMinElement(); }
+} testDescription_suite_CoordTest_testMinElement;
+
+static class TestDescription_suite_CoordTest_testAbs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testAbs() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 316, "testAbs" ) {}
+ void runTest() { suite_CoordTest.testAbs(); }
+} testDescription_suite_CoordTest_testAbs;
+
+static class TestDescription_suite_CoordTest_testSum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testSum() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 336, "testSum" ) {}
+ void runTest() { suite_CoordTest.testSum(); }
+} testDescription_suite_CoordTest_testSum;
+
+static class TestDescription_suite_CoordTest_testMult : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testMult() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 343, "testMult" ) {}
+ void runTest() { suite_CoordTest.testMult(); }
+} testDescription_suite_CoordTest_testMult;
+
+static class TestDescription_suite_CoordTest_testSerializationWithHPX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testSerializationWithHPX() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 350, "testSerializationWithHPX" ) {}
+ void runTest() { suite_CoordTest.testSerializationWithHPX(); }
+} testDescription_suite_CoordTest_testSerializationWithHPX;
+
+static class TestDescription_suite_CoordTest_testSerializationWithBoostSerialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testSerializationWithBoostSerialization() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 369, "testSerializationWithBoostSerialization" ) {}
+ void runTest() { suite_CoordTest.testSerializationWithBoostSerialization(); }
+} testDescription_suite_CoordTest_testSerializationWithBoostSerialization;
+
+static class TestDescription_suite_CoordTest_testDim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CoordTest_testDim() : CxxTest::RealTestDescription( Tests_CoordTest, suiteDescription_CoordTest, 389, "testDim" ) {}
+ void runTest() { suite_CoordTest.testDim(); }
+} testDescription_suite_CoordTest_testDim;
+
@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CostMapTest_init = false;
+#include "/root/repo/src/geometry/test/unit/costmaptest.h"
+
+static CostMapTest suite_CostMapTest;
+
+static CxxTest::List Tests_CostMapTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CostMapTest( "/root/repo/src/geometry/test/unit/costmaptest.h", 10, "CostMapTest", suite_CostMapTest, Tests_CostMapTest );
+
+static class TestDescription_suite_CostMapTest_testAddSample : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testAddSample() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 13, "testAddSample" ) {}
+ void runTest() { suite_CostMapTest.testAddSample(); }
+} testDescription_suite_CostMapTest_testAddSample;
+
+static class TestDescription_suite_CostMapTest_testCost : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testCost() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 42, "testCost" ) {}
+ void runTest() { suite_CostMapTest.testCost(); }
+} testDescription_suite_CostMapTest_testCost;
+
+static class TestDescription_suite_CostMapTest_testMerge : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CostMapTest_testMerge() : CxxTest::RealTestDescription( Tests_CostMapTest, suiteDescription_CostMapTest, 66, "testMerge" ) {}
+ void runTest() { suite_CostMapTest.testMerge(); }
+} testDescription_suite_CostMapTest_testMerge;
+
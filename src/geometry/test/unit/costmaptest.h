@@ -0,0 +1,90 @@
+#include <libgeodecomp/geometry/costmap.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CostMapTest : public CxxTest::TestSuite
+{
+public:
+    void testAddSample()
+    {
+        CostMap<2> map(CoordBox<2>(Coord<2>(10, 20), Coord<2>(30, 10)), Coord<2>(8, 4));
+        TS_ASSERT(map.empty());
+        TS_ASSERT_EQUALS(std::size_t(4 * 3), map.seconds().size());
+
+        // spans blocks 0 and 1 of the first row of blocks:
+        map.addSample(Streak<2>(Coord<2>(14, 21), 22), 8.0);
+        TS_ASSERT(!map.empty());
+        TS_ASSERT_EQUALS(4.0, map.seconds()[0]);
+        TS_ASSERT_EQUALS(4.0, map.cells()[0]);
+        TS_ASSERT_EQUALS(4.0, map.seconds()[1]);
+        TS_ASSERT_EQUALS(4.0, map.cells()[1]);
+
+        // clipped to the box, spans blocks 10 and 11:
+        map.addSample(Streak<2>(Coord<2>(30, 29), 50), 10.0);
+        TS_ASSERT_EQUALS(2.0, map.seconds()[10]);
+        TS_ASSERT_EQUALS(4.0, map.cells()[10]);
+        TS_ASSERT_EQUALS(3.0, map.seconds()[11]);
+        TS_ASSERT_EQUALS(6.0, map.cells()[11]);
+
+        // outside:
+        map.addSample(Streak<2>(Coord<2>(10, 19), 20), 10.0);
+        map.addSample(Streak<2>(Coord<2>(10, 30), 20), 10.0);
+        map.addSample(Streak<2>(Coord<2>(40, 25), 45), 10.0);
+        TS_ASSERT_EQUALS(13.0, sum(map.seconds()));
+        TS_ASSERT_EQUALS(18.0, sum(map.cells()));
+    }
+
+    void testCost()
+    {
+        CostMap<2> map(CoordBox<2>(Coord<2>(0, 0), Coord<2>(20, 20)), Coord<2>(10, 10));
+        TS_ASSERT_EQUALS(1.0, map.cost(Coord<2>(5, 5)));
+
+        map.addSample(Streak<2>(Coord<2>(0, 0), 10), 5.0);
+        map.addSample(Streak<2>(Coord<2>(0, 1), 10), 1.0);
+        map.addSample(Streak<2>(Coord<2>(10, 10), 20), 0.2);
+
+        TS_ASSERT_DELTA(0.3,  map.cost(Coord<2>(9, 9)),   1e-12);
+        TS_ASSERT_DELTA(0.02, map.cost(Coord<2>(10, 10)), 1e-12);
+        // no samples, hence average:
+        TS_ASSERT_DELTA(6.2 / 30, map.cost(Coord<2>(15, 0)), 1e-12);
+        // outside, hence nearest block:
+        TS_ASSERT_DELTA(0.02, map.cost(Coord<2>(100, 100)), 1e-12);
+
+        std::vector<double> costs = map.blockCosts();
+        TS_ASSERT_EQUALS(std::size_t(4), costs.size());
+        TS_ASSERT_DELTA(0.3,      costs[0], 1e-12);
+        TS_ASSERT_DELTA(6.2 / 30, costs[1], 1e-12);
+        TS_ASSERT_DELTA(6.2 / 30, costs[2], 1e-12);
+        TS_ASSERT_DELTA(0.02,     costs[3], 1e-12);
+    }
+
+    void testMerge()
+    {
+        CoordBox<3> box(Coord<3>(0, 0, 0), Coord<3>(20, 20, 20));
+        CostMap<3> mapA(box);
+        CostMap<3> mapB(box);
+        TS_ASSERT_EQUALS(CostMap<3>::defaultBlockDimensions(), mapA.getBlockDimensions());
+
+        mapA.addSample(Streak<3>(Coord<3>(0, 0, 0), 10), 1.0);
+        mapB.addSample(Streak<3>(Coord<3>(0, 0, 0), 10), 3.0);
+        mapA += mapB;
+        TS_ASSERT_EQUALS(4.0,  mapA.seconds()[0]);
+        TS_ASSERT_EQUALS(20.0, mapA.cells()[0]);
+        TS_ASSERT_DELTA(0.2, mapA.cost(Coord<3>(1, 2, 3)), 1e-12);
+
+        CostMap<3> mapC(box, box.dimensions, std::vector<double>(1, 1.0), std::vector<double>(1, 1.0));
+        TS_ASSERT_THROWS(mapA += mapC, std::invalid_argument&);
+        TS_ASSERT_THROWS(CostMap<3>(box, Coord<3>(20, 20, 10), mapA.seconds(), mapA.cells()), std::invalid_argument&);
+
+        mapA.clear();
+        TS_ASSERT(mapA.empty());
+        TS_ASSERT_EQUALS(1.0, mapA.cost(Coord<3>(1, 2, 3)));
+    }
+};
+
+}
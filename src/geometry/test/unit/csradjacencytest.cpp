@@ -0,0 +1,45 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CSRAdjacencyTest_init = false;
+#include "/root/repo/src/geometry/test/unit/csradjacencytest.h"
+
+static CSRAdjacencyTest suite_CSRAdjacencyTest;
+
+static CxxTest::List Tests_CSRAdjacencyTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CSRAdjacencyTest( "/root/repo/src/geometry/test/unit/csradjacencytest.h", 10, "CSRAdjacencyTest", suite_CSRAdjacencyTest, Tests_CSRAdjacencyTest );
+
+static class TestDescription_suite_CSRAdjacencyTest_testInsertAndGetNeighbors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRAdjacencyTest_testInsertAndGetNeighbors() : CxxTest::RealTestDescription( Tests_CSRAdjacencyTest, suiteDescription_CSRAdjacencyTest, 13, "testInsertAndGetNeighbors" ) {}
+ void runTest() { suite_CSRAdjacencyTest.testInsertAndGetNeighbors(); }
+} testDescription_suite_CSRAdjacencyTest_testInsertAndGetNeighbors;
+
+static class TestDescription_suite_CSRAdjacencyTest_testFromMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRAdjacencyTest_testFromMatrix() : CxxTest::RealTestDescription( Tests_CSRAdjacencyTest, suiteDescription_CSRAdjacencyTest, 59, "testFromMatrix" ) {}
+ void runTest() { suite_CSRAdjacencyTest.testFromMatrix(); }
+} testDescription_suite_CSRAdjacencyTest_testFromMatrix;
+
@@ -0,0 +1,87 @@
+#include <libgeodecomp/geometry/csradjacency.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CSRAdjacencyTest : public CxxTest::TestSuite
+{
+public:
+    void testInsertAndGetNeighbors()
+    {
+        CSRAdjacency adjacency;
+        adjacency.insert(0, 2);
+        adjacency.insert(0, 6);
+        adjacency.insert(0, 4);
+        adjacency.insert(5, 3);
+        adjacency.insert(5, 1);
+        adjacency.insert(3, 9);
+        adjacency.insert(3, 0);
+        adjacency.insert(5, 3);
+
+        TS_ASSERT_EQUALS(std::size_t(7), adjacency.size());
+        TS_ASSERT_EQUALS(6, adjacency.numNodes());
+
+        std::vector<int> expected;
+        std::vector<int> actual;
+        expected << 2 << 4 << 6;
+        adjacency.getNeighbors(0, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+
+        expected.clear();
+        actual.clear();
+        adjacency.getNeighbors(1, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+        adjacency.getNeighbors(-1, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+        adjacency.getNeighbors(4711, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+
+        expected << 0 << 9;
+        adjacency.getNeighbors(3, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+
+        // getNeighbors() appends:
+        expected << 1 << 3;
+        adjacency.getNeighbors(5, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+
+        std::vector<int> expectedOffsets;
+        expectedOffsets << 0 << 3 << 3 << 3 << 5 << 5 << 7;
+        TS_ASSERT_EQUALS(expectedOffsets, adjacency.rowOffsets());
+
+        TS_ASSERT_THROWS(adjacency.insert(-1, 0), std::out_of_range&);
+    }
+
+    void testFromMatrix()
+    {
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> values;
+        rows    << 2 << 0 << 2 << 1;
+        columns << 3 << 1 << 0 << 2;
+        values  << 1 << 2 << 3 << 4;
+
+        CSRAdjacency adjacency(CSRMatrix<double>::fromCOO(4, 4, rows, columns, values));
+        TS_ASSERT_EQUALS(4, adjacency.numNodes());
+        TS_ASSERT_EQUALS(std::size_t(4), adjacency.size());
+
+        std::vector<int> expected;
+        std::vector<int> actual;
+        expected << 0 << 3;
+        adjacency.getNeighbors(2, &actual);
+        TS_ASSERT_EQUALS(expected, actual);
+
+        rows << 2;
+        columns << 3;
+        values << 5;
+        TS_ASSERT_THROWS(
+            CSRAdjacency(CSRMatrix<double>::fromCOO(4, 4, rows, columns, values)),
+            std::invalid_argument&);
+    }
+};
+
+}
@@ -1,6 +1,8 @@
+#include <libgeodecomp/geometry/csradjacency.h>
 #include <libgeodecomp/geometry/partitionmanager.h>
 #include <libgeodecomp/geometry/partitions/recursivebisectionpartition.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
+#include <libgeodecomp/geometry/partitions/unstructuredstripingpartition.h>
 
 #include <boost/assign/std/vector.hpp>
 
@@ -9,6 +11,42 @@ using namespace LibGeoDecomp;
 
 namespace LibGeoDecomp {
 
+/**
+ * Counts per-node lookups, which Region::expandWithAdjacency()
+ * should avoid for CSRAdjacency.
+ */
+class CountingCSRAdjacency : public CSRAdjacency
+{
+public:
+    CountingCSRAdjacency() :
+        lookups(0)
+    {}
+
+    void getNeighbors(int node, std::vector<int> *neighbors) const
+    {
+        ++lookups;
+        CSRAdjacency::getNeighbors(node, neighbors);
+    }
+
+    mutable int lookups;
+};
+
+/**
+ * UnstructuredStripingPartition ignores its adjacency parameter,
+ * this one keeps it.
+ */
+class UnstructuredStripingPartitionWithAdjacency : public UnstructuredStripingPartition
+{
+public:
+    UnstructuredStripingPartitionWithAdjacency(
+        const std::vector<std::size_t>& weights,
+        const boost::shared_ptr<Adjacency>& adjacency) :
+        UnstructuredStripingPartition(Coord<1>(), Coord<1>(), 0, weights)
+    {
+        this->adjacency = adjacency;
+    }
+};
+
 class PartitionManagerTest : public CxxTest::TestSuite
 {
 public:
@@ -190,6 +228,62 @@ public:
         TS_ASSERT_EQUALS(expected, partitionManager.innerSet(1));
     }
 
+    void testSparseGhostZonesMatchDense()
+    {
+        std::vector<std::size_t> weights2D;
+        weights2D += 100, 300, 200, 50, 150, 200, 300, 100, 100, 100, 900;
+        checkSparseGhostZones<Topologies::Cube<2>::Topology>(
+            CoordBox<2>(Coord<2>(), Coord<2>(50, 50)), weights2D, 3);
+
+        std::vector<std::size_t> weights3D;
+        weights3D += 1000, 2000, 3000, 1000, 4000, 2000, 3000, 1000, 2000, 5795;
+        checkSparseGhostZones<Topologies::Torus<3>::Topology>(
+            CoordBox<3>(Coord<3>(), Coord<3>(31, 29, 27)), weights3D, 2);
+    }
+
+    void testUnstructuredExpansionUsesCSRAdjacency()
+    {
+        int numNodes = 1000;
+        boost::shared_ptr<CountingCSRAdjacency> csrAdjacency(new CountingCSRAdjacency);
+        boost::shared_ptr<RegionBasedAdjacency> regionAdjacency(new RegionBasedAdjacency);
+        for (int i = 0; i < numNodes; ++i) {
+            int neighbors[] = { (i + numNodes - 1) % numNodes, (i + 1) % numNodes, (i * 7) % numNodes };
+            for (int j = 0; j < 3; ++j) {
+                csrAdjacency->insert(i, neighbors[j]);
+                regionAdjacency->insert(i, neighbors[j]);
+            }
+        }
+
+        std::vector<std::size_t> weights;
+        weights += 300, 400, 300;
+        CoordBox<1> box(Coord<1>(0), Coord<1>(numNodes));
+        unsigned ghostZoneWidth = 3;
+
+        PartitionManager<Topologies::Unstructured::Topology> csrManager;
+        csrManager.resetRegions(
+            box,
+            boost::shared_ptr<Partition<1> >(
+                new UnstructuredStripingPartitionWithAdjacency(weights, csrAdjacency)),
+            1,
+            ghostZoneWidth);
+
+        PartitionManager<Topologies::Unstructured::Topology> referenceManager;
+        referenceManager.resetRegions(
+            box,
+            boost::shared_ptr<Partition<1> >(
+                new UnstructuredStripingPartitionWithAdjacency(weights, regionAdjacency)),
+            1,
+            ghostZoneWidth);
+
+        for (unsigned width = 0; width <= ghostZoneWidth; ++width) {
+            TS_ASSERT_EQUALS(
+                referenceManager.getRegion(1, width),
+                csrManager.getRegion(1, width));
+        }
+        TS_ASSERT(csrManager.getRegion(1, ghostZoneWidth).size() > 400);
+        TS_ASSERT_EQUALS(0, csrAdjacency->lookups);
+    }
+
 private:
     Coord<2> dimensions;
     unsigned offset;
@@ -229,6 +323,57 @@ private:
         return boundingBoxes;
     }
 
+    /**
+     * Sets up the PartitionManagers of all nodes once via the
+     * (dense) local expansion of their neighbors' regions and once
+     * via the exchange of regions between candidates.
+     */
+    template<typename TOPOLOGY>
+    void checkSparseGhostZones(
+        const CoordBox<TOPOLOGY::DIM>& box,
+        const std::vector<std::size_t>& weights,
+        unsigned ghostZoneWidth)
+    {
+        const int DIM = TOPOLOGY::DIM;
+        typedef PartitionManager<TOPOLOGY> PartitionManagerType;
+        typedef typename PartitionManagerType::RegionVecMap RegionVecMap;
+
+        boost::shared_ptr<Partition<DIM> > partition(
+            new RecursiveBisectionPartition<DIM>(box.origin, box.dimensions, 0, weights));
+        std::size_t size = weights.size();
+
+        std::vector<PartitionManagerType> dense(size);
+        std::vector<PartitionManagerType> sparse(size);
+        std::vector<CoordBox<DIM> > boundingBoxes;
+        std::vector<CoordBox<DIM> > expandedBoundingBoxes;
+        for (std::size_t i = 0; i < size; ++i) {
+            dense[i].resetRegions(box, partition, i, ghostZoneWidth);
+            sparse[i].resetRegions(box, partition, i, ghostZoneWidth);
+            boundingBoxes << dense[i].ownRegion().boundingBox();
+            expandedBoundingBoxes << sparse[i].ownExpandedRegion().boundingBox();
+        }
+
+        for (std::size_t i = 0; i < size; ++i) {
+            dense[i].resetGhostZones(boundingBoxes);
+
+            RegionVecMap neighborExpansions;
+            std::vector<int> candidates = sparse[i].neighborCandidates(expandedBoundingBoxes);
+            for (std::vector<int>::iterator j = candidates.begin(); j != candidates.end(); ++j) {
+                // candidates need to be symmetric for the exchange to work:
+                std::vector<int> reverse = sparse[*j].neighborCandidates(expandedBoundingBoxes);
+                TS_ASSERT(std::find(reverse.begin(), reverse.end(), int(i)) != reverse.end());
+
+                neighborExpansions[*j] = sparse[*j].exchangeRegions(expandedBoundingBoxes[i]);
+            }
+            sparse[i].resetGhostZones(expandedBoundingBoxes, neighborExpansions);
+
+            TS_ASSERT_EQUALS(dense[i].getOuterGhostZoneFragments(), sparse[i].getOuterGhostZoneFragments());
+            TS_ASSERT_EQUALS(dense[i].getInnerGhostZoneFragments(), sparse[i].getInnerGhostZoneFragments());
+            // there's more than one neighbor plus the outgroup:
+            TS_ASSERT_LESS_THAN(2, dense[i].getOuterGhostZoneFragments().size());
+        }
+    }
+
     template<class PARTITION>
     void checkRegion(
         const Region<2>& region,
@@ -1,4 +1,6 @@
+#include <libgeodecomp/geometry/adjacency.h>
 #include <libgeodecomp/geometry/regionbasedadjacency.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
 
 #include <boost/assign/std/vector.hpp>
 #include <cxxtest/TestSuite.h>
@@ -232,6 +234,49 @@ public:
         TS_ASSERT_EQUALS(neighbors, actual);
 
     }
+
+    void testMakeAdjacencyFromCSR()
+    {
+        // 1 2 0 0
+        // 0 0 3 0
+        // 0 4 5 0
+        // 6 0 0 0
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> values;
+        rows    << 0 << 0 << 1 << 2 << 2 << 3;
+        columns << 0 << 1 << 2 << 1 << 2 << 0;
+        values  << 1 << 2 << 3 << 4 << 5 << 6;
+        CSRMatrix<double> matrix = CSRMatrix<double>::fromCOO(4, 4, rows, columns, values);
+
+        boost::shared_ptr<RegionBasedAdjacency> adjacency =
+            MakeAdjacency<RegionBasedAdjacency>(matrix);
+
+        std::vector<std::vector<int> > expected(4);
+        expected[0] << 1 << 3;
+        expected[1] << 0 << 2;
+        expected[2] << 1;
+        expected[3] << 0;
+
+        for (int i = 0; i < 4; ++i) {
+            std::vector<int> actual;
+            adjacency->getNeighbors(i, &actual);
+            TS_ASSERT_EQUALS(expected[i], actual);
+        }
+        TS_ASSERT_EQUALS(6, adjacency->size());
+
+        std::map<Coord<2>, double> map;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            map[Coord<2>(rows[i], columns[i])] = values[i];
+        }
+        adjacency = MakeAdjacency<RegionBasedAdjacency>(map);
+
+        for (int i = 0; i < 4; ++i) {
+            std::vector<int> actual;
+            adjacency->getNeighbors(i, &actual);
+            TS_ASSERT_EQUALS(expected[i], actual);
+        }
+    }
 };
 
 }
@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RegionStreakIteratorTest_init = false;
+#include "/root/repo/src/geometry/test/unit/regionstreakiteratortest.h"
+
+static RegionStreakIteratorTest suite_RegionStreakIteratorTest;
+
+static CxxTest::List Tests_RegionStreakIteratorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RegionStreakIteratorTest( "/root/repo/src/geometry/test/unit/regionstreakiteratortest.h", 9, "RegionStreakIteratorTest", suite_RegionStreakIteratorTest, Tests_RegionStreakIteratorTest );
+
+static class TestDescription_suite_RegionStreakIteratorTest_testOffsetBasedConstructor3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionStreakIteratorTest_testOffsetBasedConstructor3D() : CxxTest::RealTestDescription( Tests_RegionStreakIteratorTest, suiteDescription_RegionStreakIteratorTest, 15, "testOffsetBasedConstructor3D" ) {}
+ void runTest() { suite_RegionStreakIteratorTest.testOffsetBasedConstructor3D(); }
+} testDescription_suite_RegionStreakIteratorTest_testOffsetBasedConstructor3D;
+
+static class TestDescription_suite_RegionStreakIteratorTest_testInitForEmptyRegions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionStreakIteratorTest_testInitForEmptyRegions() : CxxTest::RealTestDescription( Tests_RegionStreakIteratorTest, suiteDescription_RegionStreakIteratorTest, 43, "testInitForEmptyRegions" ) {}
+ void runTest() { suite_RegionStreakIteratorTest.testInitForEmptyRegions(); }
+} testDescription_suite_RegionStreakIteratorTest_testInitForEmptyRegions;
+
+static class TestDescription_suite_RegionStreakIteratorTest_testSubstraction2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionStreakIteratorTest_testSubstraction2D() : CxxTest::RealTestDescription( Tests_RegionStreakIteratorTest, suiteDescription_RegionStreakIteratorTest, 54, "testSubstraction2D" ) {}
+ void runTest() { suite_RegionStreakIteratorTest.testSubstraction2D(); }
+} testDescription_suite_RegionStreakIteratorTest_testSubstraction2D;
+
+static class TestDescription_suite_RegionStreakIteratorTest_testOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RegionStreakIteratorTest_testOffset() : CxxTest::RealTestDescription( Tests_RegionStreakIteratorTest, suiteDescription_RegionStreakIteratorTest, 103, "testOffset" ) {}
+ void runTest() { suite_RegionStreakIteratorTest.testOffset(); }
+} testDescription_suite_RegionStreakIteratorTest_testOffset;
+
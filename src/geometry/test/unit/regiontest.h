@@ -1,5 +1,7 @@
+#include <libgeodecomp/geometry/csradjacency.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/geometry/regionbasedadjacency.h>
 #include <libgeodecomp/misc/chronometer.h>
 #include <libgeodecomp/storage/displacedgrid.h>
 
@@ -7,6 +9,8 @@
 #include <boost/filesystem.hpp>
 #include <cxxtest/TestSuite.h>
 
+#include <set>
+
 using namespace boost::assign;
 using namespace LibGeoDecomp;
 
@@ -130,6 +134,62 @@ public:
 #endif
     }
 
+    void testExpandWithCSRAdjacency()
+    {
+        int numNodes = 2000;
+        RegionBasedAdjacency regionAdjacency;
+        CSRAdjacency csrAdjacency;
+        std::vector<std::set<int> > edges(numNodes);
+
+        // random order inserts, including duplicates and edges to
+        // nodes beyond numNodes, which have no neighbors themselves:
+        for (int i = 0; i < 5 * numNodes; ++i) {
+            int from = (i * 7919) % numNodes;
+            int to = (i * 104729 + i / 3) % (numNodes + 50);
+            regionAdjacency.insert(from, to);
+            csrAdjacency.insert(from, to);
+            edges[from].insert(to);
+        }
+        TS_ASSERT_EQUALS(regionAdjacency.size(), csrAdjacency.size());
+
+        Region<1> region;
+        region << Streak<1>(Coord<1>(10), 20)
+               << Streak<1>(Coord<1>(500), 501)
+               << Coord<1>(numNodes + 10);
+
+        for (unsigned width = 0; width < 5; ++width) {
+            // naive reference: breadth first search with std::set
+            std::set<int> expected;
+            std::set<int> frontier;
+            for (Region<1>::Iterator i = region.begin(); i != region.end(); ++i) {
+                expected.insert(i->x());
+                frontier.insert(i->x());
+            }
+            for (unsigned pass = 0; pass < width; ++pass) {
+                std::set<int> next;
+                for (std::set<int>::iterator i = frontier.begin(); i != frontier.end(); ++i) {
+                    if (*i >= numNodes) {
+                        continue;
+                    }
+                    for (std::set<int>::iterator j = edges[*i].begin(); j != edges[*i].end(); ++j) {
+                        if (expected.insert(*j).second) {
+                            next.insert(*j);
+                        }
+                    }
+                }
+                frontier = next;
+            }
+
+            Region<1> expectedRegion;
+            for (std::set<int>::iterator i = expected.begin(); i != expected.end(); ++i) {
+                expectedRegion << Coord<1>(*i);
+            }
+
+            TS_ASSERT_EQUALS(expectedRegion, region.expandWithAdjacency(width, regionAdjacency));
+            TS_ASSERT_EQUALS(expectedRegion, region.expandWithAdjacency(width, csrAdjacency));
+        }
+    }
+
     void testMoveAssignment()
     {
 #ifdef LIBGEODECOMP_WITH_CPP14
@@ -2195,6 +2255,39 @@ public:
         TS_ASSERT( r6.isAppendable(r5));
     }
 
+    void testMultiThreadedOperations()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        Region<3> r1;
+        Region<3> r2;
+        for (int z = 0; z < 60; ++z) {
+            for (int y = 0; y < 200; ++y) {
+                int x = (7 * y + 3 * z) % 20;
+                r1 << Streak<3>(Coord<3>(x,      y, z), x + 10)
+                   << Streak<3>(Coord<3>(x + 40, y, z), x + 45);
+                r2 << Streak<3>(Coord<3>(x + 5,  y + 3, z + 1), x + 42);
+            }
+        }
+
+        int threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        Region<3> expectedDifference   = r1 - r2;
+        Region<3> expectedIntersection = r1 & r2;
+        Region<3> expectedUnion        = r1 + r2;
+        Region<3> expectedExpansion    = r1.expand(Coord<3>(1, 2, 3));
+
+        omp_set_num_threads(4);
+        TS_ASSERT_EQUALS(expectedDifference,   r1 - r2);
+        TS_ASSERT_EQUALS(expectedIntersection, r1 & r2);
+        TS_ASSERT_EQUALS(expectedUnion,        r1 + r2);
+        TS_ASSERT_EQUALS(expectedExpansion,    r1.expand(Coord<3>(1, 2, 3)));
+
+        TS_ASSERT_EQUALS(expectedUnion.size(), (r1 + r2).size());
+        TS_ASSERT_EQUALS(expectedExpansion.boundingBox(), r1.expand(Coord<3>(1, 2, 3)).boundingBox());
+        omp_set_num_threads(threads);
+#endif
+    }
+
 private:
     Region<2> c;
     CoordVector bigInsertOrdered;
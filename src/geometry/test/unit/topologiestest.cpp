@@ -0,0 +1,103 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TopologiesTest_init = false;
+#include "/root/repo/src/geometry/test/unit/topologiestest.h"
+
+static TopologiesTest suite_TopologiesTest;
+
+static CxxTest::List Tests_TopologiesTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TopologiesTest( "/root/repo/src/geometry/test/unit/topologiestest.h", 10, "TopologiesTest", suite_TopologiesTest, Tests_TopologiesTest );
+
+static class TestDescription_suite_TopologiesTest_testNormalizeCoordAndOutOfBoundsAndNormalizeEdges : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testNormalizeCoordAndOutOfBoundsAndNormalizeEdges() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 13, "testNormalizeCoordAndOutOfBoundsAndNormalizeEdges" ) {}
+ void runTest() { suite_TopologiesTest.testNormalizeCoordAndOutOfBoundsAndNormalizeEdges(); }
+} testDescription_suite_TopologiesTest_testNormalizeCoordAndOutOfBoundsAndNormalizeEdges;
+
+static class TestDescription_suite_TopologiesTest_testWrapsAxisClass : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testWrapsAxisClass() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 60, "testWrapsAxisClass" ) {}
+ void runTest() { suite_TopologiesTest.testWrapsAxisClass(); }
+} testDescription_suite_TopologiesTest_testWrapsAxisClass;
+
+static class TestDescription_suite_TopologiesTest_testIsOutOfBoundsCube2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testIsOutOfBoundsCube2D() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 89, "testIsOutOfBoundsCube2D" ) {}
+ void runTest() { suite_TopologiesTest.testIsOutOfBoundsCube2D(); }
+} testDescription_suite_TopologiesTest_testIsOutOfBoundsCube2D;
+
+static class TestDescription_suite_TopologiesTest_testIsOutOfBoundsCube3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testIsOutOfBoundsCube3D() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 102, "testIsOutOfBoundsCube3D" ) {}
+ void runTest() { suite_TopologiesTest.testIsOutOfBoundsCube3D(); }
+} testDescription_suite_TopologiesTest_testIsOutOfBoundsCube3D;
+
+static class TestDescription_suite_TopologiesTest_testIsOutOfBoundsTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testIsOutOfBoundsTorus() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 117, "testIsOutOfBoundsTorus" ) {}
+ void runTest() { suite_TopologiesTest.testIsOutOfBoundsTorus(); }
+} testDescription_suite_TopologiesTest_testIsOutOfBoundsTorus;
+
+static class TestDescription_suite_TopologiesTest_testIsOutOfBoundsSpecial1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testIsOutOfBoundsSpecial1() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 130, "testIsOutOfBoundsSpecial1" ) {}
+ void runTest() { suite_TopologiesTest.testIsOutOfBoundsSpecial1(); }
+} testDescription_suite_TopologiesTest_testIsOutOfBoundsSpecial1;
+
+static class TestDescription_suite_TopologiesTest_testIsOutOfBoundsSpecial2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testIsOutOfBoundsSpecial2() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 143, "testIsOutOfBoundsSpecial2" ) {}
+ void runTest() { suite_TopologiesTest.testIsOutOfBoundsSpecial2(); }
+} testDescription_suite_TopologiesTest_testIsOutOfBoundsSpecial2;
+
+static class TestDescription_suite_TopologiesTest_testLocateCube2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testLocateCube2D() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 156, "testLocateCube2D" ) {}
+ void runTest() { suite_TopologiesTest.testLocateCube2D(); }
+} testDescription_suite_TopologiesTest_testLocateCube2D;
+
+static class TestDescription_suite_TopologiesTest_testLocateCube3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testLocateCube3D() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 181, "testLocateCube3D" ) {}
+ void runTest() { suite_TopologiesTest.testLocateCube3D(); }
+} testDescription_suite_TopologiesTest_testLocateCube3D;
+
+static class TestDescription_suite_TopologiesTest_testLocateTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testLocateTorus() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 202, "testLocateTorus" ) {}
+ void runTest() { suite_TopologiesTest.testLocateTorus(); }
+} testDescription_suite_TopologiesTest_testLocateTorus;
+
+static class TestDescription_suite_TopologiesTest_testNormalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testNormalize() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 226, "testNormalize" ) {}
+ void runTest() { suite_TopologiesTest.testNormalize(); }
+} testDescription_suite_TopologiesTest_testNormalize;
+
+static class TestDescription_suite_TopologiesTest_testWrapsAxis : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TopologiesTest_testWrapsAxis() : CxxTest::RealTestDescription( Tests_TopologiesTest, suiteDescription_TopologiesTest, 238, "testWrapsAxis" ) {}
+ void runTest() { suite_TopologiesTest.testWrapsAxis(); }
+} testDescription_suite_TopologiesTest_testWrapsAxis;
+
@@ -0,0 +1,568 @@
+#ifndef LIBGEODECOMP_IO_ASYNCWRITER_H
+#define LIBGEODECOMP_IO_ASYNCWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/selector.h>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Determines what an AsyncWriter does if a new snapshot arrives while
+ * its queue is full: wait for the IO thread to catch up, discard the
+ * new snapshot, or let it replace the most recent one which has not
+ * yet been handed to the delegate.
+ */
+enum AsyncWriterPolicy {
+    ASYNC_WRITER_BLOCK,
+    ASYNC_WRITER_DROP,
+    ASYNC_WRITER_COALESCE
+};
+
+namespace AsyncWriterHelpers {
+
+/**
+ * Staging buffer which holds a copy of the grid (or of a single
+ * member of its cells) for one time step. Snapshots are recycled by
+ * the SnapshotQueue, so their storage is only allocated once.
+ */
+template<typename CELL_TYPE>
+class Snapshot
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    typedef DisplacedGrid<CELL_TYPE, Topology> GridType;
+    static const int DIM = Topology::DIM;
+
+    Snapshot() :
+        step(0),
+        event(WRITER_STEP_FINISHED),
+        rank(0)
+    {}
+
+    void reset(const CoordBox<DIM>& box)
+    {
+        if (grid.boundingBox() != box) {
+            grid.resize(box);
+        }
+
+        validRegion.clear();
+        memberBuffer.clear();
+        memberRegions.clear();
+    }
+
+    /**
+     * Copies the cells in region from source. If selector is given,
+     * only the selected member is copied into a flat buffer and
+     * unpacked later on by the IO thread.
+     */
+    void save(
+        const GridBase<CELL_TYPE, DIM>& source,
+        const Region<DIM>& region,
+        const Selector<CELL_TYPE> *selector)
+    {
+        grid.setEdge(source.getEdge());
+        validRegion += region;
+
+        if (selector == 0) {
+            grid.paste(source, region);
+            return;
+        }
+
+        if (region.size() == 0) {
+            return;
+        }
+
+        std::size_t offset = memberBuffer.size();
+        memberBuffer.resize(offset + region.size() * selector->sizeOfExternal());
+        source.saveMemberUnchecked(&memberBuffer[offset], MemoryLocation::HOST, *selector, region);
+        memberRegions.push_back(region);
+    }
+
+    void unpack(const Selector<CELL_TYPE> *selector)
+    {
+        if (selector == 0) {
+            return;
+        }
+
+        const char *source = memberBuffer.empty() ? 0 : &memberBuffer[0];
+        for (std::size_t i = 0; i < memberRegions.size(); ++i) {
+            for (typename Region<DIM>::StreakIterator j = memberRegions[i].beginStreak();
+                 j != memberRegions[i].endStreak();
+                 ++j) {
+                selector->copyMemberIn(
+                    source,
+                    MemoryLocation::HOST,
+                    &grid[j->origin],
+                    MemoryLocation::HOST,
+                    j->length());
+                source += selector->sizeOfExternal() * j->length();
+            }
+        }
+    }
+
+    GridType grid;
+    Region<DIM> validRegion;
+    Coord<DIM> globalDimensions;
+    unsigned step;
+    WriterEvent event;
+    std::size_t rank;
+
+private:
+    std::vector<char> memberBuffer;
+    std::vector<Region<DIM> > memberRegions;
+};
+
+/**
+ * Bounded producer/consumer queue between the simulation thread
+ * (which acquires and pushes snapshots) and the IO thread (which pops
+ * and releases them). At most capacity snapshots exist at any time,
+ * including the one currently being written.
+ */
+template<typename SNAPSHOT>
+class SnapshotQueue
+{
+public:
+    typedef boost::shared_ptr<SNAPSHOT> SnapshotPtr;
+
+    SnapshotQueue(std::size_t capacity, AsyncWriterPolicy policy) :
+        capacity(capacity),
+        policy(policy),
+        allocated(0),
+        unfinished(0),
+        dropped(0),
+        coalesced(0),
+        closed(false)
+    {
+        if (capacity == 0) {
+            throw std::invalid_argument("AsyncWriter needs room for at least one snapshot");
+        }
+    }
+
+    std::size_t getCapacity() const
+    {
+        return capacity;
+    }
+
+    AsyncWriterPolicy getPolicy() const
+    {
+        return policy;
+    }
+
+    /**
+     * Returns a staging buffer for the next snapshot. Only expendable
+     * snapshots (i.e. regular time steps) are subject to the policy,
+     * all others wait for the IO thread. A null pointer means that
+     * the snapshot was dropped.
+     */
+    SnapshotPtr acquire(bool expendable)
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+
+        for (;;) {
+            checkError();
+
+            if (allocated < capacity) {
+                ++allocated;
+                if (pool.empty()) {
+                    return SnapshotPtr(new SNAPSHOT);
+                }
+
+                SnapshotPtr ret = pool.back();
+                pool.pop_back();
+                return ret;
+            }
+
+            if (expendable && (policy == ASYNC_WRITER_DROP)) {
+                ++dropped;
+                return SnapshotPtr();
+            }
+
+            if (expendable && (policy == ASYNC_WRITER_COALESCE) &&
+                !queue.empty() && (queue.back()->event == WRITER_STEP_FINISHED)) {
+                SnapshotPtr ret = queue.back();
+                queue.pop_back();
+                --unfinished;
+                ++coalesced;
+                return ret;
+            }
+
+            snapshotReleased.wait(lock);
+        }
+    }
+
+    void push(const SnapshotPtr& snapshot)
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        queue.push_back(snapshot);
+        ++unfinished;
+        snapshotPushed.notify_one();
+    }
+
+    /**
+     * Called by the IO thread. Blocks until a snapshot is available.
+     * Returns a null pointer once the queue has been closed and
+     * drained.
+     */
+    SnapshotPtr pop()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while (queue.empty() && !closed) {
+            snapshotPushed.wait(lock);
+        }
+
+        if (queue.empty()) {
+            return SnapshotPtr();
+        }
+
+        SnapshotPtr ret = queue.front();
+        queue.pop_front();
+        return ret;
+    }
+
+    /**
+     * Returns a snapshot to the pool once the IO thread is done with
+     * it. A non-empty error will be rethrown on the simulation
+     * thread.
+     */
+    void release(const SnapshotPtr& snapshot, const std::string& message)
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        pool.push_back(snapshot);
+        --allocated;
+        --unfinished;
+        if (error.empty()) {
+            error = message;
+        }
+        snapshotReleased.notify_all();
+    }
+
+    /**
+     * Waits until all pushed snapshots have been written.
+     */
+    void flush()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while (unfinished > 0) {
+            snapshotReleased.wait(lock);
+        }
+        checkError();
+    }
+
+    void close()
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        closed = true;
+        snapshotPushed.notify_all();
+    }
+
+    std::size_t droppedSnapshots()
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        return dropped;
+    }
+
+    std::size_t coalescedSnapshots()
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        return coalesced;
+    }
+
+private:
+    std::size_t capacity;
+    AsyncWriterPolicy policy;
+    std::deque<SnapshotPtr> queue;
+    std::vector<SnapshotPtr> pool;
+    // snapshots handed out by acquire() and not yet released:
+    std::size_t allocated;
+    // snapshots pushed but not yet released:
+    std::size_t unfinished;
+    std::size_t dropped;
+    std::size_t coalesced;
+    bool closed;
+    std::string error;
+    boost::mutex mutex;
+    boost::condition_variable snapshotPushed;
+    boost::condition_variable snapshotReleased;
+
+    void checkError()
+    {
+        if (!error.empty()) {
+            std::string message = error;
+            error.clear();
+            throw std::runtime_error("AsyncWriter: delegate failed: " + message);
+        }
+    }
+};
+
+}
+
+/**
+ * The AsyncWriter decouples a Writer or ParallelWriter from the
+ * simulation's time loop: on each call it merely copies the valid
+ * region of the grid into a staging buffer and returns. A dedicated
+ * IO thread then feeds the snapshots to the delegate. Thus
+ * TimeOutput (or TimePatchAccepters for ParallelWriters) will only
+ * account for the copy, formatting and disk IO overlap with the
+ * computation.
+ *
+ * At most maxQueueLength snapshots are kept in memory, policy
+ * determines what happens if the IO thread falls behind. Events
+ * other than WRITER_STEP_FINISHED are never dropped or coalesced.
+ * WRITER_ALL_DONE blocks until the delegate has caught up.
+ *
+ * Multiple calls of a ParallelWriter for one time step are gathered
+ * in the same snapshot, so the delegate will only be called once per
+ * step (with lastCall set). Delegates which communicate (e.g. via
+ * MPI) need to be safe to call from a separate thread.
+ */
+template<typename CELL_TYPE>
+class AsyncWriter :
+        public Clonable<Writer<CELL_TYPE>,         AsyncWriter<CELL_TYPE> >,
+        public Clonable<ParallelWriter<CELL_TYPE>, AsyncWriter<CELL_TYPE> >
+{
+public:
+    typedef typename Writer<CELL_TYPE>::GridType WriterGridType;
+    typedef typename ParallelWriter<CELL_TYPE>::GridType ParallelWriterGridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    typedef AsyncWriterHelpers::Snapshot<CELL_TYPE> Snapshot;
+    typedef AsyncWriterHelpers::SnapshotQueue<Snapshot> Queue;
+    typedef typename Queue::SnapshotPtr SnapshotPtr;
+
+    static const int DIM = Topology::DIM;
+
+    explicit AsyncWriter(
+        Writer<CELL_TYPE> *writer,
+        std::size_t maxQueueLength = 2,
+        AsyncWriterPolicy policy = ASYNC_WRITER_BLOCK) :
+        Clonable<Writer<CELL_TYPE>,         AsyncWriter<CELL_TYPE> >(writer->getPrefix(), writer->getPeriod()),
+        Clonable<ParallelWriter<CELL_TYPE>, AsyncWriter<CELL_TYPE> >(writer->getPrefix(), writer->getPeriod()),
+        writer(writer),
+        queue(maxQueueLength, policy),
+        dropCurrentStep(false),
+        ioThread(&AsyncWriter::drain, this)
+    {}
+
+    explicit AsyncWriter(
+        ParallelWriter<CELL_TYPE> *parallelWriter,
+        std::size_t maxQueueLength = 2,
+        AsyncWriterPolicy policy = ASYNC_WRITER_BLOCK) :
+        Clonable<Writer<CELL_TYPE>,         AsyncWriter<CELL_TYPE> >(
+            parallelWriter->getPrefix(), parallelWriter->getPeriod()),
+        Clonable<ParallelWriter<CELL_TYPE>, AsyncWriter<CELL_TYPE> >(
+            parallelWriter->getPrefix(), parallelWriter->getPeriod()),
+        parallelWriter(parallelWriter),
+        queue(maxQueueLength, policy),
+        dropCurrentStep(false),
+        ioThread(&AsyncWriter::drain, this)
+    {}
+
+    AsyncWriter(const AsyncWriter& other) :
+        Clonable<Writer<CELL_TYPE>,         AsyncWriter<CELL_TYPE> >(other),
+        Clonable<ParallelWriter<CELL_TYPE>, AsyncWriter<CELL_TYPE> >(other),
+        writer(other.writer ? other.writer->clone() : 0),
+        parallelWriter(other.parallelWriter ? other.parallelWriter->clone() : 0),
+        selector(other.selector),
+        queue(other.queue.getCapacity(), other.queue.getPolicy()),
+        dropCurrentStep(false),
+        ioThread(&AsyncWriter::drain, this)
+    {}
+
+    ~AsyncWriter()
+    {
+        queue.close();
+        ioThread.join();
+    }
+
+    /**
+     * Restricts the snapshots to the member selected by newSelector,
+     * which reduces the time spent copying. All other members of the
+     * cells handed to the delegate are undefined.
+     */
+    void setSelector(const Selector<CELL_TYPE>& newSelector)
+    {
+        queue.flush();
+        selector.reset(new Selector<CELL_TYPE>(newSelector));
+    }
+
+    virtual void setRegion(const Region<DIM>& newRegion)
+    {
+        ParallelWriter<CELL_TYPE>::setRegion(newRegion);
+        checkParallelWriter();
+
+        // the delegate isn't meant to be called concurrently:
+        queue.flush();
+        parallelWriter->setRegion(newRegion);
+    }
+
+    virtual void stepFinished(const WriterGridType& grid, unsigned step, WriterEvent event)
+    {
+        if (!writer) {
+            throw std::logic_error("AsyncWriter needs a Writer as delegate to be used with a MonolithicSimulator");
+        }
+
+        SnapshotPtr snapshot = queue.acquire(event == WRITER_STEP_FINISHED);
+        if (!snapshot) {
+            return;
+        }
+
+        CoordBox<DIM> box = grid.boundingBox();
+        Region<DIM> region;
+        region << box;
+
+        snapshot->reset(box);
+        snapshot->save(grid, region, selector.get());
+        snapshot->step = step;
+        snapshot->event = event;
+        queue.push(snapshot);
+
+        if (event == WRITER_ALL_DONE) {
+            queue.flush();
+        }
+    }
+
+    virtual void stepFinished(
+        const ParallelWriterGridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        checkParallelWriter();
+
+        if (!current && !dropCurrentStep) {
+            current = queue.acquire(event == WRITER_STEP_FINISHED);
+            if (current) {
+                CoordBox<DIM> box = ParallelWriter<CELL_TYPE>::region.boundingBox();
+                if (box.size() == 0) {
+                    box = grid.boundingBox();
+                }
+                current->reset(box);
+            } else {
+                dropCurrentStep = true;
+            }
+        }
+
+        if (current) {
+            current->save(grid, validRegion, selector.get());
+        }
+
+        if (!lastCall) {
+            return;
+        }
+
+        dropCurrentStep = false;
+        if (current) {
+            current->globalDimensions = globalDimensions;
+            current->step = step;
+            current->event = event;
+            current->rank = rank;
+            queue.push(current);
+            current.reset();
+        }
+
+        if (event == WRITER_ALL_DONE) {
+            queue.flush();
+        }
+    }
+
+    /**
+     * Blocks until the delegate has caught up with all snapshots
+     * taken so far.
+     */
+    void flush()
+    {
+        queue.flush();
+    }
+
+    std::size_t droppedSnapshots()
+    {
+        return queue.droppedSnapshots();
+    }
+
+    std::size_t coalescedSnapshots()
+    {
+        return queue.coalescedSnapshots();
+    }
+
+private:
+    boost::shared_ptr<Writer<CELL_TYPE> > writer;
+    boost::shared_ptr<ParallelWriter<CELL_TYPE> > parallelWriter;
+    boost::shared_ptr<Selector<CELL_TYPE> > selector;
+    Queue queue;
+    // snapshot of the step which is currently being assembled from
+    // multiple ParallelWriter calls:
+    SnapshotPtr current;
+    bool dropCurrentStep;
+    // needs to come last as it starts running in the c-tor:
+    boost::thread ioThread;
+
+    void checkParallelWriter()
+    {
+        if (!parallelWriter) {
+            throw std::logic_error("AsyncWriter needs a ParallelWriter as delegate to be used with a DistributedSimulator");
+        }
+    }
+
+    void drain()
+    {
+        for (;;) {
+            SnapshotPtr snapshot = queue.pop();
+            if (!snapshot) {
+                return;
+            }
+
+            std::string error;
+            try {
+                write(snapshot.get());
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+
+            queue.release(snapshot, error);
+        }
+    }
+
+    void write(Snapshot *snapshot)
+    {
+        snapshot->unpack(selector.get());
+
+        if (writer) {
+            writer->stepFinished(snapshot->grid, snapshot->step, snapshot->event);
+            return;
+        }
+
+        parallelWriter->stepFinished(
+            snapshot->grid,
+            snapshot->validRegion,
+            snapshot->globalDimensions,
+            snapshot->step,
+            snapshot->event,
+            snapshot->rank,
+            true);
+    }
+};
+
+}
+
+#endif
+
+#endif
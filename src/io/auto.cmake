@@ -0,0 +1,47 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}mockinitializer.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}asciiwriter.h
+  ${RELATIVE_PATH}asyncwriter.h
+  ${RELATIVE_PATH}bovoutput.h
+  ${RELATIVE_PATH}bovwriter.h
+  ${RELATIVE_PATH}clonableinitializer.h
+  ${RELATIVE_PATH}clonableinitializerwrapper.h
+  ${RELATIVE_PATH}collectingwriter.h
+  ${RELATIVE_PATH}imagepainter.h
+  ${RELATIVE_PATH}initializer.h
+  ${RELATIVE_PATH}ioexception.h
+  ${RELATIVE_PATH}logger.h
+  ${RELATIVE_PATH}memorywriter.h
+  ${RELATIVE_PATH}mockinitializer.h
+  ${RELATIVE_PATH}mocksteerer.h
+  ${RELATIVE_PATH}mockwriter.h
+  ${RELATIVE_PATH}mpiio.h
+  ${RELATIVE_PATH}mpiioinitializer.h
+  ${RELATIVE_PATH}mpiiowriter.h
+  ${RELATIVE_PATH}parallelmemorywriter.h
+  ${RELATIVE_PATH}parallelmpiiowriter.h
+  ${RELATIVE_PATH}parallelsilowriter.h
+  ${RELATIVE_PATH}paralleltestwriter.h
+  ${RELATIVE_PATH}parallelwriter.h
+  ${RELATIVE_PATH}plotter.h
+  ${RELATIVE_PATH}ppmwriter.h
+  ${RELATIVE_PATH}qtwidgetwriter.h
+  ${RELATIVE_PATH}remotesteerer.h
+  ${RELATIVE_PATH}sellsortingwriter.h
+  ${RELATIVE_PATH}serialbovwriter.h
+  ${RELATIVE_PATH}silowriter.h
+  ${RELATIVE_PATH}simplecellplotter.h
+  ${RELATIVE_PATH}simpleinitializer.h
+  ${RELATIVE_PATH}steerer.h
+  ${RELATIVE_PATH}testinitializer.h
+  ${RELATIVE_PATH}teststeerer.h
+  ${RELATIVE_PATH}testwriter.h
+  ${RELATIVE_PATH}timelinewriter.h
+  ${RELATIVE_PATH}tracingwriter.h
+  ${RELATIVE_PATH}unstructuredtestinitializer.h
+  ${RELATIVE_PATH}varstepinitializerproxy.h
+  ${RELATIVE_PATH}visitwriter.h
+  ${RELATIVE_PATH}writer.h
+)
@@ -8,13 +8,28 @@
 #include <libgeodecomp/io/parallelwriter.h>
 #include <libgeodecomp/misc/clonable.h>
 
+#include <stdexcept>
+#include <vector>
+
 namespace LibGeoDecomp {
 
 /**
  * Adapter class whose purpose is to use legacy Writer objects
- * together with a DistributedSimulator. Good for testing, but doesn't
- * scale, as all memory is concentrated on one node and IO is
- * serialized to that node. Use with care!
+ * together with a DistributedSimulator. All cells are collected on
+ * the root, so this doesn't scale as well as true parallel IO. Use
+ * with care!
+ *
+ * To avoid the root becoming a serial bottleneck, the ranks are
+ * arranged in a tree of degree arity (rooted at root). Each rank packs
+ * the cells of its validRegion, appends the data received from its
+ * children and forwards the result to its parent. Thus the root only
+ * receives from its direct children.
+ *
+ * Alternatively a ParallelWriter may be used as delegate. In that
+ * case the root won't assemble the global grid, but will hand each
+ * rank's subdomain to the delegate as soon as it arrives. Only the
+ * data of one subtree needs to be kept on the root at any time, so a
+ * higher arity yields smaller subtrees and thus less memory.
  */
 template<typename CELL_TYPE>
 class CollectingWriter : public Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >
@@ -32,23 +47,44 @@ public:
         Writer<CELL_TYPE> *writer,
         int root = 0,
         MPI_Comm communicator = MPI_COMM_WORLD,
-        MPI_Datatype mpiDatatype = APITraits::SelectMPIDataType<CELL_TYPE>::value()) :
+        MPI_Datatype mpiDatatype = APITraits::SelectMPIDataType<CELL_TYPE>::value(),
+        int arity = 2) :
         Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >("",  1),
         writer(writer),
         mpiLayer(communicator),
         root(root),
+        arity(arity),
         datatype(mpiDatatype)
     {
-        if ((mpiLayer.rank() != root) && (writer != 0)) {
-            throw std::invalid_argument("can't call back a writer on a node other than the root");
+        checkDelegate(writer);
+        if (mpiLayer.rank() == root) {
+            period = writer->getPeriod();
         }
 
-        if (mpiLayer.rank() == root) {
-            if (writer == 0) {
-                throw std::invalid_argument("delegate writer on root must not be null");
-            }
+        period = mpiLayer.broadcast(period, root);
+    }
 
-            period = writer->getPeriod();
+    /**
+     * Streaming mode: the ParallelWriter on the root will be called
+     * back once per rank and step, with lastCall only being set for
+     * the final invocation.
+     */
+    explicit CollectingWriter(
+        ParallelWriter<CELL_TYPE> *parallelWriter,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD,
+        MPI_Datatype mpiDatatype = APITraits::SelectMPIDataType<CELL_TYPE>::value(),
+        int arity = 2) :
+        Clonable<ParallelWriter<CELL_TYPE>, CollectingWriter<CELL_TYPE> >("",  1),
+        parallelWriter(parallelWriter),
+        mpiLayer(communicator),
+        root(root),
+        arity(arity),
+        datatype(mpiDatatype)
+    {
+        checkDelegate(parallelWriter);
+        if (mpiLayer.rank() == root) {
+            period = parallelWriter->getPeriod();
         }
 
         period = mpiLayer.broadcast(period, root);
@@ -63,60 +99,251 @@ public:
         std::size_t rank,
         bool lastCall)
     {
-        if (mpiLayer.rank() == root) {
-            if (globalGrid.boundingBox().dimensions != globalDimensions) {
-                globalGrid.resize(CoordBox<DIM>(Coord<DIM>(), globalDimensions));
-            }
+        std::vector<int> children = childRanks();
+
+        if (mpiLayer.rank() != root) {
+            Packet packet;
+            pack(grid, validRegion, &packet);
+            receivePacket(children, &packet);
+            sendPacket(packet, parentRank());
+            return;
+        }
 
-            globalGrid.paste(grid, validRegion);
-            globalGrid.setEdge(grid.getEdge());
-        }
-
-        CoordBox<DIM> box = grid.boundingBox();
-        StorageGridType localGrid(box);
-
-        for (typename CoordBox<DIM>::StreakIterator i = box.beginStreak(); i != box.endStreak(); ++i) {
-            Streak<DIM> s(*i);
-            grid.get(s, &localGrid[s.origin]);
-        }
-
-        for (int sender = 0; sender < mpiLayer.size(); ++sender) {
-            if (sender != root) {
-                if (mpiLayer.rank() == root) {
-                    Region<DIM> recvRegion;
-                    mpiLayer.recvRegion(&recvRegion, sender);
-                    mpiLayer.recvUnregisteredRegion(
-                        &globalGrid,
-                        recvRegion,
-                        sender,
-                        MPILayer::PARALLEL_MEMORY_WRITER,
-                        datatype);
-                }
-                if (mpiLayer.rank() == sender) {
-                    mpiLayer.sendRegion(validRegion, root);
-                    mpiLayer.sendUnregisteredRegion(
-                        &localGrid,
-                        validRegion,
-                        root,
-                        MPILayer::PARALLEL_MEMORY_WRITER,
-                        datatype);
-                }
+        if (parallelWriter) {
+            parallelWriter->stepFinished(
+                grid, validRegion, globalDimensions, step, event, rank, lastCall && children.empty());
+
+            for (std::size_t i = 0; i < children.size(); ++i) {
+                Packet packet;
+                receivePacket(std::vector<int>(1, children[i]), &packet);
+                bool lastPacket = lastCall && (i == (children.size() - 1));
+                streamPacket(packet, grid.getEdge(), globalDimensions, step, event, rank, lastPacket);
             }
+
+            return;
+        }
+
+        if (globalGrid.boundingBox().dimensions != globalDimensions) {
+            globalGrid.resize(CoordBox<DIM>(Coord<DIM>(), globalDimensions));
         }
 
-        mpiLayer.waitAll();
+        globalGrid.paste(grid, validRegion);
+        globalGrid.setEdge(grid.getEdge());
+
+        // receiving from one child at a time limits the size of the
+        // buffers on the root to the largest subtree:
+        for (std::vector<int>::iterator i = children.begin(); i != children.end(); ++i) {
+            Packet packet;
+            receivePacket(std::vector<int>(1, *i), &packet);
+            unpack(packet, &globalGrid);
+        }
 
-        if (lastCall && (mpiLayer.rank() == root)) {
+        if (lastCall) {
             writer->stepFinished(*globalGrid.vanillaGrid(), step, event);
         }
     }
 
 private:
+    /**
+     * Cells of a number of ranks, packed streak by streak. For each
+     * contributing rank segments holds the number of its streaks and
+     * cells.
+     */
+    class Packet
+    {
+    public:
+        std::vector<long> segments;
+        std::vector<Streak<DIM> > streaks;
+        std::vector<CELL_TYPE> cells;
+    };
+
     boost::shared_ptr<Writer<CELL_TYPE> > writer;
+    boost::shared_ptr<ParallelWriter<CELL_TYPE> > parallelWriter;
     MPILayer mpiLayer;
     int root;
+    int arity;
     StorageGridType globalGrid;
     MPI_Datatype datatype;
+
+    template<typename DELEGATE>
+    void checkDelegate(DELEGATE *delegate)
+    {
+        if (arity < 1) {
+            throw std::invalid_argument("arity of the gather tree must be positive");
+        }
+
+        if ((mpiLayer.rank() != root) && (delegate != 0)) {
+            throw std::invalid_argument("can't call back a writer on a node other than the root");
+        }
+
+        if ((mpiLayer.rank() == root) && (delegate == 0)) {
+            throw std::invalid_argument("delegate writer on root must not be null");
+        }
+    }
+
+    /**
+     * Ranks are renumbered so that the root becomes 0. Children of
+     * virtual rank v are arity * v + 1, ..., arity * v + arity.
+     */
+    int virtualRank(int rank) const
+    {
+        return (rank - root + mpiLayer.size()) % mpiLayer.size();
+    }
+
+    int realRank(int virtualRank) const
+    {
+        return (virtualRank + root) % mpiLayer.size();
+    }
+
+    int parentRank() const
+    {
+        return realRank((virtualRank(mpiLayer.rank()) - 1) / arity);
+    }
+
+    std::vector<int> childRanks() const
+    {
+        std::vector<int> ret;
+        int first = virtualRank(mpiLayer.rank()) * arity + 1;
+
+        for (int i = first; (i < (first + arity)) && (i < mpiLayer.size()); ++i) {
+            ret << realRank(i);
+        }
+
+        return ret;
+    }
+
+    void pack(const SimulatorGridType& grid, const Region<DIM>& validRegion, Packet *packet)
+    {
+        packet->segments << long(validRegion.numStreaks()) << long(validRegion.size());
+        packet->streaks.reserve(validRegion.numStreaks());
+        packet->cells.resize(validRegion.size());
+
+        CELL_TYPE *cursor = packet->cells.empty() ? 0 : &packet->cells[0];
+        for (typename Region<DIM>::StreakIterator i = validRegion.beginStreak(); i != validRegion.endStreak(); ++i) {
+            packet->streaks << *i;
+            grid.get(*i, cursor);
+            cursor += i->length();
+        }
+    }
+
+    void unpack(const Packet& packet, StorageGridType *target)
+    {
+        const CELL_TYPE *cursor = packet.cells.empty() ? 0 : &packet.cells[0];
+        for (typename std::vector<Streak<DIM> >::const_iterator i = packet.streaks.begin();
+             i != packet.streaks.end();
+             ++i) {
+            target->set(*i, cursor);
+            cursor += i->length();
+        }
+    }
+
+    /**
+     * Calls back the ParallelWriter once for each rank whose data is
+     * contained in packet.
+     */
+    void streamPacket(
+        const Packet& packet,
+        const CELL_TYPE& edgeCell,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        typename std::vector<Streak<DIM> >::const_iterator streak = packet.streaks.begin();
+        const CELL_TYPE *cursor = packet.cells.empty() ? 0 : &packet.cells[0];
+
+        for (std::size_t i = 0; i < packet.segments.size(); i += 2) {
+            Region<DIM> region;
+            for (long j = 0; j < packet.segments[i]; ++j) {
+                region << streak[j];
+            }
+
+            StorageGridType chunk(region.boundingBox(), CELL_TYPE(), edgeCell);
+            for (long j = 0; j < packet.segments[i]; ++j) {
+                chunk.set(*streak, cursor);
+                cursor += streak->length();
+                ++streak;
+            }
+
+            bool lastSegment = (i + 2) == packet.segments.size();
+            parallelWriter->stepFinished(
+                chunk, region, globalDimensions, step, event, rank, lastCall && lastSegment);
+        }
+    }
+
+    /**
+     * Receives the packets of all sources concurrently and appends
+     * them to packet. A header announces the size of each packet.
+     */
+    void receivePacket(const std::vector<int>& sources, Packet *packet)
+    {
+        const int tag = MPILayer::PARALLEL_MEMORY_WRITER;
+        std::vector<long> headers(3 * sources.size());
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            mpiLayer.recv(&headers[3 * i], sources[i], 3, tag);
+        }
+        mpiLayer.wait(tag);
+
+        std::size_t segmentOffset = packet->segments.size();
+        std::size_t streakOffset = packet->streaks.size();
+        std::size_t cellOffset = packet->cells.size();
+        std::size_t numSegments = segmentOffset;
+        std::size_t numStreaks = streakOffset;
+        std::size_t numCells = cellOffset;
+
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            numSegments += 2 * headers[3 * i + 0];
+            numStreaks  +=     headers[3 * i + 1];
+            numCells    +=     headers[3 * i + 2];
+        }
+
+        packet->segments.resize(numSegments);
+        packet->streaks.resize(numStreaks);
+        packet->cells.resize(numCells);
+
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            long segmentCount = 2 * headers[3 * i + 0];
+            long streakCount = headers[3 * i + 1];
+            long cellCount = headers[3 * i + 2];
+
+            if (segmentCount > 0) {
+                mpiLayer.recv(&packet->segments[segmentOffset], sources[i], segmentCount, tag);
+            }
+            if (streakCount > 0) {
+                mpiLayer.recv(&packet->streaks[streakOffset], sources[i], streakCount, tag);
+            }
+            if (cellCount > 0) {
+                mpiLayer.recv(&packet->cells[cellOffset], sources[i], cellCount, tag, datatype);
+            }
+
+            segmentOffset += segmentCount;
+            streakOffset += streakCount;
+            cellOffset += cellCount;
+        }
+        mpiLayer.wait(tag);
+    }
+
+    void sendPacket(const Packet& packet, int dest)
+    {
+        const int tag = MPILayer::PARALLEL_MEMORY_WRITER;
+        std::vector<long> header;
+        header << long(packet.segments.size() / 2)
+               << long(packet.streaks.size())
+               << long(packet.cells.size());
+
+        mpiLayer.send(&header[0], dest, 3, tag);
+        if (!packet.segments.empty()) {
+            mpiLayer.send(&packet.segments[0], dest, packet.segments.size(), tag);
+        }
+        if (!packet.streaks.empty()) {
+            mpiLayer.send(&packet.streaks[0], dest, packet.streaks.size(), tag);
+        }
+        if (!packet.cells.empty()) {
+            mpiLayer.send(&packet.cells[0], dest, packet.cells.size(), tag, datatype);
+        }
+        mpiLayer.wait(tag);
+    }
 };
 
 }
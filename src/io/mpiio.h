@@ -4,6 +4,8 @@
 #define LIBGEODECOMP_IO_MPIIO_H
 
 #include <mpi.h>
+#include <algorithm>
+#include <stdexcept>
 
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/communication/typemaps.h>
@@ -12,8 +14,47 @@
 
 namespace LibGeoDecomp {
 
+namespace MPIIOHelpers {
+
+/**
+ * A Streak of a Region along with the offset of its first cell in
+ * the file (in cells, not counting the header) and in the buffer
+ * which holds the cells in memory.
+ */
+template<int DIM>
+class Chunk
+{
+public:
+    inline Chunk(
+        const Streak<DIM>& streak,
+        MPI_Offset fileIndex,
+        std::size_t bufferIndex) :
+        streak(streak),
+        fileIndex(fileIndex),
+        bufferIndex(bufferIndex),
+        length(streak.length())
+    {}
+
+    inline bool operator<(const Chunk& other) const
+    {
+        return fileIndex < other.fileIndex;
+    }
+
+    Streak<DIM> streak;
+    MPI_Offset fileIndex;
+    std::size_t bufferIndex;
+    int length;
+};
+
+}
+
 /**
  * Utility class which bundles common MPI-based input/output code.
+ *
+ * Regions are read and written with a single collective operation
+ * per rank: the Region's streaks are turned into a file view so that
+ * the MPI implementation can aggregate the many small accesses into
+ * few large ones.
  */
 template<
     typename CELL_TYPE,
@@ -22,6 +63,67 @@ template<
 class MPIIO
 {
 public:
+    /**
+     * A Snapshot collects the cells of one or more Regions (e.g. from
+     * multiple calls to a ParallelWriter within one time step) so
+     * that they can be written in one go. Writing is split into
+     * beginWrite() and finishWrite(), which allows callers to go on
+     * while the data is being transferred to the file system.
+     */
+    template<int DIM>
+    class Snapshot
+    {
+    public:
+        friend class MPIIO;
+
+        inline Snapshot() :
+            file(MPI_FILE_NULL),
+            request(MPI_REQUEST_NULL),
+            fileType(MPI_DATATYPE_NULL),
+            memoryType(MPI_DATATYPE_NULL)
+        {}
+
+        /**
+         * Copies the cells of the region from the grid to the
+         * Snapshot's buffer.
+         */
+        template<typename GRID_TYPE>
+        void add(const GRID_TYPE& grid, const Region<DIM>& region, const Coord<DIM>& dimensions)
+        {
+            if (pending()) {
+                throw std::logic_error("can't add cells to a Snapshot which is still being written");
+            }
+
+            std::size_t offset = buffer.size();
+            buffer.resize(offset + region.size());
+
+            for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+                 i != region.endStreak();
+                 ++i) {
+                // the coords need to be normalized because on torus
+                // topologies the coordnates may exceed the bounding box
+                // (especially negative coordnates may occurr).
+                Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
+                chunks << MPIIOHelpers::Chunk<DIM>(*i, coord.toIndex(dimensions), offset);
+                grid.get(*i, &buffer[offset]);
+                offset += i->length();
+            }
+        }
+
+        inline bool pending() const
+        {
+            return file != MPI_FILE_NULL;
+        }
+
+    private:
+        std::vector<MPIIOHelpers::Chunk<DIM> > chunks;
+        std::vector<CELL_TYPE> buffer;
+        MPI_File file;
+        MPI_Request request;
+        MPI_Datatype fileType;
+        MPI_Datatype memoryType;
+    };
+
     template<typename GRID_TYPE, int DIM>
     void readRegion(
         GRID_TYPE *grid,
@@ -37,29 +139,41 @@ public:
         getLengths<DIM>(&headerLength, &cellLength, mpiDatatype);
 
         // edge cell is the last element of the header:
-        MPI_File_seek(file, headerLength - cellLength, MPI_SEEK_SET);
         CELL_TYPE cell;
-        MPI_File_read(file, &cell, 1, mpiDatatype, MPI_STATUS_IGNORE);
+        MPI_File_read_at(file, headerLength - cellLength, &cell, 1, mpiDatatype, MPI_STATUS_IGNORE);
         grid->setEdge(cell);
 
+        std::vector<MPIIOHelpers::Chunk<DIM> > chunks;
+        std::size_t offset = 0;
         for (typename Region<DIM>::StreakIterator i = region.beginStreak();
              i != region.endStreak();
              ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
             Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
-            MPI_File_seek(
-                file,
-                offset(headerLength, coord, dimensions, cellLength),
-                MPI_SEEK_SET);
-            int length = i->endX - i->origin.x();
-            std::vector<CELL_TYPE> vec(length);
-
-            MPI_File_read(file, &vec[0], length, mpiDatatype, MPI_STATUS_IGNORE);
-            grid->set(*i, &vec[0]);
+            chunks << MPIIOHelpers::Chunk<DIM>(*i, coord.toIndex(dimensions), offset);
+            offset += i->length();
+        }
+
+        std::vector<CELL_TYPE> buffer(offset);
+        MPI_Datatype fileType;
+        MPI_Datatype memoryType;
+        // overlapping chunks are fine as long as we don't write:
+        createDatatypes(&chunks, false, cellLength, mpiDatatype, &fileType, &memoryType);
+
+        setView(file, headerLength, mpiDatatype, fileType);
+        MPI_File_read_all(
+            file,
+            buffer.empty() ? 0 : &buffer[0],
+            memoryType == MPI_DATATYPE_NULL ? 0 : 1,
+            memoryType == MPI_DATATYPE_NULL ? mpiDatatype : memoryType,
+            MPI_STATUS_IGNORE);
+
+        for (typename std::vector<MPIIOHelpers::Chunk<DIM> >::iterator i = chunks.begin();
+             i != chunks.end();
+             ++i) {
+            grid->set(i->streak, &buffer[i->bufferIndex]);
         }
 
+        freeDatatypes(&fileType, &memoryType);
         MPI_File_close(&file);
     }
 
@@ -89,6 +203,32 @@ public:
         const MPI_Datatype& mpiDatatype = Typemaps::lookup<CELL_TYPE>(),
         const MPI_Comm& comm = MPI_COMM_WORLD)
     {
+        Snapshot<DIM> snapshot;
+        snapshot.add(grid, region, dimensions);
+        beginWrite(&snapshot, grid.getEdge(), dimensions, step, maxSteps, filename, mpiDatatype, comm);
+        finishWrite(&snapshot);
+    }
+
+    /**
+     * Opens the file and initiates a non-blocking, collective write
+     * of all cells in the snapshot. Rank 0 will also write the
+     * header. Needs to be called collectively.
+     */
+    template<int DIM>
+    void beginWrite(
+        Snapshot<DIM> *snapshot,
+        const CELL_TYPE& edgeCell,
+        const Coord<DIM>& dimensions,
+        unsigned step,
+        unsigned maxSteps,
+        const std::string& filename,
+        const MPI_Datatype& mpiDatatype = Typemaps::lookup<CELL_TYPE>(),
+        const MPI_Comm& comm = MPI_COMM_WORLD)
+    {
+        if (snapshot->pending()) {
+            throw std::logic_error("Snapshot is already being written");
+        }
+
         MPI_File file = openFileForWrite(filename, comm);
         MPI_Aint headerLength = 0;
         MPI_Aint cellLength = 0;
@@ -97,40 +237,58 @@ public:
         MPI_Comm_rank(comm, &rank);
 
         if (rank == 0) {
-            CELL_TYPE cell = grid.getEdge();
-            MPI_File_write(file, const_cast<Coord<DIM>*>(&dimensions),
-                           1, Typemaps::lookup<Coord<DIM> >(), MPI_STATUS_IGNORE);
+            MPI_Aint coordLength = getLength(Typemaps::lookup<Coord<DIM> >());
+            MPI_Aint unsignedLength = getLength(MPI_UNSIGNED);
+            CELL_TYPE cell = edgeCell;
 
-            MPI_File_write(file, const_cast<unsigned*>(&step),
-                           1, MPI_UNSIGNED, MPI_STATUS_IGNORE);
+            MPI_File_write_at(file, 0, const_cast<Coord<DIM>*>(&dimensions),
+                              1, Typemaps::lookup<Coord<DIM> >(), MPI_STATUS_IGNORE);
 
-            MPI_File_write(file, const_cast<unsigned*>(&maxSteps),
-                           1, MPI_UNSIGNED, MPI_STATUS_IGNORE);
+            MPI_File_write_at(file, coordLength, &step,
+                              1, MPI_UNSIGNED, MPI_STATUS_IGNORE);
 
-            MPI_File_write(file, &cell,
-                           1, mpiDatatype,  MPI_STATUS_IGNORE);
+            MPI_File_write_at(file, coordLength + unsignedLength, &maxSteps,
+                              1, MPI_UNSIGNED, MPI_STATUS_IGNORE);
+
+            MPI_File_write_at(file, headerLength - cellLength, &cell,
+                              1, mpiDatatype,  MPI_STATUS_IGNORE);
         }
 
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
-             i != region.endStreak();
-             ++i) {
-            // the coords need to be normalized because on torus
-            // topologies the coordnates may exceed the bounding box
-            // (especially negative coordnates may occurr).
-            Coord<DIM> coord = TOPOLOGY::normalize(i->origin, dimensions);
-            MPI_File_seek(
-                file,
-                offset(headerLength, coord, dimensions, cellLength),
-                MPI_SEEK_SET);
+        createDatatypes(
+            &snapshot->chunks,
+            true,
+            cellLength,
+            mpiDatatype,
+            &snapshot->fileType,
+            &snapshot->memoryType);
+        setView(file, headerLength, mpiDatatype, snapshot->fileType);
 
-            int length = i->endX - i->origin.x();
-            std::vector<CELL_TYPE> vec(length);
-            grid.get(*i, &vec[0]);
+        MPI_File_iwrite_all(
+            file,
+            snapshot->buffer.empty() ? 0 : &snapshot->buffer[0],
+            snapshot->memoryType == MPI_DATATYPE_NULL ? 0 : 1,
+            snapshot->memoryType == MPI_DATATYPE_NULL ? mpiDatatype : snapshot->memoryType,
+            &snapshot->request);
+        snapshot->file = file;
+    }
 
-            MPI_File_write(file, &vec[0], length, mpiDatatype, MPI_STATUS_IGNORE);
+    /**
+     * Waits for the write initiated by beginWrite() to complete and
+     * closes the file. The Snapshot may then be reused. Needs to be
+     * called collectively.
+     */
+    template<int DIM>
+    void finishWrite(Snapshot<DIM> *snapshot)
+    {
+        if (!snapshot->pending()) {
+            return;
         }
 
-        MPI_File_close(&file);
+        MPI_Wait(&snapshot->request, MPI_STATUS_IGNORE);
+        MPI_File_close(&snapshot->file);
+        freeDatatypes(&snapshot->fileType, &snapshot->memoryType);
+        snapshot->chunks.clear();
+        snapshot->buffer.clear();
     }
 
     MPI_File openFileForRead(
@@ -194,6 +352,99 @@ private:
         *headerLength = coordLength + 2 * unsignedLength + *cellLength;
     }
 
+    /**
+     * Creates the file view's filetype and the matching datatype for
+     * the buffer in memory from the given chunks. Both are set to
+     * MPI_DATATYPE_NULL if there are no chunks. The chunks need to
+     * be sorted by their offset in the file, and for writing they
+     * may not overlap either.
+     */
+    template<int DIM>
+    void createDatatypes(
+        std::vector<MPIIOHelpers::Chunk<DIM> > *chunks,
+        bool removeOverlap,
+        const MPI_Aint& cellLength,
+        const MPI_Datatype& mpiDatatype,
+        MPI_Datatype *fileType,
+        MPI_Datatype *memoryType)
+    {
+        *fileType = MPI_DATATYPE_NULL;
+        *memoryType = MPI_DATATYPE_NULL;
+        std::sort(chunks->begin(), chunks->end());
+
+        std::vector<int> lengths;
+        std::vector<MPI_Aint> fileDisplacements;
+        std::vector<MPI_Aint> memoryDisplacements;
+        MPI_Offset end = 0;
+
+        for (typename std::vector<MPIIOHelpers::Chunk<DIM> >::iterator i = chunks->begin();
+             i != chunks->end();
+             ++i) {
+            MPI_Offset fileIndex = i->fileIndex;
+            std::size_t bufferIndex = i->bufferIndex;
+            int length = i->length;
+
+            // streaks may exceed the grid's width (they'll then
+            // continue in the next row), so they can overlap with
+            // their successors:
+            if (removeOverlap && (i != chunks->begin()) && (fileIndex < end)) {
+                MPI_Offset cut = (std::min)(end - fileIndex, MPI_Offset(length));
+                fileIndex += cut;
+                bufferIndex += cut;
+                length -= cut;
+            }
+            end = (std::max)(end, fileIndex + length);
+
+            if (length > 0) {
+                lengths << length;
+                fileDisplacements << MPI_Aint(fileIndex * cellLength);
+                memoryDisplacements << MPI_Aint(bufferIndex * cellLength);
+            }
+        }
+
+        if (lengths.empty()) {
+            return;
+        }
+
+        MPI_Type_create_hindexed(
+            lengths.size(), &lengths[0], &fileDisplacements[0], mpiDatatype, fileType);
+        MPI_Type_commit(fileType);
+
+        MPI_Type_create_hindexed(
+            lengths.size(), &lengths[0], &memoryDisplacements[0], mpiDatatype, memoryType);
+        MPI_Type_commit(memoryType);
+    }
+
+    void freeDatatypes(MPI_Datatype *fileType, MPI_Datatype *memoryType)
+    {
+        if (*fileType != MPI_DATATYPE_NULL) {
+            MPI_Type_free(fileType);
+        }
+        if (*memoryType != MPI_DATATYPE_NULL) {
+            MPI_Type_free(memoryType);
+        }
+    }
+
+    /**
+     * Ranks without any cells still need to take part in the
+     * collective calls, they'll use the plain cell type as filetype
+     * and transfer zero elements.
+     */
+    void setView(
+        MPI_File file,
+        const MPI_Aint& headerLength,
+        const MPI_Datatype& mpiDatatype,
+        const MPI_Datatype& fileType)
+    {
+        MPI_File_set_view(
+            file,
+            headerLength,
+            mpiDatatype,
+            fileType == MPI_DATATYPE_NULL ? mpiDatatype : fileType,
+            const_cast<char*>("native"),
+            MPI_INFO_NULL);
+    }
+
     template<int DIM>
     Coord<DIM> getDimensions(MPI_File file)
     {
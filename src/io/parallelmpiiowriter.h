@@ -16,6 +16,14 @@ namespace LibGeoDecomp {
  * simulation for checkpoint/restart capabilities. Use this class for
  * parallel runs. Consider MPIIOInitializer for restarting from a
  * snapshot.
+ *
+ * All cells of a snapshot which are passed to this writer during one
+ * time step are collected and written in one collective operation
+ * once lastCall is set. If asynchronous is set (the default), the
+ * writer won't wait for the transfer to complete. The simulation can
+ * then continue while the snapshot drains to the file system; the
+ * writer will only block on it upon the next snapshot or at the end
+ * of the simulation. This costs a copy of the local cells.
  */
 template<typename CELL_TYPE>
 class ParallelMPIIOWriter : public Clonable<ParallelWriter<CELL_TYPE>, ParallelMPIIOWriter<CELL_TYPE> >
@@ -32,12 +40,24 @@ public:
         const std::string& prefix,
         const unsigned period,
         const unsigned maxSteps,
-        const MPI_Comm& communicator = MPI_COMM_WORLD) :
+        const MPI_Comm& communicator = MPI_COMM_WORLD,
+        bool asynchronous = true) :
         Clonable<ParallelWriter<CELL_TYPE>, ParallelMPIIOWriter<CELL_TYPE> >(prefix, period),
         maxSteps(maxSteps),
-        comm(communicator)
+        comm(communicator),
+        asynchronous(asynchronous)
     {}
 
+    /**
+     * Will block until a pending snapshot is written. As closing
+     * the file is a collective operation, all ranks need to
+     * destroy their writers.
+     */
+    virtual ~ParallelMPIIOWriter()
+    {
+        mpiio.finishWrite(&snapshot);
+    }
+
     virtual void stepFinished(
         const GridType& grid,
         const Region<Topology::DIM>& validRegion,
@@ -51,21 +71,35 @@ public:
             return;
         }
 
-        mpiio.writeRegion(
-            grid,
+        // the previous snapshot needs to be on disk before we can
+        // reuse the buffer:
+        mpiio.finishWrite(&snapshot);
+        snapshot.add(grid, validRegion, globalDimensions);
+        if (!lastCall) {
+            return;
+        }
+
+        mpiio.beginWrite(
+            &snapshot,
+            grid.getEdge(),
             globalDimensions,
             step,
             maxSteps,
             filename(step),
-            validRegion,
             APITraits::SelectMPIDataType<CELL_TYPE>::value(),
             comm);
+
+        if (!asynchronous || (event == WRITER_ALL_DONE)) {
+            mpiio.finishWrite(&snapshot);
+        }
     }
 
 private:
     MPIIO<CELL_TYPE> mpiio;
+    typename MPIIO<CELL_TYPE>::template Snapshot<DIM> snapshot;
     unsigned maxSteps;
     MPI_Comm comm;
+    bool asynchronous;
 
     std::string filename(unsigned step) const
     {
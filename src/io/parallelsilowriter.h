@@ -0,0 +1,554 @@
+#ifndef LIBGEODECOMP_IO_PARALLELSILOWRITER_H
+#define LIBGEODECOMP_IO_PARALLELSILOWRITER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_SILO
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/io/silowriter.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+/**
+ * ParallelSiloWriter is the SiloWriter's counterpart for
+ * DistributedSimulators. Instead of funneling all cells to one rank
+ * (as a SiloWriter behind a CollectingWriter would do), each rank
+ * writes its subdomain as a separate block. The ranks are split into
+ * numFiles groups of consecutive ranks. Each group shares one file to
+ * which its members write in turn (by passing a baton), so the number
+ * of files can be traded off against the degree of parallelism. The
+ * root then only adds a master file which holds multimeshes and
+ * multivars referencing all blocks.
+ *
+ * Selectors are added just like with the SiloWriter, which is also
+ * used internally to write the blocks' point meshes, unstructured
+ * grids and variables. Each block is buffered in a grid spanning the
+ * bounding box of the rank's region; cells outside of the region are
+ * default-constructed and thus shouldn't yield any points or shapes.
+ * The regular grid of a block is offset by its bounding box' origin
+ * and zones outside of the region are labeled as ghost zones.
+ *
+ * Silo refuses to write empty meshes, so blocks without any points
+ * or shapes omit the respective mesh and its variables. The master
+ * file lists these blocks as "EMPTY", which is Silo's convention for
+ * absent blocks in multimeshes and multivars.
+ */
+template<typename CELL>
+class ParallelSiloWriter : public Clonable<ParallelWriter<CELL>, ParallelSiloWriter<CELL> >
+{
+public:
+    typedef typename ParallelWriter<CELL>::GridType GridType;
+    typedef typename ParallelWriter<CELL>::Topology Topology;
+    typedef DisplacedGrid<CELL, Topology> StorageGridType;
+    typedef CELL Cell;
+
+    using ParallelWriter<CELL>::prefix;
+    using ParallelWriter<CELL>::region;
+
+    static const int DIM = Topology::DIM;
+
+    /**
+     * See SiloWriter for a description of the parameters. numFiles
+     * defaults to one file per rank.
+     */
+    ParallelSiloWriter(
+        const std::string& prefix,
+        const unsigned period,
+        const std::string& regularGridLabel = "regular_grid",
+        const std::string& unstructuredMeshLabel = "unstructured_mesh",
+        const std::string& pointMeshLabel = "point_mesh",
+        int databaseType = DB_PDB,
+        int numFiles = 0,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL>, ParallelSiloWriter<CELL> >(prefix, period),
+        siloWriter(prefix, period, regularGridLabel, unstructuredMeshLabel, pointMeshLabel, databaseType),
+        mpiLayer(communicator),
+        numFiles(numFiles),
+        root(root),
+        collecting(false)
+    {}
+
+    template<typename CONTAINER, typename CARGO>
+    ParallelSiloWriter(
+        CONTAINER CARGO:: *memberPointer,
+        const std::string& prefix,
+        const unsigned period,
+        const std::string& regularGridLabel = "regular_grid",
+        const std::string& unstructuredMeshLabel = "unstructured_mesh",
+        const std::string& pointMeshLabel = "point_mesh",
+        int databaseType = DB_PDB,
+        int numFiles = 0,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL>, ParallelSiloWriter<CELL> >(prefix, period),
+        siloWriter(
+            memberPointer, prefix, period, regularGridLabel, unstructuredMeshLabel, pointMeshLabel, databaseType),
+        mpiLayer(communicator),
+        numFiles(numFiles),
+        root(root),
+        collecting(false)
+    {}
+
+    template<typename CONTAINER1, typename CONTAINER2, typename CARGO1, typename CARGO2>
+    ParallelSiloWriter(
+        CONTAINER1 CARGO1:: *memberPointerForPointMesh,
+        CONTAINER2 CARGO2:: *memberPointerForUnstructuredGrid,
+        const std::string& prefix,
+        const unsigned period,
+        const std::string& regularGridLabel = "regular_grid",
+        const std::string& unstructuredMeshLabel = "unstructured_mesh",
+        const std::string& pointMeshLabel = "point_mesh",
+        int databaseType = DB_PDB,
+        int numFiles = 0,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        Clonable<ParallelWriter<CELL>, ParallelSiloWriter<CELL> >(prefix, period),
+        siloWriter(
+            memberPointerForPointMesh,
+            memberPointerForUnstructuredGrid,
+            prefix,
+            period,
+            regularGridLabel,
+            unstructuredMeshLabel,
+            pointMeshLabel,
+            databaseType),
+        mpiLayer(communicator),
+        numFiles(numFiles),
+        root(root),
+        collecting(false)
+    {}
+
+    template<typename MEMBER, typename CARGO>
+    void addSelectorForPointMesh(
+        MEMBER CARGO:: *memberPointer,
+        const std::string& memberName,
+        const boost::shared_ptr<FilterBase<CARGO> >& filter)
+    {
+        siloWriter.addSelectorForPointMesh(memberPointer, memberName, filter);
+    }
+
+    template<typename MEMBER, typename CARGO>
+    void addSelectorForPointMesh(
+        MEMBER CARGO:: *memberPointer,
+        const std::string& memberName)
+    {
+        siloWriter.addSelectorForPointMesh(memberPointer, memberName);
+    }
+
+    template<typename MEMBER, typename CARGO>
+    void addSelectorForUnstructuredGrid(
+        MEMBER CARGO:: *memberPointer,
+        const std::string& memberName,
+        const boost::shared_ptr<FilterBase<CARGO> >& filter)
+    {
+        siloWriter.addSelectorForUnstructuredGrid(memberPointer, memberName, filter);
+    }
+
+    template<typename MEMBER, typename CARGO>
+    void addSelectorForUnstructuredGrid(
+        MEMBER CARGO:: *memberPointer,
+        const std::string& memberName)
+    {
+        siloWriter.addSelectorForUnstructuredGrid(memberPointer, memberName);
+    }
+
+    template<typename MEMBER>
+    void addSelector(
+        MEMBER Cell:: *memberPointer,
+        const std::string& memberName,
+        const boost::shared_ptr<FilterBase<Cell> >& filter)
+    {
+        siloWriter.addSelector(memberPointer, memberName, filter);
+    }
+
+    template<typename MEMBER>
+    void addSelector(
+        MEMBER Cell:: *memberPointer,
+        const std::string& memberName)
+    {
+        siloWriter.addSelector(memberPointer, memberName);
+    }
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        const Coord<DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        // the simulator may call us multiple times per step, and the
+        // grid may be updated in between, so we need to buffer:
+        if (!collecting) {
+            CoordBox<DIM> box = region.boundingBox();
+            if (box.size() == 0) {
+                box = grid.boundingBox();
+            }
+            // start from scratch as cells outside of our region
+            // need to be default-constructed:
+            buffer = StorageGridType(box);
+
+            blockRegion.clear();
+            collecting = true;
+        }
+
+        buffer.paste(grid, validRegion);
+        buffer.setEdge(grid.getEdge());
+        blockRegion += validRegion;
+
+        if (!lastCall) {
+            return;
+        }
+
+        collecting = false;
+        int contents = writeBlock(step);
+
+        std::vector<int> blockContents = mpiLayer.gather(contents, root);
+        if (mpiLayer.rank() == root) {
+            writeMasterFile(step, blockContents);
+        }
+    }
+
+    std::string masterFilename(unsigned step) const
+    {
+        std::ostringstream buf;
+        buf << prefix << "." << std::setfill('0') << std::setw(5) << step << ".silo";
+        return buf.str();
+    }
+
+    std::string blockFilename(unsigned step, int group) const
+    {
+        std::ostringstream buf;
+        buf << prefix << "."
+            << std::setfill('0') << std::setw(5) << step << "."
+            << std::setfill('0') << std::setw(5) << group << ".silo";
+        return buf.str();
+    }
+
+    std::string blockDirectory(int rank) const
+    {
+        std::ostringstream buf;
+        buf << "domain_" << std::setfill('0') << std::setw(5) << rank;
+        return buf.str();
+    }
+
+    /**
+     * Returns the ID of the file the given rank writes to.
+     */
+    int group(int rank) const
+    {
+        int size = mpiLayer.size();
+        int files = ((numFiles <= 0) || (numFiles > size)) ? size : numFiles;
+        return static_cast<int>(static_cast<long>(rank) * files / size);
+    }
+
+private:
+    /**
+     * Flags which tell the root which meshes a block contains.
+     */
+    enum BlockContents {
+        REGULAR_GRID = 1,
+        POINT_MESH = 2,
+        UNSTRUCTURED_MESH = 4
+    };
+
+    SiloWriter<CELL> siloWriter;
+    MPILayer mpiLayer;
+    int numFiles;
+    int root;
+    StorageGridType buffer;
+    Region<DIM> blockRegion;
+    bool collecting;
+
+    /**
+     * Waits for the baton from the previous rank in our group, adds
+     * our block to the group's file and hands the baton on. The baton
+     * tells whether the file has already been created. Returns the
+     * block's BlockContents, 0 if we didn't write a block at all.
+     */
+    int writeBlock(unsigned step)
+    {
+        int rank = mpiLayer.rank();
+        int myGroup = group(rank);
+        int fileCreated = 0;
+        int contents = 0;
+
+        if ((rank > 0) && (group(rank - 1) == myGroup)) {
+            mpiLayer.recv(&fileCreated, rank - 1, 1, MPILayer::PARALLEL_SILO_WRITER, MPI_INT);
+            mpiLayer.wait(MPILayer::PARALLEL_SILO_WRITER);
+        }
+
+        if (!blockRegion.empty()) {
+            std::string filename = blockFilename(step, myGroup);
+            DBfile *dbfile = 0;
+            if (fileCreated) {
+                dbfile = DBOpen(filename.c_str(), DB_UNKNOWN, DB_APPEND);
+            } else {
+                dbfile = DBCreate(filename.c_str(), DB_CLOBBER, DB_LOCAL,
+                                  "simulation time step", siloWriter.databaseType);
+            }
+
+            std::string directory = blockDirectory(rank);
+            DBMkDir(dbfile, directory.c_str());
+            DBSetDir(dbfile, directory.c_str());
+            contents = writeBlockContents(dbfile);
+            DBClose(dbfile);
+            fileCreated = 1;
+        }
+
+        if ((rank < (mpiLayer.size() - 1)) && (group(rank + 1) == myGroup)) {
+            mpiLayer.send(&fileCreated, rank + 1, 1, MPILayer::PARALLEL_SILO_WRITER, MPI_INT);
+            mpiLayer.wait(MPILayer::PARALLEL_SILO_WRITER);
+        }
+
+        return contents;
+    }
+
+    /**
+     * Writes meshes and variables of our block to the current
+     * directory of dbfile.
+     */
+    int writeBlockContents(DBfile *dbfile)
+    {
+        int contents =
+            handleUnstructuredGrid(dbfile, typename APITraits::SelectUnstructuredGrid<Cell>::Value()) |
+            handlePointMesh(       dbfile, typename APITraits::SelectPointMesh<       Cell>::Value()) |
+            handleRegularGrid(     dbfile, typename APITraits::SelectRegularGrid<     Cell>::Value());
+
+        for (typename SiloWriter<CELL>::CellSelectorVec::iterator i = siloWriter.cellSelectors.begin();
+             i != siloWriter.cellSelectors.end();
+             ++i) {
+            siloWriter.handleVariable(dbfile, buffer, *i);
+        }
+
+        if (contents & UNSTRUCTURED_MESH) {
+            siloWriter.unstructuredGridSelectors->callbackHandleVariableForUnstructuredGrid(&siloWriter, dbfile, buffer);
+        }
+        if (contents & POINT_MESH) {
+            siloWriter.pointMeshSelectors->callbackHandleVariableForPointMesh(&siloWriter, dbfile, buffer);
+        }
+
+        return contents;
+    }
+
+    int handleUnstructuredGrid(DBfile *dbfile, APITraits::TrueType)
+    {
+        siloWriter.flushDataStores();
+        siloWriter.collectShapes(buffer);
+        if (siloWriter.elementTypes.empty()) {
+            return 0;
+        }
+
+        siloWriter.outputUnstructuredMesh(dbfile);
+        return UNSTRUCTURED_MESH;
+    }
+
+    int handleUnstructuredGrid(DBfile *dbfile, APITraits::FalseType)
+    {
+        return 0;
+    }
+
+    int handlePointMesh(DBfile *dbfile, APITraits::TrueType)
+    {
+        siloWriter.flushDataStores();
+        siloWriter.collectPoints(buffer);
+        if (siloWriter.coords[0].empty()) {
+            return 0;
+        }
+
+        siloWriter.outputPointMesh(dbfile);
+        return POINT_MESH;
+    }
+
+    int handlePointMesh(DBfile *dbfile, APITraits::FalseType)
+    {
+        return 0;
+    }
+
+    /**
+     * Unlike the SiloWriter's regular grid, a block's quadmesh is
+     * offset by its origin. Zones which belong to other blocks are
+     * masked.
+     */
+    int handleRegularGrid(DBfile *dbfile, APITraits::TrueType)
+    {
+        CoordBox<DIM> box = buffer.boundingBox();
+        FloatCoord<DIM> quadrantDim;
+        FloatCoord<DIM> origin;
+        APITraits::SelectRegularGrid<Cell>::value(&quadrantDim, &origin);
+
+        std::vector<std::vector<double> > coords(DIM);
+        int dimensions[DIM];
+        double *tempCoords[DIM];
+        for (int d = 0; d < DIM; ++d) {
+            for (int i = 0; i <= box.dimensions[d]; ++i) {
+                coords[d] << (origin[d] + quadrantDim[d] * (box.origin[d] + i));
+            }
+            dimensions[d] = coords[d].size();
+            tempCoords[d] = &coords[d][0];
+        }
+
+        std::vector<char> ghostLabels(box.dimensions.prod(), DB_GHOSTTYPE_INTDUP);
+        for (typename Region<DIM>::StreakIterator i = blockRegion.beginStreak(); i != blockRegion.endStreak(); ++i) {
+            std::size_t offset = (i->origin - box.origin).toIndex(box.dimensions);
+            std::fill(ghostLabels.begin() + offset, ghostLabels.begin() + offset + i->length(), DB_GHOSTTYPE_NOGHOST);
+        }
+
+        DBoptlist *optlist = DBMakeOptlist(1);
+        DBAddOption(optlist, DBOPT_GHOST_ZONE_LABELS, &ghostLabels[0]);
+        DBPutQuadmesh(dbfile, siloWriter.regularGridLabel.c_str(), NULL, tempCoords, dimensions, DIM,
+                      DB_DOUBLE, DB_COLLINEAR, optlist);
+        DBFreeOptlist(optlist);
+        return REGULAR_GRID;
+    }
+
+    int handleRegularGrid(DBfile *dbfile, APITraits::FalseType)
+    {
+        // intentionally left blank: the model doesn't expose a regular grid
+        return 0;
+    }
+
+    void writeMasterFile(unsigned step, const std::vector<int>& blockContents)
+    {
+        std::vector<int> blockRanks;
+        for (std::size_t i = 0; i < blockContents.size(); ++i) {
+            if (blockContents[i]) {
+                blockRanks << int(i);
+            }
+        }
+
+        if (blockRanks.empty()) {
+            return;
+        }
+
+        DBfile *dbfile = DBCreate(masterFilename(step).c_str(), DB_CLOBBER, DB_LOCAL,
+                                  "simulation time step", siloWriter.databaseType);
+
+        std::vector<std::string> cellVariables;
+        for (typename SiloWriter<CELL>::CellSelectorVec::iterator i = siloWriter.cellSelectors.begin();
+             i != siloWriter.cellSelectors.end();
+             ++i) {
+            cellVariables << i->name();
+        }
+
+        putMultiObjects(
+            dbfile, step, blockRanks, blockContents, UNSTRUCTURED_MESH,
+            siloWriter.unstructuredMeshLabel, DB_UCDMESH,
+            siloWriter.unstructuredGridSelectors->selectorNames(), DB_UCDVAR,
+            typename APITraits::SelectUnstructuredGrid<Cell>::Value());
+        putMultiObjects(
+            dbfile, step, blockRanks, blockContents, POINT_MESH,
+            siloWriter.pointMeshLabel, DB_POINTMESH,
+            siloWriter.pointMeshSelectors->selectorNames(), DB_POINTVAR,
+            typename APITraits::SelectPointMesh<Cell>::Value());
+        putMultiObjects(
+            dbfile, step, blockRanks, blockContents, REGULAR_GRID,
+            siloWriter.regularGridLabel, DB_QUAD_RECT,
+            cellVariables, DB_QUADVAR,
+            typename APITraits::SelectRegularGrid<Cell>::Value());
+
+        DBClose(dbfile);
+    }
+
+    void putMultiObjects(
+        DBfile *dbfile,
+        unsigned step,
+        const std::vector<int>& blockRanks,
+        const std::vector<int>& blockContents,
+        int meshFlag,
+        const std::string& meshLabel,
+        int meshType,
+        const std::vector<std::string>& variables,
+        int variableType,
+        APITraits::TrueType)
+    {
+        std::vector<int> meshRanks;
+        for (std::vector<int>::const_iterator i = blockRanks.begin(); i != blockRanks.end(); ++i) {
+            if (blockContents[*i] & meshFlag) {
+                meshRanks << *i;
+            }
+        }
+        if (meshRanks.empty()) {
+            return;
+        }
+
+        putMultiObject(dbfile, step, blockRanks, meshRanks, meshLabel, meshType, true);
+        for (std::vector<std::string>::const_iterator i = variables.begin(); i != variables.end(); ++i) {
+            putMultiObject(dbfile, step, blockRanks, meshRanks, *i, variableType, false);
+        }
+    }
+
+    void putMultiObjects(
+        DBfile *dbfile,
+        unsigned step,
+        const std::vector<int>& blockRanks,
+        const std::vector<int>& blockContents,
+        int meshFlag,
+        const std::string& meshLabel,
+        int meshType,
+        const std::vector<std::string>& variables,
+        int variableType,
+        APITraits::FalseType)
+    {
+        // intentionally left blank: the model doesn't expose this mesh
+    }
+
+    /**
+     * Blocks which lack the mesh (i.e. which aren't listed in
+     * meshRanks) are referenced as "EMPTY".
+     */
+    void putMultiObject(
+        DBfile *dbfile,
+        unsigned step,
+        const std::vector<int>& blockRanks,
+        const std::vector<int>& meshRanks,
+        const std::string& name,
+        int type,
+        bool isMesh)
+    {
+        std::string masterFile = masterFilename(step);
+        std::size_t pos = masterFile.find_last_of('/');
+        // blocks are referenced relative to the master file:
+        std::size_t basenameOffset = (pos == std::string::npos) ? 0 : (pos + 1);
+
+        std::vector<std::string> names;
+        for (std::vector<int>::const_iterator i = blockRanks.begin(); i != blockRanks.end(); ++i) {
+            if (std::find(meshRanks.begin(), meshRanks.end(), *i) == meshRanks.end()) {
+                names << std::string("EMPTY");
+                continue;
+            }
+
+            names << (blockFilename(step, group(*i)).substr(basenameOffset) + ":/" +
+                      blockDirectory(*i) + "/" + name);
+        }
+
+        std::vector<char*> namePointers;
+        for (std::vector<std::string>::iterator i = names.begin(); i != names.end(); ++i) {
+            namePointers << const_cast<char*>(i->c_str());
+        }
+        std::vector<int> types(names.size(), type);
+
+        if (isMesh) {
+            DBPutMultimesh(dbfile, name.c_str(), names.size(), &namePointers[0], &types[0], NULL);
+        } else {
+            DBPutMultivar(dbfile, name.c_str(), names.size(), &namePointers[0], &types[0], NULL);
+        }
+    }
+};
+
+}
+
+#endif
+#endif
+
+#endif
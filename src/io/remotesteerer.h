@@ -10,6 +10,7 @@
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/io/steerer.h>
 #include <libgeodecomp/io/remotesteerer/commandserver.h>
+#include <libgeodecomp/io/remotesteerer/datastreamer.h>
 #include <libgeodecomp/io/remotesteerer/handler.h>
 #include <libgeodecomp/io/remotesteerer/gethandler.h>
 #include <libgeodecomp/io/remotesteerer/pipe.h>
@@ -34,6 +35,10 @@ using namespace RemoteSteererHelpers;
  *
  * Keep in mind that the connection node will generally double as an
  * execution node.
+ *
+ * For live monitoring clients may additionally subscribe to a binary
+ * stream of selected members (see enableDataStreaming()), which
+ * bypasses the text protocol.
  */
 template<typename CELL_TYPE>
 class RemoteSteerer : public Steerer<CELL_TYPE>
@@ -53,6 +58,8 @@ public:
         MPI_Comm communicator = MPI_COMM_WORLD) :
         Steerer<CELL_TYPE>(period),
         port(port),
+        root(root),
+        communicator(communicator),
         pipe(new Pipe(root, communicator))
     {
         if (MPILayer(communicator).rank() == root) {
@@ -71,6 +78,10 @@ public:
         SteererFeedback *feedback)
     {
         LOG(DBG, "RemoteSteerer::nextStep(step = " << step << ")");
+        if (dataStreamer) {
+            dataStreamer->setGridDimensions(gridDim);
+            dataStreamer->forwardRequests(&*pipe);
+        }
         pipe->sync();
         StringVec steeringRequests = pipe->retrieveSteeringRequests();
 
@@ -95,6 +106,10 @@ public:
             }
         }
 
+        if (dataStreamer) {
+            dataStreamer->nextStep(*grid, validRegion, step, lastCall);
+        }
+
         pipe->sync();
     }
 
@@ -120,6 +135,35 @@ public:
         handlers["get_" + accessor->name()].reset(new GetHandler<CELL_TYPE, MEMBER_TYPE>(accessorPtr));
     }
 
+    /**
+     * Opens a second port on the connection node which serves
+     * subscriptions to binary snapshots of the members added via
+     * addSelector(). Snapshots are only sent on time steps for
+     * which the steerer is being called, so a subscription's period
+     * should be a multiple of the steerer's period. maxPendingFrames
+     * limits the number of frames queued per client: once reached
+     * the steerer skips this client's snapshots until it has caught
+     * up. Has to be called on all nodes.
+     */
+    void enableDataStreaming(int streamPort, std::size_t maxPendingFrames = 2)
+    {
+        dataStreamer.reset(new DataStreamer<CELL_TYPE>(streamPort, maxPendingFrames, root, communicator));
+        addHandler(new typename DataStreamer<CELL_TYPE>::SubscribeHandler(dataStreamer.get()));
+        addHandler(new typename DataStreamer<CELL_TYPE>::UnsubscribeHandler(dataStreamer.get()));
+    }
+
+    /**
+     * Makes a member available for streaming, clients refer to it by
+     * the selector's name.
+     */
+    void addSelector(const Selector<CELL_TYPE>& selector)
+    {
+        if (!dataStreamer) {
+            throw std::logic_error("RemoteSteerer::addSelector() requires enableDataStreaming()");
+        }
+        dataStreamer->addSelector(selector);
+    }
+
     void sendCommand(const std::string& command)
     {
         CommandServer<CELL_TYPE>::sendCommand(command, port);
@@ -133,8 +177,11 @@ public:
 private:
     HandlerMap handlers;
     int port;
+    int root;
+    MPI_Comm communicator;
     boost::shared_ptr<Pipe> pipe;
     boost::shared_ptr<CommandServer<CELL_TYPE> > commandServer;
+    boost::shared_ptr<DataStreamer<CELL_TYPE> > dataStreamer;
 };
 
 }
@@ -0,0 +1,466 @@
+#ifndef LIBGEODECOMP_IO_REMOTESTEERER_DATASTREAMER_H
+#define LIBGEODECOMP_IO_REMOTESTEERER_DATASTREAMER_H
+
+#include <libgeodecomp/config.h>
+#ifdef LIBGEODECOMP_WITH_MPI
+
+#include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/communication/typemaps.h>
+#include <libgeodecomp/geometry/region.h>
+#include <libgeodecomp/io/remotesteerer/handler.h>
+#include <libgeodecomp/io/remotesteerer/pipe.h>
+#include <libgeodecomp/io/remotesteerer/streamserver.h>
+#include <libgeodecomp/storage/selector.h>
+
+#include <cstring>
+#include <limits>
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+/**
+ * Serves the binary subscriptions of a RemoteSteerer. Subscriptions
+ * arrive via the StreamServer on the connection node and are
+ * broadcast to all nodes as steering requests, so that every node
+ * keeps an identical list of subscriptions. Once a subscription is
+ * due, each node copies its share of the (downsampled) box into a
+ * flat buffer, which is then gathered on the connection node and
+ * handed to the StreamServer. Sending happens in the StreamServer's
+ * session threads.
+ *
+ * Boxes are clipped to the grid. Subscriptions which don't
+ * intersect the grid or which would exceed the maximum frame size
+ * are rejected with an error frame.
+ *
+ * Subscriptions whose client lags behind are skipped for the
+ * current step (backpressure), which the connection node decides
+ * upfront so that no node wastes time on copying. All methods
+ * except addSelector() and the handlers' invocations are collective
+ * operations.
+ */
+template<typename CELL_TYPE>
+class DataStreamer
+{
+public:
+    typedef typename APITraits::SelectTopology<CELL_TYPE>::Value Topology;
+    static const int DIM = Topology::DIM;
+    typedef GridBase<CELL_TYPE, DIM> GridType;
+    typedef std::map<std::string, Selector<CELL_TYPE> > SelectorMap;
+
+    /**
+     * Registers a subscription on all nodes. Parameters are the ID
+     * assigned by the StreamServer, followed by the subscription
+     * line sent by the client (sans "subscribe").
+     */
+    class SubscribeHandler : public Handler<CELL_TYPE>
+    {
+    public:
+        explicit SubscribeHandler(DataStreamer *streamer) :
+            Handler<CELL_TYPE>("stream_subscribe"),
+            streamer(streamer)
+        {}
+
+        virtual bool operator()(const StringVec& parameters, Pipe& pipe, GridType *grid, const Region<DIM>& validRegion, unsigned step)
+        {
+            streamer->subscribe(parameters, pipe);
+            return true;
+        }
+
+    private:
+        DataStreamer *streamer;
+    };
+
+    class UnsubscribeHandler : public Handler<CELL_TYPE>
+    {
+    public:
+        explicit UnsubscribeHandler(DataStreamer *streamer) :
+            Handler<CELL_TYPE>("stream_unsubscribe"),
+            streamer(streamer)
+        {}
+
+        virtual bool operator()(const StringVec& parameters, Pipe& pipe, GridType *grid, const Region<DIM>& validRegion, unsigned step)
+        {
+            if (!parameters.empty()) {
+                streamer->unsubscribe(StringOps::atoi(parameters[0]));
+            }
+            return true;
+        }
+
+    private:
+        DataStreamer *streamer;
+    };
+
+    DataStreamer(
+        int port,
+        std::size_t maxPendingFrames = 2,
+        int root = 0,
+        MPI_Comm communicator = MPI_COMM_WORLD) :
+        mpiLayer(communicator),
+        root(root),
+        stepActive(false),
+        skipped(0)
+    {
+        if (mpiLayer.rank() == root) {
+            server.reset(new StreamServer(port, maxPendingFrames));
+        }
+    }
+
+    /**
+     * Makes the selected member available to clients under the
+     * selector's name. Has to be called on all nodes alike.
+     */
+    void addSelector(const Selector<CELL_TYPE>& selector)
+    {
+        selectors[selector.name()] = selector;
+    }
+
+    /**
+     * Frames are gathered via MPI, which counts bytes in int.
+     */
+    static std::size_t maxPayloadSize()
+    {
+        return std::numeric_limits<int>::max() - sizeof(StreamFrameHeader);
+    }
+
+    /**
+     * Sets the global dimensions of the grid, against which
+     * subscriptions will be checked. Call before the handlers are
+     * invoked.
+     */
+    void setGridDimensions(const Coord<DIM>& dimensions)
+    {
+        gridBox = CoordBox<DIM>(Coord<DIM>(), dimensions);
+    }
+
+    /**
+     * Moves new subscriptions and disconnects from the StreamServer
+     * to the pipe. Call before Pipe::sync().
+     */
+    void forwardRequests(Pipe *pipe)
+    {
+        if (!server) {
+            return;
+        }
+
+        StringVec requests = server->retrieveRequests();
+        for (StringVec::iterator i = requests.begin(); i != requests.end(); ++i) {
+            pipe->addSteeringRequest(*i);
+        }
+    }
+
+    void nextStep(
+        const GridType& grid,
+        const Region<DIM>& validRegion,
+        unsigned step,
+        bool lastCall)
+    {
+        if (subscriptions.empty()) {
+            return;
+        }
+
+        if (!stepActive) {
+            selectSubscriptions(step);
+            stepActive = true;
+        }
+
+        for (typename SubscriptionMap::iterator i = subscriptions.begin(); i != subscriptions.end(); ++i) {
+            if (i->second.active) {
+                snapshot(grid, validRegion, &i->second);
+            }
+        }
+
+        if (lastCall) {
+            for (typename SubscriptionMap::iterator i = subscriptions.begin(); i != subscriptions.end(); ++i) {
+                if (i->second.active) {
+                    sendFrame(step, &i->second);
+                }
+            }
+            stepActive = false;
+        }
+    }
+
+    std::size_t numSubscriptions() const
+    {
+        return subscriptions.size();
+    }
+
+    /**
+     * Number of frames which were not produced because the client
+     * was still busy receiving previous ones. Only counted on the
+     * connection node.
+     */
+    std::size_t skippedFrames() const
+    {
+        return skipped;
+    }
+
+private:
+    class Subscription
+    {
+    public:
+        int id;
+        Selector<CELL_TYPE> selector;
+        unsigned period;
+        int stride;
+        CoordBox<DIM> box;
+        Coord<DIM> latticeDim;
+        std::size_t payloadSize;
+        bool active;
+        std::vector<Streak<DIM> > streaks;
+        std::vector<char> buffer;
+    };
+
+    typedef std::map<int, Subscription> SubscriptionMap;
+
+    MPILayer mpiLayer;
+    int root;
+    boost::shared_ptr<StreamServer> server;
+    SelectorMap selectors;
+    SubscriptionMap subscriptions;
+    CoordBox<DIM> gridBox;
+    bool stepActive;
+    std::size_t skipped;
+
+    void subscribe(const StringVec& parameters, Pipe& pipe)
+    {
+        // ID MEMBER PERIOD STRIDE ORIGIN... DIMENSIONS...
+        if (parameters.size() < 1) {
+            return;
+        }
+        int id = StringOps::atoi(parameters[0]);
+
+        std::string error;
+        Subscription subscription;
+
+        if (parameters.size() != std::size_t(4 + 2 * DIM)) {
+            error = "expected MEMBER PERIOD STRIDE and " + StringOps::itoa(2 * DIM) + " box coordinates";
+        } else if (selectors.count(parameters[1]) == 0) {
+            error = "no selector found for member " + parameters[1];
+        } else {
+            subscription.selector = selectors[parameters[1]];
+            subscription.period = StringOps::atoi(parameters[2]);
+            subscription.stride = StringOps::atoi(parameters[3]);
+            for (int d = 0; d < DIM; ++d) {
+                subscription.box.origin[d]     = StringOps::atoi(parameters[4 + d]);
+                subscription.box.dimensions[d] = StringOps::atoi(parameters[4 + DIM + d]);
+            }
+
+            if ((subscription.period < 1) || (subscription.stride < 1)) {
+                error = "PERIOD and STRIDE need to be positive";
+            } else if (subscription.box.dimensions.minElement() < 1) {
+                error = "box is empty";
+            } else {
+                subscription.box = clipToGrid(subscription.box);
+                subscription.latticeDim =
+                    (subscription.box.dimensions + Coord<DIM>::diagonal(subscription.stride - 1)) /
+                    subscription.stride;
+
+                if (subscription.box.dimensions.minElement() < 1) {
+                    error = "box doesn't intersect the grid";
+                } else if (!computePayloadSize(
+                               subscription.latticeDim,
+                               subscription.selector.sizeOfExternal(),
+                               &subscription.payloadSize)) {
+                    error = "box exceeds the maximum frame size";
+                }
+            }
+        }
+
+        if (!error.empty()) {
+            if (server) {
+                LOG(WARN, "DataStreamer rejected subscription " << id << ": " << error);
+                pipe.addSteeringFeedback("stream subscription rejected: " + error);
+                server->reject(id, error);
+            }
+            return;
+        }
+
+        subscription.id = id;
+        subscription.active = false;
+        subscriptions[id] = subscription;
+    }
+
+    void unsubscribe(int id)
+    {
+        subscriptions.erase(id);
+    }
+
+    /**
+     * Intersects box with the grid. Clients may send arbitrary
+     * coordinates, hence the bounds are computed in long.
+     */
+    CoordBox<DIM> clipToGrid(const CoordBox<DIM>& box) const
+    {
+        CoordBox<DIM> ret;
+        for (int d = 0; d < DIM; ++d) {
+            long begin = (std::max)(long(box.origin[d]), long(gridBox.origin[d]));
+            long end = (std::min)(
+                long(box.origin[d])     + box.dimensions[d],
+                long(gridBox.origin[d]) + gridBox.dimensions[d]);
+
+            ret.origin[d] = begin;
+            ret.dimensions[d] = (std::max)(end - begin, 0L);
+        }
+
+        return ret;
+    }
+
+    /**
+     * Returns false if the payload would exceed maxPayloadSize().
+     */
+    static bool computePayloadSize(const Coord<DIM>& latticeDim, std::size_t elementSize, std::size_t *payloadSize)
+    {
+        std::size_t ret = elementSize;
+        for (int d = 0; d < DIM; ++d) {
+            if (ret > (maxPayloadSize() / latticeDim[d])) {
+                return false;
+            }
+            ret *= latticeDim[d];
+        }
+
+        *payloadSize = ret;
+        return ret <= maxPayloadSize();
+    }
+
+    /**
+     * The connection node decides which subscriptions are to be
+     * served in this step, based on their periods and the clients'
+     * backlog.
+     */
+    void selectSubscriptions(unsigned step)
+    {
+        std::vector<int> flags;
+        for (typename SubscriptionMap::iterator i = subscriptions.begin(); i != subscriptions.end(); ++i) {
+            bool due = (step % i->second.period) == 0;
+            int flag = due;
+
+            if (server && due) {
+                flag = server->ready(i->first);
+                skipped += !flag;
+            }
+
+            flags << flag;
+        }
+
+        if (mpiLayer.size() > 1) {
+            mpiLayer.broadcastVector(&flags, root);
+        }
+
+        std::vector<int>::iterator flag = flags.begin();
+        for (typename SubscriptionMap::iterator i = subscriptions.begin(); i != subscriptions.end(); ++i) {
+            i->second.active = *flag++;
+        }
+    }
+
+    /**
+     * Appends the lattice points within validRegion to the
+     * subscription's buffer. Streaks are recorded in lattice
+     * coordinates so the connection node can place the data.
+     */
+    void snapshot(const GridType& grid, const Region<DIM>& validRegion, Subscription *subscription)
+    {
+        Region<DIM> boxRegion;
+        boxRegion << subscription->box;
+        Region<DIM> region = validRegion & boxRegion;
+
+        const Coord<DIM>& origin = subscription->box.origin;
+        int stride = subscription->stride;
+        std::size_t elementSize = subscription->selector.sizeOfExternal();
+        std::size_t offset = subscription->buffer.size();
+
+        if (stride == 1) {
+            for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+                subscription->streaks << Streak<DIM>(i->origin - origin, i->endX - origin.x());
+            }
+            subscription->buffer.resize(offset + region.size() * elementSize);
+            if (region.size() > 0) {
+                grid.saveMemberUnchecked(&subscription->buffer[offset], MemoryLocation::HOST, subscription->selector, region);
+            }
+            return;
+        }
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            Coord<DIM> relativeOrigin = i->origin - origin;
+            bool onLattice = true;
+            for (int d = 1; d < DIM; ++d) {
+                onLattice &= ((relativeOrigin[d] % stride) == 0);
+            }
+            if (!onLattice) {
+                continue;
+            }
+
+            int firstX = origin.x() + (relativeOrigin.x() + stride - 1) / stride * stride;
+            if (firstX >= i->endX) {
+                continue;
+            }
+            int length = (i->endX - 1 - firstX) / stride + 1;
+
+            Coord<DIM> latticeOrigin = relativeOrigin / stride;
+            latticeOrigin.x() = (firstX - origin.x()) / stride;
+            subscription->streaks << Streak<DIM>(latticeOrigin, latticeOrigin.x() + length);
+
+            subscription->buffer.resize(offset + length * elementSize);
+            Coord<DIM> c = i->origin;
+            for (int j = 0; j < length; ++j) {
+                c.x() = firstX + j * stride;
+                CELL_TYPE cell = grid.get(c);
+                subscription->selector.copyMemberOut(
+                    &cell, MemoryLocation::HOST, &subscription->buffer[offset], MemoryLocation::HOST, 1);
+                offset += elementSize;
+            }
+        }
+    }
+
+    void sendFrame(unsigned step, Subscription *subscription)
+    {
+        std::vector<int> numStreaks = mpiLayer.gather(int(subscription->streaks.size()), root);
+        std::vector<Streak<DIM> > streaks(sum(numStreaks));
+        mpiLayer.gatherV(subscription->streaks, numStreaks, root, streaks);
+
+        std::vector<int> numBytes = mpiLayer.gather(int(subscription->buffer.size()), root);
+        std::vector<char> buffer(sum(numBytes));
+        mpiLayer.gatherV(subscription->buffer, numBytes, root, buffer);
+
+        subscription->streaks.clear();
+        subscription->buffer.clear();
+
+        if (!server) {
+            return;
+        }
+
+        std::size_t elementSize = subscription->selector.sizeOfExternal();
+        std::size_t payloadSize = subscription->payloadSize;
+        StreamServer::FramePtr frame(new std::vector<char>(sizeof(StreamFrameHeader) + payloadSize, 0));
+
+        StreamFrameHeader header;
+        header.magic = StreamFrameHeader::MAGIC;
+        header.subscription = subscription->id;
+        header.step = step;
+        header.elementSize = elementSize;
+        for (int d = 0; d < 3; ++d) {
+            header.origin[d]     = (d < DIM) ? subscription->box.origin[d] : 0;
+            header.dimensions[d] = (d < DIM) ? subscription->latticeDim[d] : 1;
+        }
+        header.payloadSize = payloadSize;
+        std::memcpy(&(*frame)[0], &header, sizeof(header));
+
+        char *payload = &(*frame)[sizeof(header)];
+        std::size_t cursor = 0;
+        for (typename std::vector<Streak<DIM> >::iterator i = streaks.begin(); i != streaks.end(); ++i) {
+            std::size_t length = i->length() * elementSize;
+            std::memcpy(payload + i->origin.toIndex(subscription->latticeDim) * elementSize, &buffer[cursor], length);
+            cursor += length;
+        }
+
+        server->post(header.subscription, frame);
+    }
+};
+
+}
+
+}
+
+#endif
+
+#endif
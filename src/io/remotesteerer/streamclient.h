@@ -0,0 +1,101 @@
+#ifndef LIBGEODECOMP_IO_REMOTESTEERER_STREAMCLIENT_H
+#define LIBGEODECOMP_IO_REMOTESTEERER_STREAMCLIENT_H
+
+#include <libgeodecomp/geometry/coordbox.h>
+#include <libgeodecomp/io/remotesteerer/streamserver.h>
+
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+/**
+ * Minimal client for the StreamServer, useful for tests, benchmarks
+ * and as a reference for implementing the protocol elsewhere.
+ */
+class StreamClient
+{
+public:
+    explicit StreamClient(int port, const std::string& host = "127.0.0.1") :
+        socket(ioService)
+    {
+        tcp::resolver resolver(ioService);
+        tcp::resolver::query query(host, StringOps::itoa(port));
+        boost::asio::connect(socket, resolver.resolve(query));
+    }
+
+    /**
+     * Requests the given member to be sent every period time steps.
+     * Only every stride-th cell (along each axis) of box will be
+     * transmitted.
+     */
+    template<int DIM>
+    void subscribe(const std::string& member, unsigned period, int stride, const CoordBox<DIM>& box)
+    {
+        std::stringstream buf;
+        buf << "subscribe " << member << " " << period << " " << stride;
+        for (int d = 0; d < DIM; ++d) {
+            buf << " " << box.origin[d];
+        }
+        for (int d = 0; d < DIM; ++d) {
+            buf << " " << box.dimensions[d];
+        }
+        buf << "\n";
+
+        boost::asio::write(socket, boost::asio::buffer(buf.str()));
+    }
+
+    /**
+     * Blocks until the next frame has arrived. Returns false if the
+     * server has closed the connection or rejected the subscription,
+     * see error() for the latter.
+     */
+    bool receive(StreamFrameHeader *header, std::vector<char> *payload)
+    {
+        boost::system::error_code errorCode;
+        boost::asio::read(socket, boost::asio::buffer(header, sizeof(StreamFrameHeader)), errorCode);
+        if (errorCode) {
+            return false;
+        }
+        if ((header->magic != StreamFrameHeader::MAGIC) &&
+            (header->magic != StreamFrameHeader::ERROR_MAGIC)) {
+            throw std::runtime_error("StreamClient received corrupted frame header");
+        }
+
+        payload->resize(header->payloadSize);
+        if (header->payloadSize > 0) {
+            boost::asio::read(socket, boost::asio::buffer(*payload), errorCode);
+            if (errorCode) {
+                return false;
+            }
+        }
+
+        if (header->magic == StreamFrameHeader::ERROR_MAGIC) {
+            lastError.assign(payload->begin(), payload->end());
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * The message sent by the server when it rejected the
+     * subscription, empty otherwise.
+     */
+    const std::string& error() const
+    {
+        return lastError;
+    }
+
+private:
+    boost::asio::io_service ioService;
+    tcp::socket socket;
+    std::string lastError;
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,379 @@
+#ifndef LIBGEODECOMP_IO_REMOTESTEERER_STREAMSERVER_H
+#define LIBGEODECOMP_IO_REMOTESTEERER_STREAMSERVER_H
+
+#include <libgeodecomp/io/logger.h>
+#include <libgeodecomp/misc/stringops.h>
+#include <libgeodecomp/misc/stringvec.h>
+
+#include <boost/asio.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+namespace RemoteSteererHelpers {
+
+using boost::asio::ip::tcp;
+
+/**
+ * Precedes every frame sent by the StreamServer. All fields are
+ * stored in the byte order of the connection node, payloadSize bytes
+ * of packed member data follow immediately. The payload is ordered
+ * lexicographically (x varies fastest) within a lattice of the given
+ * dimensions. The lattice's first point is located at origin, which
+ * may differ from the subscribed box's origin if that box exceeded
+ * the grid.
+ *
+ * If a subscription is rejected, the client receives a single frame
+ * with ERROR_MAGIC instead, the payload of which holds the error
+ * message. The server closes the connection afterwards.
+ */
+class StreamFrameHeader
+{
+public:
+    static const unsigned MAGIC = 0x5344474c;
+    static const unsigned ERROR_MAGIC = 0x5344474d;
+
+    unsigned magic;
+    int subscription;
+    unsigned step;
+    unsigned elementSize;
+    int origin[3];
+    int dimensions[3];
+    unsigned payloadSize;
+};
+
+/**
+ * The StreamServer is the binary counterpart of the CommandServer:
+ * clients connect to a dedicated port, send a single line
+ *
+ *   subscribe MEMBER PERIOD STRIDE ORIGIN... DIMENSIONS...
+ *
+ * and will from then on receive a StreamFrameHeader and packed
+ * member data whenever a frame is posted for their subscription.
+ * Each client is served by its own thread, so slow clients won't
+ * stall the simulation. Instead ready() will report false once
+ * maxPendingFrames frames are waiting to be sent, which the producer
+ * should take as a hint to skip the snapshot altogether.
+ *
+ * The StreamServer neither interprets the subscription nor talks
+ * MPI. New subscriptions and disconnects are queued as steering
+ * requests ("stream_subscribe ID ..." and "stream_unsubscribe ID"),
+ * to be fetched via retrieveRequests().
+ */
+class StreamServer
+{
+public:
+    typedef boost::shared_ptr<std::vector<char> > FramePtr;
+
+    StreamServer(int port, std::size_t maxPendingFrames = 2) :
+        port(port),
+        maxPendingFrames(maxPendingFrames),
+        nextID(0),
+        stopFlag(false),
+        serverThread(&StreamServer::runServer, this)
+    {
+        // see CommandServer: we may not return before the acceptor
+        // exists, or the d-tor couldn't wake the server thread.
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while (!acceptor) {
+            signal.wait(lock);
+        }
+    }
+
+    ~StreamServer()
+    {
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            stopFlag = true;
+        }
+
+        // wake the server thread which is blocking in accept():
+        try {
+            tcp::socket socket(ioService);
+            socket.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+        } catch (std::exception& e) {
+            LOG(WARN, "StreamServer could not wake server thread: " << e.what());
+        }
+        serverThread.join();
+
+        SessionMap remainingSessions;
+        {
+            boost::lock_guard<boost::mutex> lock(mutex);
+            for (SessionMap::iterator i = sessions.begin(); i != sessions.end(); ++i) {
+                shutdown(i->second);
+            }
+            signal.notify_all();
+            swap(remainingSessions, sessions);
+        }
+
+        for (SessionMap::iterator i = remainingSessions.begin(); i != remainingSessions.end(); ++i) {
+            i->second->thread.join();
+        }
+    }
+
+    /**
+     * Returns all subscriptions/disconnects which have occurred
+     * since the last call.
+     */
+    StringVec retrieveRequests()
+    {
+        using std::swap;
+        StringVec ret;
+        boost::lock_guard<boost::mutex> lock(mutex);
+        swap(ret, requests);
+        return ret;
+    }
+
+    /**
+     * True if the subscription is alive and its client can keep up.
+     */
+    bool ready(int id)
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        SessionMap::iterator i = sessions.find(id);
+        return (i != sessions.end()) &&
+            !i->second->closed &&
+            !i->second->rejected &&
+            (i->second->frames.size() < maxPendingFrames);
+    }
+
+    /**
+     * Queues a frame for sending. The frame must not be modified
+     * afterwards as the session thread may access it at any time.
+     */
+    void post(int id, FramePtr frame)
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        SessionMap::iterator i = sessions.find(id);
+        if ((i == sessions.end()) || i->second->closed || i->second->rejected) {
+            return;
+        }
+
+        i->second->frames.push_back(frame);
+        signal.notify_all();
+    }
+
+    /**
+     * Drops the client, e.g. if its subscription was invalid.
+     */
+    void close(int id)
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        SessionMap::iterator i = sessions.find(id);
+        if (i != sessions.end()) {
+            shutdown(i->second);
+            signal.notify_all();
+        }
+    }
+
+    /**
+     * Sends an error frame (see StreamFrameHeader) to the client
+     * and drops it afterwards.
+     */
+    void reject(int id, const std::string& message)
+    {
+        StreamFrameHeader header;
+        header.magic = StreamFrameHeader::ERROR_MAGIC;
+        header.subscription = id;
+        header.step = 0;
+        header.elementSize = 0;
+        for (int d = 0; d < 3; ++d) {
+            header.origin[d] = 0;
+            header.dimensions[d] = 0;
+        }
+        header.payloadSize = message.size();
+
+        FramePtr frame(new std::vector<char>(sizeof(header) + message.size()));
+        std::memcpy(&(*frame)[0], &header, sizeof(header));
+        std::copy(message.begin(), message.end(), frame->begin() + sizeof(header));
+
+        boost::lock_guard<boost::mutex> lock(mutex);
+        SessionMap::iterator i = sessions.find(id);
+        if ((i == sessions.end()) || i->second->closed) {
+            return;
+        }
+
+        i->second->frames.push_back(frame);
+        i->second->rejected = true;
+        signal.notify_all();
+    }
+
+private:
+    class Session
+    {
+    public:
+        Session(int id, boost::shared_ptr<tcp::socket> socket) :
+            id(id),
+            socket(socket),
+            closed(false),
+            rejected(false),
+            finished(false)
+        {}
+
+        int id;
+        boost::shared_ptr<tcp::socket> socket;
+        std::deque<FramePtr> frames;
+        bool closed;
+        bool rejected;
+        bool finished;
+        boost::thread thread;
+    };
+
+    typedef boost::shared_ptr<Session> SessionPtr;
+    typedef std::map<int, SessionPtr> SessionMap;
+
+    int port;
+    std::size_t maxPendingFrames;
+    int nextID;
+    bool stopFlag;
+    boost::asio::io_service ioService;
+    boost::shared_ptr<tcp::acceptor> acceptor;
+    boost::mutex mutex;
+    boost::condition_variable signal;
+    SessionMap sessions;
+    StringVec requests;
+    boost::thread serverThread;
+
+    /**
+     * Expects the lock to be held.
+     */
+    void shutdown(SessionPtr session)
+    {
+        session->closed = true;
+        boost::system::error_code errorCode;
+        session->socket->shutdown(tcp::socket::shutdown_both, errorCode);
+    }
+
+    void runServer()
+    {
+        try {
+            {
+                boost::lock_guard<boost::mutex> lock(mutex);
+                acceptor.reset(new tcp::acceptor(ioService, tcp::endpoint(tcp::v4(), port)));
+            }
+            signal.notify_all();
+
+            for (;;) {
+                boost::shared_ptr<tcp::socket> socket(new tcp::socket(ioService));
+                boost::system::error_code errorCode;
+                acceptor->accept(*socket, errorCode);
+
+                boost::lock_guard<boost::mutex> lock(mutex);
+                if (stopFlag) {
+                    return;
+                }
+                if (errorCode) {
+                    LOG(WARN, "StreamServer::runServer() encountered " << errorCode.message());
+                    continue;
+                }
+
+                reapSessions();
+                SessionPtr session(new Session(nextID++, socket));
+                sessions[session->id] = session;
+                session->thread = boost::thread(&StreamServer::runSession, this, session);
+                LOG(INFO, "StreamServer: client " << session->id << " connected");
+            }
+        }
+        catch (std::exception& e) {
+            LOG(FATAL, "StreamServer::runServer() listening on port " << port
+                << " caught exception " << e.what() << ", exiting");
+        }
+    }
+
+    /**
+     * Joins threads of disconnected clients. Expects the lock to be
+     * held.
+     */
+    void reapSessions()
+    {
+        for (SessionMap::iterator i = sessions.begin(); i != sessions.end();) {
+            if (i->second->finished) {
+                i->second->thread.join();
+                sessions.erase(i++);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void runSession(SessionPtr session)
+    {
+        bool subscribed = readSubscription(session);
+
+        while (subscribed) {
+            FramePtr frame;
+            {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                while (!session->closed && session->frames.empty()) {
+                    signal.wait(lock);
+                }
+                if (session->closed) {
+                    break;
+                }
+
+                frame = session->frames.front();
+            }
+
+            boost::system::error_code errorCode;
+            boost::asio::write(
+                *session->socket,
+                boost::asio::buffer(*frame),
+                boost::asio::transfer_all(),
+                errorCode);
+
+            boost::lock_guard<boost::mutex> lock(mutex);
+            session->frames.pop_front();
+            if (errorCode) {
+                LOG(INFO, "StreamServer: client " << session->id << " lost: " << errorCode.message());
+                break;
+            }
+            if (session->rejected && session->frames.empty()) {
+                break;
+            }
+        }
+
+        boost::lock_guard<boost::mutex> lock(mutex);
+        if (subscribed) {
+            requests << "stream_unsubscribe " + StringOps::itoa(session->id);
+        }
+        shutdown(session);
+        session->frames.clear();
+        session->finished = true;
+    }
+
+    bool readSubscription(SessionPtr session)
+    {
+        boost::asio::streambuf buf;
+        boost::system::error_code errorCode;
+        boost::asio::read_until(*session->socket, buf, '\n', errorCode);
+        if (errorCode) {
+            return false;
+        }
+
+        std::istream stream(&buf);
+        std::string line;
+        std::getline(stream, line);
+        StringVec parameters = StringOps::tokenize(line, " \r");
+
+        if (parameters.empty() || (pop_front(parameters) != "subscribe")) {
+            LOG(WARN, "StreamServer: client " << session->id << " sent »" << line << "«, expected subscription");
+            return false;
+        }
+
+        boost::lock_guard<boost::mutex> lock(mutex);
+        requests << "stream_subscribe " + StringOps::itoa(session->id) + " " + StringOps::join(parameters, " ");
+        return true;
+    }
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ActionTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/actiontest.h"
+
+static ActionTest suite_ActionTest;
+
+static CxxTest::List Tests_ActionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ActionTest( "/root/repo/src/io/remotesteerer/test/parallel_mpi_1/actiontest.h", 12, "ActionTest", suite_ActionTest, Tests_ActionTest );
+
+static class TestDescription_suite_ActionTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ActionTest_testBasic() : CxxTest::RealTestDescription( Tests_ActionTest, suiteDescription_ActionTest, 28, "testBasic" ) {}
+ void runTest() { suite_ActionTest.testBasic(); }
+} testDescription_suite_ActionTest_testBasic;
+
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_InteractorTest_init = false;
+#include "/root/repo/src/io/remotesteerer/test/unit/interactortest.h"
+
+static InteractorTest suite_InteractorTest;
+
+static CxxTest::List Tests_InteractorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_InteractorTest( "/root/repo/src/io/remotesteerer/test/unit/interactortest.h", 12, "InteractorTest", suite_InteractorTest, Tests_InteractorTest );
+
+static class TestDescription_suite_InteractorTest_testThreaded : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_InteractorTest_testThreaded() : CxxTest::RealTestDescription( Tests_InteractorTest, suiteDescription_InteractorTest, 15, "testThreaded" ) {}
+ void runTest() { suite_InteractorTest.testThreaded(); }
+} testDescription_suite_InteractorTest_testThreaded;
+
@@ -104,6 +104,9 @@ public:
     virtual
     void callbackHandleVariableForPointMesh(SILO_WRITER *writer, DBfile *dbfile, const GridType& grid) = 0;
 
+    virtual
+    std::vector<std::string> selectorNames() = 0;
+
 protected:
     int typeId;
     SelectorVecBase *selectors;
@@ -158,12 +161,26 @@ public:
         }
     }
 
+    std::vector<std::string> selectorNames()
+    {
+        std::vector<std::string> ret;
+        SelectorVec<Cargo> *mySelectors = static_cast<SelectorVec<Cargo>*>(selectors);
+        for (typename SelectorVec<Cargo>::iterator i = mySelectors->begin(); i != mySelectors->end(); ++i) {
+            ret << i->name();
+        }
+
+        return ret;
+    }
+
 private:
     COLLECTION_INTERFACE collectionInterface;
 };
 
 }
 
+template<typename CELL>
+class ParallelSiloWriter;
+
 /**
  * SiloWriter makes use of the Silo library (
  * https://wci.llnl.gov/codes/silo/ ) to write regular grids,
@@ -179,6 +196,7 @@ class SiloWriter : public Clonable<Writer<CELL>, SiloWriter<CELL> >
 public:
     template<typename SILO_WRITER, typename COLLECTION_INTERFACE>
     friend class SiloWriterHelpers::SelectorContainerImplementation;
+    friend class ParallelSiloWriter<CELL>;
 
     typedef typename Writer<CELL>::GridType GridType;
     typedef typename Writer<CELL>::Topology Topology;
@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ASCIIWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_1/asciiwritertest.h"
+
+static ASCIIWriterTest suite_ASCIIWriterTest;
+
+static CxxTest::List Tests_ASCIIWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ASCIIWriterTest( "/root/repo/src/io/test/parallel_mpi_1/asciiwritertest.h", 23, "ASCIIWriterTest", suite_ASCIIWriterTest, Tests_ASCIIWriterTest );
+
+static class TestDescription_suite_ASCIIWriterTest_testWriteASCII : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ASCIIWriterTest_testWriteASCII() : CxxTest::RealTestDescription( Tests_ASCIIWriterTest, suiteDescription_ASCIIWriterTest, 44, "testWriteASCII" ) {}
+ void runTest() { suite_ASCIIWriterTest.testWriteASCII(); }
+} testDescription_suite_ASCIIWriterTest_testWriteASCII;
+
+static class TestDescription_suite_ASCIIWriterTest_testWriteASCIIEveryN : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ASCIIWriterTest_testWriteASCIIEveryN() : CxxTest::RealTestDescription( Tests_ASCIIWriterTest, suiteDescription_ASCIIWriterTest, 70, "testWriteASCIIEveryN" ) {}
+ void runTest() { suite_ASCIIWriterTest.testWriteASCIIEveryN(); }
+} testDescription_suite_ASCIIWriterTest_testWriteASCIIEveryN;
+
+static class TestDescription_suite_ASCIIWriterTest_testFileOpenError : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ASCIIWriterTest_testFileOpenError() : CxxTest::RealTestDescription( Tests_ASCIIWriterTest, suiteDescription_ASCIIWriterTest, 88, "testFileOpenError" ) {}
+ void runTest() { suite_ASCIIWriterTest.testFileOpenError(); }
+} testDescription_suite_ASCIIWriterTest_testFileOpenError;
+
@@ -0,0 +1,75 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AsyncWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_1/asyncwritertest.h"
+
+static AsyncWriterTest suite_AsyncWriterTest;
+
+static CxxTest::List Tests_AsyncWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AsyncWriterTest( "/root/repo/src/io/test/parallel_mpi_1/asyncwritertest.h", 121, "AsyncWriterTest", suite_AsyncWriterTest, Tests_AsyncWriterTest );
+
+static class TestDescription_suite_AsyncWriterTest_testSerialSimulatorMatchesSynchronousOutput : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testSerialSimulatorMatchesSynchronousOutput() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 138, "testSerialSimulatorMatchesSynchronousOutput" ) {}
+ void runTest() { suite_AsyncWriterTest.testSerialSimulatorMatchesSynchronousOutput(); }
+} testDescription_suite_AsyncWriterTest_testSerialSimulatorMatchesSynchronousOutput;
+
+static class TestDescription_suite_AsyncWriterTest_testDropPolicy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testDropPolicy() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 155, "testDropPolicy" ) {}
+ void runTest() { suite_AsyncWriterTest.testDropPolicy(); }
+} testDescription_suite_AsyncWriterTest_testDropPolicy;
+
+static class TestDescription_suite_AsyncWriterTest_testCoalescePolicy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testCoalescePolicy() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 177, "testCoalescePolicy" ) {}
+ void runTest() { suite_AsyncWriterTest.testCoalescePolicy(); }
+} testDescription_suite_AsyncWriterTest_testCoalescePolicy;
+
+static class TestDescription_suite_AsyncWriterTest_testBlockPolicySnapshotsAreIndependentOfLaterChanges : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testBlockPolicySnapshotsAreIndependentOfLaterChanges() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 204, "testBlockPolicySnapshotsAreIndependentOfLaterChanges" ) {}
+ void runTest() { suite_AsyncWriterTest.testBlockPolicySnapshotsAreIndependentOfLaterChanges(); }
+} testDescription_suite_AsyncWriterTest_testBlockPolicySnapshotsAreIndependentOfLaterChanges;
+
+static class TestDescription_suite_AsyncWriterTest_testSelector : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testSelector() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 227, "testSelector" ) {}
+ void runTest() { suite_AsyncWriterTest.testSelector(); }
+} testDescription_suite_AsyncWriterTest_testSelector;
+
+static class TestDescription_suite_AsyncWriterTest_testParallelWriterGathersCallsPerStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testParallelWriterGathersCallsPerStep() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 254, "testParallelWriterGathersCallsPerStep" ) {}
+ void runTest() { suite_AsyncWriterTest.testParallelWriterGathersCallsPerStep(); }
+} testDescription_suite_AsyncWriterTest_testParallelWriterGathersCallsPerStep;
+
+static class TestDescription_suite_AsyncWriterTest_testDelegateErrorsAreRethrown : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AsyncWriterTest_testDelegateErrorsAreRethrown() : CxxTest::RealTestDescription( Tests_AsyncWriterTest, suiteDescription_AsyncWriterTest, 292, "testDelegateErrorsAreRethrown" ) {}
+ void runTest() { suite_AsyncWriterTest.testDelegateErrorsAreRethrown(); }
+} testDescription_suite_AsyncWriterTest_testDelegateErrorsAreRethrown;
+
@@ -0,0 +1,311 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/asyncwriter.h>
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/parallelization/serialsimulator.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+
+/**
+ * Holds back the IO thread until the test opens it.
+ */
+class AsyncWriterTestGate
+{
+public:
+    AsyncWriterTestGate() :
+        isOpen(false)
+    {}
+
+    void wait()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while (!isOpen) {
+            condition.wait(lock);
+        }
+    }
+
+    void open()
+    {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        isOpen = true;
+        condition.notify_all();
+    }
+
+private:
+    bool isOpen;
+    boost::mutex mutex;
+    boost::condition_variable condition;
+};
+
+/**
+ * Records the steps it sees and the testValue of one cell per step.
+ */
+class GatedWriter : public Clonable<Writer<TestCell<2> >, GatedWriter>
+{
+public:
+    explicit GatedWriter(AsyncWriterTestGate *gate = 0) :
+        Clonable<Writer<TestCell<2> >, GatedWriter>("", 1),
+        gate(gate)
+    {}
+
+    virtual void stepFinished(const GridType& grid, unsigned step, WriterEvent event)
+    {
+        if (gate) {
+            gate->wait();
+        }
+
+        if (step == 666) {
+            throw std::runtime_error("the devil is in the details");
+        }
+
+        steps << step;
+        events << event;
+        values << grid.get(Coord<2>(1, 1)).testValue;
+    }
+
+    AsyncWriterTestGate *gate;
+    std::vector<unsigned> steps;
+    std::vector<WriterEvent> events;
+    std::vector<double> values;
+};
+
+/**
+ * Stores all calls for later inspection.
+ */
+class RecordingParallelWriter : public Clonable<ParallelWriter<TestCell<2> >, RecordingParallelWriter>
+{
+public:
+    typedef DisplacedGrid<TestCell<2> > StorageGrid;
+
+    RecordingParallelWriter() :
+        Clonable<ParallelWriter<TestCell<2> >, RecordingParallelWriter>("", 1)
+    {}
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<2>& validRegion,
+        const Coord<2>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        StorageGrid copy(validRegion.boundingBox());
+        copy.paste(grid, validRegion);
+
+        grids << copy;
+        regions << validRegion;
+        steps << step;
+        ranks << rank;
+        lastCalls << lastCall;
+        dimensions << globalDimensions;
+    }
+
+    std::vector<StorageGrid> grids;
+    std::vector<Region<2> > regions;
+    std::vector<unsigned> steps;
+    std::vector<std::size_t> ranks;
+    std::vector<bool> lastCalls;
+    std::vector<Coord<2> > dimensions;
+};
+
+#endif
+
+class AsyncWriterTest : public CxxTest::TestSuite
+{
+public:
+    typedef Grid<TestCell<2> > GridType;
+
+    void setUp()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        grid = GridType(Coord<2>(10, 5));
+        for (int y = 0; y < 5; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                grid[Coord<2>(x, y)].testValue = y * 10 + x;
+            }
+        }
+#endif
+    }
+
+    void testSerialSimulatorMatchesSynchronousOutput()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        SerialSimulator<TestCell<2> > sim(new TestInitializer<TestCell<2> >());
+        MemoryWriter<TestCell<2> > *syncWriter = new MemoryWriter<TestCell<2> >(3);
+        MemoryWriter<TestCell<2> > *asyncDelegate = new MemoryWriter<TestCell<2> >(3);
+        sim.addWriter(syncWriter);
+        sim.addWriter(new AsyncWriter<TestCell<2> >(asyncDelegate, 3));
+        sim.run();
+
+        TS_ASSERT_EQUALS(syncWriter->getGrids().size(), asyncDelegate->getGrids().size());
+        for (std::size_t i = 0; i < syncWriter->getGrids().size(); ++i) {
+            TS_ASSERT(syncWriter->getGrids()[i] == asyncDelegate->getGrids()[i]);
+        }
+#endif
+    }
+
+    void testDropPolicy()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        AsyncWriterTestGate gate;
+        GatedWriter *delegate = new GatedWriter(&gate);
+        AsyncWriter<TestCell<2> > writer(delegate, 1, ASYNC_WRITER_DROP);
+
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+        // the IO thread is stuck with step 0, so these get lost:
+        writer.stepFinished(grid, 1, WRITER_STEP_FINISHED);
+        writer.stepFinished(grid, 2, WRITER_STEP_FINISHED);
+        TS_ASSERT_EQUALS(std::size_t(2), writer.droppedSnapshots());
+
+        gate.open();
+        writer.stepFinished(grid, 3, WRITER_ALL_DONE);
+
+        std::vector<unsigned> expected;
+        expected << 0 << 3;
+        TS_ASSERT_EQUALS(expected, delegate->steps);
+#endif
+    }
+
+    void testCoalescePolicy()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        AsyncWriterTestGate gate;
+        GatedWriter *delegate = new GatedWriter(&gate);
+        AsyncWriter<TestCell<2> > writer(delegate, 2, ASYNC_WRITER_COALESCE);
+
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+        writer.stepFinished(grid, 1, WRITER_STEP_FINISHED);
+        grid[Coord<2>(1, 1)].testValue = 4711;
+        // replaces step 1, which is still waiting in the queue:
+        writer.stepFinished(grid, 2, WRITER_STEP_FINISHED);
+        TS_ASSERT_EQUALS(std::size_t(1), writer.coalescedSnapshots());
+
+        gate.open();
+        writer.stepFinished(grid, 3, WRITER_ALL_DONE);
+
+        std::vector<unsigned> expectedSteps;
+        expectedSteps << 0 << 2 << 3;
+        TS_ASSERT_EQUALS(expectedSteps, delegate->steps);
+
+        std::vector<double> expectedValues;
+        expectedValues << 11 << 4711 << 4711;
+        TS_ASSERT_EQUALS(expectedValues, delegate->values);
+#endif
+    }
+
+    void testBlockPolicySnapshotsAreIndependentOfLaterChanges()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        GatedWriter *delegate = new GatedWriter();
+        AsyncWriter<TestCell<2> > writer(delegate, 2, ASYNC_WRITER_BLOCK);
+
+        std::vector<double> expected;
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+        expected << 11;
+        for (int i = 1; i < 20; ++i) {
+            grid[Coord<2>(1, 1)].testValue = i;
+            writer.stepFinished(grid, i, WRITER_STEP_FINISHED);
+            expected << i;
+        }
+        writer.stepFinished(grid, 20, WRITER_ALL_DONE);
+        expected << 19;
+
+        TS_ASSERT_EQUALS(expected, delegate->values);
+        TS_ASSERT_EQUALS(std::size_t(0), writer.droppedSnapshots());
+        TS_ASSERT_EQUALS(std::size_t(0), writer.coalescedSnapshots());
+#endif
+    }
+
+    void testSelector()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        MemoryWriter<TestCell<2> > *delegate = new MemoryWriter<TestCell<2> >();
+        AsyncWriter<TestCell<2> > writer(delegate);
+        writer.setSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+
+        for (int y = 0; y < 5; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                grid[Coord<2>(x, y)].cycleCounter = 5;
+            }
+        }
+        writer.stepFinished(grid, 0, WRITER_INITIALIZED);
+        writer.stepFinished(grid, 1, WRITER_ALL_DONE);
+
+        TS_ASSERT_EQUALS(std::size_t(2), delegate->getGrids().size());
+        for (int y = 0; y < 5; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                Coord<2> c(x, y);
+                TS_ASSERT_EQUALS(grid[c].testValue, delegate->getGrids()[1][c].testValue);
+                // only the selected member was copied:
+                TS_ASSERT_EQUALS(unsigned(0), delegate->getGrids()[1][c].cycleCounter);
+            }
+        }
+#endif
+    }
+
+    void testParallelWriterGathersCallsPerStep()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        RecordingParallelWriter *delegate = new RecordingParallelWriter();
+        AsyncWriter<TestCell<2> > writer(delegate);
+
+        Region<2> region;
+        region << CoordBox<2>(Coord<2>(0, 0), Coord<2>(10, 5));
+        Region<2> rim;
+        rim << CoordBox<2>(Coord<2>(0, 0), Coord<2>(10, 1));
+        Region<2> inner = region - rim;
+        writer.setRegion(region);
+
+        DisplacedGrid<TestCell<2> > displacedGrid(CoordBox<2>(Coord<2>(), Coord<2>(10, 5)));
+        displacedGrid.paste(grid, region);
+
+        writer.stepFinished(displacedGrid, rim,   Coord<2>(10, 5), 0, WRITER_INITIALIZED, 3, false);
+        writer.stepFinished(displacedGrid, inner, Coord<2>(10, 5), 0, WRITER_INITIALIZED, 3, true);
+        writer.stepFinished(displacedGrid, rim,   Coord<2>(10, 5), 1, WRITER_ALL_DONE,    3, false);
+        writer.stepFinished(displacedGrid, inner, Coord<2>(10, 5), 1, WRITER_ALL_DONE,    3, true);
+
+        std::vector<unsigned> expectedSteps;
+        expectedSteps << 0 << 1;
+        TS_ASSERT_EQUALS(expectedSteps, delegate->steps);
+
+        for (std::size_t i = 0; i < 2; ++i) {
+            TS_ASSERT_EQUALS(region, delegate->regions[i]);
+            TS_ASSERT_EQUALS(std::size_t(3), delegate->ranks[i]);
+            TS_ASSERT(delegate->lastCalls[i]);
+            TS_ASSERT_EQUALS(Coord<2>(10, 5), delegate->dimensions[i]);
+
+            for (Region<2>::Iterator j = region.begin(); j != region.end(); ++j) {
+                TS_ASSERT_EQUALS(grid[*j].testValue, delegate->grids[i][*j].testValue);
+            }
+        }
+#endif
+    }
+
+    void testDelegateErrorsAreRethrown()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        AsyncWriter<TestCell<2> > writer(new GatedWriter());
+
+        writer.stepFinished(grid, 666, WRITER_STEP_FINISHED);
+        TS_ASSERT_THROWS(writer.flush(), std::runtime_error&);
+
+        // the error is reported only once, later steps go through:
+        writer.stepFinished(grid, 1, WRITER_ALL_DONE);
+#endif
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_THREADS
+    GridType grid;
+#endif
+};
+
+}
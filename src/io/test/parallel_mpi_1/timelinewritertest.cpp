@@ -0,0 +1,44 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TimelineWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_1/timelinewritertest.h"
+
+static TimelineWriterTest suite_TimelineWriterTest;
+
+static CxxTest::List Tests_TimelineWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimelineWriterTest( "/root/repo/src/io/test/parallel_mpi_1/timelinewritertest.h", 16, "TimelineWriterTest", suite_TimelineWriterTest, Tests_TimelineWriterTest );
+
+static class TestDescription_suite_TimelineWriterTest_testFilename : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimelineWriterTest_testFilename() : CxxTest::RealTestDescription( Tests_TimelineWriterTest, suiteDescription_TimelineWriterTest, 31, "testFilename" ) {}
+ void runTest() { suite_TimelineWriterTest.testFilename(); }
+} testDescription_suite_TimelineWriterTest_testFilename;
+
+static class TestDescription_suite_TimelineWriterTest_testPeriodicDumps : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TimelineWriterTest_testPeriodicDumps() : CxxTest::RealTestDescription( Tests_TimelineWriterTest, suiteDescription_TimelineWriterTest, 37, "testPeriodicDumps" ) {}
+ void runTest() { suite_TimelineWriterTest.testPeriodicDumps(); }
+} testDescription_suite_TimelineWriterTest_testPeriodicDumps;
+
@@ -0,0 +1,90 @@
+#include <libgeodecomp/io/timelinewriter.h>
+#include <libgeodecomp/misc/chronometer.h>
+#include <libgeodecomp/misc/tempfile.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/storage/grid.h>
+
+#include <cxxtest/TestSuite.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TimelineWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        prefix = TempFile::serial("timelinewriter") + ".";
+        Tracer::clear();
+    }
+
+    void tearDown()
+    {
+        remove(TimelineWriter<TestCell<2> >(prefix, 1).filename(3, 10).c_str());
+        remove(TimelineWriter<TestCell<2> >(prefix, 1).filename(3, 12).c_str());
+    }
+
+    void testFilename()
+    {
+        TimelineWriter<TestCell<2> > writer("foo.", 5);
+        TS_ASSERT_EQUALS("foo.00003.000010.json", writer.filename(3, 10));
+    }
+
+    void testPeriodicDumps()
+    {
+        Grid<TestCell<2> > grid(Coord<2>(10, 5));
+        Region<2> region;
+        region << grid.boundingBox();
+        TimelineWriter<TestCell<2> > writer(prefix, 5);
+        Chronometer chrono;
+
+        {
+            TimeComputeInner t(&chrono);
+        }
+        writer.stepFinished(grid, region, grid.getDimensions(), 10, WRITER_STEP_FINISHED, 3, false);
+        TS_ASSERT(!exists(writer.filename(3, 10)));
+        writer.stepFinished(grid, region, grid.getDimensions(), 10, WRITER_STEP_FINISHED, 3, true);
+        TS_ASSERT(exists(writer.filename(3, 10)));
+
+        {
+            TimeComputeGhost t(&chrono);
+        }
+        writer.stepFinished(grid, region, grid.getDimensions(), 11, WRITER_STEP_FINISHED, 3, true);
+        TS_ASSERT(!exists(writer.filename(3, 11)));
+        writer.stepFinished(grid, region, grid.getDimensions(), 12, WRITER_ALL_DONE, 3, true);
+        TS_ASSERT(exists(writer.filename(3, 12)));
+
+        std::string dump1 = read(writer.filename(3, 10));
+        std::string dump2 = read(writer.filename(3, 12));
+#ifdef LIBGEODECOMP_WITH_TRACING
+        TS_ASSERT_DIFFERS(std::string::npos, dump1.find("\"compute_time_inner\""));
+        TS_ASSERT_EQUALS(std::string::npos, dump1.find("\"compute_time_ghost\""));
+        TS_ASSERT_EQUALS(std::string::npos, dump2.find("\"compute_time_inner\""));
+        TS_ASSERT_DIFFERS(std::string::npos, dump2.find("\"compute_time_ghost\""));
+#endif
+        TS_ASSERT_DIFFERS(std::string::npos, dump1.find("\"traceEvents\""));
+        TS_ASSERT_DIFFERS(std::string::npos, dump2.find("\"traceEvents\""));
+    }
+
+private:
+    std::string prefix;
+
+    bool exists(const std::string& filename)
+    {
+        return std::ifstream(filename.c_str()).good();
+    }
+
+    std::string read(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str());
+        std::stringstream buf;
+        buf << file.rdbuf();
+        return buf.str();
+    }
+};
+
+}
@@ -0,0 +1,45 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MPIIOTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_2/mpiiotest.h"
+
+static MPIIOTest suite_MPIIOTest;
+
+static CxxTest::List Tests_MPIIOTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MPIIOTest( "/root/repo/src/io/test/parallel_mpi_2/mpiiotest.h", 14, "MPIIOTest", suite_MPIIOTest, Tests_MPIIOTest );
+
+static class TestDescription_suite_MPIIOTest_testReadWrite : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOTest_testReadWrite() : CxxTest::RealTestDescription( Tests_MPIIOTest, suiteDescription_MPIIOTest, 17, "testReadWrite" ) {}
+ void runTest() { suite_MPIIOTest.testReadWrite(); }
+} testDescription_suite_MPIIOTest_testReadWrite;
+
+static class TestDescription_suite_MPIIOTest_testSnapshotWithWrappedRegions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MPIIOTest_testSnapshotWithWrappedRegions() : CxxTest::RealTestDescription( Tests_MPIIOTest, suiteDescription_MPIIOTest, 84, "testSnapshotWithWrappedRegions" ) {}
+ void runTest() { suite_MPIIOTest.testSnapshotWithWrappedRegions(); }
+} testDescription_suite_MPIIOTest_testSnapshotWithWrappedRegions;
+
@@ -80,6 +80,63 @@ public:
             }
         }
     }
+
+    void testSnapshotWithWrappedRegions()
+    {
+        typedef Topologies::Torus<2>::Topology Topology;
+        typedef Grid<double, Topology> GridType;
+        MPIIO<double, Topology> mpiio;
+
+        Coord<2> dim(8, 6);
+        int rank = MPILayer().rank();
+        std::string filename = TempFile::parallel("mpiio");
+
+        GridType grid1(dim, -2);
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                grid1[Coord<2>(x, y)] = rank * 1000 + y * 10 + x;
+            }
+        }
+
+        // rank 0 writes rows 0-2, rank 1 rows 3-5. The negative
+        // coordinates wrap around, so the cells arrive in a
+        // different order than they'll be placed in the file:
+        Region<2> region1;
+        Region<2> region2;
+        if (rank == 0) {
+            region1 << Streak<2>(Coord<2>(0, 2), dim.x());
+            region2 << Streak<2>(Coord<2>(0, -6), dim.x());
+            region2 << Streak<2>(Coord<2>(0, 1), dim.x());
+        } else {
+            region1 << Streak<2>(Coord<2>(0, -1), dim.x());
+            region1 << Streak<2>(Coord<2>(0, 3), dim.x());
+            region2 << Streak<2>(Coord<2>(0, 4), dim.x());
+        }
+
+        MPIIO<double, Topology>::Snapshot<2> snapshot;
+        snapshot.add(grid1, region1, dim);
+        snapshot.add(grid1, region2, dim);
+        TS_ASSERT(!snapshot.pending());
+
+        mpiio.beginWrite(&snapshot, -3.0, dim, 5, 10, filename);
+        TS_ASSERT(snapshot.pending());
+        TS_ASSERT_THROWS(snapshot.add(grid1, region1, dim), std::logic_error);
+        mpiio.finishWrite(&snapshot);
+        TS_ASSERT(!snapshot.pending());
+
+        GridType grid2(dim, -1);
+        Region<2> region;
+        region << CoordBox<2>(Coord<2>(), dim);
+        mpiio.readRegion(&grid2, filename, region);
+
+        TS_ASSERT_EQUALS(-3.0, grid2.getEdge());
+        for (int y = 0; y < dim.y(); ++y) {
+            for (int x = 0; x < dim.x(); ++x) {
+                double expected = (y < 3 ? 0 : 1000) + y * 10 + x;
+                TS_ASSERT_EQUALS(expected, grid2[Coord<2>(x, y)]);
+            }
+        }
+    }
 };
 
 }
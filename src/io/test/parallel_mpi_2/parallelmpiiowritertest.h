@@ -90,6 +90,50 @@ public:
             TS_ASSERT_EQUALS(actual,        expected);
         }
     }
+
+    void testMultipleCallsPerStep()
+    {
+        typedef APITraits::SelectTopology<TestCell<2> >::Value Topology;
+        typedef Grid<TestCell<2>, Topology> GridType;
+
+        Coord<2> dim(10, 6);
+        TestInitializer<TestCell<2> > init(dim);
+        GridType grid(dim);
+        init.grid(&grid);
+
+        int rank = MPILayer().rank();
+        Region<2> region1;
+        Region<2> region2;
+        region1 << CoordBox<2>(Coord<2>(0, 3 * rank + 0), Coord<2>(dim.x(), 2));
+        region2 << CoordBox<2>(Coord<2>(0, 3 * rank + 2), Coord<2>(dim.x(), 1));
+
+        for (int asynchronous = 0; asynchronous < 2; ++asynchronous) {
+            std::string filename;
+
+            {
+                ParallelMPIIOWriter<TestCell<2> > writer(
+                    "testparallelmpiiowriter", 2, 10, MPI_COMM_WORLD, asynchronous);
+                filename = writer.filename(4);
+                files.push_back(filename);
+
+                // nothing is written until the last call of a step:
+                writer.stepFinished(grid, region1, dim, 4, WRITER_STEP_FINISHED, rank, false);
+                TS_ASSERT(!writer.snapshot.pending());
+                writer.stepFinished(grid, region2, dim, 4, WRITER_STEP_FINISHED, rank, true);
+                TS_ASSERT_EQUALS(bool(asynchronous), writer.snapshot.pending());
+            }
+
+            MPIIO<TestCell<2> > mpiio;
+            Region<2> region;
+            region << CoordBox<2>(Coord<2>(), dim);
+            GridType actual(dim);
+            mpiio.readRegion(&actual, filename, region);
+
+            TS_ASSERT_EQUALS(grid, actual);
+        }
+
+        MPILayer().barrier();
+    }
 };
 
 }
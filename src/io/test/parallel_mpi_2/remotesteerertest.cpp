@@ -0,0 +1,99 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RemoteSteererTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_2/remotesteerertest.h"
+
+static RemoteSteererTest suite_RemoteSteererTest;
+
+static CxxTest::List Tests_RemoteSteererTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RemoteSteererTest( "/root/repo/src/io/test/parallel_mpi_2/remotesteerertest.h", 25, "RemoteSteererTest", suite_RemoteSteererTest, Tests_RemoteSteererTest );
+
+static class TestDescription_suite_RemoteSteererTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testBasic() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 128, "testBasic" ) {}
+ void runTest() { suite_RemoteSteererTest.testBasic(); }
+} testDescription_suite_RemoteSteererTest_testBasic;
+
+static class TestDescription_suite_RemoteSteererTest_testNonExistentAction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testNonExistentAction() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 161, "testNonExistentAction" ) {}
+ void runTest() { suite_RemoteSteererTest.testNonExistentAction(); }
+} testDescription_suite_RemoteSteererTest_testNonExistentAction;
+
+static class TestDescription_suite_RemoteSteererTest_testInvalidHandler : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testInvalidHandler() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 176, "testInvalidHandler" ) {}
+ void runTest() { suite_RemoteSteererTest.testInvalidHandler(); }
+} testDescription_suite_RemoteSteererTest_testInvalidHandler;
+
+static class TestDescription_suite_RemoteSteererTest_testHandlerNotFound1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testHandlerNotFound1() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 207, "testHandlerNotFound1" ) {}
+ void runTest() { suite_RemoteSteererTest.testHandlerNotFound1(); }
+} testDescription_suite_RemoteSteererTest_testHandlerNotFound1;
+
+static class TestDescription_suite_RemoteSteererTest_testHandlerNotFound2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testHandlerNotFound2() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 240, "testHandlerNotFound2" ) {}
+ void runTest() { suite_RemoteSteererTest.testHandlerNotFound2(); }
+} testDescription_suite_RemoteSteererTest_testHandlerNotFound2;
+
+static class TestDescription_suite_RemoteSteererTest_testHandlerNotFound3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testHandlerNotFound3() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 273, "testHandlerNotFound3" ) {}
+ void runTest() { suite_RemoteSteererTest.testHandlerNotFound3(); }
+} testDescription_suite_RemoteSteererTest_testHandlerNotFound3;
+
+static class TestDescription_suite_RemoteSteererTest_testGetSet : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testGetSet() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 305, "testGetSet" ) {}
+ void runTest() { suite_RemoteSteererTest.testGetSet(); }
+} testDescription_suite_RemoteSteererTest_testGetSet;
+
+static class TestDescription_suite_RemoteSteererTest_testDataStreaming : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testDataStreaming() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 333, "testDataStreaming" ) {}
+ void runTest() { suite_RemoteSteererTest.testDataStreaming(); }
+} testDescription_suite_RemoteSteererTest_testDataStreaming;
+
+static class TestDescription_suite_RemoteSteererTest_testDataStreamingRejectsUnknownMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testDataStreamingRejectsUnknownMember() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 402, "testDataStreamingRejectsUnknownMember" ) {}
+ void runTest() { suite_RemoteSteererTest.testDataStreamingRejectsUnknownMember(); }
+} testDescription_suite_RemoteSteererTest_testDataStreamingRejectsUnknownMember;
+
+static class TestDescription_suite_RemoteSteererTest_testDataStreamingClipsBox : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testDataStreamingClipsBox() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 443, "testDataStreamingClipsBox" ) {}
+ void runTest() { suite_RemoteSteererTest.testDataStreamingClipsBox(); }
+} testDescription_suite_RemoteSteererTest_testDataStreamingClipsBox;
+
+static class TestDescription_suite_RemoteSteererTest_testDataStreamingRejectsBoxOutsideOfGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RemoteSteererTest_testDataStreamingRejectsBoxOutsideOfGrid() : CxxTest::RealTestDescription( Tests_RemoteSteererTest, suiteDescription_RemoteSteererTest, 495, "testDataStreamingRejectsBoxOutsideOfGrid" ) {}
+ void runTest() { suite_RemoteSteererTest.testDataStreamingRejectsBoxOutsideOfGrid(); }
+} testDescription_suite_RemoteSteererTest_testDataStreamingRejectsBoxOutsideOfGrid;
+
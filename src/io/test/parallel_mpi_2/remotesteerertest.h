@@ -12,6 +12,7 @@
 
 #include <libgeodecomp/io/remotesteerer.h>
 #include <libgeodecomp/io/remotesteerer/interactor.h>
+#include <libgeodecomp/io/remotesteerer/streamclient.h>
 
 #endif
 
@@ -329,6 +330,210 @@ public:
 #endif
     }
 
+    void testDataStreaming()
+    {
+#if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
+        MPILayer mpiLayer;
+        int rank = mpiLayer.rank();
+        int streamPort = 47131;
+        RemoteSteerer<TestCell<2> > steerer(1, 47130);
+        steerer.enableDataStreaming(streamPort, 4);
+        steerer.addSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+
+        // each rank owns a horizontal stripe of a 20x10 grid
+        Coord<2> globalDimensions(20, 10);
+        CoordBox<2> box(Coord<2>(0, rank * 5), Coord<2>(20, 5));
+        Region<2> region;
+        region << box;
+        Region<2> rim;
+        rim << CoordBox<2>(box.origin, Coord<2>(20, 1));
+        Region<2> inner = region - rim;
+        DisplacedGrid<TestCell<2> > grid(box);
+
+        boost::shared_ptr<StreamClient> client;
+        if (rank == 0) {
+            client.reset(new StreamClient(streamPort));
+            // every other cell of the right 15x10 cells, every other time step
+            client->subscribe("testValue", 2, 2, CoordBox<2>(Coord<2>(5, 0), Coord<2>(15, 10)));
+        }
+
+        // subscriptions arrive asynchronously, so we idle at step 0 until it's in:
+        unsigned step = 0;
+        while (steerer.dataStreamer->numSubscriptions() == 0) {
+            fillGrid(&grid, step);
+            steerer.nextStep(&grid, region, globalDimensions, step, STEERER_NEXT_STEP, rank, true, 0);
+            usleep(1000);
+        }
+
+        for (step = 1; step < 5; ++step) {
+            fillGrid(&grid, step);
+            steerer.nextStep(&grid, rim,   globalDimensions, step, STEERER_NEXT_STEP, rank, false, 0);
+            steerer.nextStep(&grid, inner, globalDimensions, step, STEERER_NEXT_STEP, rank, true,  0);
+        }
+
+        if (rank != 0) {
+            return;
+        }
+
+        for (unsigned expectedStep = 0; expectedStep < 5; expectedStep += 2) {
+            StreamFrameHeader header;
+            std::vector<char> payload;
+            TS_ASSERT(client->receive(&header, &payload));
+            TS_ASSERT_EQUALS(expectedStep, header.step);
+            TS_ASSERT_EQUALS(unsigned(sizeof(double)), header.elementSize);
+            TS_ASSERT_EQUALS(8, header.dimensions[0]);
+            TS_ASSERT_EQUALS(5, header.dimensions[1]);
+            TS_ASSERT_EQUALS(1, header.dimensions[2]);
+            TS_ASSERT_EQUALS(std::size_t(8 * 5 * sizeof(double)), payload.size());
+
+            const double *values = reinterpret_cast<const double*>(&payload[0]);
+            for (int y = 0; y < 5; ++y) {
+                for (int x = 0; x < 8; ++x) {
+                    double expected = expectedStep * 1000 + (y * 2) * 100 + 5 + x * 2;
+                    TS_ASSERT_EQUALS(expected, values[y * 8 + x]);
+                }
+            }
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(0), steerer.dataStreamer->skippedFrames());
+#endif
+    }
+
+    void testDataStreamingRejectsUnknownMember()
+    {
+#if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
+        MPILayer mpiLayer;
+        int rank = mpiLayer.rank();
+        int streamPort = 47133;
+        RemoteSteerer<TestCell<2> > steerer(1, 47132);
+        steerer.enableDataStreaming(streamPort);
+        steerer.addSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+
+        CoordBox<2> box(Coord<2>(0, rank * 5), Coord<2>(20, 5));
+        Region<2> region;
+        region << box;
+        DisplacedGrid<TestCell<2> > grid(box);
+
+        boost::shared_ptr<StreamClient> client;
+        if (rank == 0) {
+            client.reset(new StreamClient(streamPort));
+            client->subscribe("bogus", 1, 1, CoordBox<2>(Coord<2>(0, 0), Coord<2>(20, 10)));
+        }
+
+        for (int rejected = 0; !rejected; ) {
+            steerer.nextStep(&grid, region, Coord<2>(20, 10), 0, STEERER_NEXT_STEP, rank, true, 0);
+            rejected = (rank == 0) && !steerer.pipe->copySteeringFeedback().empty();
+            rejected = mpiLayer.broadcast(rejected, 0);
+            usleep(1000);
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(0), steerer.dataStreamer->numSubscriptions());
+        if (rank == 0) {
+            StringVec feedback = steerer.pipe->copySteeringFeedback();
+            TS_ASSERT_EQUALS("stream subscription rejected: no selector found for member bogus", feedback[0]);
+
+            StreamFrameHeader header;
+            std::vector<char> payload;
+            TS_ASSERT(!client->receive(&header, &payload));
+            TS_ASSERT_EQUALS("no selector found for member bogus", client->error());
+        }
+#endif
+    }
+
+    void testDataStreamingClipsBox()
+    {
+#if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
+        MPILayer mpiLayer;
+        int rank = mpiLayer.rank();
+        int streamPort = 47135;
+        RemoteSteerer<TestCell<2> > steerer(1, 47134);
+        steerer.enableDataStreaming(streamPort);
+        steerer.addSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+
+        Coord<2> globalDimensions(20, 10);
+        CoordBox<2> box(Coord<2>(0, rank * 5), Coord<2>(20, 5));
+        Region<2> region;
+        region << box;
+        DisplacedGrid<TestCell<2> > grid(box);
+        fillGrid(&grid, 0);
+
+        boost::shared_ptr<StreamClient> client;
+        if (rank == 0) {
+            client.reset(new StreamClient(streamPort));
+            // reaches beyond the grid on all sides:
+            client->subscribe("testValue", 1, 1, CoordBox<2>(Coord<2>(-5, 3), Coord<2>(2000000000, 2000000000)));
+        }
+
+        while (steerer.dataStreamer->numSubscriptions() == 0) {
+            steerer.nextStep(&grid, region, globalDimensions, 0, STEERER_NEXT_STEP, rank, true, 0);
+            usleep(1000);
+        }
+
+        if (rank != 0) {
+            return;
+        }
+
+        StreamFrameHeader header;
+        std::vector<char> payload;
+        TS_ASSERT(client->receive(&header, &payload));
+        TS_ASSERT_EQUALS(0,  header.origin[0]);
+        TS_ASSERT_EQUALS(3,  header.origin[1]);
+        TS_ASSERT_EQUALS(20, header.dimensions[0]);
+        TS_ASSERT_EQUALS(7,  header.dimensions[1]);
+        TS_ASSERT_EQUALS(std::size_t(20 * 7 * sizeof(double)), payload.size());
+
+        const double *values = reinterpret_cast<const double*>(&payload[0]);
+        for (int y = 0; y < 7; ++y) {
+            for (int x = 0; x < 20; ++x) {
+                double expected = (y + 3) * 100 + x;
+                TS_ASSERT_EQUALS(expected, values[y * 20 + x]);
+            }
+        }
+#endif
+    }
+
+    void testDataStreamingRejectsBoxOutsideOfGrid()
+    {
+#if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
+        MPILayer mpiLayer;
+        int rank = mpiLayer.rank();
+        int streamPort = 47137;
+        RemoteSteerer<TestCell<2> > steerer(1, 47136);
+        steerer.enableDataStreaming(streamPort);
+        steerer.addSelector(Selector<TestCell<2> >(&TestCell<2>::testValue, "testValue"));
+
+        CoordBox<2> box(Coord<2>(0, rank * 5), Coord<2>(20, 5));
+        Region<2> region;
+        region << box;
+        DisplacedGrid<TestCell<2> > grid(box);
+
+        boost::shared_ptr<StreamClient> client;
+        if (rank == 0) {
+            client.reset(new StreamClient(streamPort));
+            client->subscribe("testValue", 1, 1, CoordBox<2>(Coord<2>(20, 0), Coord<2>(5, 10)));
+        }
+
+        for (int rejected = 0; !rejected; ) {
+            steerer.nextStep(&grid, region, Coord<2>(20, 10), 0, STEERER_NEXT_STEP, rank, true, 0);
+            rejected = (rank == 0) && !steerer.pipe->copySteeringFeedback().empty();
+            rejected = mpiLayer.broadcast(rejected, 0);
+            usleep(1000);
+        }
+
+        TS_ASSERT_EQUALS(std::size_t(0), steerer.dataStreamer->numSubscriptions());
+        if (rank == 0) {
+            StreamFrameHeader header;
+            std::vector<char> payload;
+            TS_ASSERT(!client->receive(&header, &payload));
+            TS_ASSERT_EQUALS(unsigned(StreamFrameHeader::ERROR_MAGIC), header.magic);
+            TS_ASSERT_EQUALS("box doesn't intersect the grid", client->error());
+
+            // the connection is closed afterwards:
+            TS_ASSERT(!client->receive(&header, &payload));
+        }
+#endif
+    }
+
 private:
 #if defined LIBGEODECOMP_WITH_THREADS && defined LIBGEODECOMP_WITH_BOOST_ASIO
     boost::shared_ptr<MPILayer> mpiLayer;
@@ -336,6 +541,14 @@ private:
     RemoteSteerer<TestCell<2> > *steerer;
     ParallelMemoryWriter<TestCell<2> > *writer;
     int port;
+
+    void fillGrid(DisplacedGrid<TestCell<2> > *grid, unsigned step)
+    {
+        CoordBox<2> box = grid->boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            (*grid)[*i].testValue = step * 1000 + i->y() * 100 + i->x();
+        }
+    }
     // fixme: test set/get
     // fixme: test remotesteerer with 1 proc
     // fixme: add help function
@@ -0,0 +1,10 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}collectingwritertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}parallelsilowritertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}collectingwritertest.h
+  ${RELATIVE_PATH}parallelsilowritertest.h
+)
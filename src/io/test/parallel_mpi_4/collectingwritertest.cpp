@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CollectingWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_4/collectingwritertest.h"
+
+static CollectingWriterTest suite_CollectingWriterTest;
+
+static CxxTest::List Tests_CollectingWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CollectingWriterTest( "/root/repo/src/io/test/parallel_mpi_4/collectingwritertest.h", 59, "CollectingWriterTest", suite_CollectingWriterTest, Tests_CollectingWriterTest );
+
+static class TestDescription_suite_CollectingWriterTest_testArities : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectingWriterTest_testArities() : CxxTest::RealTestDescription( Tests_CollectingWriterTest, suiteDescription_CollectingWriterTest, 64, "testArities" ) {}
+ void runTest() { suite_CollectingWriterTest.testArities(); }
+} testDescription_suite_CollectingWriterTest_testArities;
+
+static class TestDescription_suite_CollectingWriterTest_testStreaming : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectingWriterTest_testStreaming() : CxxTest::RealTestDescription( Tests_CollectingWriterTest, suiteDescription_CollectingWriterTest, 98, "testStreaming" ) {}
+ void runTest() { suite_CollectingWriterTest.testStreaming(); }
+} testDescription_suite_CollectingWriterTest_testStreaming;
+
+static class TestDescription_suite_CollectingWriterTest_testInvalidArity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CollectingWriterTest_testInvalidArity() : CxxTest::RealTestDescription( Tests_CollectingWriterTest, suiteDescription_CollectingWriterTest, 134, "testInvalidArity" ) {}
+ void runTest() { suite_CollectingWriterTest.testInvalidArity(); }
+} testDescription_suite_CollectingWriterTest_testInvalidArity;
+
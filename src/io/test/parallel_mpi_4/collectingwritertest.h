@@ -0,0 +1,158 @@
+#include <libgeodecomp/io/collectingwriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/io/memorywriter.h>
+#include <libgeodecomp/loadbalancer/noopbalancer.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/stripingsimulator.h>
+
+#include <boost/shared_ptr.hpp>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+/**
+ * Assembles the chunks handed out by a streaming CollectingWriter
+ * and stores the complete grid on each lastCall.
+ */
+class StreamRecorder : public Clonable<ParallelWriter<TestCell<3> >, StreamRecorder>
+{
+public:
+    typedef DisplacedGrid<TestCell<3>, Topologies::Cube<3>::Topology> GridType;
+
+    StreamRecorder() :
+        Clonable<ParallelWriter<TestCell<3> >, StreamRecorder>("", 1),
+        calls(0)
+    {}
+
+    virtual void stepFinished(
+        const ParallelWriter<TestCell<3> >::GridType& grid,
+        const Region<3>& validRegion,
+        const Coord<3>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        ++calls;
+        if (buffer.boundingBox().dimensions != globalDimensions) {
+            buffer.resize(CoordBox<3>(Coord<3>(), globalDimensions));
+        }
+
+        buffer.paste(grid, validRegion);
+        buffer.setEdge(grid.getEdge());
+
+        if (lastCall) {
+            grids.push_back(buffer);
+            steps.push_back(step);
+        }
+    }
+
+    std::vector<GridType> grids;
+    std::vector<unsigned> steps;
+    int calls;
+
+private:
+    GridType buffer;
+};
+
+class CollectingWriterTest : public CxxTest::TestSuite
+{
+public:
+    typedef StripingSimulator<TestCell<3> > SimulatorType;
+
+    void testArities()
+    {
+        for (int arity = 1; arity <= 4; ++arity) {
+            for (int root = 0; root < MPILayer().size(); root += 3) {
+                SimulatorType sim(new TestInitializer<TestCell<3> >(Coord<3>(13, 12, 11), 7), balancer());
+                MemoryWriter<TestCell<3> > *writer = 0;
+                if (MPILayer().rank() == root) {
+                    writer = new MemoryWriter<TestCell<3> >(2);
+                }
+
+                sim.addWriter(
+                    new CollectingWriter<TestCell<3> >(
+                        writer,
+                        root,
+                        MPI_COMM_WORLD,
+                        APITraits::SelectMPIDataType<TestCell<3> >::value(),
+                        arity));
+                sim.run();
+
+                if (MPILayer().rank() == root) {
+                    std::vector<MemoryWriter<TestCell<3> >::StorageGrid>& grids = writer->getGrids();
+                    TS_ASSERT_EQUALS(std::size_t(5), grids.size());
+
+                    // steps 0, 2, 4, 6 and the final step 7:
+                    for (std::size_t i = 0; i < grids.size(); ++i) {
+                        unsigned step = std::min(std::size_t(7), 2 * i);
+                        unsigned cycle = APITraits::SelectNanoSteps<TestCell<3> >::VALUE * step;
+                        TS_ASSERT_TEST_GRID(MemoryWriter<TestCell<3> >::StorageGrid, grids[i], cycle);
+                    }
+                }
+            }
+        }
+    }
+
+    void testStreaming()
+    {
+        for (int arity = 1; arity <= 3; ++arity) {
+            SimulatorType sim(new TestInitializer<TestCell<3> >(Coord<3>(10, 20, 7), 3), balancer());
+            StreamRecorder *recorder = 0;
+            if (MPILayer().rank() == 1) {
+                recorder = new StreamRecorder();
+            }
+
+            // the simulator takes ownership of the writer, which shares
+            // the recorder with its clones:
+            CollectingWriter<TestCell<3> > *writer = new CollectingWriter<TestCell<3> >(
+                recorder,
+                1,
+                MPI_COMM_WORLD,
+                APITraits::SelectMPIDataType<TestCell<3> >::value(),
+                arity);
+            sim.addWriter(writer);
+            sim.run();
+
+            if (MPILayer().rank() == 1) {
+                // initialization, 3 steps and the final call:
+                TS_ASSERT_EQUALS(std::size_t(5), recorder->grids.size());
+                // one call per rank and output:
+                TS_ASSERT_EQUALS(5 * MPILayer().size(), recorder->calls);
+
+                for (std::size_t i = 0; i < recorder->grids.size(); ++i) {
+                    unsigned step = std::min(std::size_t(3), i);
+                    TS_ASSERT_EQUALS(step, recorder->steps[i]);
+                    unsigned cycle = APITraits::SelectNanoSteps<TestCell<3> >::VALUE * step;
+                    TS_ASSERT_TEST_GRID(StreamRecorder::GridType, recorder->grids[i], cycle);
+                }
+            }
+        }
+    }
+
+    void testInvalidArity()
+    {
+        MemoryWriter<TestCell<3> > *writer = 0;
+        if (MPILayer().rank() == 0) {
+            writer = new MemoryWriter<TestCell<3> >(1);
+        }
+
+        TS_ASSERT_THROWS(
+            CollectingWriter<TestCell<3> >(
+                writer,
+                0,
+                MPI_COMM_WORLD,
+                APITraits::SelectMPIDataType<TestCell<3> >::value(),
+                0),
+            std::invalid_argument);
+    }
+
+private:
+    LoadBalancer *balancer()
+    {
+        return MPILayer().rank() ? 0 : new NoOpBalancer;
+    }
+};
+
+}
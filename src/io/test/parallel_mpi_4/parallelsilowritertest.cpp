@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_ParallelSiloWriterTest_init = false;
+#include "/root/repo/src/io/test/parallel_mpi_4/parallelsilowritertest.h"
+
+static ParallelSiloWriterTest suite_ParallelSiloWriterTest;
+
+static CxxTest::List Tests_ParallelSiloWriterTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ParallelSiloWriterTest( "/root/repo/src/io/test/parallel_mpi_4/parallelsilowritertest.h", 72, "ParallelSiloWriterTest", suite_ParallelSiloWriterTest, Tests_ParallelSiloWriterTest );
+
+static class TestDescription_suite_ParallelSiloWriterTest_testBlocksAndMasterFile : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ParallelSiloWriterTest_testBlocksAndMasterFile() : CxxTest::RealTestDescription( Tests_ParallelSiloWriterTest, suiteDescription_ParallelSiloWriterTest, 94, "testBlocksAndMasterFile" ) {}
+ void runTest() { suite_ParallelSiloWriterTest.testBlocksAndMasterFile(); }
+} testDescription_suite_ParallelSiloWriterTest_testBlocksAndMasterFile;
+
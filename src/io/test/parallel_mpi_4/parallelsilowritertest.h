@@ -0,0 +1,230 @@
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/io/parallelsilowriter.h>
+#include <libgeodecomp/misc/tempfile.h>
+
+#include <boost/filesystem.hpp>
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+#ifdef LIBGEODECOMP_WITH_SILO
+
+class ParallelSiloWriterTestParticle
+{
+public:
+    FloatCoord<2> getPoint() const
+    {
+        return pos;
+    }
+
+    std::vector<FloatCoord<2> > getShape() const
+    {
+        return std::vector<FloatCoord<2> >(1, pos);
+    }
+
+    FloatCoord<2> pos;
+};
+
+/**
+ * SiloWriter expects cells to be containers (for point meshes and
+ * unstructured grids), even if they don't use those.
+ */
+class ParallelSiloWriterTestCell
+{
+public:
+    typedef ParallelSiloWriterTestParticle value_type;
+    typedef std::vector<value_type>::iterator iterator;
+    typedef std::vector<value_type>::const_iterator const_iterator;
+
+    iterator begin()
+    {
+        return particles.begin();
+    }
+
+    const_iterator begin() const
+    {
+        return particles.begin();
+    }
+
+    iterator end()
+    {
+        return particles.end();
+    }
+
+    const_iterator end() const
+    {
+        return particles.end();
+    }
+
+    std::size_t size() const
+    {
+        return particles.size();
+    }
+
+    std::vector<value_type> particles;
+    double value;
+};
+
+class ParallelSiloWriterTestCellWithPointMesh : public ParallelSiloWriterTestCell
+{
+public:
+    class API :
+        public APITraits::HasPointMesh
+    {};
+};
+
+#endif
+
+class ParallelSiloWriterTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        prefix = TempFile::parallel("parallelsilowriter_test") + "foo";
+#endif
+    }
+
+    void tearDown()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        MPILayer().barrier();
+        if (MPILayer().rank() == 0) {
+            boost::filesystem::remove(prefix + ".00042.silo");
+            boost::filesystem::remove(prefix + ".00042.00000.silo");
+            boost::filesystem::remove(prefix + ".00042.00001.silo");
+        }
+#endif
+    }
+
+    void testBlocksAndMasterFile()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        MPILayer mpiLayer;
+        int rank = mpiLayer.rank();
+
+        // each rank owns a horizontal stripe of a 10x8 grid
+        Coord<2> globalDimensions(10, 8);
+        CoordBox<2> box(Coord<2>(0, rank * 2), Coord<2>(10, 2));
+        Region<2> region;
+        region << box;
+        Region<2> rim;
+        rim << CoordBox<2>(box.origin, Coord<2>(10, 1));
+        Region<2> inner = region - rim;
+
+        DisplacedGrid<ParallelSiloWriterTestCell> grid(box);
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            grid[*i].value = i->y() * 10 + i->x();
+        }
+
+        // two files, shared by ranks 0/1 and 2/3
+        ParallelSiloWriter<ParallelSiloWriterTestCell> writer(prefix, 1, "regular_grid", "unstructured_mesh", "point_mesh", DB_PDB, 2);
+        writer.addSelector(&ParallelSiloWriterTestCell::value, "value");
+        writer.setRegion(region);
+
+        TS_ASSERT_EQUALS(rank / 2, writer.group(rank));
+
+        writer.stepFinished(grid, rim,   globalDimensions, 42, WRITER_STEP_FINISHED, rank, false);
+        writer.stepFinished(grid, inner, globalDimensions, 42, WRITER_STEP_FINISHED, rank, true);
+        mpiLayer.barrier();
+
+        if (rank != 0) {
+            return;
+        }
+
+        TS_ASSERT(boost::filesystem::exists(prefix + ".00042.00000.silo"));
+        TS_ASSERT(boost::filesystem::exists(prefix + ".00042.00001.silo"));
+        TS_ASSERT(!boost::filesystem::exists(prefix + ".00042.00002.silo"));
+
+        DBfile *dbfile = DBOpen((prefix + ".00042.silo").c_str(), DB_UNKNOWN, DB_READ);
+        TS_ASSERT(dbfile != 0);
+
+        std::string basename = boost::filesystem::path(prefix).filename().string();
+
+        DBmultimesh *multimesh = DBGetMultimesh(dbfile, "regular_grid");
+        TS_ASSERT_EQUALS(4, multimesh->nblocks);
+        TS_ASSERT_EQUALS(basename + ".00042.00001.silo:/domain_00003/regular_grid",
+                         std::string(multimesh->meshnames[3]));
+        TS_ASSERT_EQUALS(DB_QUAD_RECT, multimesh->meshtypes[3]);
+        DBFreeMultimesh(multimesh);
+
+        DBmultivar *multivar = DBGetMultivar(dbfile, "value");
+        TS_ASSERT_EQUALS(4, multivar->nvars);
+        TS_ASSERT_EQUALS(basename + ".00042.00000.silo:/domain_00001/value",
+                         std::string(multivar->varnames[1]));
+        TS_ASSERT_EQUALS(DB_QUADVAR, multivar->vartypes[1]);
+        DBFreeMultivar(multivar);
+        DBClose(dbfile);
+
+        // rank 3's block has been appended to the file created by rank 2:
+        dbfile = DBOpen((prefix + ".00042.00001.silo").c_str(), DB_UNKNOWN, DB_READ);
+        TS_ASSERT_EQUALS(0, DBSetDir(dbfile, "/domain_00003"));
+        DBquadvar *quadvar = DBGetQuadvar(dbfile, "value");
+        TS_ASSERT_EQUALS(20, quadvar->nels);
+        double *values = static_cast<double*>(quadvar->vals[0]);
+        for (int i = 0; i < 20; ++i) {
+            TS_ASSERT_EQUALS(60 + i, values[i]);
+        }
+        DBFreeQuadvar(quadvar);
+        DBClose(dbfile);
+#endif
+    }
+
+    void testEmptyBlocks()
+    {
+#ifdef LIBGEODECOMP_WITH_SILO
+        MPILayer mpiLayer;
+        int rank = mpiLayer.rank();
+
+        Coord<2> globalDimensions(10, 8);
+        CoordBox<2> box(Coord<2>(0, rank * 2), Coord<2>(10, 2));
+        Region<2> region;
+        region << box;
+
+        // only ranks 0 and 2 hold particles:
+        DisplacedGrid<ParallelSiloWriterTestCellWithPointMesh> grid(box);
+        if ((rank % 2) == 0) {
+            ParallelSiloWriterTestParticle particle;
+            particle.pos = FloatCoord<2>(box.origin);
+            grid[box.origin].particles << particle;
+        }
+
+        ParallelSiloWriter<ParallelSiloWriterTestCellWithPointMesh> writer(
+            prefix, 1, "regular_grid", "unstructured_mesh", "point_mesh", DB_PDB, 2);
+        writer.setRegion(region);
+        writer.stepFinished(grid, region, globalDimensions, 42, WRITER_STEP_FINISHED, rank, true);
+        mpiLayer.barrier();
+
+        if (rank != 0) {
+            return;
+        }
+
+        DBfile *dbfile = DBOpen((prefix + ".00042.silo").c_str(), DB_UNKNOWN, DB_READ);
+        TS_ASSERT(dbfile != 0);
+
+        std::string basename = boost::filesystem::path(prefix).filename().string();
+
+        DBmultimesh *multimesh = DBGetMultimesh(dbfile, "point_mesh");
+        TS_ASSERT_EQUALS(4, multimesh->nblocks);
+        TS_ASSERT_EQUALS(basename + ".00042.00001.silo:/domain_00002/point_mesh",
+                         std::string(multimesh->meshnames[2]));
+        TS_ASSERT_EQUALS(std::string("EMPTY"), std::string(multimesh->meshnames[1]));
+        TS_ASSERT_EQUALS(std::string("EMPTY"), std::string(multimesh->meshnames[3]));
+        DBFreeMultimesh(multimesh);
+
+        // the regular grid isn't affected:
+        multimesh = DBGetMultimesh(dbfile, "regular_grid");
+        TS_ASSERT_EQUALS(basename + ".00042.00001.silo:/domain_00003/regular_grid",
+                         std::string(multimesh->meshnames[3]));
+        DBFreeMultimesh(multimesh);
+        DBClose(dbfile);
+#endif
+    }
+
+private:
+    std::string prefix;
+};
+
+}
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredTestInitializerTest_init = false;
+#include "/root/repo/src/io/test/unit/unstructuredtestinitializertest.h"
+
+static UnstructuredTestInitializerTest suite_UnstructuredTestInitializerTest;
+
+static CxxTest::List Tests_UnstructuredTestInitializerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredTestInitializerTest( "/root/repo/src/io/test/unit/unstructuredtestinitializertest.h", 9, "UnstructuredTestInitializerTest", suite_UnstructuredTestInitializerTest, Tests_UnstructuredTestInitializerTest );
+
+static class TestDescription_suite_UnstructuredTestInitializerTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestInitializerTest_testBasic() : CxxTest::RealTestDescription( Tests_UnstructuredTestInitializerTest, suiteDescription_UnstructuredTestInitializerTest, 12, "testBasic" ) {}
+ void runTest() { suite_UnstructuredTestInitializerTest.testBasic(); }
+} testDescription_suite_UnstructuredTestInitializerTest_testBasic;
+
@@ -0,0 +1,72 @@
+#ifndef LIBGEODECOMP_IO_TIMELINEWRITER_H
+#define LIBGEODECOMP_IO_TIMELINEWRITER_H
+
+#include <libgeodecomp/io/parallelwriter.h>
+#include <libgeodecomp/misc/clonable.h>
+#include <libgeodecomp/misc/tracer.h>
+
+#include <iomanip>
+#include <sstream>
+
+namespace LibGeoDecomp {
+
+/**
+ * Dumps the timeline recorded by the Tracer, one file per rank. A
+ * dump is written every period steps and at the end of the
+ * simulation. Each dump contains only the events recorded since the
+ * previous one, so the memory footprint of the Tracer's ring buffers
+ * remains bounded. The files use Chrome's trace event format and can
+ * be loaded into chrome://tracing or Perfetto (multiple files at
+ * once).
+ *
+ * Tracing needs to be enabled at configure time (WITH_TRACING),
+ * otherwise the files will be empty.
+ */
+template<typename CELL_TYPE>
+class TimelineWriter : public Clonable<ParallelWriter<CELL_TYPE>, TimelineWriter<CELL_TYPE> >
+{
+public:
+    typedef typename ParallelWriter<CELL_TYPE>::GridType GridType;
+    typedef typename ParallelWriter<CELL_TYPE>::Topology Topology;
+    using ParallelWriter<CELL_TYPE>::period;
+    using ParallelWriter<CELL_TYPE>::prefix;
+
+    TimelineWriter(
+        const std::string& prefix,
+        const unsigned period) :
+        Clonable<ParallelWriter<CELL_TYPE>, TimelineWriter<CELL_TYPE> >(prefix, period)
+    {}
+
+    virtual void stepFinished(
+        const GridType& grid,
+        const Region<Topology::DIM>& validRegion,
+        const Coord<Topology::DIM>& globalDimensions,
+        unsigned step,
+        WriterEvent event,
+        std::size_t rank,
+        bool lastCall)
+    {
+        if (!lastCall || (event == WRITER_INITIALIZED)) {
+            return;
+        }
+
+        if ((event == WRITER_STEP_FINISHED) && (step % period != 0)) {
+            return;
+        }
+
+        Tracer::dump(filename(rank, step), rank);
+        Tracer::clear();
+    }
+
+    std::string filename(std::size_t rank, unsigned step) const
+    {
+        std::ostringstream buf;
+        buf << prefix << std::setfill('0') << std::setw(5) << rank << "."
+            << std::setw(6) << step << ".json";
+        return buf.str();
+    }
+};
+
+}
+
+#endif
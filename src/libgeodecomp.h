@@ -16,6 +16,7 @@
 #ifdef LIBGEODECOMP_WITH_MPI
 #include <mpi.h>
 #include <libgeodecomp/io/collectingwriter.h>
+#include <libgeodecomp/io/parallelsilowriter.h>
 #include <libgeodecomp/io/parallelwriter.h>
 #include <libgeodecomp/parallelization/hiparsimulator.h>
 #endif
@@ -25,6 +26,7 @@
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/stencils.h>
 #include <libgeodecomp/geometry/voronoimesher.h>
+#include <libgeodecomp/io/asyncwriter.h>
 #include <libgeodecomp/io/ppmwriter.h>
 #include <libgeodecomp/io/serialbovwriter.h>
 #include <libgeodecomp/io/silowriter.h>
@@ -27,51 +27,50 @@ OozeBalancer::LoadVec OozeBalancer::expectedOptimalDistribution(
     }
 
     LoadVec ret(n, 0);
-    LoadVec loadPerItem;
+    unsigned node = 0;
+    double remLoad = targetLoadPerNode;
+
+    // the load density is constant for all items of one node, so we
+    // can walk along the nodes' ranges of items (instead of along the
+    // items themselves) and cut whenever a new node is filled up to
+    // its targeted share. Fractions of ranges may be assigned to
+    // multiple nodes.
     for (unsigned i = 0; i < n; i++) {
-        if (weights[i]) {
-            LoadVec add(weights[i], relativeLoads[i] / weights[i]);
-            append(loadPerItem, add);
+        if (weights[i] == 0) {
+            continue;
         }
-    }
-    // stores the remaining fraction, which is still to be assigned,
-    // of each item.
-    LoadVec remFractPerItem(sum(weights), 1.0);
-
-    // now fill up one node after another so that each gets his
-    // targeted share...
-    for (unsigned nodeC = 0; nodeC < n - 1; nodeC++) {
-        double remLoad = targetLoadPerNode;
-
-        for (unsigned itemC = 0; itemC < loadPerItem.size(); itemC++) {
-            // skip already assigned items
-            if (remFractPerItem[itemC] == 0) {
-                continue;
+
+        double loadPerItem = relativeLoads[i] / weights[i];
+        double remItems = weights[i];
+
+        while (remItems > 0) {
+            // add remainder to last node
+            if (node == (n - 1)) {
+                ret[node] += remItems;
+                break;
             }
 
             // can we assign the whole remainder?
-            double l = remFractPerItem[itemC] * loadPerItem[itemC];
+            double l = remItems * loadPerItem;
             if (l <= remLoad) {
-                ret[nodeC] += remFractPerItem[itemC];
-                remFractPerItem[itemC] = 0;
+                ret[node] += remItems;
+                remItems = 0;
                 remLoad -= l;
             } else {
-                double consumedFract = remLoad / loadPerItem[itemC];
-                ret[nodeC] += consumedFract;
-                remFractPerItem[itemC] -= consumedFract;
+                double consumedItems = remLoad / loadPerItem;
+                ret[node] += consumedItems;
+                remItems -= consumedItems;
                 remLoad = 0;
             }
 
-            // break if node filled up
+            // continue with next node if this one is filled up
             if (remLoad == 0) {
-                break;
+                ++node;
+                remLoad = targetLoadPerNode;
             }
         }
     }
 
-    // add remainder to last node
-    ret.back() += sum(remFractPerItem);
-
     return ret;
 }
 
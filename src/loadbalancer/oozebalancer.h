@@ -65,6 +65,11 @@ private:
      * \f]
      *
      * (\f$t\f$ is currently computed on node \f$a\f$.)
+     *
+     * As \f$f(t)\f$ is piecewise constant, the cuts can be found
+     * in a single sweep over the nodes, without materializing the
+     * individual items. Time and memory are thus linear in the
+     * number of nodes and independent of the number of items.
      */
     LoadVec expectedOptimalDistribution(
         const WeightVec& weights,
@@ -0,0 +1,16 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}biasbalancertest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}noopbalancertest.cpp
+  ${RELATIVE_PATH}oozebalancertest.cpp
+  ${RELATIVE_PATH}randombalancertest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}tracingbalancertest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}biasbalancertest.h
+  ${RELATIVE_PATH}noopbalancertest.h
+  ${RELATIVE_PATH}oozebalancertest.h
+  ${RELATIVE_PATH}randombalancertest.h
+  ${RELATIVE_PATH}tracingbalancertest.h
+)
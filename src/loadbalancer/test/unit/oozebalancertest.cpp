@@ -0,0 +1,110 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_OozeBalancerTest1_init = false;
+#include "/root/repo/src/loadbalancer/test/unit/oozebalancertest.h"
+
+static OozeBalancerTest1 suite_OozeBalancerTest1;
+
+static CxxTest::List Tests_OozeBalancerTest1 = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OozeBalancerTest1( "/root/repo/src/loadbalancer/test/unit/oozebalancertest.h", 11, "OozeBalancerTest1", suite_OozeBalancerTest1, Tests_OozeBalancerTest1 );
+
+static class TestDescription_suite_OozeBalancerTest1_testConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest1_testConstructor() : CxxTest::RealTestDescription( Tests_OozeBalancerTest1, suiteDescription_OozeBalancerTest1, 14, "testConstructor" ) {}
+ void runTest() { suite_OozeBalancerTest1.testConstructor(); }
+} testDescription_suite_OozeBalancerTest1_testConstructor;
+
+static class TestDescription_suite_OozeBalancerTest1_testExpectedOptimalDistribution1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest1_testExpectedOptimalDistribution1() : CxxTest::RealTestDescription( Tests_OozeBalancerTest1, suiteDescription_OozeBalancerTest1, 29, "testExpectedOptimalDistribution1" ) {}
+ void runTest() { suite_OozeBalancerTest1.testExpectedOptimalDistribution1(); }
+} testDescription_suite_OozeBalancerTest1_testExpectedOptimalDistribution1;
+
+static class TestDescription_suite_OozeBalancerTest1_testExpectedOptimalDistribution2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest1_testExpectedOptimalDistribution2() : CxxTest::RealTestDescription( Tests_OozeBalancerTest1, suiteDescription_OozeBalancerTest1, 57, "testExpectedOptimalDistribution2" ) {}
+ void runTest() { suite_OozeBalancerTest1.testExpectedOptimalDistribution2(); }
+} testDescription_suite_OozeBalancerTest1_testExpectedOptimalDistribution2;
+
+static class TestDescription_suite_OozeBalancerTest1_testOptDistWithElementsTooLargeForOneNode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest1_testOptDistWithElementsTooLargeForOneNode() : CxxTest::RealTestDescription( Tests_OozeBalancerTest1, suiteDescription_OozeBalancerTest1, 73, "testOptDistWithElementsTooLargeForOneNode" ) {}
+ void runTest() { suite_OozeBalancerTest1.testOptDistWithElementsTooLargeForOneNode(); }
+} testDescription_suite_OozeBalancerTest1_testOptDistWithElementsTooLargeForOneNode;
+
+static class TestDescription_suite_OozeBalancerTest1_testExpectedOptimalDistributionWithHugeWeights : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest1_testExpectedOptimalDistributionWithHugeWeights() : CxxTest::RealTestDescription( Tests_OozeBalancerTest1, suiteDescription_OozeBalancerTest1, 114, "testExpectedOptimalDistributionWithHugeWeights" ) {}
+ void runTest() { suite_OozeBalancerTest1.testExpectedOptimalDistributionWithHugeWeights(); }
+} testDescription_suite_OozeBalancerTest1_testExpectedOptimalDistributionWithHugeWeights;
+
+static OozeBalancerTest2 suite_OozeBalancerTest2;
+
+static CxxTest::List Tests_OozeBalancerTest2 = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OozeBalancerTest2( "/root/repo/src/loadbalancer/test/unit/oozebalancertest.h", 139, "OozeBalancerTest2", suite_OozeBalancerTest2, Tests_OozeBalancerTest2 );
+
+static class TestDescription_suite_OozeBalancerTest2_testConvergence1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testConvergence1() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 213, "testConvergence1" ) {}
+ void runTest() { suite_OozeBalancerTest2.testConvergence1(); }
+} testDescription_suite_OozeBalancerTest2_testConvergence1;
+
+static class TestDescription_suite_OozeBalancerTest2_testConvergence2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testConvergence2() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 222, "testConvergence2" ) {}
+ void runTest() { suite_OozeBalancerTest2.testConvergence2(); }
+} testDescription_suite_OozeBalancerTest2_testConvergence2;
+
+static class TestDescription_suite_OozeBalancerTest2_testEqualize1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testEqualize1() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 241, "testEqualize1" ) {}
+ void runTest() { suite_OozeBalancerTest2.testEqualize1(); }
+} testDescription_suite_OozeBalancerTest2_testEqualize1;
+
+static class TestDescription_suite_OozeBalancerTest2_testEqualize2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testEqualize2() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 258, "testEqualize2" ) {}
+ void runTest() { suite_OozeBalancerTest2.testEqualize2(); }
+} testDescription_suite_OozeBalancerTest2_testEqualize2;
+
+static class TestDescription_suite_OozeBalancerTest2_testEqualize3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testEqualize3() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 265, "testEqualize3" ) {}
+ void runTest() { suite_OozeBalancerTest2.testEqualize3(); }
+} testDescription_suite_OozeBalancerTest2_testEqualize3;
+
+static class TestDescription_suite_OozeBalancerTest2_testLinearCombo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testLinearCombo() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 272, "testLinearCombo" ) {}
+ void runTest() { suite_OozeBalancerTest2.testLinearCombo(); }
+} testDescription_suite_OozeBalancerTest2_testLinearCombo;
+
+static class TestDescription_suite_OozeBalancerTest2_testZeroRelativeLoads : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OozeBalancerTest2_testZeroRelativeLoads() : CxxTest::RealTestDescription( Tests_OozeBalancerTest2, suiteDescription_OozeBalancerTest2, 293, "testZeroRelativeLoads" ) {}
+ void runTest() { suite_OozeBalancerTest2.testZeroRelativeLoads(); }
+} testDescription_suite_OozeBalancerTest2_testZeroRelativeLoads;
+
@@ -110,6 +110,29 @@ public:
 
         checkExpectedOptimalDistribution(expected, loads, relLoads);
     }
+
+    void testExpectedOptimalDistributionWithHugeWeights()
+    {
+        // way too many items to be stored individually:
+        std::size_t items = std::size_t(1) << 40;
+        OozeBalancer::WeightVec loads(3, items);
+
+        OozeBalancer::LoadVec relLoads(3);
+        relLoads[0] = 1.0;
+        relLoads[1] = 3.0;
+        relLoads[2] = 2.0;
+
+        OozeBalancer::LoadVec expected(3);
+        // target load is 2.0 per node, so the first node receives a
+        // third of the second node's items. The remaining two thirds
+        // alone match the target load of the second node...
+        expected[0] = items * (1.0 + 1.0 / 3);
+        expected[1] = items * (2.0 / 3);
+        // ...and the third one keeps its share.
+        expected[2] = items;
+
+        checkExpectedOptimalDistribution(expected, loads, relLoads);
+    }
 };
 
 
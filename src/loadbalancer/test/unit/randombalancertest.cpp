@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_RandomBalancerTest_init = false;
+#include "/root/repo/src/loadbalancer/test/unit/randombalancertest.h"
+
+static RandomBalancerTest suite_RandomBalancerTest;
+
+static CxxTest::List Tests_RandomBalancerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RandomBalancerTest( "/root/repo/src/loadbalancer/test/unit/randombalancertest.h", 8, "RandomBalancerTest", suite_RandomBalancerTest, Tests_RandomBalancerTest );
+
+static class TestDescription_suite_RandomBalancerTest_testEcho : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_RandomBalancerTest_testEcho() : CxxTest::RealTestDescription( Tests_RandomBalancerTest, suiteDescription_RandomBalancerTest, 12, "testEcho" ) {}
+ void runTest() { suite_RandomBalancerTest.testEcho(); }
+} testDescription_suite_RandomBalancerTest_testEcho;
+
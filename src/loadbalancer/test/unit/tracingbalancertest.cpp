@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TracingBalancerTest_init = false;
+#include "/root/repo/src/loadbalancer/test/unit/tracingbalancertest.h"
+
+static TracingBalancerTest suite_TracingBalancerTest;
+
+static CxxTest::List Tests_TracingBalancerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TracingBalancerTest( "/root/repo/src/loadbalancer/test/unit/tracingbalancertest.h", 11, "TracingBalancerTest", suite_TracingBalancerTest, Tests_TracingBalancerTest );
+
+static class TestDescription_suite_TracingBalancerTest_testInterfaceToOtherBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracingBalancerTest_testInterfaceToOtherBalancer() : CxxTest::RealTestDescription( Tests_TracingBalancerTest, suiteDescription_TracingBalancerTest, 29, "testInterfaceToOtherBalancer" ) {}
+ void runTest() { suite_TracingBalancerTest.testInterfaceToOtherBalancer(); }
+} testDescription_suite_TracingBalancerTest_testInterfaceToOtherBalancer;
+
+static class TestDescription_suite_TracingBalancerTest_testDeleteBalancer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracingBalancerTest_testDeleteBalancer() : CxxTest::RealTestDescription( Tests_TracingBalancerTest, suiteDescription_TracingBalancerTest, 48, "testDeleteBalancer" ) {}
+ void runTest() { suite_TracingBalancerTest.testDeleteBalancer(); }
+} testDescription_suite_TracingBalancerTest_testDeleteBalancer;
+
+static class TestDescription_suite_TracingBalancerTest_testTrace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracingBalancerTest_testTrace() : CxxTest::RealTestDescription( Tests_TracingBalancerTest, suiteDescription_TracingBalancerTest, 58, "testTrace" ) {}
+ void runTest() { suite_TracingBalancerTest.testTrace(); }
+} testDescription_suite_TracingBalancerTest_testTrace;
+
@@ -458,6 +458,37 @@ public:
 
     // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
+    template<typename CELL, typename HAS_MASKED_UPDATE_LINE_X = void>
+    class SelectMaskedUpdateLineX
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectMaskedUpdateLineX<CELL, typename CELL::API::SupportsMaskedUpdateLineX>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Unstructured SoA models flagged with this class promise to
+     * write results only via hoodNew.store() in updateLineX(). This
+     * allows the UpdateFunctor to hand them streaks which start or end
+     * in the middle of a chunk: the chunk is computed in full, but
+     * only the lanes of cells within the streak are written back.
+     * Without this flag, partial chunks are peeled off and updated
+     * via update().
+     */
+    class HasMaskedUpdateLineX
+    {
+    public:
+        typedef void SupportsMaskedUpdateLineX;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
     template<typename CELL, typename HAS_SELL_TYPE = void>
     class SelectSellType
     {
@@ -525,6 +556,41 @@ public:
 
     // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 
+    /**
+     * Check whether the UpdateFunctor should time the update of each
+     * streak and record the timings in a CostMap.
+     */
+    template<typename CELL, typename HAS_COST_SAMPLING = void>
+    class SelectCostSampling
+    {
+    public:
+        typedef FalseType Value;
+    };
+
+    template<typename CELL>
+    class SelectCostSampling<CELL, typename CELL::API::SupportsCostSampling>
+    {
+    public:
+        typedef TrueType Value;
+    };
+
+    /**
+     * Use this if the cost of updating your cells varies strongly
+     * throughout the domain (e.g. wet vs. dry cells, refined vs.
+     * coarse regions). Steppers will then measure the time spent on
+     * each streak and the HiParSimulator will place the boundaries of
+     * space-filling curve partitions according to the accumulated
+     * cost instead of the number of cells. Sampling adds two timer
+     * calls per streak, so it's off by default.
+     */
+    class HasCostSampling
+    {
+    public:
+        typedef void SupportsCostSampling;
+    };
+
+    // XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
+
     template<typename CELL,
              typename HAS_MPI_DATA_TYPE = void,
              typename MPI_DATA_TYPE_RETRIEVAL = void>
@@ -0,0 +1,226 @@
+#ifndef LIBGEODECOMP_MISC_AUTOTUNINGCACHE_H
+#define LIBGEODECOMP_MISC_AUTOTUNINGCACHE_H
+
+#include <libgeodecomp/misc/simulationparameters.h>
+#include <libgeodecomp/misc/stringops.h>
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Persists the outcome of parameter optimizations on disk, so that
+ * subsequent runs of the same model on the same machine can skip (or
+ * at least shorten) the tuning phase. See AutoTuningSimulator.
+ *
+ * Entries are identified by a key which describes the setup (e.g.
+ * model, grid size, CPU) and the name of the simulation factory.
+ * The file holds one entry per line, fields are separated by tabs:
+ * key, simulation, steps, fitness, parameter count, parameter values.
+ * Malformed lines are skipped.
+ */
+class AutoTuningCache
+{
+public:
+    /**
+     * Tuned parameters of a simulation factory, along with the
+     * fitness they yielded when running for the given number of
+     * steps.
+     */
+    class Entry
+    {
+    public:
+        explicit
+        Entry(
+            double fitness = 0,
+            unsigned steps = 0,
+            const std::vector<double>& values = std::vector<double>()) :
+            fitness(fitness),
+            steps(steps),
+            values(values)
+        {}
+
+        Entry(const SimulationParameters& params, double fitness, unsigned steps) :
+            fitness(fitness),
+            steps(steps)
+        {
+            for (std::size_t i = 0; i < params.size(); ++i) {
+                values << params[i].getValue();
+            }
+        }
+
+        /**
+         * Writes the stored values back to params. Returns false (and
+         * leaves params untouched) if the number of parameters
+         * doesn't match, e.g. because the factory has changed since
+         * the entry was written.
+         */
+        bool apply(SimulationParameters *params) const
+        {
+            if (params->size() != values.size()) {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                (*params)[i].setValue(values[i]);
+            }
+
+            return true;
+        }
+
+        bool operator==(const Entry& other) const
+        {
+            return
+                (fitness == other.fitness) &&
+                (steps   == other.steps) &&
+                (values  == other.values);
+        }
+
+        double fitness;
+        unsigned steps;
+        std::vector<double> values;
+    };
+
+    explicit AutoTuningCache(const std::string& filename) :
+        filename(filename)
+    {
+        load();
+    }
+
+    bool contains(const std::string& key, const std::string& simulation) const
+    {
+        return entries.find(std::make_pair(key, simulation)) != entries.end();
+    }
+
+    const Entry& get(const std::string& key, const std::string& simulation) const
+    {
+        EntryMap::const_iterator i = entries.find(std::make_pair(key, simulation));
+        if (i == entries.end()) {
+            throw std::invalid_argument("AutoTuningCache: no entry for " + simulation);
+        }
+
+        return i->second;
+    }
+
+    /**
+     * Adds or replaces an entry. Changes will only be written to disk
+     * by flush().
+     */
+    void put(const std::string& key, const std::string& simulation, const Entry& entry)
+    {
+        if ((key.find_first_of("\t\n") != std::string::npos) ||
+            (simulation.find_first_of("\t\n") != std::string::npos)) {
+            throw std::invalid_argument("AutoTuningCache: keys must not contain tabs or newlines");
+        }
+
+        entries[std::make_pair(key, simulation)] = entry;
+    }
+
+    std::size_t size() const
+    {
+        return entries.size();
+    }
+
+    /**
+     * Writes all entries to a temporary file which then replaces the
+     * cache file, so concurrent readers won't see partial files.
+     */
+    void flush() const
+    {
+        std::string tempName = filename + ".tmp";
+        {
+            std::ofstream file(tempName.c_str());
+            if (!file) {
+                throw std::runtime_error("AutoTuningCache: could not open " + tempName);
+            }
+
+            file.precision(std::numeric_limits<double>::digits10 + 2);
+            for (EntryMap::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+                const Entry& entry = i->second;
+                file << i->first.first << "\t"
+                     << i->first.second << "\t"
+                     << entry.steps << "\t"
+                     << entry.fitness << "\t"
+                     << entry.values.size();
+                for (std::size_t j = 0; j < entry.values.size(); ++j) {
+                    file << "\t" << entry.values[j];
+                }
+                file << "\n";
+            }
+        }
+
+        if (std::rename(tempName.c_str(), filename.c_str()) != 0) {
+            throw std::runtime_error("AutoTuningCache: could not replace " + filename);
+        }
+    }
+
+    /**
+     * Name of the CPU model as reported by the OS, or "unknown".
+     */
+    static std::string cpuModel()
+    {
+        std::ifstream file("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.compare(0, 10, "model name") != 0) {
+                continue;
+            }
+
+            std::size_t colon = line.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+
+            StringVec tokens = StringOps::tokenize(line.substr(colon + 1), " \t");
+            return StringOps::join(tokens, " ");
+        }
+
+        return "unknown";
+    }
+
+private:
+    typedef std::map<std::pair<std::string, std::string>, Entry> EntryMap;
+
+    std::string filename;
+    EntryMap entries;
+
+    void load()
+    {
+        std::ifstream file(filename.c_str());
+        std::string line;
+
+        while (std::getline(file, line)) {
+            StringVec fields = StringOps::tokenize(line, "\t");
+            if (fields.size() < 5) {
+                continue;
+            }
+
+            std::stringstream buf;
+            buf << fields[2] << " " << fields[3] << " " << fields[4];
+            Entry entry;
+            std::size_t numValues = 0;
+            if (!(buf >> entry.steps >> entry.fitness >> numValues) ||
+                (fields.size() != (5 + numValues))) {
+                continue;
+            }
+
+            for (std::size_t i = 0; i < numValues; ++i) {
+                entry.values << StringOps::atof(fields[5 + i]);
+            }
+
+            entries[std::make_pair(fields[0], fields[1])] = entry;
+        }
+    }
+};
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef LIBGEODECOMP_MISC_CACHEBLOCKINGSIMULATIONFACTORY_H
 #define LIBGEODECOMP_MISC_CACHEBLOCKINGSIMULATIONFACTORY_H
 
+#include <libgeodecomp/misc/cacheinfo.h>
 #include <libgeodecomp/misc/simulationfactory.h>
 #include <libgeodecomp/parallelization/cacheblockingsimulator.h>
 
@@ -9,21 +10,86 @@
 namespace LibGeoDecomp {
 
 /**
- * Customized factory for instantiating a CacheBlockingSimulator
+ * Customized factory for instantiating a CacheBlockingSimulator.
+ * Wavefronts may span up to the whole grid, but pipelines are
+ * limited to lengths which still fit into the cache (per default a
+ * single core's share of the L2 cache as detected at runtime, as
+ * each thread works on its own wavefront) with the narrowest
+ * wavefront. The initial values form a pipeline of medium length
+ * whose wavefronts span whole lines along the x-axis (short lines
+ * are expensive to update) and which still fits into the cache.
+ * That's a reasonable starting point for the optimizer.
  */
 template<typename CELL>
 class CacheBlockingSimulationFactory : public SimulationFactory<CELL>
 {
 public:
+    typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+    static const int DIM = Topology::DIM;
+    static const int MAX_PIPELINE_LENGTH = 32;
+
     using SimulationFactory<CELL>::addSteerers;
     using SimulationFactory<CELL>::addWriters;
 
-    CacheBlockingSimulationFactory<CELL>(boost::shared_ptr<ClonableInitializer<CELL> > initializer):
+    CacheBlockingSimulationFactory<CELL>(
+        boost::shared_ptr<ClonableInitializer<CELL> > initializer,
+        std::size_t cacheSize = CacheInfo::size(2)) :
         SimulationFactory<CELL>(initializer)
     {
-        SimulationFactory<CELL>::parameterSet.addParameter("WavefrontWidth", 10, 1000);
-        SimulationFactory<CELL>::parameterSet.addParameter("WavefrontHeight",10, 1000);
-        SimulationFactory<CELL>::parameterSet.addParameter("PipelineLength",  1,   30);
+        Coord<DIM> gridDim = initializer->gridDimensions();
+
+        int minWidth = 8;
+        for (int d = 0; d < (DIM - 1); ++d) {
+            minWidth = (std::min)(minWidth, gridDim[d]);
+        }
+
+        int maxPipelineLength = 1;
+        while ((maxPipelineLength < MAX_PIPELINE_LENGTH) &&
+               (footprint(maxPipelineLength + 1, Coord<DIM - 1>::diagonal(minWidth)) <= cacheSize)) {
+            ++maxPipelineLength;
+        }
+
+        // The remaining axes should be at least twice as wide as the
+        // halo (2 * RADIUS * pipelineLength) so that no more than a
+        // third of the updates in the first stage are redundant.
+        // Together with full lines this may force us to shorten the
+        // pipeline:
+        int initialPipelineLength = (maxPipelineLength + 1) / 2;
+        Coord<DIM - 1> initialWavefront;
+        for (;;) {
+            initialWavefront[0] = gridDim[0];
+            for (int d = 1; d < (DIM - 1); ++d) {
+                initialWavefront[d] = (std::max)(
+                    minWidth,
+                    (std::min)(4 * radius() * initialPipelineLength, gridDim[d]));
+            }
+
+            if ((initialPipelineLength == 1) ||
+                (footprint(initialPipelineLength, initialWavefront) <= cacheSize)) {
+                break;
+            }
+            --initialPipelineLength;
+        }
+
+        for (int d = 1; d < (DIM - 1); ++d) {
+            Coord<DIM - 1> wavefront = initialWavefront;
+            while (wavefront[d] < gridDim[d]) {
+                ++wavefront[d];
+                if (footprint(initialPipelineLength, wavefront) > cacheSize) {
+                    break;
+                }
+                initialWavefront = wavefront;
+            }
+        }
+
+        SimulationParameters& params = SimulationFactory<CELL>::parameterSet;
+        params.addParameter("PipelineLength", 1, maxPipelineLength + 1);
+        params["PipelineLength"].setValue(initialPipelineLength - 1);
+
+        for (int d = 0; d < (DIM - 1); ++d) {
+            params.addParameter(wavefrontParameter(d), minWidth, gridDim[d] + 1);
+            params[wavefrontParameter(d)].setValue(initialWavefront[d] - minWidth);
+        }
     }
 
     std::string name() const
@@ -31,16 +97,31 @@ public:
         return "CacheBlockingSimulator";
     }
 
+    /**
+     * Estimated size (in bytes) of the buffers one thread of the
+     * CacheBlockingSimulator needs for the given parameters.
+     */
+    static std::size_t footprint(int pipelineLength, const Coord<DIM - 1>& wavefrontDim)
+    {
+        std::size_t ret = pipelineLength * (2 * radius() + 1) * sizeof(CELL);
+        for (int d = 0; d < (DIM - 1); ++d) {
+            ret *= wavefrontDim[d] + 2 * radius() * pipelineLength;
+        }
+
+        return ret;
+    }
+
 protected:
     virtual Simulator<CELL> *buildSimulator(
         boost::shared_ptr<ClonableInitializer<CELL> > initializer,
         const SimulationParameters& params) const
     {
         int pipelineLength  = params["PipelineLength"];
-        int wavefrontWidth  = params["WavefrontWidth"];
-        int wavefrontHeight = params["WavefrontHeight"];
+        Coord<DIM - 1> wavefrontDim;
+        for (int d = 0; d < (DIM - 1); ++d) {
+            wavefrontDim[d] = params[wavefrontParameter(d)];
+        }
 
-        Coord<2> wavefrontDim(wavefrontWidth, wavefrontHeight);
         CacheBlockingSimulator<CELL> *sim =
             new CacheBlockingSimulator<CELL>(
                 initializer->clone(),
@@ -52,6 +133,17 @@ protected:
 
         return sim;
     }
+
+private:
+    static int radius()
+    {
+        return (std::max)(int(APITraits::SelectStencil<CELL>::Value::RADIUS), 1);
+    }
+
+    static std::string wavefrontParameter(int dimension)
+    {
+        return (dimension == 0) ? "WavefrontWidth" : "WavefrontHeight";
+    }
 };
 
 }
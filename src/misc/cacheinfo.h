@@ -0,0 +1,167 @@
+#ifndef LIBGEODECOMP_MISC_CACHEINFO_H
+#define LIBGEODECOMP_MISC_CACHEINFO_H
+
+#include <libgeodecomp/misc/stringops.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace LibGeoDecomp {
+
+/**
+ * Queries the sizes of the CPU's data caches at runtime. Useful for
+ * picking blocking parameters (see CacheBlockingSimulationFactory).
+ * Falls back to conservative defaults if the platform won't tell.
+ */
+class CacheInfo
+{
+public:
+    /**
+     * Returns the size in bytes of the data (or unified) cache at
+     * the given level (1 to 3) as seen by a single core: caches
+     * shared by multiple cores (typically L2 and L3) are split evenly
+     * among them. Only the sysfs query knows about sharing, the
+     * sysconf() fallback reports the total size.
+     */
+    static std::size_t size(int level)
+    {
+        std::size_t ret = sizeFromSysFS(level);
+        if (ret == 0) {
+            ret = sizeFromSysconf(level);
+        }
+        if (ret == 0) {
+            ret = defaultSize(level);
+        }
+
+        return ret;
+    }
+
+    static std::size_t defaultSize(int level)
+    {
+        switch (level) {
+        case 1:
+            return 32 * 1024;
+        case 2:
+            return 256 * 1024;
+        default:
+            return 2 * 1024 * 1024;
+        }
+    }
+
+    /**
+     * Counts the CPUs in a list as found in sysfs' shared_cpu_list,
+     * e.g. "0-3,8-11" yields 8.
+     */
+    static int countCPUs(const std::string& cpuList)
+    {
+        int ret = 0;
+        StringVec ranges = StringOps::tokenize(cpuList, ",");
+
+        for (StringVec::iterator i = ranges.begin(); i != ranges.end(); ++i) {
+            StringVec bounds = StringOps::tokenize(*i, "-");
+            if (bounds.size() == 1) {
+                ret += 1;
+            }
+            if (bounds.size() == 2) {
+                ret += StringOps::atoi(bounds[1]) - StringOps::atoi(bounds[0]) + 1;
+            }
+        }
+
+        return ret;
+    }
+
+private:
+    /**
+     * Linux exports the cache hierarchy for each CPU in
+     * /sys/devices/system/cpu/cpuN/cache/indexM/{level,type,size},
+     * along with the CPUs sharing that cache in shared_cpu_list.
+     */
+    static std::size_t sizeFromSysFS(int level)
+    {
+        for (int index = 0; index < 16; ++index) {
+            std::string prefix =
+                "/sys/devices/system/cpu/cpu0/cache/index" + StringOps::itoa(index) + "/";
+
+            std::string levelString = readFirstLine(prefix + "level");
+            if (levelString.empty()) {
+                break;
+            }
+            if (StringOps::atoi(levelString) != level) {
+                continue;
+            }
+            if (readFirstLine(prefix + "type") == "Instruction") {
+                continue;
+            }
+
+            std::string sizeString = readFirstLine(prefix + "size");
+            if (sizeString.empty()) {
+                continue;
+            }
+
+            std::size_t factor = 1;
+            switch (sizeString[sizeString.size() - 1]) {
+            case 'K':
+                factor = 1024;
+                break;
+            case 'M':
+                factor = 1024 * 1024;
+                break;
+            default:
+                break;
+            }
+
+            std::size_t size = std::strtoul(sizeString.c_str(), 0, 10) * factor;
+            int sharingCPUs = countCPUs(readFirstLine(prefix + "shared_cpu_list"));
+            if (sharingCPUs > 1) {
+                size /= sharingCPUs;
+            }
+
+            return size;
+        }
+
+        return 0;
+    }
+
+    static std::size_t sizeFromSysconf(int level)
+    {
+        long ret = -1;
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+        switch (level) {
+        case 1:
+            ret = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+            break;
+        case 2:
+            ret = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            break;
+        case 3:
+            ret = sysconf(_SC_LEVEL3_CACHE_SIZE);
+            break;
+        default:
+            break;
+        }
+#endif
+
+        return (ret > 0) ? ret : 0;
+    }
+
+    static std::string readFirstLine(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str());
+        std::string ret;
+        if (file) {
+            std::getline(file, ret);
+        }
+
+        return ret;
+    }
+};
+
+}
+
+#endif
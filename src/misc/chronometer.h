@@ -2,6 +2,7 @@
 #define LIBGEODECOMP_MISC_CHRONOMETER_H
 
 #include <libgeodecomp/misc/scopedtimer.h>
+#include <libgeodecomp/misc/tracer.h>
 #include <libgeodecomp/storage/fixedarray.h>
 
 #include <iomanip>
@@ -39,12 +40,6 @@ public:
 
 protected:
     double *totalTimes;
-
-    double elapsed() const
-    {
-        return ScopedTimer::time() - t;
-    }
-
     double t;
 };
 
@@ -121,7 +116,9 @@ public:
                                                                     \
         ~CLASS_NAME()                                               \
         {                                                           \
-            t = elapsed();                                          \
+            double end = ScopedTimer::time();                       \
+            Tracer::record("chronometer", EVENT_NAME, t, end);      \
+            t = end - t;                                            \
         }                                                           \
     };
 }
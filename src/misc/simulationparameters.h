@@ -339,7 +339,7 @@ public:
 
     void setValue(double newValue)
     {
-        index = sanitizeIndex(index);
+        index = sanitizeIndex(newValue);
         current = elements[index];
     }
 
@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_APITraitsTest_init = false;
+#include "/root/repo/src/misc/test/unit/apitraitstest.h"
+
+static APITraitsTest suite_APITraitsTest;
+
+static CxxTest::List Tests_APITraitsTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_APITraitsTest( "/root/repo/src/misc/test/unit/apitraitstest.h", 77, "APITraitsTest", suite_APITraitsTest, Tests_APITraitsTest );
+
+static class TestDescription_suite_APITraitsTest_testBasicCallback1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testBasicCallback1() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 85, "testBasicCallback1" ) {}
+ void runTest() { suite_APITraitsTest.testBasicCallback1(); }
+} testDescription_suite_APITraitsTest_testBasicCallback1;
+
+static class TestDescription_suite_APITraitsTest_testBasicCallback2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testBasicCallback2() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 108, "testBasicCallback2" ) {}
+ void runTest() { suite_APITraitsTest.testBasicCallback2(); }
+} testDescription_suite_APITraitsTest_testBasicCallback2;
+
+static class TestDescription_suite_APITraitsTest_testStaticDataHandling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testStaticDataHandling() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 127, "testStaticDataHandling" ) {}
+ void runTest() { suite_APITraitsTest.testStaticDataHandling(); }
+} testDescription_suite_APITraitsTest_testStaticDataHandling;
+
+static class TestDescription_suite_APITraitsTest_testSelectAPI : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testSelectAPI() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 148, "testSelectAPI" ) {}
+ void runTest() { suite_APITraitsTest.testSelectAPI(); }
+} testDescription_suite_APITraitsTest_testSelectAPI;
+
+static class TestDescription_suite_APITraitsTest_testSelectRegularGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testSelectRegularGrid() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 153, "testSelectRegularGrid" ) {}
+ void runTest() { suite_APITraitsTest.testSelectRegularGrid(); }
+} testDescription_suite_APITraitsTest_testSelectRegularGrid;
+
+static class TestDescription_suite_APITraitsTest_testTrueTypeFalseTypeOperators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_APITraitsTest_testTrueTypeFalseTypeOperators() : CxxTest::RealTestDescription( Tests_APITraitsTest, suiteDescription_APITraitsTest, 191, "testTrueTypeFalseTypeOperators" ) {}
+ void runTest() { suite_APITraitsTest.testTrueTypeFalseTypeOperators(); }
+} testDescription_suite_APITraitsTest_testTrueTypeFalseTypeOperators;
+
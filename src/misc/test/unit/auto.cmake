@@ -0,0 +1,49 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}apitraitstest.cpp
+  ${RELATIVE_PATH}autotuningcachetest.cpp
+  ${RELATIVE_PATH}cacheinfotest.cpp
+  ${RELATIVE_PATH}chronometertest.cpp
+  ${RELATIVE_PATH}clonabletest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}nonpodtestcelltest.cpp
+  ${RELATIVE_PATH}optimizertest.cpp
+  ${RELATIVE_PATH}palettetest.cpp
+  ${RELATIVE_PATH}quickpalettetest.cpp
+  ${RELATIVE_PATH}randomtest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}scopedtimertest.cpp
+  ${RELATIVE_PATH}simulationfactorywithoutcudatest.cpp
+  ${RELATIVE_PATH}simulationparameterstest.cpp
+  ${RELATIVE_PATH}stdcontaineroverloadstest.cpp
+  ${RELATIVE_PATH}stringopstest.cpp
+  ${RELATIVE_PATH}tempfiletest.cpp
+  ${RELATIVE_PATH}testcelltest.cpp
+  ${RELATIVE_PATH}testhelpertest.cpp
+  ${RELATIVE_PATH}tracertest.cpp
+  ${RELATIVE_PATH}unstructuredtestcelltest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}apitraitstest.h
+  ${RELATIVE_PATH}autotuningcachetest.h
+  ${RELATIVE_PATH}cacheinfotest.h
+  ${RELATIVE_PATH}chronometertest.h
+  ${RELATIVE_PATH}clonabletest.h
+  ${RELATIVE_PATH}cudautiltest.h
+  ${RELATIVE_PATH}nonpodtestcelltest.h
+  ${RELATIVE_PATH}optimizertest.h
+  ${RELATIVE_PATH}optimizertestfunctions.h
+  ${RELATIVE_PATH}palettetest.h
+  ${RELATIVE_PATH}quickpalettetest.h
+  ${RELATIVE_PATH}randomtest.h
+  ${RELATIVE_PATH}scopedtimertest.h
+  ${RELATIVE_PATH}simulationfactorywithcudatest.h
+  ${RELATIVE_PATH}simulationfactorywithoutcudatest.h
+  ${RELATIVE_PATH}simulationparameterstest.h
+  ${RELATIVE_PATH}stdcontaineroverloadstest.h
+  ${RELATIVE_PATH}stringopstest.h
+  ${RELATIVE_PATH}tempfiletest.h
+  ${RELATIVE_PATH}testcelltest.h
+  ${RELATIVE_PATH}testhelpertest.h
+  ${RELATIVE_PATH}tracertest.h
+  ${RELATIVE_PATH}unstructuredtestcelltest.h
+)
@@ -0,0 +1,57 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_AutoTuningCacheTest_init = false;
+#include "/root/repo/src/misc/test/unit/autotuningcachetest.h"
+
+static AutoTuningCacheTest suite_AutoTuningCacheTest;
+
+static CxxTest::List Tests_AutoTuningCacheTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AutoTuningCacheTest( "/root/repo/src/misc/test/unit/autotuningcachetest.h", 13, "AutoTuningCacheTest", suite_AutoTuningCacheTest, Tests_AutoTuningCacheTest );
+
+static class TestDescription_suite_AutoTuningCacheTest_testRoundTrip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutoTuningCacheTest_testRoundTrip() : CxxTest::RealTestDescription( Tests_AutoTuningCacheTest, suiteDescription_AutoTuningCacheTest, 26, "testRoundTrip" ) {}
+ void runTest() { suite_AutoTuningCacheTest.testRoundTrip(); }
+} testDescription_suite_AutoTuningCacheTest_testRoundTrip;
+
+static class TestDescription_suite_AutoTuningCacheTest_testSkipsMalformedLines : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutoTuningCacheTest_testSkipsMalformedLines() : CxxTest::RealTestDescription( Tests_AutoTuningCacheTest, suiteDescription_AutoTuningCacheTest, 56, "testSkipsMalformedLines" ) {}
+ void runTest() { suite_AutoTuningCacheTest.testSkipsMalformedLines(); }
+} testDescription_suite_AutoTuningCacheTest_testSkipsMalformedLines;
+
+static class TestDescription_suite_AutoTuningCacheTest_testPutRejectsSeparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutoTuningCacheTest_testPutRejectsSeparators() : CxxTest::RealTestDescription( Tests_AutoTuningCacheTest, suiteDescription_AutoTuningCacheTest, 76, "testPutRejectsSeparators" ) {}
+ void runTest() { suite_AutoTuningCacheTest.testPutRejectsSeparators(); }
+} testDescription_suite_AutoTuningCacheTest_testPutRejectsSeparators;
+
+static class TestDescription_suite_AutoTuningCacheTest_testApply : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AutoTuningCacheTest_testApply() : CxxTest::RealTestDescription( Tests_AutoTuningCacheTest, suiteDescription_AutoTuningCacheTest, 84, "testApply" ) {}
+ void runTest() { suite_AutoTuningCacheTest.testApply(); }
+} testDescription_suite_AutoTuningCacheTest_testApply;
+
@@ -0,0 +1,109 @@
+#include <libgeodecomp/misc/autotuningcache.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/misc/tempfile.h>
+
+#include <cxxtest/TestSuite.h>
+#include <cstdio>
+#include <fstream>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class AutoTuningCacheTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        filename = TempFile::serial("autotuningcache");
+    }
+
+    void tearDown()
+    {
+        remove(filename.c_str());
+    }
+
+    void testRoundTrip()
+    {
+        std::vector<double> values;
+        values << 1.0
+               << 0.1
+               << 12345.678;
+
+        AutoTuningCache cacheA(filename);
+        TS_ASSERT_EQUALS(std::size_t(0), cacheA.size());
+        cacheA.put("dim=(10, 20) threads=4", "SerialSimulator", AutoTuningCache::Entry(-1.5, 10, values));
+        cacheA.put("dim=(10, 20) threads=4", "CacheBlockingSimulator", AutoTuningCache::Entry(-0.25, 20));
+        cacheA.put("dim=(10, 30) threads=4", "SerialSimulator", AutoTuningCache::Entry(-1.0 / 3, 5, values));
+        cacheA.flush();
+
+        AutoTuningCache cacheB(filename);
+        TS_ASSERT_EQUALS(std::size_t(3), cacheB.size());
+        TS_ASSERT(cacheB.contains("dim=(10, 20) threads=4", "CacheBlockingSimulator"));
+        TS_ASSERT(!cacheB.contains("dim=(10, 30) threads=4", "CacheBlockingSimulator"));
+        TS_ASSERT_EQUALS(
+            AutoTuningCache::Entry(-1.5, 10, values),
+            cacheB.get("dim=(10, 20) threads=4", "SerialSimulator"));
+        TS_ASSERT_EQUALS(
+            AutoTuningCache::Entry(-0.25, 20),
+            cacheB.get("dim=(10, 20) threads=4", "CacheBlockingSimulator"));
+        TS_ASSERT_EQUALS(
+            AutoTuningCache::Entry(-1.0 / 3, 5, values),
+            cacheB.get("dim=(10, 30) threads=4", "SerialSimulator"));
+        TS_ASSERT_THROWS(cacheB.get("dim=(10, 30) threads=4", "foo"), std::invalid_argument&);
+    }
+
+    void testSkipsMalformedLines()
+    {
+        {
+            std::ofstream file(filename.c_str());
+            file << "keyA\tsimA\t5\t-1\t2\t1\t2\n"
+                 << "keyB\tsimB\t5\t-1\t3\t1\t2\n"
+                 << "keyC\tsimC\tfoo\t-1\t0\n"
+                 << "keyD\tsimD\t5\n"
+                 << "\n";
+        }
+
+        AutoTuningCache cache(filename);
+        TS_ASSERT_EQUALS(std::size_t(1), cache.size());
+
+        std::vector<double> values;
+        values << 1
+               << 2;
+        TS_ASSERT_EQUALS(AutoTuningCache::Entry(-1, 5, values), cache.get("keyA", "simA"));
+    }
+
+    void testPutRejectsSeparators()
+    {
+        AutoTuningCache cache(filename);
+        TS_ASSERT_THROWS(cache.put("foo\tbar", "sim", AutoTuningCache::Entry()), std::invalid_argument&);
+        TS_ASSERT_THROWS(cache.put("foo", "sim\n", AutoTuningCache::Entry()), std::invalid_argument&);
+        TS_ASSERT_EQUALS(std::size_t(0), cache.size());
+    }
+
+    void testApply()
+    {
+        SimulationParameters params;
+        params.addParameter("foo", 0, 10);
+        params.addParameter("bar", 5, 20);
+        params["foo"].setValue(3);
+
+        AutoTuningCache::Entry entry(params, -2.0, 7);
+        TS_ASSERT_EQUALS(std::size_t(2), entry.values.size());
+
+        SimulationParameters target;
+        target.addParameter("foo", 0, 10);
+        target.addParameter("bar", 5, 20);
+        TS_ASSERT(entry.apply(&target));
+        TS_ASSERT_EQUALS(3.0, target["foo"].getValue());
+        TS_ASSERT_EQUALS(0.0, target["bar"].getValue());
+
+        target.addParameter("baz", 1, 2);
+        TS_ASSERT(!entry.apply(&target));
+    }
+
+private:
+    std::string filename;
+};
+
+}
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CacheInfoTest_init = false;
+#include "/root/repo/src/misc/test/unit/cacheinfotest.h"
+
+static CacheInfoTest suite_CacheInfoTest;
+
+static CxxTest::List Tests_CacheInfoTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CacheInfoTest( "/root/repo/src/misc/test/unit/cacheinfotest.h", 9, "CacheInfoTest", suite_CacheInfoTest, Tests_CacheInfoTest );
+
+static class TestDescription_suite_CacheInfoTest_testSizesArePlausible : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheInfoTest_testSizesArePlausible() : CxxTest::RealTestDescription( Tests_CacheInfoTest, suiteDescription_CacheInfoTest, 12, "testSizesArePlausible" ) {}
+ void runTest() { suite_CacheInfoTest.testSizesArePlausible(); }
+} testDescription_suite_CacheInfoTest_testSizesArePlausible;
+
+static class TestDescription_suite_CacheInfoTest_testDefaults : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheInfoTest_testDefaults() : CxxTest::RealTestDescription( Tests_CacheInfoTest, suiteDescription_CacheInfoTest, 23, "testDefaults" ) {}
+ void runTest() { suite_CacheInfoTest.testDefaults(); }
+} testDescription_suite_CacheInfoTest_testDefaults;
+
+static class TestDescription_suite_CacheInfoTest_testCountCPUs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheInfoTest_testCountCPUs() : CxxTest::RealTestDescription( Tests_CacheInfoTest, suiteDescription_CacheInfoTest, 29, "testCountCPUs" ) {}
+ void runTest() { suite_CacheInfoTest.testCountCPUs(); }
+} testDescription_suite_CacheInfoTest_testCountCPUs;
+
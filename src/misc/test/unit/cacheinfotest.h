@@ -0,0 +1,39 @@
+#include <libgeodecomp/misc/cacheinfo.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CacheInfoTest : public CxxTest::TestSuite
+{
+public:
+    void testSizesArePlausible()
+    {
+        std::size_t l1 = CacheInfo::size(1);
+        std::size_t l2 = CacheInfo::size(2);
+        std::size_t l3 = CacheInfo::size(3);
+
+        TS_ASSERT_LESS_THAN_EQUALS(std::size_t(1024), l1);
+        TS_ASSERT_LESS_THAN_EQUALS(l1, l2);
+        TS_ASSERT_LESS_THAN(std::size_t(0), l3);
+    }
+
+    void testDefaults()
+    {
+        TS_ASSERT_EQUALS(std::size_t(32 * 1024),  CacheInfo::defaultSize(1));
+        TS_ASSERT_EQUALS(std::size_t(256 * 1024), CacheInfo::defaultSize(2));
+    }
+
+    void testCountCPUs()
+    {
+        TS_ASSERT_EQUALS(0, CacheInfo::countCPUs(""));
+        TS_ASSERT_EQUALS(1, CacheInfo::countCPUs("5"));
+        TS_ASSERT_EQUALS(2, CacheInfo::countCPUs("0,4"));
+        TS_ASSERT_EQUALS(8, CacheInfo::countCPUs("0-3,8-11"));
+        TS_ASSERT_EQUALS(5, CacheInfo::countCPUs("0-1,4,6-7"));
+    }
+};
+
+}
@@ -0,0 +1,80 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SimulationFactoryWithoutCudaTest_init = false;
+#include "/root/repo/src/misc/test/unit/simulationfactorywithoutcudatest.h"
+
+static SimulationFactoryWithoutCudaTest suite_SimulationFactoryWithoutCudaTest;
+
+static CxxTest::List Tests_SimulationFactoryWithoutCudaTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SimulationFactoryWithoutCudaTest( "/root/repo/src/misc/test/unit/simulationfactorywithoutcudatest.h", 14, "SimulationFactoryWithoutCudaTest", suite_SimulationFactoryWithoutCudaTest, Tests_SimulationFactoryWithoutCudaTest );
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testVarStepInitializerProxy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testVarStepInitializerProxy() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 41, "testVarStepInitializerProxy" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testVarStepInitializerProxy(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testVarStepInitializerProxy;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testBasic() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 70, "testBasic" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testBasic(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testBasic;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingFitness : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingFitness() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 84, "testCacheBlockingFitness" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testCacheBlockingFitness(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingFitness;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingParameterRanges : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingParameterRanges() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 101, "testCacheBlockingParameterRanges" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testCacheBlockingParameterRanges(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingParameterRanges;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingSimulatorFromFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingSimulatorFromFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 137, "testCacheBlockingSimulatorFromFactory" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testCacheBlockingSimulatorFromFactory(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testCacheBlockingSimulatorFromFactory;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToSimulator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToSimulator() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 153, "testAddWriterToSimulator" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testAddWriterToSimulator(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToSimulator;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToSerialSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToSerialSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 169, "testAddWriterToSerialSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testAddWriterToSerialSimulationFactory(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToSerialSimulationFactory;
+
+static class TestDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToCacheBlockingSimulationFactory : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToCacheBlockingSimulationFactory() : CxxTest::RealTestDescription( Tests_SimulationFactoryWithoutCudaTest, suiteDescription_SimulationFactoryWithoutCudaTest, 183, "testAddWriterToCacheBlockingSimulationFactory" ) {}
+ void runTest() { suite_SimulationFactoryWithoutCudaTest.testAddWriterToCacheBlockingSimulationFactory(); }
+} testDescription_suite_SimulationFactoryWithoutCudaTest_testAddWriterToCacheBlockingSimulationFactory;
+
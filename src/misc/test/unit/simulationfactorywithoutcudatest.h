@@ -98,6 +98,58 @@ public:
 #endif
     }
 
+    void testCacheBlockingParameterRanges()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+#ifdef LIBGEODECOMP_WITH_CPP14
+        CacheBlockingSimulationFactory<SimFabTestCell> fab(initializerProxy, 256 * 1024);
+        const SimulationParameters& params = fab.parameters();
+
+        // 11 * (8 + 2 * 11)^2 * 3 * sizeof(double) is the largest
+        // pipeline which still fits in with the narrowest wavefront
+        // (intervals exclude their maximum):
+        TS_ASSERT_EQUALS(11.0, params["PipelineLength"].getMax());
+        // wavefronts may span the whole grid:
+        TS_ASSERT_EQUALS(93.0, params["WavefrontWidth"].getMax());
+        TS_ASSERT_EQUALS(93.0, params["WavefrontHeight"].getMax());
+
+        // full lines and a wavefront height of at least 4 times the
+        // pipeline length only fit into the cache with a shorter
+        // pipeline:
+        TS_ASSERT_EQUALS(4,   int(params["PipelineLength"]));
+        TS_ASSERT_EQUALS(100, int(params["WavefrontWidth"]));
+        TS_ASSERT_EQUALS(17,  int(params["WavefrontHeight"]));
+        TS_ASSERT_LESS_THAN_EQUALS(
+            CacheBlockingSimulationFactory<SimFabTestCell>::footprint(4, Coord<2>(100, 17)),
+            std::size_t(256 * 1024));
+        TS_ASSERT_LESS_THAN(
+            std::size_t(256 * 1024),
+            CacheBlockingSimulationFactory<SimFabTestCell>::footprint(4, Coord<2>(100, 18)));
+
+        CacheBlockingSimulationFactory<SimFabTestCell> tinyFab(initializerProxy, 1);
+        TS_ASSERT_EQUALS(1.0, tinyFab.parameters()["PipelineLength"].getMax());
+        TS_ASSERT_EQUALS(100, int(tinyFab.parameters()["WavefrontWidth"]));
+        TS_ASSERT_EQUALS(8,   int(tinyFab.parameters()["WavefrontHeight"]));
+#endif
+#endif
+    }
+
+    void testCacheBlockingSimulatorFromFactory()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+#ifdef LIBGEODECOMP_WITH_CPP14
+        boost::shared_ptr<VarStepInitializerProxy<SimFabTestCell> > init(
+            new VarStepInitializerProxy<SimFabTestCell>(
+                new SimFabTestInitializer(Coord<3>(20, 15, 10), 10)));
+        CacheBlockingSimulationFactory<SimFabTestCell> fab(init);
+
+        boost::shared_ptr<Simulator<SimFabTestCell> > sim(fab());
+        sim->run();
+        TS_ASSERT_EQUALS(unsigned(10), sim->getStep());
+#endif
+#endif
+    }
+
     void testAddWriterToSimulator()
     {
         // fixme
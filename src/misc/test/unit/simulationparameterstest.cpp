@@ -0,0 +1,68 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SimulationParametersTest_init = false;
+#include "/root/repo/src/misc/test/unit/simulationparameterstest.h"
+
+static SimulationParametersTest suite_SimulationParametersTest;
+
+static CxxTest::List Tests_SimulationParametersTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SimulationParametersTest( "/root/repo/src/misc/test/unit/simulationparameterstest.h", 10, "SimulationParametersTest", suite_SimulationParametersTest, Tests_SimulationParametersTest );
+
+static class TestDescription_suite_SimulationParametersTest_testOptimizableParameterInterface1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationParametersTest_testOptimizableParameterInterface1() : CxxTest::RealTestDescription( Tests_SimulationParametersTest, suiteDescription_SimulationParametersTest, 21, "testOptimizableParameterInterface1" ) {}
+ void runTest() { suite_SimulationParametersTest.testOptimizableParameterInterface1(); }
+} testDescription_suite_SimulationParametersTest_testOptimizableParameterInterface1;
+
+static class TestDescription_suite_SimulationParametersTest_testOptimizableParameterInterface2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationParametersTest_testOptimizableParameterInterface2() : CxxTest::RealTestDescription( Tests_SimulationParametersTest, suiteDescription_SimulationParametersTest, 47, "testOptimizableParameterInterface2" ) {}
+ void runTest() { suite_SimulationParametersTest.testOptimizableParameterInterface2(); }
+} testDescription_suite_SimulationParametersTest_testOptimizableParameterInterface2;
+
+static class TestDescription_suite_SimulationParametersTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationParametersTest_testBasic() : CxxTest::RealTestDescription( Tests_SimulationParametersTest, suiteDescription_SimulationParametersTest, 70, "testBasic" ) {}
+ void runTest() { suite_SimulationParametersTest.testBasic(); }
+} testDescription_suite_SimulationParametersTest_testBasic;
+
+static class TestDescription_suite_SimulationParametersTest_testReplaceParameterAndToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationParametersTest_testReplaceParameterAndToString() : CxxTest::RealTestDescription( Tests_SimulationParametersTest, suiteDescription_SimulationParametersTest, 170, "testReplaceParameterAndToString" ) {}
+ void runTest() { suite_SimulationParametersTest.testReplaceParameterAndToString(); }
+} testDescription_suite_SimulationParametersTest_testReplaceParameterAndToString;
+
+static class TestDescription_suite_SimulationParametersTest_testSetValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationParametersTest_testSetValue() : CxxTest::RealTestDescription( Tests_SimulationParametersTest, suiteDescription_SimulationParametersTest, 194, "testSetValue" ) {}
+ void runTest() { suite_SimulationParametersTest.testSetValue(); }
+} testDescription_suite_SimulationParametersTest_testSetValue;
+
+static class TestDescription_suite_SimulationParametersTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulationParametersTest_testToString() : CxxTest::RealTestDescription( Tests_SimulationParametersTest, suiteDescription_SimulationParametersTest, 212, "testToString" ) {}
+ void runTest() { suite_SimulationParametersTest.testToString(); }
+} testDescription_suite_SimulationParametersTest_testToString;
+
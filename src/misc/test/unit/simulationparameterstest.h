@@ -191,6 +191,24 @@ public:
         TS_ASSERT_EQUALS("DiscreteSet([a, b, c], 2)", params["foo"].toString());
     }
 
+    void testSetValue()
+    {
+        std::vector<char> values;
+        values << 'a'
+               << 'b'
+               << 'c';
+        SimulationParameters params;
+        params.addParameter("foo", values);
+        params.addParameter("bar", 10, 20);
+
+        params["foo"].setValue(2);
+        params["bar"].setValue(7);
+        TS_ASSERT_EQUALS("DiscreteSet([a, b, c], 2)", params["foo"].toString());
+        TS_ASSERT_EQUALS("Interval([10, 20], 7)", params["bar"].toString());
+        TS_ASSERT_EQUALS(2.0, params["foo"].getValue());
+        TS_ASSERT_EQUALS(7.0, params["bar"].getValue());
+    }
+
     void testToString()
     {
         std::stringstream buf;
@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TracerTest_init = false;
+#include "/root/repo/src/misc/test/unit/tracertest.h"
+
+static TracerTest suite_TracerTest;
+
+static CxxTest::List Tests_TracerTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TracerTest( "/root/repo/src/misc/test/unit/tracertest.h", 15, "TracerTest", suite_TracerTest, Tests_TracerTest );
+
+static class TestDescription_suite_TracerTest_testDumpFormat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracerTest_testDumpFormat() : CxxTest::RealTestDescription( Tests_TracerTest, suiteDescription_TracerTest, 28, "testDumpFormat" ) {}
+ void runTest() { suite_TracerTest.testDumpFormat(); }
+} testDescription_suite_TracerTest_testDumpFormat;
+
+static class TestDescription_suite_TracerTest_testChronometerScopes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracerTest_testChronometerScopes() : CxxTest::RealTestDescription( Tests_TracerTest, suiteDescription_TracerTest, 58, "testChronometerScopes" ) {}
+ void runTest() { suite_TracerTest.testChronometerScopes(); }
+} testDescription_suite_TracerTest_testChronometerScopes;
+
+static class TestDescription_suite_TracerTest_testScopedTrace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracerTest_testScopedTrace() : CxxTest::RealTestDescription( Tests_TracerTest, suiteDescription_TracerTest, 81, "testScopedTrace" ) {}
+ void runTest() { suite_TracerTest.testScopedTrace(); }
+} testDescription_suite_TracerTest_testScopedTrace;
+
+static class TestDescription_suite_TracerTest_testRingBufferOverflow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TracerTest_testRingBufferOverflow() : CxxTest::RealTestDescription( Tests_TracerTest, suiteDescription_TracerTest, 99, "testRingBufferOverflow" ) {}
+ void runTest() { suite_TracerTest.testRingBufferOverflow(); }
+} testDescription_suite_TracerTest_testRingBufferOverflow;
+
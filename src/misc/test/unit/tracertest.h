@@ -0,0 +1,122 @@
+#include <libgeodecomp/misc/chronometer.h>
+#include <libgeodecomp/misc/tracer.h>
+
+#include <cxxtest/TestSuite.h>
+#include <sstream>
+
+#ifdef LIBGEODECOMP_WITH_TRACING
+#include <thread>
+#endif
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TracerTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        Tracer::clear();
+    }
+
+    void tearDown()
+    {
+        Tracer::clear();
+    }
+
+    void testDumpFormat()
+    {
+        Tracer::record("foo", "bar", 1.0, 1.5);
+        Tracer::record("foo", "baz", 2.0, 2.25, 3, 1024);
+        Tracer::record("foo", "qux", 3.0, 3.0, -1, 0, 42);
+        Tracer::record("foo", "baz", 4.0, 4.5, 1, 8, 43);
+
+        std::stringstream buf;
+        Tracer::dump(buf, 7);
+
+#ifdef LIBGEODECOMP_WITH_TRACING
+        std::string expected =
+            "{\"traceEvents\":[\n"
+            "{\"name\":\"bar\",\"cat\":\"foo\",\"ph\":\"X\",\"pid\":7,\"tid\":0,"
+            "\"ts\":1000000.000,\"dur\":500000.000},\n"
+            "{\"name\":\"baz\",\"cat\":\"foo\",\"ph\":\"X\",\"pid\":7,\"tid\":0,"
+            "\"ts\":2000000.000,\"dur\":250000.000,\"args\":{\"peer\":3,\"bytes\":1024}},\n"
+            "{\"name\":\"qux\",\"cat\":\"foo\",\"ph\":\"X\",\"pid\":7,\"tid\":0,"
+            "\"ts\":3000000.000,\"dur\":0.000,\"args\":{\"nano_step\":42}},\n"
+            "{\"name\":\"baz\",\"cat\":\"foo\",\"ph\":\"X\",\"pid\":7,\"tid\":0,"
+            "\"ts\":4000000.000,\"dur\":500000.000,\"args\":{\"peer\":1,\"bytes\":8,\"nano_step\":43}}\n"
+            "],\"displayTimeUnit\":\"ms\"}\n";
+#else
+        std::string expected =
+            "{\"traceEvents\":[\n"
+            "],\"displayTimeUnit\":\"ms\"}\n";
+#endif
+        TS_ASSERT_EQUALS(expected, buf.str());
+    }
+
+    void testChronometerScopes()
+    {
+        Chronometer chrono;
+        {
+            TimeCompute t(&chrono);
+            ScopedTimer::busyWait(1000);
+        }
+        chrono.addTime<TimeInput>(1.0);
+
+        std::vector<std::vector<Tracer::Record> > events = Tracer::events();
+#ifdef LIBGEODECOMP_WITH_TRACING
+        TS_ASSERT_EQUALS(std::size_t(1), events[0].size());
+        TS_ASSERT_EQUALS(std::string("chronometer"), events[0][0].category);
+        TS_ASSERT_EQUALS(std::string("compute_time"), events[0][0].name);
+        TS_ASSERT_DELTA(
+            chrono.interval<TimeCompute>(),
+            events[0][0].end - events[0][0].begin,
+            1e-9);
+#else
+        TS_ASSERT(events.empty());
+#endif
+    }
+
+    void testScopedTrace()
+    {
+        {
+            ScopedTrace trace("patchlink", "send", 5, 0, 7);
+            trace.setBytes(80);
+        }
+
+#ifdef LIBGEODECOMP_WITH_TRACING
+        std::vector<std::vector<Tracer::Record> > events = Tracer::events();
+        TS_ASSERT_EQUALS(std::size_t(1), events[0].size());
+        TS_ASSERT_EQUALS(std::string("send"), events[0][0].name);
+        TS_ASSERT_EQUALS(5, events[0][0].peer);
+        TS_ASSERT_EQUALS(std::size_t(80), events[0][0].bytes);
+        TS_ASSERT_EQUALS(7, events[0][0].nanoStep);
+        TS_ASSERT_LESS_THAN_EQUALS(events[0][0].begin, events[0][0].end);
+#endif
+    }
+
+    void testRingBufferOverflow()
+    {
+#ifdef LIBGEODECOMP_WITH_TRACING
+        Tracer::setCapacity(4);
+        std::thread worker([]() {
+                for (int i = 0; i < 10; ++i) {
+                    Tracer::record("test", "event", i, i + 0.5);
+                }
+            });
+        worker.join();
+        Tracer::setCapacity(Tracer::DEFAULT_CAPACITY);
+
+        std::vector<std::vector<Tracer::Record> > events = Tracer::events();
+        std::vector<Tracer::Record> workerEvents = events.back();
+        TS_ASSERT_EQUALS(std::size_t(4), workerEvents.size());
+        for (int i = 0; i < 4; ++i) {
+            TS_ASSERT_EQUALS(6.0 + i, workerEvents[i].begin);
+        }
+        TS_ASSERT_EQUALS(std::size_t(6), Tracer::dropped());
+#endif
+    }
+};
+
+}
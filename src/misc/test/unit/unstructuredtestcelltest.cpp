@@ -0,0 +1,67 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredTestCellTest_init = false;
+#include "/root/repo/src/misc/test/unit/unstructuredtestcelltest.h"
+
+static UnstructuredTestCellTest suite_UnstructuredTestCellTest;
+
+static CxxTest::List Tests_UnstructuredTestCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredTestCellTest( "/root/repo/src/misc/test/unit/unstructuredtestcelltest.h", 14, "UnstructuredTestCellTest", suite_UnstructuredTestCellTest, Tests_UnstructuredTestCellTest );
+
+static class TestDescription_suite_UnstructuredTestCellTest_testBasicUpdates : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testBasicUpdates() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 35, "testBasicUpdates" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testBasicUpdates(); }
+} testDescription_suite_UnstructuredTestCellTest_testBasicUpdates;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testWeightsChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testWeightsChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 51, "testWeightsChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testWeightsChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testWeightsChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testNanoStepChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testNanoStepChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 73, "testNanoStepChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testNanoStepChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testNanoStepChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testIDChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testIDChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 96, "testIDChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testIDChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testIDChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testValidityChecking : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testValidityChecking() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 119, "testValidityChecking" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testValidityChecking(); }
+} testDescription_suite_UnstructuredTestCellTest_testValidityChecking;
+
+static class TestDescription_suite_UnstructuredTestCellTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredTestCellTest_testSoA() : CxxTest::RealTestDescription( Tests_UnstructuredTestCellTest, suiteDescription_UnstructuredTestCellTest, 142, "testSoA" ) {}
+ void runTest() { suite_UnstructuredTestCellTest.testSoA(); }
+} testDescription_suite_UnstructuredTestCellTest_testSoA;
+
@@ -0,0 +1,357 @@
+#ifndef LIBGEODECOMP_MISC_TRACER_H
+#define LIBGEODECOMP_MISC_TRACER_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/misc/scopedtimer.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef LIBGEODECOMP_WITH_TRACING
+#include <boost/shared_ptr.hpp>
+#include <mutex>
+#endif
+
+namespace LibGeoDecomp {
+
+/**
+ * The Tracer records a timeline of events (e.g. all Chronometer
+ * scopes and PatchLink transmissions) so that stalls can be
+ * attributed to individual nano steps, threads and neighbors -- the
+ * Chronometer alone only yields totals. Each thread writes to its own
+ * ring buffer which is allocated once, upon its first event. If a
+ * buffer overflows, its oldest events will be overwritten.
+ *
+ * dump() writes the timeline in Chrome's trace event format, which
+ * can be viewed with chrome://tracing or Perfetto. Buffers should
+ * only be dumped or cleared while no other thread is recording
+ * events, e.g. from a ParallelWriter (see TimelineWriter).
+ *
+ * Tracing needs to be enabled at configure time (WITH_TRACING).
+ * Otherwise all functions of this class are no-ops and recording
+ * events costs nothing.
+ */
+class Tracer
+{
+public:
+    class Record
+    {
+    public:
+        inline Record(
+            const char *category = "",
+            const char *name = "",
+            double begin = 0,
+            double end = 0,
+            int peer = -1,
+            std::size_t bytes = 0,
+            long nanoStep = -1) :
+            category(category),
+            name(name),
+            begin(begin),
+            end(end),
+            peer(peer),
+            bytes(bytes),
+            nanoStep(nanoStep)
+        {}
+
+        const char *category;
+        const char *name;
+        double begin;
+        double end;
+        int peer;
+        std::size_t bytes;
+        long nanoStep;
+    };
+
+    static const std::size_t DEFAULT_CAPACITY = 1 << 16;
+
+    /**
+     * Records an event of the calling thread. category and name need
+     * to point to strings with static storage duration (i.e. string
+     * literals), the Tracer won't copy them. peer and bytes may
+     * describe a transmission, nanoStep the (global) nano step to
+     * which the event belongs. Negative values mean "not available".
+     */
+    static inline void record(
+        const char *category,
+        const char *name,
+        double begin,
+        double end,
+        int peer = -1,
+        std::size_t bytes = 0,
+        long nanoStep = -1)
+    {
+#ifdef LIBGEODECOMP_WITH_TRACING
+        threadBuffer().push(Record(category, name, begin, end, peer, bytes, nanoStep));
+#endif
+    }
+
+    /**
+     * Sets the number of events each thread can hold. Only affects
+     * threads which haven't recorded any events yet.
+     */
+    static void setCapacity(std::size_t capacity)
+    {
+#ifdef LIBGEODECOMP_WITH_TRACING
+        if (capacity == 0) {
+            throw std::invalid_argument("Tracer capacity must be positive");
+        }
+
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        registry().capacity = capacity;
+#endif
+    }
+
+    /**
+     * Returns the recorded events of all threads, oldest first.
+     * Events of the ith thread are stored in the ith vector.
+     */
+    static std::vector<std::vector<Record> > events()
+    {
+        std::vector<std::vector<Record> > ret;
+
+#ifdef LIBGEODECOMP_WITH_TRACING
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        for (std::size_t i = 0; i < registry().buffers.size(); ++i) {
+            ret.push_back(registry().buffers[i]->events());
+        }
+#endif
+
+        return ret;
+    }
+
+    /**
+     * Returns the number of events lost due to full ring buffers.
+     */
+    static std::size_t dropped()
+    {
+        std::size_t ret = 0;
+
+#ifdef LIBGEODECOMP_WITH_TRACING
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        for (std::size_t i = 0; i < registry().buffers.size(); ++i) {
+            ret += registry().buffers[i]->dropped();
+        }
+#endif
+
+        return ret;
+    }
+
+    /**
+     * Discards all recorded events, e.g. after a periodic dump().
+     * Buffers remain allocated.
+     */
+    static void clear()
+    {
+#ifdef LIBGEODECOMP_WITH_TRACING
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        for (std::size_t i = 0; i < registry().buffers.size(); ++i) {
+            registry().buffers[i]->clear();
+        }
+#endif
+    }
+
+    /**
+     * Writes all events in Chrome's JSON trace event format. rank
+     * becomes the process ID, so the dumps of multiple ranks can be
+     * viewed side by side. Timestamps are given in microseconds.
+     */
+    static void dump(std::ostream& stream, std::size_t rank)
+    {
+        std::vector<std::vector<Record> > threads = events();
+        bool first = true;
+
+        stream << std::fixed << std::setprecision(3)
+               << "{\"traceEvents\":[";
+        for (std::size_t thread = 0; thread < threads.size(); ++thread) {
+            for (std::size_t i = 0; i < threads[thread].size(); ++i) {
+                const Record& record = threads[thread][i];
+                stream << (first ? "\n" : ",\n")
+                       << "{\"name\":\"" << record.name
+                       << "\",\"cat\":\"" << record.category
+                       << "\",\"ph\":\"X\",\"pid\":" << rank
+                       << ",\"tid\":" << thread
+                       << ",\"ts\":" << (record.begin * 1e6)
+                       << ",\"dur\":" << ((record.end - record.begin) * 1e6);
+                if ((record.peer >= 0) || (record.nanoStep >= 0)) {
+                    stream << ",\"args\":{";
+                    if (record.peer >= 0) {
+                        stream << "\"peer\":" << record.peer
+                               << ",\"bytes\":" << record.bytes
+                               << ((record.nanoStep >= 0) ? "," : "");
+                    }
+                    if (record.nanoStep >= 0) {
+                        stream << "\"nano_step\":" << record.nanoStep;
+                    }
+                    stream << "}";
+                }
+                stream << "}";
+                first = false;
+            }
+        }
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    static void dump(const std::string& filename, std::size_t rank)
+    {
+        std::ofstream file(filename.c_str());
+        if (!file) {
+            throw std::runtime_error("Tracer could not open " + filename);
+        }
+
+        dump(file, rank);
+    }
+
+private:
+#ifdef LIBGEODECOMP_WITH_TRACING
+    /**
+     * Fixed size ring buffer, written by a single thread.
+     */
+    class Buffer
+    {
+    public:
+        explicit Buffer(std::size_t capacity) :
+            records(capacity),
+            counter(0)
+        {}
+
+        inline void push(const Record& record)
+        {
+            records[counter % records.size()] = record;
+            ++counter;
+        }
+
+        std::vector<Record> events() const
+        {
+            std::vector<Record> ret;
+            std::size_t begin = counter - size();
+            for (std::size_t i = begin; i < counter; ++i) {
+                ret.push_back(records[i % records.size()]);
+            }
+
+            return ret;
+        }
+
+        std::size_t size() const
+        {
+            return (std::min)(counter, records.size());
+        }
+
+        std::size_t dropped() const
+        {
+            return counter - size();
+        }
+
+        void clear()
+        {
+            counter = 0;
+        }
+
+    private:
+        std::vector<Record> records;
+        std::size_t counter;
+    };
+
+    /**
+     * Keeps the buffers of all threads, so events survive the
+     * threads which recorded them.
+     */
+    class Registry
+    {
+    public:
+        Registry() :
+            capacity(DEFAULT_CAPACITY)
+        {}
+
+        std::mutex mutex;
+        std::size_t capacity;
+        std::vector<boost::shared_ptr<Buffer> > buffers;
+    };
+
+    static Registry& registry()
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    static inline Buffer& threadBuffer()
+    {
+        static thread_local Buffer *buffer = 0;
+        if (buffer == 0) {
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            registry().buffers.push_back(
+                boost::shared_ptr<Buffer>(new Buffer(registry().capacity)));
+            buffer = registry().buffers.back().get();
+        }
+
+        return *buffer;
+    }
+#endif
+};
+
+/**
+ * Records the time between creation and destruction as an event of
+ * the Tracer. Costs nothing if tracing is disabled.
+ */
+class ScopedTrace
+{
+public:
+#ifdef LIBGEODECOMP_WITH_TRACING
+    inline ScopedTrace(
+        const char *category,
+        const char *name,
+        int peer = -1,
+        std::size_t bytes = 0,
+        long nanoStep = -1) :
+        category(category),
+        name(name),
+        peer(peer),
+        bytes(bytes),
+        nanoStep(nanoStep),
+        begin(ScopedTimer::time())
+    {}
+
+    inline ~ScopedTrace()
+    {
+        Tracer::record(category, name, begin, ScopedTimer::time(), peer, bytes, nanoStep);
+    }
+
+    /**
+     * Updates the size of the transmission, e.g. if it's only known
+     * after packing or receiving the payload.
+     */
+    inline void setBytes(std::size_t newBytes)
+    {
+        bytes = newBytes;
+    }
+
+private:
+    const char *category;
+    const char *name;
+    int peer;
+    std::size_t bytes;
+    long nanoStep;
+    double begin;
+#else
+    inline ScopedTrace(
+        const char * /* category */,
+        const char * /* name */,
+        int /* peer */ = -1,
+        std::size_t /* bytes */ = 0,
+        long /* nanoStep */ = -1)
+    {}
+
+    inline void setBytes(std::size_t /* newBytes */)
+    {}
+#endif
+};
+
+}
+
+#endif
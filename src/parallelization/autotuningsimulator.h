@@ -5,6 +5,7 @@
 
 #ifdef LIBGEODECOMP_WITH_CPP14
 
+#include <libgeodecomp/misc/autotuningcache.h>
 #include <libgeodecomp/misc/optimizer.h>
 #include <libgeodecomp/misc/cacheblockingsimulationfactory.h>
 #include <libgeodecomp/misc/cudasimulationfactory.h>
@@ -13,7 +14,14 @@
 #include <libgeodecomp/io/initializer.h>
 #include <libgeodecomp/io/varstepinitializerproxy.h>
 #include <libgeodecomp/io/logger.h>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
 #include <cfloat>
+#include <sstream>
+#include <typeinfo>
 
 namespace LibGeoDecomp {
 
@@ -52,6 +60,14 @@ public:
  * facilities to select the most efficient Simulator implementation
  * and suitable parameters for the given simulation model and
  * hardware.
+ *
+ * Tuning results can be stored in an AutoTuningCache (see
+ * setCacheFile()). Entries are keyed by model, grid dimensions,
+ * thread count and CPU model. If all simulations are found in the
+ * cache, a short validation run of the best one replaces the tuning
+ * phase. Should that run be significantly slower than the cached
+ * fitness suggests, the cached parameters merely serve as starting
+ * points for the optimizers.
  */
 template<typename CELL_TYPE, typename OPTIMIZER_TYPE>
 class AutoTuningSimulator
@@ -72,12 +88,28 @@ public:
 
     void addSteerer(const Steerer<CELL_TYPE> *steerer);
 
+    /**
+     * Enables persistent caching of tuning results in the given
+     * file. Cached results will be considered stale if the
+     * validation run is slower by more than the given tolerance
+     * (relative to the cached fitness).
+     */
+    void setCacheFile(const std::string& filename, double tolerance = 0.5);
+
     void run();
 
 private:
+    /**
+     * The validation run for cached results lasts only a fraction of
+     * the steps used during tuning.
+     */
+    static const unsigned VALIDATION_STEPS_DIVISOR = 4;
+
     std::map<const std::string, SimulationPtr> simulations;
     unsigned optimizationSteps; // maximum number of Steps for the optimizer
     boost::shared_ptr<VarStepInitializerProxy<CELL_TYPE> > varStepInitializer;
+    boost::shared_ptr<AutoTuningCache> cache;
+    double cacheTolerance;
     std::vector<boost::shared_ptr<ParallelWriter<CELL_TYPE> > > parallelWriters;
     std::vector<boost::shared_ptr<Writer<CELL_TYPE> > > writers;
     std::vector<boost::shared_ptr<Steerer<CELL_TYPE> > > steerers;
@@ -109,6 +141,14 @@ private:
 
     void prepareSimulations();
 
+    std::string cacheKey() const;
+
+    bool restoreFromCache();
+
+    bool validateCachedResult(const std::string& simulatorName);
+
+    void storeInCache(unsigned steps);
+
     SimulationPtr getSimulation(const std::string& simulatorName)
     {
         if (simulations.find(simulatorName) == simulations.end()) {
@@ -122,7 +162,8 @@ private:
 template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::AutoTuningSimulator(Initializer<CELL_TYPE> *initializer, unsigned optimizationSteps):
     optimizationSteps(optimizationSteps),
-    varStepInitializer(new VarStepInitializerProxy<CELL_TYPE>(initializer))
+    varStepInitializer(new VarStepInitializerProxy<CELL_TYPE>(initializer)),
+    cacheTolerance(0.5)
 {
     addSimulation(SerialSimulationFactory<CELL_TYPE>(varStepInitializer));
 #ifdef LIBGEODECOMP_WITH_THREADS
@@ -155,6 +196,13 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::addSteerer(const Steerer<CE
     steerers.push_back(boost::shared_ptr<Steerer<CELL_TYPE> >(steerer));
 }
 
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::setCacheFile(const std::string& filename, double tolerance)
+{
+    cache.reset(new AutoTuningCache(filename));
+    cacheTolerance = tolerance;
+}
+
 template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::run()
 {
@@ -165,12 +213,25 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::run()
     unsigned defaultInitializerSteps = 5;
 
     prepareSimulations();
-    if (!normalizeSteps(fitnessGoal, defaultInitializerSteps)) {
+    if (restoreFromCache()) {
+        std::string best = getBestSim();
+        if (validateCachedResult(best)) {
+            runToCompletion(best);
+            return;
+        }
+
+        LOG(Logger::INFO, "cached tuning results are stale, using them as starting points only");
+    }
+
+    unsigned steps = normalizeSteps(fitnessGoal, defaultInitializerSteps);
+    if (!steps) {
         LOG(Logger::WARN, "normalize Steps was not successful, default step number will be used");
-        varStepInitializer->setMaxSteps(defaultInitializerSteps);
+        steps = defaultInitializerSteps;
+        varStepInitializer->setMaxSteps(steps);
     }
 
     runTest();
+    storeInCache(steps);
     std::string best = getBestSim();
     runToCompletion(best);
 }
@@ -179,7 +240,7 @@ template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
 std::string AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::getBestSim()
 {
     std::string bestSimulation;
-    double tmpFitness = std::numeric_limits<double>::min();
+    double tmpFitness = -std::numeric_limits<double>::max();
     typedef typename std::map<const std::string, SimulationPtr>::iterator IterType;
 
     for (IterType iter = simulations.begin(); iter != simulations.end(); iter++) {
@@ -208,7 +269,7 @@ unsigned AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::normalizeSteps(double g
         throw std::invalid_argument("startSteps needs to be grater than zero");
     }
 
-    SimulationPtr simulation = getSimulation("SerialSimulation");
+    SimulationPtr simulation = getSimulation("SerialSimulator");
     SimFactoryPtr factory = simulation->simulationFactory;
     unsigned steps = startStepNum;
     unsigned oldSteps = startStepNum;
@@ -275,6 +336,101 @@ void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::prepareSimulations()
     }
 }
 
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+std::string AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::cacheKey() const
+{
+#ifdef LIBGEODECOMP_WITH_THREADS
+    int threads = omp_get_max_threads();
+#else
+    int threads = 1;
+#endif
+
+    std::stringstream buf;
+    buf << "cell=" << typeid(CELL_TYPE).name()
+        << " dim=" << varStepInitializer->gridDimensions()
+        << " threads=" << threads
+        << " cpu=" << AutoTuningCache::cpuModel();
+    return buf.str();
+}
+
+/**
+ * Sets parameters and fitness of all simulations found in the cache.
+ * Returns true if all simulations could be restored.
+ */
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+bool AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::restoreFromCache()
+{
+    if (!cache) {
+        return false;
+    }
+
+    std::string key = cacheKey();
+    bool ret = true;
+    typedef typename std::map<const std::string, SimulationPtr>::iterator IterType;
+
+    for (IterType iter = simulations.begin(); iter != simulations.end(); iter++) {
+        if (!cache->contains(key, iter->first)) {
+            ret = false;
+            continue;
+        }
+
+        const AutoTuningCache::Entry& entry = cache->get(key, iter->first);
+        if (!entry.apply(&iter->second->parameters)) {
+            ret = false;
+            continue;
+        }
+
+        iter->second->fitness = entry.fitness;
+        LOG(Logger::DBG, "restored " << iter->first << " from cache, fitness: " << entry.fitness);
+    }
+
+    return ret;
+}
+
+/**
+ * Runs the given simulation for a couple of steps and checks whether
+ * its performance still matches the cached fitness.
+ */
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+bool AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::validateCachedResult(const std::string& simulatorName)
+{
+    const AutoTuningCache::Entry& entry = cache->get(cacheKey(), simulatorName);
+    if (entry.steps == 0) {
+        return false;
+    }
+
+    unsigned steps = (std::max)(1u, entry.steps / VALIDATION_STEPS_DIVISOR);
+    varStepInitializer->setMaxSteps(steps);
+    SimulationPtr simulation = getSimulation(simulatorName);
+    double fitness = (*simulation->simulationFactory)(simulation->parameters);
+
+    // fitness is the negative run time, hence the scaled fitness
+    // is the lower bound for acceptable fitness values:
+    double expected = entry.fitness * steps / entry.steps;
+    LOG(Logger::DBG, "validation of " << simulatorName << ", fitness: " << fitness << " expected: " << expected);
+    return fitness >= (expected * (1.0 + cacheTolerance));
+}
+
+template<typename CELL_TYPE,typename OPTIMIZER_TYPE>
+void AutoTuningSimulator<CELL_TYPE, OPTIMIZER_TYPE>::storeInCache(unsigned steps)
+{
+    if (!cache) {
+        return;
+    }
+
+    std::string key = cacheKey();
+    typedef typename std::map<const std::string, SimulationPtr>::iterator IterType;
+
+    for (IterType iter = simulations.begin(); iter != simulations.end(); iter++) {
+        cache->put(
+            key,
+            iter->first,
+            AutoTuningCache::Entry(iter->second->parameters, iter->second->fitness, steps));
+    }
+
+    cache->flush();
+}
+
 }
 
 #endif
@@ -5,17 +5,140 @@
 #ifdef LIBGEODECOMP_WITH_THREADS
 
 #include <omp.h>
+#include <algorithm>
 #include <libgeodecomp/io/logger.h>
 #include <libgeodecomp/parallelization/monolithicsimulator.h>
-#include <libgeodecomp/storage/displacedgrid.h>
+#include <libgeodecomp/storage/coordmap.h>
+#include <libgeodecomp/storage/grid.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
 namespace LibGeoDecomp {
 
+namespace CacheBlockingSimulatorHelpers {
+
+/**
+ * Holds a limited number of layers (along the outermost axis) of a
+ * grid. Layer z is mapped to slot z % height, so a wavefront can
+ * advance layer by layer without ever moving any data. The bounding
+ * box spans all layers the wavefront may visit, which keeps the
+ * UpdateFunctor from mistaking the buffer's first or last slot for
+ * the boundary of the simulation space.
+ */
+template<typename CELL, int DIMENSIONS>
+class RingBuffer
+{
+public:
+    const static int DIM = DIMENSIONS;
+
+    typedef CELL Cell;
+    typedef typename Topologies::Cube<DIM>::Topology Topology;
+    typedef Grid<CELL, Topology> Delegate;
+    typedef CoordMap<CELL, RingBuffer> CoordMapType;
+
+    explicit RingBuffer(
+        const Coord<DIM>& dimensions = Coord<DIM>(),
+        const CELL& edgeCell = CELL()) :
+        delegate(dimensions, edgeCell, edgeCell),
+        box(Coord<DIM>(), dimensions)
+    {}
+
+    /**
+     * Moves the buffer so that its lateral extent covers the given
+     * box. The box's extent along the outermost axis may exceed the
+     * buffer's number of layers.
+     */
+    inline void setBoundingBox(const CoordBox<DIM>& newBox)
+    {
+        box = newBox;
+    }
+
+    inline const CoordBox<DIM>& boundingBox() const
+    {
+        return box;
+    }
+
+    inline CELL& operator[](const Coord<DIM>& absoluteCoord)
+    {
+        Coord<DIM> relativeCoord = absoluteCoord - box.origin;
+        relativeCoord[DIM - 1] = slot(absoluteCoord[DIM - 1]);
+        return delegate[relativeCoord];
+    }
+
+    inline const CELL& operator[](const Coord<DIM>& absoluteCoord) const
+    {
+        return (const_cast<RingBuffer&>(*this))[absoluteCoord];
+    }
+
+    inline CoordMapType getNeighborhood(const Coord<DIM>& center) const
+    {
+        return CoordMapType(center, this);
+    }
+
+    inline const CELL& getEdgeCell() const
+    {
+        return delegate.getEdgeCell();
+    }
+
+    inline void setEdge(const CELL& cell)
+    {
+        delegate.setEdge(cell);
+    }
+
+    inline void fill(const CELL& cell)
+    {
+        delegate.fill(delegate.boundingBox(), cell);
+    }
+
+    /**
+     * Overwrites all cells whose outermost coordinate equals z.
+     */
+    inline void fillLayer(int z, const CELL& cell)
+    {
+        Coord<DIM> origin;
+        origin[DIM - 1] = slot(z);
+        Coord<DIM> dimensions = delegate.getDimensions();
+        dimensions[DIM - 1] = 1;
+
+        delegate.fill(CoordBox<DIM>(origin, dimensions), cell);
+    }
+
+private:
+    Delegate delegate;
+    CoordBox<DIM> box;
+
+    inline int slot(int z) const
+    {
+        int height = delegate.getDimensions()[DIM - 1];
+        int relative = (z - box.origin[DIM - 1]) % height;
+        return (relative < 0) ? (relative + height) : relative;
+    }
+};
+
+}
+
 /**
- * CacheBlockingSimulator is an experimental simulator to explore the
- * infrastructure required to implement a pipelined wavefront update
- * algorith and which benefits is may provide.
+ * CacheBlockingSimulator implements a pipelined wavefront update:
+ * the simulation space is cut into columns along the outermost axis,
+ * whose lateral extent is given by wavefrontDim. Each column is
+ * swept layer by layer, advancing up to pipelineLength nano steps at
+ * once. Intermediate time levels are kept in per-thread ring
+ * buffers, each holding 2 * RADIUS + 1 layers, so the working set
+ * of a column is roughly
+ *
+ *   pipelineLength * (wavefrontDim + 2 * RADIUS * pipelineLength) * (2 * RADIUS + 1)
+ *
+ * cells, which should fit into the cache (see
+ * CacheBlockingSimulationFactory for suitable parameter ranges).
+ * Neighboring columns don't exchange intermediate results, instead
+ * each column recomputes the halo it needs (overlapped tiling),
+ * which renders columns independent so they can be processed by
+ * multiple threads concurrently.
+ *
+ * Writers and Steerers only see the grid at pipeline flushes, so
+ * the simulator shortens the pipeline whenever the next IO event
+ * would otherwise fall into the middle of a pipeline pass. Models
+ * with periodic boundary conditions are supported, as are 2D and 3D
+ * models with the AoS memory layout.
  */
 template<typename CELL>
 class CacheBlockingSimulator : public MonolithicSimulator<CELL>
@@ -24,11 +147,13 @@ public:
     friend class CacheBlockingSimulatorTest;
 
     typedef typename APITraits::SelectTopology<CELL>::Value Topology;
-    typedef typename TopologiesHelpers::Topology<3, Topology::template WrapsAxis<0>::VALUE, Topology::template WrapsAxis<1>::VALUE, true> BufferTopology;
+    typedef typename MonolithicSimulator<CELL>::GridType GridBaseType;
     typedef Grid<CELL, Topology> GridType;
-    typedef DisplacedGrid<CELL, BufferTopology> BufferType;
-    typedef std::vector<std::vector<Region<3> > > WavefrontFrames;
+    typedef typename Steerer<CELL>::SteererFeedback SteererFeedback;
     static const int DIM = Topology::DIM;
+    static const int RADIUS = APITraits::SelectStencil<CELL>::Value::RADIUS;
+    typedef CacheBlockingSimulatorHelpers::RingBuffer<CELL, DIM> BufferType;
+    typedef std::vector<BufferType> BufferVec;
 
     using MonolithicSimulator<CELL>::NANO_STEPS;
     using MonolithicSimulator<CELL>::chronometer;
@@ -38,30 +163,48 @@ public:
         int pipelineLength,
         const Coord<DIM - 1>& wavefrontDim) :
         MonolithicSimulator<CELL>(initializer),
-        buffers(omp_get_max_threads()),
         pipelineLength(pipelineLength),
-        wavefrontDim(wavefrontDim)
+        wavefrontDim(wavefrontDim),
+        nanoStep(0)
     {
+        if (pipelineLength < 1) {
+            throw std::invalid_argument("CacheBlockingSimulator needs a pipelineLength of at least 1");
+        }
+        for (int d = 0; d < (DIM - 1); ++d) {
+            if (wavefrontDim[d] < 1) {
+                throw std::invalid_argument("CacheBlockingSimulator needs a wavefrontDim of at least 1");
+            }
+        }
+
+        stepNum = initializer->startStep();
         Coord<DIM> dim = initializer->gridBox().dimensions;
         curGrid = new GridType(dim);
         newGrid = new GridType(dim);
         initializer->grid(curGrid);
         initializer->grid(newGrid);
+        simArea << curGrid->boundingBox();
+
+        // periodic boundaries are handled by reading halo cells from
+        // the opposite side of the grid, but only once:
+        maxHop = pipelineLength;
+        for (int d = 0; d < DIM; ++d) {
+            if (Topology::wrapsAxis(d)) {
+                maxHop = (std::min)(maxHop, (std::max)(dim[d] / radius(), 1));
+            }
+        }
 
         Coord<DIM> bufferDim;
-
-        for (int i = 0; i < DIM - 1; ++i) {
-            bufferDim[i] = wavefrontDim[i] + 2 * pipelineLength - 2;
+        for (int d = 0; d < (DIM - 1); ++d) {
+            bufferDim[d] = wavefrontDim[d] + 2 * radius() * maxHop;
         }
-        bufferDim[DIM - 1] = pipelineLength * 4 - 4;
+        bufferDim[DIM - 1] = 2 * radius() + 1;
 
-        for (std::size_t i = 0; i < buffers.size(); ++i) {
-            buffers[i] = BufferType(CoordBox<DIM>(Coord<DIM>(), bufferDim), curGrid->getEdgeCell(), curGrid->getEdgeCell());
-        }
-        LOG(DBG, "created " << buffers.size() << " buffers");
+        buffers = std::vector<BufferVec>(
+            omp_get_max_threads(),
+            BufferVec(maxHop - 1, BufferType(bufferDim, curGrid->getEdgeCell())));
+        LOG(DBG, "CacheBlockingSimulator created " << buffers.size() << " buffer sets");
 
-        generateFrames();
-        nanoStep = 0;
+        generateColumns();
     }
 
     virtual ~CacheBlockingSimulator()
@@ -70,38 +213,53 @@ public:
         delete curGrid;
     }
 
+    /**
+     * performs a single simulation step.
+     */
     virtual void step()
     {
-        // fixme
+        SteererFeedback feedback;
+        step(&feedback);
     }
 
+    virtual void step(SteererFeedback *feedback)
+    {
+        TimeTotal t(&chronometer);
+
+        handleInput(STEERER_NEXT_STEP, feedback);
+        update(NANO_STEPS);
+        handleOutput(WRITER_STEP_FINISHED);
+    }
+
+    /**
+     * continue simulating until the maximum number of steps is
+     * reached. Unlike step(), this will pipeline across time step
+     * boundaries if no IO is due in between.
+     */
     virtual void run()
     {
         initializer->grid(curGrid);
         stepNum = initializer->startStep();
         nanoStep = 0;
+        setIORegions();
 
-        for(unsigned i = 0; i < writers.size(); ++i) {
-            writers[i]->stepFinished(
-                *getGrid(),
-                getStep(),
-                WRITER_INITIALIZED);
-        }
+        SteererFeedback feedback;
+        handleInput(STEERER_INITIALIZED, &feedback);
+        handleOutput(WRITER_INITIALIZED);
 
-        for (stepNum = initializer->startStep();
-             stepNum < initializer->maxSteps();) {
-            hop();
-        }
+        while ((stepNum < initializer->maxSteps()) && !feedback.simulationEnded()) {
+            TimeTotal t(&chronometer);
 
-        for(unsigned i = 0; i < writers.size(); ++i) {
-            writers[i]->stepFinished(
-                *getGrid(),
-                getStep(),
-                WRITER_ALL_DONE);
+            handleInput(STEERER_NEXT_STEP, &feedback);
+            update(stepsToNextEvent() * NANO_STEPS);
+            handleOutput(WRITER_STEP_FINISHED);
         }
+
+        handleInput(STEERER_ALL_DONE, &feedback);
+        handleOutput(WRITER_ALL_DONE);
     }
 
-    virtual const GridType *getGrid()
+    virtual const GridBaseType *getGrid()
     {
         return curGrid;
     }
@@ -112,225 +270,300 @@ private:
     using MonolithicSimulator<CELL>::stepNum;
     using MonolithicSimulator<CELL>::writers;
     using MonolithicSimulator<CELL>::getStep;
+    using MonolithicSimulator<CELL>::gridDim;
 
     GridType *curGrid;
     GridType *newGrid;
-    std::vector<BufferType> buffers;
+    Region<DIM> simArea;
+    std::vector<BufferVec> buffers;
     int pipelineLength;
+    int maxHop;
     Coord<DIM - 1> wavefrontDim;
-    Grid<WavefrontFrames> frames;
+    std::vector<CoordBox<DIM> > columns;
     unsigned nanoStep;
 
-    void generateFrames()
+    static int radius()
     {
-        Coord<DIM> gridDim = initializer->gridBox().dimensions;
+        return (std::max)(RADIUS, 1);
+    }
 
-        Coord<DIM - 1> framesDim;
-        for (int i = 0; i < (DIM - 1); ++i) {
-            framesDim[i] = gridDim[i] / wavefrontDim[i];
-            if ((gridDim[i] % wavefrontDim[i]) != 0) {
-                framesDim[i] += 1;
+    /**
+     * Returns the number of time steps until a Writer or Steerer
+     * needs to see the grid, or the simulation ends.
+     */
+    unsigned stepsToNextEvent() const
+    {
+        unsigned maxSteps = initializer->maxSteps();
+        for (unsigned step = stepNum + 1; step < maxSteps; ++step) {
+            for (std::size_t i = 0; i < writers.size(); ++i) {
+                if ((step % writers[i]->getPeriod()) == 0) {
+                    return step - stepNum;
+                }
+            }
+            for (std::size_t i = 0; i < steerers.size(); ++i) {
+                if ((step % steerers[i]->getPeriod()) == 0) {
+                    return step - stepNum;
+                }
             }
         }
-        frames.resize(framesDim);
 
-        for (int y = 0; y < framesDim.y(); ++y) {
-            for (int x = 0; x < framesDim.x(); ++x) {
-                frames[Coord<2>(x, y)] = generateWavefrontFrames(
-                    Coord<3>(x * wavefrontDim.x(),
-                             y * wavefrontDim.y(),
-                             0));
+        return (std::max)(maxSteps, stepNum + 1) - stepNum;
+    }
 
-            }
+    void update(std::size_t nanoSteps)
+    {
+        while (nanoSteps > 0) {
+            std::size_t hopLength = (std::min)(nanoSteps, std::size_t(maxHop));
+            hop(hopLength);
+            nanoSteps -= hopLength;
         }
     }
 
-    WavefrontFrames generateWavefrontFrames(const Coord<DIM> offset)
+    void generateColumns()
     {
-        Coord<DIM> gridDim = initializer->gridBox().dimensions;
-        Coord<DIM> wavefrontRegionDim;
-        for (int i = 0; i < (DIM - 1); ++i) {
-            wavefrontRegionDim[i] = wavefrontDim[i];
-        }
-        wavefrontRegionDim[DIM - 1] = gridDim[DIM - 1] - offset[DIM - 1];
-        Region<DIM> region;
-        region << CoordBox<DIM>(offset, wavefrontRegionDim);
-        std::vector<Region<3> > regions(pipelineLength);
-        regions[pipelineLength - 1] = region.expandWithTopology(
-            0, gridDim, Topologies::Cube<3>::Topology());
-
-        for (int i = pipelineLength - 2; i >= 0; --i) {
-            regions[i] = regions[i + 1].expandWithTopology(
-                1, gridDim, Topologies::Cube<3>::Topology());
+        Coord<DIM> gridDim = curGrid->getDimensions();
+        Coord<DIM> columnDim = gridDim;
+        for (int d = 0; d < (DIM - 1); ++d) {
+            columnDim[d] = wavefrontDim[d];
         }
 
-        int wavefrontLength = gridDim[DIM - 1] + 1;
-        WavefrontFrames ret(wavefrontLength, std::vector<Region<DIM> >(pipelineLength));
-
-        for (int index = 0; index < wavefrontLength; ++index) {
-            Coord<DIM> maskOrigin;
-            maskOrigin[DIM - 1] = index;
-            Topology::normalize(maskOrigin, initializer->gridDimensions());
-            Coord<DIM> maskDim = gridDim;
-            maskDim[DIM - 1] = 1;
+        Coord<DIM> columnsDim = Coord<DIM>::diagonal(1);
+        for (int d = 0; d < (DIM - 1); ++d) {
+            columnsDim[d] = (gridDim[d] - 1) / columnDim[d] + 1;
+        }
 
-            Region<DIM> mask;
-            mask << CoordBox<DIM>(maskOrigin, maskDim);
-            for (int i = 0; i < pipelineLength; ++i) {
-                ret[index][i] = regions[i] & mask;
+        CoordBox<DIM> columnIndices(Coord<DIM>(), columnsDim);
+        for (typename CoordBox<DIM>::Iterator i = columnIndices.begin(); i != columnIndices.end(); ++i) {
+            Coord<DIM> origin;
+            Coord<DIM> dim = columnDim;
+            for (int d = 0; d < (DIM - 1); ++d) {
+                origin[d] = (*i)[d] * columnDim[d];
+                dim[d] = (std::min)(columnDim[d], gridDim[d] - origin[d]);
             }
-        }
 
-        return ret;
+            columns << CoordBox<DIM>(origin, dim);
+        }
     }
 
-    void hop()
+    void hop(std::size_t hopLength)
     {
         using std::swap;
-        TimeTotal t(&chronometer);
+        TimeCompute t(&chronometer);
 
-        CoordBox<DIM - 1> frameBox = frames.boundingBox();
-        // for (typename CoordBox<DIM -1>::Iterator waveIter = frameBox.begin();
-        //      waveIter != frameBox.end();
-        //      ++waveIter) {
-        //     updateWavefront(*waveIter);
-        // }
-
-#pragma omp parallel for
-        for (int y = 0; y < frameBox.dimensions.y(); ++y) {
-            for (int x = 0; x < frameBox.dimensions.x(); ++x) {
-                updateWavefront(&buffers[omp_get_thread_num()], Coord<2>(x, y));
-            }
+#pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < int(columns.size()); ++i) {
+            updateColumn(&buffers[omp_get_thread_num()], columns[i], hopLength);
         }
 
         swap(curGrid, newGrid);
-        int curNanoStep = nanoStep + pipelineLength;
-        stepNum += curNanoStep / NANO_STEPS;
-        nanoStep = curNanoStep % NANO_STEPS;
+        nanoStep += hopLength;
+        stepNum += nanoStep / NANO_STEPS;
+        nanoStep %= NANO_STEPS;
     }
 
-    void updateWavefront(BufferType *buffer, const Coord<DIM - 1>& wavefrontCoord)
+    /**
+     * Advances the given column by hopLength nano steps. Level 1 is
+     * computed straight from curGrid, levels 2 to hopLength - 1 read
+     * from and write to the buffers, the last level is written to
+     * newGrid. Level L needs to cover the column plus a halo of
+     * RADIUS * (hopLength - L) cells. Level L runs RADIUS layers
+     * behind level L - 1, which is just enough so that the layers it
+     * depends on are still present in the ring buffer.
+     */
+    void updateColumn(BufferVec *buffers, const CoordBox<DIM>& column, std::size_t hopLength)
     {
-        LOG(INFO, "wavefrontCoord(" << wavefrontCoord << ")");
-        buffer->setEdge(curGrid->getEdge());
-        buffer->fill(buffer->boundingBox(), curGrid->getEdgeCell());
-        fixBufferOrigin(buffer, wavefrontCoord);
-
-        int index = 0;
-        CoordBox<DIM> boundingBox = curGrid->boundingBox();
-        int maxIndex = boundingBox.origin[DIM - 1] + boundingBox.dimensions[DIM - 1];
-
-        // fill pipeline
-        for (; index < 2 * pipelineLength - 2; ++index) {
-            int lastStage = (index >> 1) + 1;
-            pipelinedUpdate(buffer, wavefrontCoord, index, index, 0, lastStage);
-        }
+        int levelCount = hopLength;
+        int height = column.dimensions[DIM - 1];
+        int maxHalo = radius() * (levelCount - 1);
 
-        // normal operation
-        for (; index < maxIndex; ++index) {
-            pipelinedUpdate(buffer, wavefrontCoord, index, index, 0, pipelineLength);
+        CoordBox<DIM> bufferBox = column;
+        for (int d = 0; d < (DIM - 1); ++d) {
+            bufferBox.origin[d]     -= radius() * maxHop;
+            bufferBox.dimensions[d] += radius() * maxHop * 2;
+        }
+        bufferBox.origin[DIM - 1]     = -maxHalo - radius();
+        bufferBox.dimensions[DIM - 1] = height + 2 * (maxHalo + radius());
+
+        for (int level = 1; level < levelCount; ++level) {
+            BufferType& buffer = (*buffers)[level - 1];
+            buffer.setBoundingBox(bufferBox);
+            buffer.setEdge(curGrid->getEdgeCell());
+            buffer.fill(curGrid->getEdgeCell());
         }
 
-        // let pipeline drain
-        for (; index < (maxIndex + 2 * pipelineLength - 2); ++index) {
-            int firstStage = (index - maxIndex + 1) >> 1 ;
-            pipelinedUpdate(buffer, wavefrontCoord, index, index, firstStage, pipelineLength);
+        for (int pos = -maxHalo; pos < (height + maxHalo); ++pos) {
+            for (int level = 1; level <= levelCount; ++level) {
+                int z = pos - (level - 1) * radius();
+                int halo = radius() * (levelCount - level);
+                if ((z < -halo) || (z >= (height + halo))) {
+                    continue;
+                }
+
+                CoordBox<DIM> layer = layerBox(column, z, halo);
+                unsigned curNanoStep = (nanoStep + level - 1) % NANO_STEPS;
+
+                if (level == levelCount) {
+                    if (level == 1) {
+                        updateLayer(layer, *curGrid, newGrid, curNanoStep);
+                    } else {
+                        updateLayer(layer, (*buffers)[level - 2], newGrid, curNanoStep);
+                    }
+                    continue;
+                }
+
+                BufferType *target = &(*buffers)[level - 1];
+
+                if (!Topology::wrapsAxis(DIM - 1) && ((z < 0) || (z >= height))) {
+                    target->fillLayer(z, curGrid->getEdgeCell());
+                    continue;
+                }
+
+                if (level == 1) {
+                    updateLayerFromGrid(layer, target, curNanoStep);
+                } else {
+                    updateLayer(layer, (*buffers)[level - 2], target, curNanoStep);
+                }
+            }
         }
     }
 
-    void fixBufferOrigin(BufferType *buffer, const Coord<DIM - 1>& frameCoord)
+    /**
+     * Returns layer z of the column, widened by halo cells on all
+     * lateral sides. The result is clipped to the grid along axes
+     * without periodic boundary conditions.
+     */
+    CoordBox<DIM> layerBox(const CoordBox<DIM>& column, int z, int halo) const
     {
-        Coord<DIM> bufferOrigin;
-        // fixme: wrong on boundary with Torus topology
+        Coord<DIM> gridDim = curGrid->getDimensions();
+        CoordBox<DIM> ret = column;
+        ret.origin[DIM - 1] = z;
+        ret.dimensions[DIM - 1] = 1;
+
         for (int d = 0; d < (DIM - 1); ++d) {
-            bufferOrigin[d] = std::max(0, frameCoord[d] * wavefrontDim[d] - pipelineLength + 1);
+            int begin = column.origin[d] - halo;
+            int end = column.origin[d] + column.dimensions[d] + halo;
+            if (!Topology::wrapsAxis(d)) {
+                begin = (std::max)(begin, 0);
+                end = (std::min)(end, gridDim[d]);
+            }
+
+            ret.origin[d] = begin;
+            ret.dimensions[d] = end - begin;
         }
-        bufferOrigin[DIM - 1] = 0;
-        buffer->setOrigin(bufferOrigin);
+
+        return ret;
     }
 
-    void pipelinedUpdate(
-        BufferType *buffer,
-        const Coord<DIM - 1>& frameCoord,
-        int globalIndex,
-        int localIndex,
-        int firstStage,
-        int lastStage)
+    /**
+     * Updates a layer of the first level of the pipeline. The layer's
+     * halo may extend beyond the grid along axes with periodic
+     * boundaries, so we cut it into pieces which map to the grid in a
+     * single piece each. This way curGrid can be read directly and no
+     * copy of the original time level is required.
+     */
+    void updateLayerFromGrid(const CoordBox<DIM>& layer, BufferType *target, unsigned curNanoStep) const
     {
-        LOG(DBG, "  pipelinedUpdate(frameCoord = " << frameCoord << ", globalIndex = " << globalIndex << ", localIndex = " << localIndex << ", firstStage = " << firstStage << ", lastStage = " << lastStage << ")");
-
-        for (int i = firstStage; i < lastStage; ++i) {
-            bool firstIteration = (i == 0);
-            bool lastIteration =  (i == (pipelineLength - 1));
-            int currentGlobalIndex = globalIndex - 2 * i;
-            bool needsFlushing = (i == firstStage) &&
-                (currentGlobalIndex >= newGrid->getDimensions()[DIM - 1]);
-            int sourceIndex = firstIteration ? currentGlobalIndex : normalizeIndex(localIndex + 2 - 4 * i);
-            int targetIndex = lastIteration  ? currentGlobalIndex : normalizeIndex(localIndex + 0 - 4 * i);
-
-            const Region<DIM>& updateFrame = frames[frameCoord][globalIndex - 2 * i][i];
-            unsigned curNanoStep = (nanoStep + i) % NANO_STEPS;
-
-            if ( firstIteration &&  lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *curGrid, newGrid, curNanoStep);
+        using std::swap;
+        Coord<DIM> gridDim = curGrid->getDimensions();
+        std::vector<CoordBox<DIM> > pieces(1, layer);
+
+        for (int d = 0; d < DIM; ++d) {
+            if (!Topology::wrapsAxis(d)) {
+                continue;
             }
 
-            if ( firstIteration && !lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *curGrid, buffer,  curNanoStep);
+            std::vector<CoordBox<DIM> > newPieces;
+            for (typename std::vector<CoordBox<DIM> >::iterator i = pieces.begin(); i != pieces.end(); ++i) {
+                int begin = i->origin[d];
+                int end = begin + i->dimensions[d];
+
+                while (begin < end) {
+                    int period = begin - normalize(begin, gridDim[d]);
+                    int cut = (std::min)(end, period + gridDim[d]);
+
+                    CoordBox<DIM> piece = *i;
+                    piece.origin[d] = begin;
+                    piece.dimensions[d] = cut - begin;
+                    newPieces << piece;
+
+                    begin = cut;
+                }
             }
+            swap(pieces, newPieces);
+        }
 
-            if (!firstIteration &&  lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *buffer,  newGrid, curNanoStep);
+        for (typename std::vector<CoordBox<DIM> >::iterator i = pieces.begin(); i != pieces.end(); ++i) {
+            Coord<DIM> offset;
+            for (int d = 0; d < DIM; ++d) {
+                offset[d] = i->origin[d] - normalize(i->origin[d], gridDim[d]);
             }
 
-            if (!firstIteration && !lastIteration) {
-                frameUpdate(needsFlushing, updateFrame, sourceIndex, targetIndex, *buffer,  buffer,  curNanoStep);
+            Region<DIM> region;
+            region << CoordBox<DIM>(i->origin - offset, i->dimensions);
+            UpdateFunctor<CELL>()(region, Coord<DIM>(), offset, *curGrid, target, curNanoStep);
+        }
+    }
+
+    static int normalize(int coord, int dim)
+    {
+        int ret = coord % dim;
+        return (ret < 0) ? (ret + dim) : ret;
+    }
+
+    template<typename SOURCE_GRID, typename TARGET_GRID>
+    void updateLayer(const CoordBox<DIM>& layer, const SOURCE_GRID& source, TARGET_GRID *target, unsigned curNanoStep) const
+    {
+        Region<DIM> region;
+        region << layer;
+        UpdateFunctor<CELL>()(region, Coord<DIM>(), Coord<DIM>(), source, target, curNanoStep);
+    }
+
+    /**
+     * notifies all registered Writers
+     */
+    void handleOutput(WriterEvent event)
+    {
+        TimeOutput t(&chronometer);
+
+        for (unsigned i = 0; i < writers.size(); i++) {
+            if ((event != WRITER_STEP_FINISHED) ||
+                ((getStep() % writers[i]->getPeriod()) == 0)) {
+                writers[i]->stepFinished(
+                    *curGrid,
+                    getStep(),
+                    event);
             }
         }
     }
 
-    template<class GRID1, class GRID2>
-    void frameUpdate(
-        bool needsFlushing,
-        const Region<DIM>& updateFrame,
-        int sourceIndex,
-        int targetIndex,
-        const GRID1& sourceGrid,
-        GRID2 *targetGrid,
-        unsigned curNanoStep)
+    /**
+     * notifies all registered Steerers
+     */
+    void handleInput(SteererEvent event, SteererFeedback *feedback)
     {
-        LOG(DBG, "    frameUpdate("
-            << needsFlushing << ", "
-            << updateFrame.boundingBox() << ", "
-            << sourceIndex << ", "
-            << targetIndex <<  ")");
-
-        if (needsFlushing) {
-            // fixme: only works with cube topologies
-            Coord<DIM> fillOrigin = buffers[omp_get_thread_num()].getOrigin();
-            fillOrigin[DIM - 1] = targetIndex;
-            Coord<DIM> fillDim = buffers[omp_get_thread_num()].getDimensions();
-            fillDim[DIM - 1] = 1;
-
-            buffers[omp_get_thread_num()].fill(
-                CoordBox<DIM>(fillOrigin, fillDim),
-                buffers[omp_get_thread_num()].getEdgeCell());
-        } else {
-            Coord<DIM> sourceOffset;
-            Coord<DIM> targetOffset;
-            sourceOffset[DIM - 1] = sourceIndex;
-            targetOffset[DIM - 1] = targetIndex;
-
-            UpdateFunctor<CELL>()(updateFrame, sourceOffset, targetOffset, sourceGrid, targetGrid, curNanoStep);
+        TimeInput t(&chronometer);
+
+        for (unsigned i = 0; i < steerers.size(); ++i) {
+            if ((event != STEERER_NEXT_STEP) ||
+                (stepNum % steerers[i]->getPeriod() == 0)) {
+                steerers[i]->nextStep(
+                    curGrid,
+                    simArea,
+                    gridDim,
+                    getStep(),
+                    event,
+                    0,
+                    true,
+                    feedback);
+            }
         }
-     }
+    }
 
-    // wraps the index (for 3D this will be the Z coordinate) around
-    // the buffer's dimension
-    int normalizeIndex(int localIndex)
+    void setIORegions()
     {
-        int bufferSize = buffers[0].getDimensions()[DIM - 1];
-        return (localIndex + bufferSize) % bufferSize;
+        for (unsigned i = 0; i < steerers.size(); i++) {
+            steerers[i]->setRegion(simArea);
+        }
     }
 };
 
@@ -17,6 +17,7 @@
 #include <cmath>
 #include <stdexcept>
 #include <boost/make_shared.hpp>
+#include <boost/type_traits/is_base_of.hpp>
 
 namespace LibGeoDecomp {
 
@@ -66,9 +67,59 @@ public:
         ParentType(initializer, loadBalancingPeriod * NANO_STEPS),
         balancer(balancer),
         ghostZoneWidth(ghostZoneWidth),
-        mpiLayer(communicator)
+        mpiLayer(communicator),
+        repartitioningThreshold(0),
+        lastRepartitioning(0)
     {}
 
+    /**
+     * Sets the number of buffers per ghost zone link (see
+     * MPIUpdateGroupOptions). Like the following options, this
+     * needs to be set before the simulation is started.
+     */
+    inline void setPatchLinkDepth(unsigned depth)
+    {
+        checkNotStarted();
+        updateGroupOptions.patchLinkDepth = depth;
+    }
+
+    /**
+     * Lets the ghost zones be sent directly from the grid, skipping
+     * one copy per transmission. Sends then need to complete before
+     * the Stepper may continue with the next update.
+     */
+    inline void enableZeroCopyPatchLinks(bool enable = true)
+    {
+        checkNotStarted();
+        updateGroupOptions.zeroCopyPatchLinks = enable;
+    }
+
+    /**
+     * Lets ranks determine their neighbors via a pairwise exchange
+     * of regions instead of expanding the regions of all potential
+     * neighbors locally, which pays off for large numbers of ranks.
+     */
+    inline void enableSparseNeighborDiscovery(bool enable = true)
+    {
+        checkNotStarted();
+        updateGroupOptions.sparseNeighborDiscovery = enable;
+    }
+
+    /**
+     * Load balancing will only migrate cells if at least one of the
+     * boundaries between the ranks' subdomains moves by more than
+     * threshold times the average number of cells per rank (e.g.
+     * 0.05 for 5%). With the default of 0 any change of the
+     * partition triggers a repartitioning.
+     */
+    inline void setRepartitioningThreshold(double threshold)
+    {
+        if (threshold < 0) {
+            throw std::invalid_argument("repartitioning threshold must not be negative");
+        }
+        repartitioningThreshold = threshold;
+    }
+
     inline void run()
     {
         initSimulation();
@@ -152,8 +203,13 @@ private:
 
     boost::shared_ptr<LoadBalancer> balancer;
     unsigned ghostZoneWidth;
+    MPIUpdateGroupOptions updateGroupOptions;
     MPILayer mpiLayer;
     boost::shared_ptr<UpdateGroupType> updateGroup;
+    Chronometer lastStatistics;
+    boost::shared_ptr<PARTITION> pendingPartition;
+    double repartitioningThreshold;
+    long lastRepartitioning;
 
     typename UpdateGroupType::PatchProviderVec steererAdaptersGhost;
     typename UpdateGroupType::PatchProviderVec steererAdaptersInner;
@@ -165,8 +221,16 @@ private:
         long remainingNanoSteps = s;
         while (remainingNanoSteps > 0) {
             long hop = std::min(remainingNanoSteps, timeToNextEvent());
+            if (pendingPartition) {
+                hop = std::min(hop, timeToRepartitioning());
+            }
+
             updateGroup->update(hop);
             handleEvents();
+            if (pendingPartition && (timeToRepartitioning() == 0)) {
+                repartition();
+            }
+
             remainingNanoSteps -= hop;
         }
     }
@@ -188,6 +252,7 @@ private:
         }
 
         CoordBox<DIM> box = initializer->gridBox();
+        lastRepartitioning = initializer->startStep() * NANO_STEPS;
 
         double mySpeed = APITraits::SelectSpeedGuide<CELL_TYPE>::value();
         std::vector<double> rankSpeeds = mpiLayer.allGather(mySpeed);
@@ -195,17 +260,9 @@ private:
             box.dimensions.prod(),
             rankSpeeds);
 
-        boost::shared_ptr<PARTITION> partition(
-            new PARTITION(
-                box.origin,
-                box.dimensions,
-                0,
-                weights,
-                initializer->getAdjacency()));
-
         updateGroup.reset(
             new UpdateGroupType(
-                partition,
+                createPartition(weights),
                 box,
                 ghostZoneWidth,
                 initializer,
@@ -214,7 +271,8 @@ private:
                 writerAdaptersInner,
                 steererAdaptersGhost,
                 steererAdaptersInner,
-                mpiLayer.communicator()));
+                mpiLayer.communicator(),
+                updateGroupOptions));
 
         writerAdaptersGhost.clear();
         writerAdaptersInner.clear();
@@ -224,25 +282,168 @@ private:
         initEvents();
     }
 
+    inline void checkNotStarted() const
+    {
+        if (updateGroup) {
+            throw std::logic_error("options of the UpdateGroup can't be changed once the simulation has started");
+        }
+    }
+
     inline long currentNanoStep() const
     {
         std::pair<int, int> now = updateGroup->currentStep();
         return (long)now.first * NANO_STEPS + now.second;
     }
 
+    /**
+     * Each rank reports the fraction of the wall clock time which it
+     * spent computing since the last load balancing. The new weights
+     * computed by the LoadBalancer on the root are then broadcast and
+     * will be applied at the next step at which the ghost zones are
+     * being synchronized.
+     *
+     * For models with APITraits::HasCostSampling the ranks' streak
+     * timings are summed up, too. Space-filling curves will then cut
+     * the new partition by cost. Each rank derives the same new
+     * partition from the same weights and costs, so all ranks agree
+     * on whether it's different enough from the current one to be
+     * worth the migration (see setRepartitioningThreshold()).
+     */
     inline void balanceLoad()
     {
-        if (mpiLayer.rank() == 0) {
-            if (!balancer) {
-                return;
+        Chronometer stats = updateGroup->statistics();
+        double computeTime =
+            stats.interval<TimeComputeInner>() - lastStatistics.interval<TimeComputeInner>() +
+            stats.interval<TimeComputeGhost>() - lastStatistics.interval<TimeComputeGhost>();
+        double totalTime = stats.interval<TimeTotal>() - lastStatistics.interval<TimeTotal>();
+        double relativeLoad = (totalTime > 0) ? (computeTime / totalTime) : 1.0;
+        lastStatistics = stats;
+
+        LoadBalancer::LoadVec loads = mpiLayer.gather(relativeLoad, 0);
+        LoadBalancer::WeightVec newWeights;
+        CostMap<DIM> costs = gatherCosts(typename APITraits::SelectCostSampling<CELL_TYPE>::Value());
+
+        if ((mpiLayer.rank() == 0) && balancer) {
+            newWeights = balancer->balance(updateGroup->getWeights(), loads);
+            if ((newWeights == updateGroup->getWeights()) && costs.empty()) {
+                newWeights.clear();
+            }
+        }
+
+        newWeights = mpiLayer.broadcastVector(newWeights, 0);
+        pendingPartition.reset();
+        if (newWeights.empty()) {
+            return;
+        }
+
+        boost::shared_ptr<PARTITION> partition = createPartition(newWeights);
+        applyCosts(&*partition, costs);
+        if (exceedsRepartitioningThreshold(partition->getStartOffsets(), updateGroup->getStartOffsets())) {
+            pendingPartition = partition;
+        }
+    }
+
+    /**
+     * Checks whether any boundary between two ranks' subdomains
+     * would move by more than the repartitioning threshold.
+     */
+    inline bool exceedsRepartitioningThreshold(
+        const std::vector<std::size_t>& newOffsets,
+        const std::vector<std::size_t>& oldOffsets) const
+    {
+        if (newOffsets.size() != oldOffsets.size()) {
+            return true;
+        }
+
+        double cellsPerRank = double(oldOffsets.back() - oldOffsets.front()) / (oldOffsets.size() - 1);
+        double maxShift = repartitioningThreshold * cellsPerRank;
+
+        for (std::size_t i = 0; i < newOffsets.size(); ++i) {
+            double shift = std::abs(double(newOffsets[i]) - double(oldOffsets[i]));
+            if (shift > maxShift) {
+                return true;
             }
+        }
+
+        return false;
+    }
+
+    /**
+     * returns the number of nano steps until the Stepper reaches the
+     * next ghost zone synchronization which coincides with the
+     * beginning of a time step -- only then all cells of a subdomain
+     * are at the same time step and may be migrated.
+     */
+    inline long timeToRepartitioning() const
+    {
+        long period = ghostZoneWidth;
+        while (period % NANO_STEPS) {
+            period += ghostZoneWidth;
+        }
+
+        long elapsed = currentNanoStep() - lastRepartitioning;
+        return (period - elapsed % period) % period;
+    }
+
+    inline void repartition()
+    {
+        boost::shared_ptr<PARTITION> partition = pendingPartition;
+        pendingPartition.reset();
 
-            LoadBalancer::LoadVec loads(mpiLayer.size(), 1.0);
-            LoadBalancer::WeightVec newWeights =
-                balancer->balance(updateGroup->getWeights(), loads);
-            // fixme: actually balance the load!
+        if (currentNanoStep() >= long(initializer->maxSteps() * NANO_STEPS)) {
+            // no use in migrating cells after the last step
+            return;
         }
+
+        updateGroup->repartition(partition, static_cast<STEPPER*>(0));
+        lastRepartitioning = currentNanoStep();
     }
+
+    inline boost::shared_ptr<PARTITION> createPartition(const std::vector<std::size_t>& weights) const
+    {
+        CoordBox<DIM> box = initializer->gridBox();
+        return boost::shared_ptr<PARTITION>(
+            new PARTITION(
+                box.origin,
+                box.dimensions,
+                0,
+                weights,
+                initializer->getAdjacency()));
+    }
+
+    /**
+     * Sums up the CostMaps of all ranks so that each rank will
+     * compute the same partition. Only space-filling curves can
+     * make use of the costs.
+     */
+    inline CostMap<DIM> gatherCosts(APITraits::TrueType)
+    {
+        if (!boost::is_base_of<SpaceFillingCurve<DIM>, PARTITION>::value) {
+            return CostMap<DIM>();
+        }
+
+        const CostMap<DIM>& costs = updateGroup->costs();
+        return CostMap<DIM>(
+            costs.boundingBox(),
+            costs.getBlockDimensions(),
+            mpiLayer.allReduce(costs.seconds()),
+            mpiLayer.allReduce(costs.cells()));
+    }
+
+    inline CostMap<DIM> gatherCosts(APITraits::FalseType)
+    {
+        return CostMap<DIM>();
+    }
+
+    static inline void applyCosts(SpaceFillingCurve<DIM> *partition, const CostMap<DIM>& costs)
+    {
+        if (!costs.empty()) {
+            partition->setCosts(costs);
+        }
+    }
+
+    static inline void applyCosts(Partition<DIM> * /* partition */, const CostMap<DIM>& /* costs */)
+    {}
 };
 
 }
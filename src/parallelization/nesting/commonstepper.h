@@ -121,6 +121,15 @@ protected:
                     partitionManager->rank());
             }
         }
+
+        // all transmissions have been issued, now they may complete
+        // concurrently before we modify the grid again:
+        for (typename ParentType::PatchAccepterList::iterator i =
+                 patchAccepters[patchType].begin();
+             i != patchAccepters[patchType].end();
+             ++i) {
+            (*i)->release();
+        }
     }
 
     inline void notifyPatchProviders(
@@ -157,8 +166,12 @@ protected:
         CoordBox<DIM> gridBox;
         guessOffset(&gridBox.origin, &gridBox.dimensions);
 
-        oldGrid.reset(new GridType(gridBox, CELL_TYPE(), CELL_TYPE(), topoDim));
-        newGrid.reset(new GridType(gridBox, CELL_TYPE(), CELL_TYPE(), topoDim));
+        // derived classes may have allocated the grids already,
+        // e.g. to control their placement on NUMA nodes:
+        if (!oldGrid) {
+            oldGrid.reset(new GridType(gridBox, CELL_TYPE(), CELL_TYPE(), topoDim));
+            newGrid.reset(new GridType(gridBox, CELL_TYPE(), CELL_TYPE(), topoDim));
+        }
 
         initializer->grid(&*oldGrid);
         initializer->grid(&*newGrid);
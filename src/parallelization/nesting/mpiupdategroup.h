@@ -6,12 +6,49 @@
 
 #include <libgeodecomp/communication/mpilayer.h>
 #include <libgeodecomp/communication/patchlink.h>
+#include <libgeodecomp/parallelization/nesting/offsethelper.h>
+#include <libgeodecomp/parallelization/nesting/repartitioninitializer.h>
 #include <libgeodecomp/parallelization/nesting/updategroup.h>
 
 namespace LibGeoDecomp {
 
 class HiParSimulatorTest;
 
+/**
+ * Bundles the settings of the MPIUpdateGroup's ghost zone
+ * communication:
+ *
+ * patchLinkDepth is the number of buffers per ghost zone link. With
+ * more than one buffer, packing of and posting receives for the
+ * following ghost zone synchronizations may overlap with
+ * transmissions which are still in flight.
+ *
+ * If zeroCopyPatchLinks is set, the PatchLink::Accepters will send
+ * the ghost zones directly from the Stepper's grid instead of
+ * packing them into buffers first (see PatchLink). The Providers
+ * keep receiving into their buffers as they need to post their
+ * receives ahead of time.
+ *
+ * With sparseNeighborDiscovery the ghost zone fragments are computed
+ * by exchanging regions only with candidate neighbors (see
+ * MPIUpdateGroup::resetGhostZones()), which keeps the setup cost
+ * independent of the number of ranks. Otherwise each rank expands
+ * the regions of all potential neighbors itself.
+ */
+class MPIUpdateGroupOptions
+{
+public:
+    inline MPIUpdateGroupOptions() :
+        patchLinkDepth(2),
+        zeroCopyPatchLinks(false),
+        sparseNeighborDiscovery(false)
+    {}
+
+    std::size_t patchLinkDepth;
+    bool zeroCopyPatchLinks;
+    bool sparseNeighborDiscovery;
+};
+
 /**
  * This is an implementation of the UpdateGroup for MPI-based
  * hiearchical Simulators, e.g. the HiParSimulator.
@@ -21,6 +58,7 @@ class MPIUpdateGroup : public UpdateGroup<CELL_TYPE, PatchLink>
 {
 public:
     friend class LibGeoDecomp::HiParSimulatorTest;
+    friend class MPIUpdateGroupTest;
     friend class UpdateGroupPrototypeTest;
     friend class UpdateGroupTest;
 
@@ -28,10 +66,25 @@ public:
     typedef typename UpdateGroup<CELL_TYPE, PatchLink>::PatchProviderVec PatchProviderVec;
     typedef typename UpdateGroup<CELL_TYPE, PatchLink>::PatchLinkAccepter PatchLinkAccepter;
     typedef typename UpdateGroup<CELL_TYPE, PatchLink>::PatchLinkProvider PatchLinkProvider;
+    typedef typename UpdateGroup<CELL_TYPE, PatchLink>::PartitionManagerType PartitionManagerType;
+    typedef typename UpdateGroup<CELL_TYPE, PatchLink>::RegionVecMap RegionVecMap;
+    typedef typename UpdateGroup<CELL_TYPE, PatchLink>::GridType GridType;
+    typedef typename UpdateGroup<CELL_TYPE, PatchLink>::Topology Topology;
+    typedef typename SerializationBuffer<CELL_TYPE>::BufferType BufferType;
+    typedef RepartitionInitializer<CELL_TYPE, GridType> RepartitionInitializerType;
 
-
+    using UpdateGroup<CELL_TYPE, PatchLink>::box;
+    using UpdateGroup<CELL_TYPE, PatchLink>::currentStep;
+    using UpdateGroup<CELL_TYPE, PatchLink>::ghostZoneWidth;
     using UpdateGroup<CELL_TYPE, PatchLink>::init;
+    using UpdateGroup<CELL_TYPE, PatchLink>::initializer;
+    using UpdateGroup<CELL_TYPE, PatchLink>::initPatchLinksAndStepper;
+    using UpdateGroup<CELL_TYPE, PatchLink>::partitionManager;
+    using UpdateGroup<CELL_TYPE, PatchLink>::patchLinks;
     using UpdateGroup<CELL_TYPE, PatchLink>::rank;
+    using UpdateGroup<CELL_TYPE, PatchLink>::resetPartitionManager;
+    using UpdateGroup<CELL_TYPE, PatchLink>::retiredStatistics;
+    using UpdateGroup<CELL_TYPE, PatchLink>::stepper;
     const static int DIM = UpdateGroup<CELL_TYPE, PatchLink>::DIM;
 
     template<typename STEPPER>
@@ -45,9 +98,11 @@ public:
         PatchAccepterVec patchAcceptersInner = PatchAccepterVec(),
         PatchProviderVec patchProvidersGhost = PatchProviderVec(),
         PatchProviderVec patchProvidersInner = PatchProviderVec(),
-        MPI_Comm communicator = MPI_COMM_WORLD) :
+        MPI_Comm communicator = MPI_COMM_WORLD,
+        const MPIUpdateGroupOptions& options = MPIUpdateGroupOptions()) :
         UpdateGroup<CELL_TYPE, PatchLink>(ghostZoneWidth, initializer, MPILayer(communicator).rank()),
-        mpiLayer(communicator)
+        mpiLayer(communicator),
+        options(options)
     {
         init(
             partition,
@@ -61,8 +116,224 @@ public:
             patchProvidersInner);
     }
 
+    /**
+     * Switches to the domain decomposition given by newPartition
+     * without restarting from the Initializer. Cells whose owner
+     * changes are sent to their new rank, along with those cells
+     * which form the new outer ghost zones. The PartitionManager,
+     * the PatchLinks and the Stepper are then rebuilt in place.
+     *
+     * Needs to be called collectively and only at the beginning of a
+     * time step (nanoStep == 0) which coincides with a ghost zone
+     * synchronization, as only then the Stepper's grid holds its
+     * whole subdomain at the same time step.
+     */
+    template<typename STEPPER>
+    void repartition(boost::shared_ptr<Partition<DIM> > newPartition, STEPPER *stepperType)
+    {
+        std::pair<std::size_t, std::size_t> now = currentStep();
+        if (now.second != 0) {
+            throw std::logic_error("repartitioning is only possible at the beginning of a time step");
+        }
+
+        // all ranks have received their ghost zones for the current
+        // step, so the only outstanding requests are the receives for
+        // the next synchronization, which will never be served:
+        mpiLayer.barrier();
+        for (typename std::vector<typename UpdateGroup<CELL_TYPE, PatchLink>::PatchLinkPtr>::iterator i =
+                 patchLinks.begin();
+             i != patchLinks.end();
+             ++i) {
+            (*i)->cancel();
+            (*i)->wait();
+        }
+        patchLinks.clear();
+        // don't let the new links' messages collide with the old ones:
+        mpiLayer.barrier();
+
+        boost::shared_ptr<PartitionManagerType> oldPartitionManager = partitionManager;
+        partitionManager.reset(new PartitionManagerType());
+        resetPartitionManager(newPartition);
+
+        CoordBox<DIM> gridBox;
+        OffsetHelper<DIM - 1, DIM, Topology>()(
+            &gridBox.origin,
+            &gridBox.dimensions,
+            partitionManager->ownRegion().boundingBox(),
+            initializer->gridBox(),
+            ghostZoneWidth);
+        boost::shared_ptr<GridType> stagingGrid(
+            new GridType(gridBox, CELL_TYPE(), stepper->grid().getEdge(), initializer->gridDimensions()));
+
+        migrateCells(*oldPartitionManager, stepper->grid(), &*stagingGrid);
+
+        retiredStatistics += stepper->statistics();
+        // free the old grids before the new Stepper allocates its own:
+        stepper.reset();
+
+        boost::shared_ptr<RepartitionInitializerType> stepperInitializer(
+            new RepartitionInitializerType(
+                initializer,
+                stagingGrid,
+                partitionManager->ownExpandedRegion(),
+                now.first));
+        stagingGrid.reset();
+
+        long firstSyncPoint = now.first * APITraits::SelectNanoSteps<CELL_TYPE>::VALUE + ghostZoneWidth;
+        initPatchLinksAndStepper(firstSyncPoint, stepperInitializer, stepperType);
+        stepperInitializer->releaseStagingGrid();
+    }
+
 private:
     MPILayer mpiLayer;
+    MPIUpdateGroupOptions options;
+
+    /**
+     * Sparse neighbor discovery: the candidates for neighbors are
+     * those ranks whose expanded bounding boxes intersect ours. Each
+     * pair of candidates exchanges the parts of their (expanded)
+     * regions which lie within the other's bounding box, so no rank
+     * has to expand any other rank's region.
+     */
+    void resetGhostZones(boost::shared_ptr<Partition<DIM> > partition)
+    {
+        if (!options.sparseNeighborDiscovery) {
+            UpdateGroup<CELL_TYPE, PatchLink>::resetGhostZones(partition);
+            return;
+        }
+
+        int tag = MPILayer::UPDATE_GROUP_NEIGHBOR_DISCOVERY;
+        std::size_t numLayers = ghostZoneWidth + 1;
+        std::vector<CoordBox<DIM> > boundingBoxes =
+            gatherBoundingBoxes(partitionManager->ownExpandedRegion().boundingBox(), partition);
+        std::vector<int> neighbors = partitionManager->neighborCandidates(boundingBoxes);
+
+        // each message consists of the number of streaks per layer,
+        // followed by the streaks of all layers:
+        std::vector<std::vector<unsigned> > sendLengths(neighbors.size());
+        std::vector<std::vector<unsigned> > recvLengths(neighbors.size(), std::vector<unsigned>(numLayers));
+        std::vector<std::vector<Streak<DIM> > > sendStreaks(neighbors.size());
+        std::vector<std::vector<Streak<DIM> > > recvStreaks(neighbors.size());
+
+        for (std::size_t i = 0; i < neighbors.size(); ++i) {
+            std::vector<Region<DIM> > layers =
+                partitionManager->exchangeRegions(boundingBoxes[neighbors[i]]);
+            for (std::size_t j = 0; j < numLayers; ++j) {
+                std::vector<Streak<DIM> > streaks = layers[j].toVector();
+                sendLengths[i] << streaks.size();
+                sendStreaks[i].insert(sendStreaks[i].end(), streaks.begin(), streaks.end());
+            }
+
+            mpiLayer.recv(&recvLengths[i][0], neighbors[i], numLayers, tag, MPI_UNSIGNED);
+            mpiLayer.send(&sendLengths[i][0], neighbors[i], numLayers, tag, MPI_UNSIGNED);
+        }
+        mpiLayer.wait(tag);
+
+        MPI_Datatype streakDatatype = Typemaps::lookup<Streak<DIM> >();
+        for (std::size_t i = 0; i < neighbors.size(); ++i) {
+            recvStreaks[i].resize(sum(recvLengths[i]));
+            if (!recvStreaks[i].empty()) {
+                mpiLayer.recv(&recvStreaks[i][0], neighbors[i], recvStreaks[i].size(), tag, streakDatatype);
+            }
+            if (!sendStreaks[i].empty()) {
+                mpiLayer.send(&sendStreaks[i][0], neighbors[i], sendStreaks[i].size(), tag, streakDatatype);
+            }
+        }
+        mpiLayer.wait(tag);
+
+        RegionVecMap neighborExpansions;
+        for (std::size_t i = 0; i < neighbors.size(); ++i) {
+            std::vector<Region<DIM> >& layers = neighborExpansions[neighbors[i]];
+            layers.resize(numLayers);
+
+            typename std::vector<Streak<DIM> >::iterator begin = recvStreaks[i].begin();
+            for (std::size_t j = 0; j < numLayers; ++j) {
+                typename std::vector<Streak<DIM> >::iterator end = begin + recvLengths[i][j];
+                layers[j].load(begin, end);
+                begin = end;
+            }
+        }
+
+        partitionManager->resetGhostZones(boundingBoxes, neighborExpansions);
+    }
+
+    /**
+     * Sends those parts of the old subdomain to other ranks which
+     * they require for their new subdomain (including its outer
+     * ghost zone) and receives the respective parts of our new
+     * subdomain. Locally retained cells are copied directly.
+     */
+    void migrateCells(
+        PartitionManagerType& oldPartitionManager,
+        const GridType& oldGrid,
+        GridType *newGrid)
+    {
+        int size = mpiLayer.size();
+        int tag = MPILayer::UPDATE_GROUP_MIGRATION;
+        MPI_Datatype cellMPIDatatype = SerializationBuffer<CELL_TYPE>::cellMPIDataType();
+
+        const Region<DIM>& oldRegion = oldPartitionManager.ownRegion();
+        const Region<DIM>& newRegion = partitionManager->ownExpandedRegion();
+        std::vector<Region<DIM> > sendRegions(size);
+        std::vector<Region<DIM> > recvRegions(size);
+        std::vector<BufferType> sendBuffers(size);
+        std::vector<BufferType> recvBuffers(size);
+        std::vector<int> recvSizes(size, 0);
+        std::vector<int> sendSizes(size, 0);
+
+        for (int i = 0; i < size; ++i) {
+            sendRegions[i] = oldRegion & partitionManager->getRegion(i, ghostZoneWidth);
+            recvRegions[i] = newRegion & oldPartitionManager.getRegion(i, 0);
+        }
+
+        // buffer sizes are sent ahead as serialized cells don't have a
+        // fixed size:
+        for (int i = 0; i < size; ++i) {
+            if ((i != int(rank)) && !recvRegions[i].empty()) {
+                mpiLayer.recv(&recvSizes[i], i, 1, tag, MPI_INT);
+            }
+        }
+        for (int i = 0; i < size; ++i) {
+            if (sendRegions[i].empty()) {
+                continue;
+            }
+
+            sendBuffers[i] = SerializationBuffer<CELL_TYPE>::create(sendRegions[i]);
+            GridVecConv::gridToVector(oldGrid, &sendBuffers[i], sendRegions[i]);
+
+            if (i == int(rank)) {
+                GridVecConv::vectorToGrid(sendBuffers[i], newGrid, sendRegions[i]);
+                sendBuffers[i].clear();
+                continue;
+            }
+
+            if (sendBuffers[i].size() > INT_MAX) {
+                throw std::invalid_argument("buffer size exceeds INT_MAX");
+            }
+            sendSizes[i] = sendBuffers[i].size();
+            mpiLayer.send(&sendSizes[i], i, 1, tag, MPI_INT);
+        }
+        mpiLayer.wait(tag);
+
+        for (int i = 0; i < size; ++i) {
+            if (recvSizes[i] > 0) {
+                recvBuffers[i].resize(recvSizes[i]);
+                mpiLayer.recv(&recvBuffers[i][0], i, recvSizes[i], tag, cellMPIDatatype);
+            }
+        }
+        for (int i = 0; i < size; ++i) {
+            if (sendSizes[i] > 0) {
+                mpiLayer.send(&sendBuffers[i][0], i, sendSizes[i], tag, cellMPIDatatype);
+            }
+        }
+        mpiLayer.wait(tag);
+
+        for (int i = 0; i < size; ++i) {
+            if (recvSizes[i] > 0) {
+                GridVecConv::vectorToGrid(recvBuffers[i], newGrid, recvRegions[i]);
+            }
+        }
+    }
 
     std::vector<CoordBox<DIM> > gatherBoundingBoxes(
         const CoordBox<DIM>& ownBoundingBox,
@@ -81,7 +352,9 @@ private:
                 target,
                 MPILayer::PATCH_LINK,
                 SerializationBuffer<CELL_TYPE>::cellMPIDataType(),
-                mpiLayer.communicator()));
+                mpiLayer.communicator(),
+                options.patchLinkDepth,
+                options.zeroCopyPatchLinks));
 
     }
 
@@ -93,7 +366,8 @@ private:
                 source,
                 MPILayer::PATCH_LINK,
                 SerializationBuffer<CELL_TYPE>::cellMPIDataType(),
-                mpiLayer.communicator()));
+                mpiLayer.communicator(),
+                options.patchLinkDepth));
     }
 };
 
@@ -4,48 +4,396 @@
 #include <libgeodecomp/config.h>
 #ifdef LIBGEODECOMP_WITH_THREADS
 
-#include <libgeodecomp/parallelization/nesting/commonstepper.h>
-#include <libgeodecomp/storage/patchbufferfixed.h>
+#include <libgeodecomp/parallelization/nesting/vanillastepper.h>
+#include <libgeodecomp/storage/displacedgrid.h>
+#include <omp.h>
 
 namespace LibGeoDecomp {
 
+namespace MultiCoreStepperHelpers {
+
+/**
+ * Threads only need to synchronize with their neighbors if the cells
+ * they're updating may only access cells within the stencil radius.
+ * This doesn't hold for unstructured grids, which is why these will
+ * be updated in a single slice.
+ */
+template<typename TOPOLOGY>
+class SupportsSlicing
+{
+public:
+    static const bool VALUE = true;
+};
+
+template<>
+class SupportsSlicing<Topologies::Unstructured::Topology>
+{
+public:
+    static const bool VALUE = false;
+};
+
+/**
+ * Progress counter of a single slice. Padded to a cache line to
+ * avoid false sharing while threads are spinning on their
+ * neighbors' counters.
+ */
+class SliceProgress
+{
+public:
+    SliceProgress() :
+        value(0)
+    {}
+
+    long value;
+    char padding[64 - sizeof(long)];
+};
+
+/**
+ * Allocates the grids of the MultiCoreStepper. If the grid type
+ * supports it, cells are left uninitialized, so that the threads may
+ * first-touch their slices. Other grid types are value-initialized by
+ * the calling thread.
+ */
+template<typename GRID_TYPE>
+class GridAllocator
+{
+public:
+    static const bool UNINITIALIZED = false;
+
+    template<typename CELL, int DIM>
+    GRID_TYPE *operator()(
+        const CoordBox<DIM>& box,
+        const CELL& defaultCell,
+        const Coord<DIM>& topologicalDimensions)
+    {
+        return new GRID_TYPE(box, defaultCell, defaultCell, topologicalDimensions);
+    }
+};
+
+/**
+ * see above
+ */
+template<typename CELL, typename TOPOLOGY, bool TOPOLOGICALLY_CORRECT>
+class GridAllocator<DisplacedGrid<CELL, TOPOLOGY, TOPOLOGICALLY_CORRECT> >
+{
+public:
+    typedef DisplacedGrid<CELL, TOPOLOGY, TOPOLOGICALLY_CORRECT> GridType;
+
+    static const bool UNINITIALIZED = true;
+
+    template<int DIM>
+    GridType *operator()(
+        const CoordBox<DIM>& box,
+        const CELL& defaultCell,
+        const Coord<DIM>& topologicalDimensions)
+    {
+        GridType *ret = new GridType(CoordBox<DIM>(), defaultCell, defaultCell, topologicalDimensions);
+        ret->resizeUninitialized(box);
+        return ret;
+    }
+};
+
+}
+
 /**
  * MultiCoreStepper is an OpenMP-enabled implementation of the Stepper
- * concept.
+ * concept. Unlike the VanillaStepper with ConcurrencyEnableOpenMP,
+ * which uses one parallel loop (and thus one barrier) per nano step,
+ * it cuts the ownRegion() into slices along the outermost dimension
+ * and assigns each slice to a thread. Threads then advance the inner
+ * set of their slices by multiple nano steps within a single parallel
+ * region, synchronizing only with the threads updating the two
+ * neighboring slices: a slice may be updated to nano step t once both
+ * neighbors have reached t - 1. The number of nano steps per parallel
+ * region is bounded by the ghost zone width and by the next request
+ * of the inner set PatchAccepters/Providers. Ghost zone updates are
+ * delegated to the VanillaStepper.
+ *
+ * Slices are statically mapped to threads, so each thread keeps
+ * working on the same part of the grids. The grids are allocated
+ * uninitialized and each thread first-touches its slices, so pages
+ * are placed on the NUMA node of the thread updating them. This
+ * requires C++11 and cells with trivial default constructors,
+ * otherwise the pages are placed by the thread setting up the
+ * Stepper.
  *
  * fixme: how to handle threading if user code has a multithreaded
  *        update() itself? (e.g. n-body codes)
- *
- * fixme: cache blocking?
- *
- * fixme: mpi pacing?
  */
 template<typename CELL_TYPE>
-class MultiCoreStepper : public CommonStepper<CELL_TYPE>
+class MultiCoreStepper : public VanillaStepper<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>
 {
 public:
-    typedef typename Stepper<CELL_TYPE>::Topology Topology;
-    const static int DIM = Topology::DIM;
-    const static unsigned NANO_STEPS = APITraits::SelectNanoSteps<CELL_TYPE>::VALUE;
+    friend class MultiCoreStepperTest;
 
-    typedef class Stepper<CELL_TYPE> ParentType;
+    typedef VanillaStepper<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> ParentType;
+    typedef typename ParentType::Topology Topology;
     typedef typename ParentType::GridType GridType;
-    typedef PartitionManager<Topology> PartitionManagerType;
-    typedef PatchBufferFixed<GridType, GridType, 1> PatchBufferType1;
-    typedef PatchBufferFixed<GridType, GridType, 2> PatchBufferType2;
+    typedef typename ParentType::PartitionManagerType PartitionManagerType;
     typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
+    typedef typename ParentType::PatchProviderVec PatchProviderVec;
+    typedef typename ParentType::PatchAccepterList PatchAccepterList;
+    typedef typename ParentType::PatchProviderList PatchProviderList;
+    typedef MultiCoreStepperHelpers::SliceProgress SliceProgress;
 
+    const static int DIM = Topology::DIM;
+    const static unsigned NANO_STEPS = APITraits::SelectNanoSteps<CELL_TYPE>::VALUE;
+    const static int RADIUS = APITraits::SelectStencil<CELL_TYPE>::Value::RADIUS;
+
+    using ParentType::chronometer;
+    using ParentType::costMap;
+    using ParentType::curNanoStep;
+    using ParentType::curStep;
+    using ParentType::finishInnerSetUpdate;
+    using ParentType::ghostZoneWidth;
+    using ParentType::globalNanoStep;
+    using ParentType::guessOffset;
+    using ParentType::initGrids;
+    using ParentType::initializer;
+    using ParentType::innerSet;
+    using ParentType::nanoStepsToNextInnerSetEvent;
+    using ParentType::newGrid;
+    using ParentType::oldGrid;
+    using ParentType::partitionManager;
+    using ParentType::patchAccepters;
+    using ParentType::patchProviders;
+    using ParentType::validGhostZoneWidth;
+
+    /**
+     * maxThreads limits the number of slices (and thus threads)
+     * used for updating the inner set. 0 defaults to
+     * omp_get_max_threads().
+     */
     inline MultiCoreStepper(
         boost::shared_ptr<PartitionManagerType> partitionManager,
         boost::shared_ptr<Initializer<CELL_TYPE> > initializer,
         const PatchAccepterVec& ghostZonePatchAccepters = PatchAccepterVec(),
-        const PatchAccepterVec& innerSetPatchAccepters = PatchAccepterVec()) :
-        CommonStepper<CELL_TYPE>(
+        const PatchAccepterVec& innerSetPatchAccepters = PatchAccepterVec(),
+        const PatchProviderVec& ghostZonePatchProviders = PatchProviderVec(),
+        const PatchProviderVec& innerSetPatchProviders = PatchProviderVec(),
+        bool enableFineGrainedParallelism = false,
+        int maxThreads = 0) :
+        ParentType(
             partitionManager,
             initializer,
             ghostZonePatchAccepters,
-            innerSetPatchAccepters)
+            innerSetPatchAccepters,
+            ghostZonePatchProviders,
+            innerSetPatchProviders,
+            enableFineGrainedParallelism,
+            typename ParentType::DeferInitGrids())
+    {
+        if (maxThreads <= 0) {
+            maxThreads = omp_get_max_threads();
+        }
+
+        initSlices(maxThreads);
+        allocateGrids();
+        initGrids();
+    }
+
+    inline virtual void update(std::size_t nanoSteps)
+    {
+        while (nanoSteps > 0) {
+            std::size_t hop = nanoStepsToNextInnerSetEvent(nanoSteps);
+            updateHop(hop);
+            nanoSteps -= hop;
+        }
+    }
+
+    inline std::size_t numSlices() const
+    {
+        return sliceInnerSets.size();
+    }
+
+protected:
+    // sliceInnerSets[slice][i] = innerSet(i) & slice
+    std::vector<std::vector<Region<DIM> > > sliceInnerSets;
+    // slice i spans [sliceBounds[i], sliceBounds[i + 1]) along the
+    // outermost dimension
+    std::vector<int> sliceBounds;
+    std::vector<SliceProgress> progress;
+
+    inline void initSlices(int maxThreads)
+    {
+        CoordBox<DIM> box = partitionManager->ownRegion().boundingBox();
+        int height = box.dimensions[DIM - 1];
+        int minThickness = (std::max)(RADIUS, 1);
+
+        int slices = (std::min)(maxThreads, height / minThickness);
+        if (!MultiCoreStepperHelpers::SupportsSlicing<Topology>::VALUE) {
+            slices = 1;
+        }
+        slices = (std::max)(slices, 1);
+
+        sliceInnerSets.resize(slices);
+        sliceBounds.resize(slices + 1);
+        progress.resize(slices);
+
+        for (int slice = 0; slice <= slices; ++slice) {
+            sliceBounds[slice] = box.origin[DIM - 1] + long(height) * slice / slices;
+        }
+
+        for (int slice = 0; slice < slices; ++slice) {
+            Region<DIM> sliceRegion;
+            sliceRegion << sliceBox(box, slice);
+
+            sliceInnerSets[slice].resize(ghostZoneWidth() + 1);
+            for (unsigned i = 0; i <= ghostZoneWidth(); ++i) {
+                sliceInnerSets[slice][i] = innerSet(i) & sliceRegion;
+            }
+        }
+    }
+
+    /**
+     * Returns the part of box which belongs to the given slice. The
+     * first and last slice extend to the box' boundaries, so that
+     * ghost zones get assigned to them.
+     */
+    inline CoordBox<DIM> sliceBox(CoordBox<DIM> box, long slice) const
+    {
+        int start = box.origin[DIM - 1];
+        int end = start + box.dimensions[DIM - 1];
+
+        if (slice > 0) {
+            start = sliceBounds[slice];
+        }
+        if (slice < long(numSlices() - 1)) {
+            end = sliceBounds[slice + 1];
+        }
+
+        box.origin[DIM - 1] = start;
+        box.dimensions[DIM - 1] = (std::max)(end - start, 0);
+        return box;
+    }
+
+    /**
+     * Allocates both grids and lets each thread initialize the
+     * slices it'll update later on, using the same mapping of slices
+     * to threads as updateSlices(). This way the pages end up on the
+     * NUMA node of the thread which is updating them. The
+     * Initializer will be applied later on by initGrids().
+     */
+    inline void allocateGrids()
+    {
+        typedef MultiCoreStepperHelpers::GridAllocator<GridType> Allocator;
+
+        CoordBox<DIM> gridBox;
+        guessOffset(&gridBox.origin, &gridBox.dimensions);
+        Coord<DIM> topoDim = initializer->gridDimensions();
+
+        oldGrid.reset(Allocator()(gridBox, CELL_TYPE(), topoDim));
+        newGrid.reset(Allocator()(gridBox, CELL_TYPE(), topoDim));
+
+        if (!Allocator::UNINITIALIZED) {
+            return;
+        }
+
+        long slices = numSlices();
+        GridType *grids[] = { &*oldGrid, &*newGrid };
+
+#pragma omp parallel num_threads(slices)
+        {
+            long threads = omp_get_num_threads();
+            std::vector<CELL_TYPE> buffer(gridBox.dimensions.x(), CELL_TYPE());
+
+            for (long slice = omp_get_thread_num(); slice < slices; slice += threads) {
+                Region<DIM> region;
+                region << sliceBox(gridBox, slice);
+
+                for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+                     i != region.endStreak();
+                     ++i) {
+                    grids[0]->set(*i, &buffer[0]);
+                    grids[1]->set(*i, &buffer[0]);
+                }
+            }
+        }
+    }
+
+    inline void updateHop(std::size_t hop)
     {
+        using std::swap;
+        TimeTotal t(&chronometer);
+
+        {
+            TimeComputeInner t(&chronometer);
+            unsigned firstIndex = ghostZoneWidth() - validGhostZoneWidth + 1;
+            updateSlices(firstIndex, hop);
+
+            if (hop % 2) {
+                swap(oldGrid, newGrid);
+            }
+
+            validGhostZoneWidth -= hop;
+            curNanoStep += hop;
+            curStep += curNanoStep / NANO_STEPS;
+            curNanoStep %= NANO_STEPS;
+        }
+
+        finishInnerSetUpdate();
+    }
+
+    /**
+     * Each thread updates its slices by hop nano steps, starting
+     * with innerSet(firstIndex). Threads wait for the neighboring
+     * slices (wrapping around, as the outermost dimension might be
+     * periodic) instead of using a barrier per nano step.
+     */
+    inline void updateSlices(unsigned firstIndex, std::size_t hop)
+    {
+        long slices = numSlices();
+        for (long i = 0; i < slices; ++i) {
+            progress[i].value = 0;
+        }
+
+        GridType *grids[] = { &*oldGrid, &*newGrid };
+
+#pragma omp parallel num_threads(slices)
+        {
+            long threads = omp_get_num_threads();
+
+            for (std::size_t step = 0; step < hop; ++step) {
+                const GridType& sourceGrid = *grids[step % 2];
+                GridType *targetGrid = grids[(step + 1) % 2];
+                unsigned nanoStep = (curNanoStep + step) % NANO_STEPS;
+
+                // slices are processed in ascending order, which
+                // avoids deadlocks if OpenMP gave us fewer threads
+                // than requested.
+                for (long slice = omp_get_thread_num(); slice < slices; slice += threads) {
+                    waitForSlice((slice + slices - 1) % slices, step);
+                    waitForSlice((slice + 1) % slices, step);
+
+                    UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyNoP> updateFunctor(&costMap);
+                    updateFunctor(
+                        sliceInnerSets[slice][firstIndex + step],
+                        Coord<DIM>(),
+                        Coord<DIM>(),
+                        sourceGrid,
+                        targetGrid,
+                        nanoStep,
+                        UpdateFunctorHelpers::ConcurrencyNoP());
+
+#pragma omp flush
+                    long newProgress = step + 1;
+#pragma omp atomic write
+                    progress[slice].value = newProgress;
+                }
+            }
+        }
+    }
+
+    inline void waitForSlice(long slice, long step)
+    {
+        long sliceProgress;
+
+        do {
+#pragma omp atomic read
+            sliceProgress = progress[slice].value;
+        } while (sliceProgress < step);
+
+#pragma omp flush
     }
 };
 
@@ -0,0 +1,146 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_OVERLAPPINGSTEPPER_H
+#define LIBGEODECOMP_PARALLELIZATION_NESTING_OVERLAPPINGSTEPPER_H
+
+#include <libgeodecomp/parallelization/nesting/vanillastepper.h>
+
+namespace LibGeoDecomp {
+
+/**
+ * The OverlappingStepper behaves just like the VanillaStepper, but
+ * updates its inner sets in batches of streaks. Between two batches
+ * it will poll all ghost zone PatchAccepters and PatchProviders so
+ * that the transmission of the ghost zones (which are being sent
+ * right after the rim has been updated) can progress while the
+ * kernel is being computed. Without this, MPI implementations
+ * lacking asynchronous progress would only move the data once the
+ * Stepper blocks on the next ghost zone update.
+ *
+ * Time spent polling is accounted for as TimeCommunication.
+ */
+template<typename CELL_TYPE, typename CONCURRENCY_SPEC>
+class OverlappingStepper : public VanillaStepper<CELL_TYPE, CONCURRENCY_SPEC>
+{
+public:
+    typedef VanillaStepper<CELL_TYPE, CONCURRENCY_SPEC> ParentType;
+    typedef typename ParentType::Topology Topology;
+    typedef typename ParentType::PartitionManagerType PartitionManagerType;
+    typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
+    typedef typename ParentType::PatchProviderVec PatchProviderVec;
+    typedef typename ParentType::PatchAccepterList PatchAccepterList;
+    typedef typename ParentType::PatchProviderList PatchProviderList;
+    const static int DIM = Topology::DIM;
+
+    using ParentType::chronometer;
+    using ParentType::costMap;
+    using ParentType::curNanoStep;
+    using ParentType::enableFineGrainedParallelism;
+    using ParentType::ghostZoneWidth;
+    using ParentType::innerSet;
+    using ParentType::newGrid;
+    using ParentType::oldGrid;
+    using ParentType::patchAccepters;
+    using ParentType::patchProviders;
+
+    /**
+     * cellsPerBatch determines the granularity of the polling: the
+     * inner sets are cut into batches of consecutive streaks, each
+     * containing about this many cells.
+     */
+    inline OverlappingStepper(
+        boost::shared_ptr<PartitionManagerType> partitionManager,
+        boost::shared_ptr<Initializer<CELL_TYPE> > initializer,
+        const PatchAccepterVec& ghostZonePatchAccepters = PatchAccepterVec(),
+        const PatchAccepterVec& innerSetPatchAccepters = PatchAccepterVec(),
+        const PatchProviderVec& ghostZonePatchProviders = PatchProviderVec(),
+        const PatchProviderVec& innerSetPatchProviders = PatchProviderVec(),
+        bool enableFineGrainedParallelism = false,
+        std::size_t cellsPerBatch = 16384) :
+        ParentType(
+            partitionManager,
+            initializer,
+            ghostZonePatchAccepters,
+            innerSetPatchAccepters,
+            ghostZonePatchProviders,
+            innerSetPatchProviders,
+            enableFineGrainedParallelism)
+    {
+        batches.resize(ghostZoneWidth() + 1);
+        for (std::size_t i = 0; i < batches.size(); ++i) {
+            splitRegion(innerSet(i), cellsPerBatch, &batches[i]);
+        }
+    }
+
+protected:
+    std::vector<std::vector<Region<DIM> > > batches;
+
+    virtual void updateInnerSet(unsigned index)
+    {
+        const std::vector<Region<DIM> >& regions = batches[index];
+
+        for (std::size_t i = 0; i < regions.size(); ++i) {
+            {
+                TimeComputeInner t(&chronometer);
+
+                UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC> updateFunctor(&costMap);
+                updateFunctor(
+                    regions[i],
+                    Coord<DIM>(),
+                    Coord<DIM>(),
+                    *oldGrid,
+                    &*newGrid,
+                    curNanoStep,
+                    CONCURRENCY_SPEC(false, enableFineGrainedParallelism));
+            }
+
+            progressCommunication();
+        }
+    }
+
+    inline void progressCommunication()
+    {
+        TimeCommunication t(&chronometer);
+
+        for (typename PatchProviderList::iterator i = patchProviders[ParentType::GHOST].begin();
+             i != patchProviders[ParentType::GHOST].end();
+             ++i) {
+            (*i)->progress();
+        }
+
+        for (typename PatchAccepterList::iterator i = patchAccepters[ParentType::GHOST].begin();
+             i != patchAccepters[ParentType::GHOST].end();
+             ++i) {
+            (*i)->progress();
+        }
+    }
+
+    static void splitRegion(
+        const Region<DIM>& region,
+        std::size_t cellsPerBatch,
+        std::vector<Region<DIM> > *target)
+    {
+        target->clear();
+        Region<DIM> batch;
+        std::size_t batchSize = 0;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak();
+             i != region.endStreak();
+             ++i) {
+            batch << *i;
+            batchSize += i->length();
+
+            if (batchSize >= cellsPerBatch) {
+                *target << batch;
+                batch.clear();
+                batchSize = 0;
+            }
+        }
+
+        if (!batch.empty() || target->empty()) {
+            *target << batch;
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_REPARTITIONINITIALIZER_H
+#define LIBGEODECOMP_PARALLELIZATION_NESTING_REPARTITIONINITIALIZER_H
+
+#include <libgeodecomp/io/initializer.h>
+
+#include <boost/shared_ptr.hpp>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+/**
+ * The RepartitionInitializer is used by the UpdateGroup to
+ * re-initialize a Stepper after the domain decomposition has been
+ * changed. Instead of calling the user-supplied Initializer it will
+ * copy the cells which have been migrated to this process from a
+ * staging grid. All other properties (grid dimensions, adjacency,
+ * maxSteps()) are forwarded to the original Initializer, while
+ * startStep() reflects the time step at which the repartitioning
+ * took place.
+ */
+template<typename CELL, typename GRID_TYPE>
+class RepartitionInitializer : public Initializer<CELL>
+{
+public:
+    typedef typename Initializer<CELL>::Topology Topology;
+    const static int DIM = Topology::DIM;
+
+    RepartitionInitializer(
+        boost::shared_ptr<Initializer<CELL> > delegate,
+        boost::shared_ptr<GRID_TYPE> stagingGrid,
+        const Region<DIM>& validRegion,
+        unsigned step) :
+        delegate(delegate),
+        stagingGrid(stagingGrid),
+        validRegion(validRegion),
+        step(step)
+    {}
+
+    virtual void grid(GridBase<CELL, DIM> *target)
+    {
+        if (!stagingGrid) {
+            throw std::logic_error("staging grid has already been released");
+        }
+
+        std::vector<CELL> buffer;
+
+        for (typename Region<DIM>::StreakIterator i = validRegion.beginStreak();
+             i != validRegion.endStreak();
+             ++i) {
+            buffer.resize(i->length());
+            stagingGrid->get(*i, &buffer[0]);
+            target->set(*i, &buffer[0]);
+        }
+
+        target->setEdge(stagingGrid->getEdge());
+    }
+
+    virtual Coord<DIM> gridDimensions() const
+    {
+        return delegate->gridDimensions();
+    }
+
+    virtual CoordBox<DIM> gridBox()
+    {
+        return delegate->gridBox();
+    }
+
+    virtual unsigned startStep() const
+    {
+        return step;
+    }
+
+    virtual unsigned maxSteps() const
+    {
+        return delegate->maxSteps();
+    }
+
+    virtual boost::shared_ptr<Adjacency> getAdjacency() const
+    {
+        return delegate->getAdjacency();
+    }
+
+    /**
+     * Steppers only pull their grid upon construction, but will hold
+     * on to their Initializer. This allows the UpdateGroup to free
+     * the staging grid once the Stepper has been set up.
+     */
+    void releaseStagingGrid()
+    {
+        stagingGrid.reset();
+        validRegion.clear();
+    }
+
+private:
+    boost::shared_ptr<Initializer<CELL> > delegate;
+    boost::shared_ptr<GRID_TYPE> stagingGrid;
+    Region<DIM> validRegion;
+    unsigned step;
+};
+
+}
+
+#endif
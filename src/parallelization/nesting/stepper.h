@@ -4,6 +4,7 @@
 #include <boost/shared_ptr.hpp>
 #include <deque>
 
+#include <libgeodecomp/geometry/costmap.h>
 #include <libgeodecomp/geometry/partitionmanager.h>
 #include <libgeodecomp/io/initializer.h>
 #include <libgeodecomp/misc/chronometer.h>
@@ -45,7 +46,9 @@ public:
         boost::shared_ptr<Initializer<CELL_TYPE> > initializer) :
         partitionManager(partitionManager),
         initializer(initializer)
-    {}
+    {
+        initCostMap(typename APITraits::SelectCostSampling<CELL_TYPE>::Value());
+    }
 
     virtual ~Stepper()
     {}
@@ -78,12 +81,22 @@ public:
         return chronometer;
     }
 
+    /**
+     * Timings of the streaks updated by this Stepper, only available
+     * for models with APITraits::HasCostSampling.
+     */
+    const CostMap<DIM>& costs() const
+    {
+        return costMap;
+    }
+
 protected:
     boost::shared_ptr<PartitionManagerType> partitionManager;
     boost::shared_ptr<Initializer<CELL_TYPE> > initializer;
     PatchProviderList patchProviders[2];
     PatchAccepterList patchAccepters[2];
     Chronometer chronometer;
+    CostMap<DIM> costMap;
 
     /**
      * calculates a (mostly) suitable offset which (in conjuction with
@@ -101,6 +114,15 @@ protected:
             initializer->gridBox(),
             partitionManager->getGhostZoneWidth());
     }
+
+private:
+    inline void initCostMap(APITraits::TrueType)
+    {
+        costMap = CostMap<DIM>(initializer->gridBox());
+    }
+
+    inline void initCostMap(APITraits::FalseType)
+    {}
 };
 
 }
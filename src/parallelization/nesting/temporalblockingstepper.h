@@ -0,0 +1,271 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_NESTING_TEMPORALBLOCKINGSTEPPER_H
+#define LIBGEODECOMP_PARALLELIZATION_NESTING_TEMPORALBLOCKINGSTEPPER_H
+
+#include <libgeodecomp/parallelization/nesting/vanillastepper.h>
+
+#include <map>
+
+namespace LibGeoDecomp {
+
+namespace TemporalBlockingStepperHelpers {
+
+/**
+ * Tiling along the outermost dimension relies on cells only
+ * accessing neighbors within the stencil radius, which isn't the
+ * case for unstructured grids.
+ */
+template<typename TOPOLOGY>
+class SupportsTiling
+{
+public:
+    static const bool VALUE = true;
+};
+
+template<>
+class SupportsTiling<Topologies::Unstructured::Topology>
+{
+public:
+    static const bool VALUE = false;
+};
+
+}
+
+/**
+ * The TemporalBlockingStepper exploits wide ghost zones for cache
+ * reuse across time steps: instead of streaming the whole inner set
+ * from memory once per nano step, it cuts the inner set into bands
+ * along the outermost dimension and advances each band by multiple
+ * nano steps while it resides in the cache. Bands are sized so that
+ * both grids' share fits into cacheSize bytes.
+ *
+ * Since every nano step enlarges the data dependencies by one
+ * stencil radius, each band is updated as a trapezoid which shrinks
+ * by RADIUS per nano step on both sides. A second pass fills the
+ * inverted trapezoids (the "gaps") between the bands, which also
+ * grow by RADIUS per nano step. This scheme works with only the two
+ * grids which the VanillaStepper already employs: a gap reads the
+ * cells from the neighboring trapezoids before they could be
+ * overwritten by newer time steps. The outermost two boundaries of
+ * the inner set are treated as a single gap, which makes this safe
+ * for periodic boundary conditions, too.
+ *
+ * The number of nano steps per block is bounded by the ghost zone
+ * width and by the next request of any inner set
+ * PatchAccepter/PatchProvider, just like in the MultiCoreStepper.
+ * With a ghost zone width of 1 this Stepper degenerates to the
+ * VanillaStepper. Ghost zone updates are delegated to the
+ * VanillaStepper anyway.
+ */
+template<typename CELL_TYPE, typename CONCURRENCY_SPEC>
+class TemporalBlockingStepper : public VanillaStepper<CELL_TYPE, CONCURRENCY_SPEC>
+{
+public:
+    friend class TemporalBlockingStepperTest;
+
+    typedef VanillaStepper<CELL_TYPE, CONCURRENCY_SPEC> ParentType;
+    typedef typename ParentType::Topology Topology;
+    typedef typename ParentType::GridType GridType;
+    typedef typename ParentType::PartitionManagerType PartitionManagerType;
+    typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
+    typedef typename ParentType::PatchProviderVec PatchProviderVec;
+
+    const static int DIM = Topology::DIM;
+    const static unsigned NANO_STEPS = APITraits::SelectNanoSteps<CELL_TYPE>::VALUE;
+    const static int RADIUS = APITraits::SelectStencil<CELL_TYPE>::Value::RADIUS;
+
+    /**
+     * tiles[i][s] is the part of tile i which gets updated in the
+     * s-th nano step of a block.
+     */
+    typedef std::vector<std::vector<Region<DIM> > > Tiling;
+
+    using ParentType::chronometer;
+    using ParentType::costMap;
+    using ParentType::curNanoStep;
+    using ParentType::curStep;
+    using ParentType::enableFineGrainedParallelism;
+    using ParentType::finishInnerSetUpdate;
+    using ParentType::ghostZoneWidth;
+    using ParentType::innerSet;
+    using ParentType::nanoStepsToNextInnerSetEvent;
+    using ParentType::newGrid;
+    using ParentType::oldGrid;
+    using ParentType::validGhostZoneWidth;
+
+    /**
+     * cacheSize should be set to the size of the (per core) cache
+     * level which the bands are supposed to fit into.
+     */
+    inline TemporalBlockingStepper(
+        boost::shared_ptr<PartitionManagerType> partitionManager,
+        boost::shared_ptr<Initializer<CELL_TYPE> > initializer,
+        const PatchAccepterVec& ghostZonePatchAccepters = PatchAccepterVec(),
+        const PatchAccepterVec& innerSetPatchAccepters = PatchAccepterVec(),
+        const PatchProviderVec& ghostZonePatchProviders = PatchProviderVec(),
+        const PatchProviderVec& innerSetPatchProviders = PatchProviderVec(),
+        bool enableFineGrainedParallelism = false,
+        std::size_t cacheSize = 1 << 20) :
+        ParentType(
+            partitionManager,
+            initializer,
+            ghostZonePatchAccepters,
+            innerSetPatchAccepters,
+            ghostZonePatchProviders,
+            innerSetPatchProviders,
+            enableFineGrainedParallelism),
+        cacheSize(cacheSize)
+    {}
+
+    inline virtual void update(std::size_t nanoSteps)
+    {
+        while (nanoSteps > 0) {
+            std::size_t hop = nanoStepsToNextInnerSetEvent(nanoSteps);
+            unsigned firstIndex = ghostZoneWidth() - validGhostZoneWidth + 1;
+            const Tiling& tiling = getTiling(firstIndex, hop);
+
+            if (tiling.empty()) {
+                ParentType::update1();
+                --nanoSteps;
+                continue;
+            }
+
+            updateHop(tiling, hop);
+            nanoSteps -= hop;
+        }
+    }
+
+protected:
+    std::size_t cacheSize;
+    std::map<std::pair<unsigned, std::size_t>, Tiling> tilings;
+
+    inline void updateHop(const Tiling& tiling, std::size_t hop)
+    {
+        using std::swap;
+        TimeTotal t(&chronometer);
+
+        {
+            TimeComputeInner t(&chronometer);
+            GridType *grids[] = { &*oldGrid, &*newGrid };
+            UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC> updateFunctor(&costMap);
+
+            for (typename Tiling::const_iterator tile = tiling.begin(); tile != tiling.end(); ++tile) {
+                for (std::size_t step = 0; step < hop; ++step) {
+                    updateFunctor(
+                        (*tile)[step],
+                        Coord<DIM>(),
+                        Coord<DIM>(),
+                        *grids[step % 2],
+                        grids[(step + 1) % 2],
+                        (curNanoStep + step) % NANO_STEPS,
+                        CONCURRENCY_SPEC(false, enableFineGrainedParallelism));
+                }
+            }
+
+            if (hop % 2) {
+                swap(oldGrid, newGrid);
+            }
+
+            validGhostZoneWidth -= hop;
+            curNanoStep += hop;
+            curStep += curNanoStep / NANO_STEPS;
+            curNanoStep %= NANO_STEPS;
+        }
+
+        finishInnerSetUpdate();
+    }
+
+    /**
+     * Returns the (cached) tiling for hop nano steps, starting at
+     * innerSet(firstIndex). An empty tiling indicates that blocking
+     * isn't worthwhile or the inner set is too thin.
+     */
+    inline const Tiling& getTiling(unsigned firstIndex, std::size_t hop)
+    {
+        std::pair<unsigned, std::size_t> key(firstIndex, hop);
+        typename std::map<std::pair<unsigned, std::size_t>, Tiling>::iterator i = tilings.find(key);
+        if (i != tilings.end()) {
+            return i->second;
+        }
+
+        Tiling& tiling = tilings[key];
+        if ((hop < 2) || !TemporalBlockingStepperHelpers::SupportsTiling<Topology>::VALUE) {
+            return tiling;
+        }
+
+        const Region<DIM>& region = innerSet(firstIndex);
+        CoordBox<DIM> box = region.boundingBox();
+        int begin = box.origin[DIM - 1];
+        int height = box.dimensions[DIM - 1];
+        int radius = (std::max)(RADIUS, 1);
+        int maxShrink = radius * int(hop - 1);
+        if (height < 2 * maxShrink) {
+            return tiling;
+        }
+
+        // each band (plus its gaps) should fit into the cache, but
+        // may not be thinner than the shrinkage of its trapezoid
+        std::size_t bytesPerLayer = 2 * sizeof(CELL_TYPE) * region.size() / height;
+        int bandHeight = cacheSize / (std::max)(bytesPerLayer, std::size_t(1));
+        bandHeight = (std::max)(bandHeight, 2 * maxShrink);
+        bandHeight = (std::max)(bandHeight, 1);
+        int bands = (std::max)(height / bandHeight, 1);
+
+        std::vector<int> boundaries;
+        for (int band = 0; band <= bands; ++band) {
+            boundaries << begin + int(long(height) * band / bands);
+        }
+
+        // trapezoids shrink...
+        for (int band = 0; band < bands; ++band) {
+            std::vector<Region<DIM> > tile(hop);
+            for (std::size_t step = 0; step < hop; ++step) {
+                int shrink = radius * step;
+                tile[step] = layers(firstIndex + step, boundaries[band] + shrink, boundaries[band + 1] - shrink);
+            }
+            tiling << tile;
+        }
+
+        // ...while gaps grow. The first gap wraps around from the
+        // top to the bottom of the inner set:
+        for (int band = 0; band < bands; ++band) {
+            std::vector<Region<DIM> > tile(hop);
+            for (std::size_t step = 1; step < hop; ++step) {
+                int shrink = radius * step;
+                if (band == 0) {
+                    tile[step] =
+                        layers(firstIndex + step, boundaries[0], boundaries[0] + shrink) +
+                        layers(firstIndex + step, boundaries[bands] - shrink, boundaries[bands]);
+                } else {
+                    tile[step] = layers(firstIndex + step, boundaries[band] - shrink, boundaries[band] + shrink);
+                }
+            }
+            tiling << tile;
+        }
+
+        return tiling;
+    }
+
+    /**
+     * Returns all cells of innerSet(index) whose outermost
+     * coordinate lies within [begin, end).
+     */
+    inline Region<DIM> layers(unsigned index, int begin, int end)
+    {
+        const Region<DIM>& region = innerSet(index);
+        if (end <= begin) {
+            return Region<DIM>();
+        }
+
+        CoordBox<DIM> box = region.boundingBox();
+        box.origin[DIM - 1] = begin;
+        box.dimensions[DIM - 1] = end - begin;
+
+        Region<DIM> slab;
+        slab << box;
+        return region & slab;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MultiCoreStepperTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/multicoresteppertest.h"
+
+static MultiCoreStepperTest suite_MultiCoreStepperTest;
+
+static CxxTest::List Tests_MultiCoreStepperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MultiCoreStepperTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/multicoresteppertest.h", 13, "MultiCoreStepperTest", suite_MultiCoreStepperTest, Tests_MultiCoreStepperTest );
+
+static class TestDescription_suite_MultiCoreStepperTest_testUpdateMultiple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultiCoreStepperTest_testUpdateMultiple() : CxxTest::RealTestDescription( Tests_MultiCoreStepperTest, suiteDescription_MultiCoreStepperTest, 50, "testUpdateMultiple" ) {}
+ void runTest() { suite_MultiCoreStepperTest.testUpdateMultiple(); }
+} testDescription_suite_MultiCoreStepperTest_testUpdateMultiple;
+
+static class TestDescription_suite_MultiCoreStepperTest_testInnerSetPatchAccepter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultiCoreStepperTest_testInnerSetPatchAccepter() : CxxTest::RealTestDescription( Tests_MultiCoreStepperTest, suiteDescription_MultiCoreStepperTest, 67, "testInnerSetPatchAccepter" ) {}
+ void runTest() { suite_MultiCoreStepperTest.testInnerSetPatchAccepter(); }
+} testDescription_suite_MultiCoreStepperTest_testInnerSetPatchAccepter;
+
+static class TestDescription_suite_MultiCoreStepperTest_testWideGhostZones3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultiCoreStepperTest_testWideGhostZones3D() : CxxTest::RealTestDescription( Tests_MultiCoreStepperTest, suiteDescription_MultiCoreStepperTest, 81, "testWideGhostZones3D" ) {}
+ void runTest() { suite_MultiCoreStepperTest.testWideGhostZones3D(); }
+} testDescription_suite_MultiCoreStepperTest_testWideGhostZones3D;
+
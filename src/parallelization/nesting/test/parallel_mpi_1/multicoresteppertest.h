@@ -10,13 +10,16 @@ using namespace LibGeoDecomp;
 
 namespace LibGeoDecomp {
 
-class MulticoreStepperTest : public CxxTest::TestSuite
+class MultiCoreStepperTest : public CxxTest::TestSuite
 {
 public:
     typedef APITraits::SelectTopology<TestCell<2> >::Value Topology;
     typedef DisplacedGrid<TestCell<2>, Topology, true> GridType;
+    typedef APITraits::SelectTopology<TestCell<3> >::Value Topology3D;
+    typedef DisplacedGrid<TestCell<3>, Topology3D, true> GridType3D;
 #ifdef LIBGEODECOMP_WITH_THREADS
     typedef MultiCoreStepper<TestCell<2> > StepperType;
+    typedef MultiCoreStepper<TestCell<3> > StepperType3D;
 #endif
 
     void setUp()
@@ -30,16 +33,84 @@ public:
         patchAccepter->pushRequest(13);
 
         partitionManager.reset(new PartitionManager<Topology>(rect));
-        // stepper.reset(
-        //     new StepperType(partitionManager, init));
+#ifdef LIBGEODECOMP_WITH_THREADS
+        stepper.reset(
+            new StepperType(
+                partitionManager,
+                init,
+                StepperType::PatchAccepterVec(),
+                StepperType::PatchAccepterVec(1, patchAccepter),
+                StepperType::PatchProviderVec(),
+                StepperType::PatchProviderVec(),
+                false,
+                4));
+#endif
+    }
+
+    void testUpdateMultiple()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        TS_ASSERT_EQUALS(std::size_t(4), stepper->numSlices());
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 0);
+
+        stepper->update(1);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 1);
+
+        stepper->update(7);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 8);
+
+        stepper->update(30);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 38);
+#endif
+    }
 
-        // stepper->addPatchAccepter(patchAccepter, StepperType::GHOST);
+    void testInnerSetPatchAccepter()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        stepper->update(11);
+        TS_ASSERT_EQUALS(std::size_t(2), patchAccepter->getOfferedNanoSteps().size());
+        TS_ASSERT_EQUALS(std::size_t(2),  patchAccepter->getOfferedNanoSteps()[0]);
+        TS_ASSERT_EQUALS(std::size_t(10), patchAccepter->getOfferedNanoSteps()[1]);
+
+        stepper->update(2);
+        TS_ASSERT_EQUALS(std::size_t(3), patchAccepter->getOfferedNanoSteps().size());
+        TS_ASSERT_EQUALS(std::size_t(13), patchAccepter->getOfferedNanoSteps()[2]);
+#endif
     }
 
-    void testFoo()
+    void testWideGhostZones3D()
     {
 #ifdef LIBGEODECOMP_WITH_THREADS
-        std::cout << "fixme\n";
+        unsigned ghostZoneWidth = 4;
+        boost::shared_ptr<TestInitializer<TestCell<3> > > init3D(
+            new TestInitializer<TestCell<3> >(Coord<3>(20, 15, 30)));
+        CoordBox<3> box = init3D->gridBox();
+
+        std::vector<std::size_t> weights(1, box.dimensions.prod());
+        boost::shared_ptr<Partition<3> > partition(
+            new StripingPartition<3>(Coord<3>(), box.dimensions, 0, weights));
+
+        boost::shared_ptr<PartitionManager<Topology3D> > partitionManager3D(
+            new PartitionManager<Topology3D>());
+        partitionManager3D->resetRegions(box, partition, 0, ghostZoneWidth);
+        partitionManager3D->resetGhostZones(std::vector<CoordBox<3> >(1, box));
+
+        StepperType3D stepper3D(
+            partitionManager3D,
+            init3D,
+            StepperType3D::PatchAccepterVec(),
+            StepperType3D::PatchAccepterVec(),
+            StepperType3D::PatchProviderVec(),
+            StepperType3D::PatchProviderVec(),
+            false,
+            7);
+        TS_ASSERT_EQUALS(std::size_t(7), stepper3D.numSlices());
+
+        stepper3D.update(3);
+        TS_ASSERT_TEST_GRID(GridType3D, stepper3D.grid(), 3);
+
+        stepper3D.update(10);
+        TS_ASSERT_TEST_GRID(GridType3D, stepper3D.grid(), 13);
 #endif
     }
 
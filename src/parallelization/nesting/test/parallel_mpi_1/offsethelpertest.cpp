@@ -0,0 +1,43 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_OffsetHelperTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/offsethelpertest.h"
+
+static OffsetHelperTest suite_OffsetHelperTest;
+
+static CxxTest::List Tests_OffsetHelperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OffsetHelperTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/offsethelpertest.h", 11, "OffsetHelperTest", suite_OffsetHelperTest, Tests_OffsetHelperTest );
+
+static class TestDescription_suite_OffsetHelperTest_testTorus : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testTorus() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 14, "testTorus" ) {}
+ void runTest() { suite_OffsetHelperTest.testTorus(); }
+} testDescription_suite_OffsetHelperTest_testTorus;
+
+static class TestDescription_suite_OffsetHelperTest_testCube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OffsetHelperTest_testCube() : CxxTest::RealTestDescription( Tests_OffsetHelperTest, suiteDescription_OffsetHelperTest, 30, "testCube" ) {}
+ void runTest() { suite_OffsetHelperTest.testCube(); }
+} testDescription_suite_OffsetHelperTest_testCube;
+
@@ -0,0 +1,62 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_TemporalBlockingStepperTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/temporalblockingsteppertest.h"
+
+static TemporalBlockingStepperTest suite_TemporalBlockingStepperTest;
+
+static CxxTest::List Tests_TemporalBlockingStepperTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TemporalBlockingStepperTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/temporalblockingsteppertest.h", 13, "TemporalBlockingStepperTest", suite_TemporalBlockingStepperTest, Tests_TemporalBlockingStepperTest );
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testUpdateMultiple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testUpdateMultiple() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 46, "testUpdateMultiple" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testUpdateMultiple(); }
+} testDescription_suite_TemporalBlockingStepperTest_testUpdateMultiple;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testTiling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testTiling() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 60, "testTiling" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testTiling(); }
+} testDescription_suite_TemporalBlockingStepperTest_testTiling;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testInnerSetPatchAccepter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testInnerSetPatchAccepter() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 82, "testInnerSetPatchAccepter" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testInnerSetPatchAccepter(); }
+} testDescription_suite_TemporalBlockingStepperTest_testInnerSetPatchAccepter;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testPeriodicBoundaries3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testPeriodicBoundaries3D() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 95, "testPeriodicBoundaries3D" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testPeriodicBoundaries3D(); }
+} testDescription_suite_TemporalBlockingStepperTest_testPeriodicBoundaries3D;
+
+static class TestDescription_suite_TemporalBlockingStepperTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_TemporalBlockingStepperTest_testSoA() : CxxTest::RealTestDescription( Tests_TemporalBlockingStepperTest, suiteDescription_TemporalBlockingStepperTest, 121, "testSoA" ) {}
+ void runTest() { suite_TemporalBlockingStepperTest.testSoA(); }
+} testDescription_suite_TemporalBlockingStepperTest_testSoA;
+
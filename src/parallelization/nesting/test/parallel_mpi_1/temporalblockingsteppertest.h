@@ -0,0 +1,166 @@
+#include <cxxtest/TestSuite.h>
+
+#include <libgeodecomp.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/nesting/temporalblockingstepper.h>
+#include <libgeodecomp/storage/mockpatchaccepter.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class TemporalBlockingStepperTest : public CxxTest::TestSuite
+{
+public:
+    typedef APITraits::SelectTopology<TestCell<2> >::Value Topology;
+    typedef DisplacedGrid<TestCell<2>, Topology, true> GridType;
+    typedef APITraits::SelectTopology<TestCell<3> >::Value Topology3D;
+    typedef DisplacedGrid<TestCell<3>, Topology3D, true> GridType3D;
+    typedef TemporalBlockingStepper<TestCell<2>, UpdateFunctorHelpers::ConcurrencyNoP> StepperType;
+    typedef TemporalBlockingStepper<TestCell<3>, UpdateFunctorHelpers::ConcurrencyNoP> StepperType3D;
+    typedef TemporalBlockingStepper<TestCellSoA, UpdateFunctorHelpers::ConcurrencyNoP> StepperTypeSoA;
+
+    void setUp()
+    {
+        init.reset(new TestInitializer<TestCell<2> >(Coord<2>(30, 40)));
+
+        patchAccepter.reset(new MockPatchAccepter<GridType>());
+        patchAccepter->pushRequest(2);
+        patchAccepter->pushRequest(10);
+        patchAccepter->pushRequest(13);
+
+        stepper.reset(
+            new StepperType(
+                partitionManager<Topology>(init->gridBox(), 4),
+                init,
+                StepperType::PatchAccepterVec(),
+                StepperType::PatchAccepterVec(1, patchAccepter),
+                StepperType::PatchProviderVec(),
+                StepperType::PatchProviderVec(),
+                false,
+                // tiny cache, so we get many bands:
+                1));
+    }
+
+    void testUpdateMultiple()
+    {
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 0);
+
+        stepper->update(1);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 1);
+
+        stepper->update(7);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 8);
+
+        stepper->update(30);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 38);
+    }
+
+    void testTiling()
+    {
+        // innerSet(1) is 40 layers high, trapezoids for 4 nano steps
+        // need at least 6 layers:
+        const StepperType::Tiling& tiling = stepper->getTiling(1, 4);
+        TS_ASSERT_EQUALS(std::size_t(2 * 6), tiling.size());
+
+        for (std::size_t step = 0; step < 4; ++step) {
+            Region<2> region;
+            for (std::size_t i = 0; i < tiling.size(); ++i) {
+                TS_ASSERT((region & tiling[i][step]).empty());
+                region += tiling[i][step];
+            }
+            TS_ASSERT_EQUALS(stepper->innerSet(1 + step), region);
+        }
+
+        // blocking is pointless for single nano steps...
+        TS_ASSERT(stepper->getTiling(1, 1).empty());
+        // ...and impossible if the inner set is too thin:
+        TS_ASSERT(stepper->getTiling(1, 22).empty());
+    }
+
+    void testInnerSetPatchAccepter()
+    {
+        stepper->update(11);
+        TS_ASSERT_EQUALS(std::size_t(2), patchAccepter->getOfferedNanoSteps().size());
+        TS_ASSERT_EQUALS(std::size_t(2),  patchAccepter->getOfferedNanoSteps()[0]);
+        TS_ASSERT_EQUALS(std::size_t(10), patchAccepter->getOfferedNanoSteps()[1]);
+
+        stepper->update(2);
+        TS_ASSERT_EQUALS(std::size_t(3), patchAccepter->getOfferedNanoSteps().size());
+        TS_ASSERT_EQUALS(std::size_t(13), patchAccepter->getOfferedNanoSteps()[2]);
+        TS_ASSERT_TEST_GRID(GridType, stepper->grid(), 13);
+    }
+
+    void testPeriodicBoundaries3D()
+    {
+        // TestCell<3> lives on a torus, so the bands at the bottom
+        // and top depend on each other:
+        boost::shared_ptr<TestInitializer<TestCell<3> > > init3D(
+            new TestInitializer<TestCell<3> >(Coord<3>(20, 15, 30)));
+
+        StepperType3D stepper3D(
+            partitionManager<Topology3D>(init3D->gridBox(), 3),
+            init3D,
+            StepperType3D::PatchAccepterVec(),
+            StepperType3D::PatchAccepterVec(),
+            StepperType3D::PatchProviderVec(),
+            StepperType3D::PatchProviderVec(),
+            false,
+            20 * 15 * 8 * sizeof(TestCell<3>));
+
+        TS_ASSERT_LESS_THAN(std::size_t(2), stepper3D.getTiling(1, 3).size());
+
+        stepper3D.update(3);
+        TS_ASSERT_TEST_GRID(GridType3D, stepper3D.grid(), 3);
+
+        stepper3D.update(10);
+        TS_ASSERT_TEST_GRID(GridType3D, stepper3D.grid(), 13);
+    }
+
+    void testSoA()
+    {
+        typedef StepperTypeSoA::GridType GridTypeSoA;
+
+        boost::shared_ptr<TestInitializer<TestCellSoA> > initSoA(
+            new TestInitializer<TestCellSoA>(Coord<3>(20, 15, 30)));
+
+        StepperTypeSoA stepperSoA(
+            partitionManager<StepperTypeSoA::Topology>(initSoA->gridBox(), 4),
+            initSoA,
+            StepperTypeSoA::PatchAccepterVec(),
+            StepperTypeSoA::PatchAccepterVec(),
+            StepperTypeSoA::PatchProviderVec(),
+            StepperTypeSoA::PatchProviderVec(),
+            false,
+            1);
+
+        stepperSoA.update(5);
+        TS_ASSERT_TEST_GRID(GridTypeSoA, stepperSoA.grid(), 5);
+
+        stepperSoA.update(12);
+        TS_ASSERT_TEST_GRID(GridTypeSoA, stepperSoA.grid(), 17);
+    }
+
+private:
+    boost::shared_ptr<TestInitializer<TestCell<2> > > init;
+    boost::shared_ptr<StepperType> stepper;
+    boost::shared_ptr<MockPatchAccepter<GridType> > patchAccepter;
+
+    template<typename TOPOLOGY>
+    boost::shared_ptr<PartitionManager<TOPOLOGY> > partitionManager(
+        const CoordBox<TOPOLOGY::DIM>& box, unsigned ghostZoneWidth)
+    {
+        const int DIM = TOPOLOGY::DIM;
+        std::vector<std::size_t> weights(1, box.dimensions.prod());
+        boost::shared_ptr<Partition<DIM> > partition(
+            new StripingPartition<DIM>(Coord<DIM>(), box.dimensions, 0, weights));
+
+        boost::shared_ptr<PartitionManager<TOPOLOGY> > ret(new PartitionManager<TOPOLOGY>());
+        ret->resetRegions(box, partition, 0, ghostZoneWidth);
+        ret->resetGhostZones(std::vector<CoordBox<DIM> >(1, box));
+        return ret;
+    }
+};
+
+}
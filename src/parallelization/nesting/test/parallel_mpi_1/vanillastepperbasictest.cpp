@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_VanillaStepperBasicTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/vanillastepperbasictest.h"
+
+static VanillaStepperBasicTest suite_VanillaStepperBasicTest;
+
+static CxxTest::List Tests_VanillaStepperBasicTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_VanillaStepperBasicTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/vanillastepperbasictest.h", 13, "VanillaStepperBasicTest", suite_VanillaStepperBasicTest, Tests_VanillaStepperBasicTest );
+
+static class TestDescription_suite_VanillaStepperBasicTest_testUpdate1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaStepperBasicTest_testUpdate1() : CxxTest::RealTestDescription( Tests_VanillaStepperBasicTest, suiteDescription_VanillaStepperBasicTest, 36, "testUpdate1" ) {}
+ void runTest() { suite_VanillaStepperBasicTest.testUpdate1(); }
+} testDescription_suite_VanillaStepperBasicTest_testUpdate1;
+
+static class TestDescription_suite_VanillaStepperBasicTest_testUpdateMultiple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaStepperBasicTest_testUpdateMultiple() : CxxTest::RealTestDescription( Tests_VanillaStepperBasicTest, suiteDescription_VanillaStepperBasicTest, 43, "testUpdateMultiple" ) {}
+ void runTest() { suite_VanillaStepperBasicTest.testUpdateMultiple(); }
+} testDescription_suite_VanillaStepperBasicTest_testUpdateMultiple;
+
+static class TestDescription_suite_VanillaStepperBasicTest_testPutPatch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaStepperBasicTest_testPutPatch() : CxxTest::RealTestDescription( Tests_VanillaStepperBasicTest, suiteDescription_VanillaStepperBasicTest, 51, "testPutPatch" ) {}
+ void runTest() { suite_VanillaStepperBasicTest.testPutPatch(); }
+} testDescription_suite_VanillaStepperBasicTest_testPutPatch;
+
@@ -0,0 +1,38 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_VanillaStepperRegionTest_init = false;
+#include "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/vanillastepperregiontest.h"
+
+static VanillaStepperRegionTest suite_VanillaStepperRegionTest;
+
+static CxxTest::List Tests_VanillaStepperRegionTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_VanillaStepperRegionTest( "/root/repo/src/parallelization/nesting/test/parallel_mpi_1/vanillastepperregiontest.h", 43, "VanillaStepperRegionTest", suite_VanillaStepperRegionTest, Tests_VanillaStepperRegionTest );
+
+static class TestDescription_suite_VanillaStepperRegionTest_testUpdate1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_VanillaStepperRegionTest_testUpdate1() : CxxTest::RealTestDescription( Tests_VanillaStepperRegionTest, suiteDescription_VanillaStepperRegionTest, 81, "testUpdate1" ) {}
+ void runTest() { suite_VanillaStepperRegionTest.testUpdate1(); }
+} testDescription_suite_VanillaStepperRegionTest_testUpdate1;
+
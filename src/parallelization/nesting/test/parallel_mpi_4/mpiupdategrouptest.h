@@ -62,6 +62,47 @@ public:
         TS_ASSERT_EQUALS(actualNanoSteps, expectedNanoSteps);
     }
 
+    void testSparseNeighborDiscovery()
+    {
+        // a separate communicator keeps the PatchLinks of both
+        // UpdateGroups apart:
+        MPI_Comm communicator;
+        MPI_Comm_dup(MPI_COMM_WORLD, &communicator);
+        MPIUpdateGroupOptions options;
+        options.sparseNeighborDiscovery = true;
+
+        boost::shared_ptr<UpdateGroupType> sparseUpdateGroup(
+            new UpdateGroupType(
+                partition,
+                CoordBox<2>(Coord<2>(), dimensions),
+                ghostZoneWidth,
+                init,
+                reinterpret_cast<StepperType*>(0),
+                UpdateGroupType::PatchAccepterVec(),
+                UpdateGroupType::PatchAccepterVec(),
+                UpdateGroupType::PatchProviderVec(),
+                UpdateGroupType::PatchProviderVec(),
+                communicator,
+                options));
+
+        TS_ASSERT_EQUALS(
+            updateGroup->partitionManager->getOuterGhostZoneFragments(),
+            sparseUpdateGroup->partitionManager->getOuterGhostZoneFragments());
+        TS_ASSERT_EQUALS(
+            updateGroup->partitionManager->getInnerGhostZoneFragments(),
+            sparseUpdateGroup->partitionManager->getInnerGhostZoneFragments());
+
+        updateGroup->update(20);
+        sparseUpdateGroup->update(20);
+        const Region<2>& region = updateGroup->partitionManager->ownRegion();
+        for (Region<2>::Iterator i = region.begin(); i != region.end(); ++i) {
+            TS_ASSERT_EQUALS(updateGroup->grid().get(*i), sparseUpdateGroup->grid().get(*i));
+        }
+
+        sparseUpdateGroup.reset();
+        MPI_Comm_free(&communicator);
+    }
+
 private:
     std::deque<std::size_t> expectedNanoSteps;
     unsigned rank;
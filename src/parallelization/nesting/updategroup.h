@@ -70,9 +70,22 @@ public:
         }
     }
 
-    const Chronometer& statistics() const
+    /**
+     * Returns the accumulated timings of the current Stepper and of
+     * all Steppers which were retired by a repartitioning.
+     */
+    Chronometer statistics() const
     {
-        return stepper->statistics();
+        return retiredStatistics + stepper->statistics();
+    }
+
+    /**
+     * Returns the streak timings recorded by the current Stepper,
+     * i.e. since the last repartitioning.
+     */
+    const CostMap<DIM>& costs() const
+    {
+        return stepper->costs();
     }
 
     void addPatchProvider(
@@ -109,6 +122,11 @@ public:
         return partitionManager->getWeights();
     }
 
+    inline const std::vector<std::size_t>& getStartOffsets() const
+    {
+        return partitionManager->getStartOffsets();
+    }
+
     inline double computeTimeInner() const
     {
         return stepper->computeTimeInner;
@@ -136,6 +154,12 @@ protected:
     unsigned ghostZoneWidth;
     boost::shared_ptr<Initializer<CELL_TYPE> > initializer;
     unsigned rank;
+    CoordBox<DIM> box;
+    PatchAccepterVec patchAcceptersGhost;
+    PatchAccepterVec patchAcceptersInner;
+    PatchProviderVec patchProvidersGhost;
+    PatchProviderVec patchProvidersInner;
+    Chronometer retiredStatistics;
 
     /**
      * Actual initialization of the UpdateGroup, can't be done in
@@ -155,20 +179,61 @@ protected:
         PatchAccepterVec patchAcceptersInner,
         PatchProviderVec patchProvidersGhost,
         PatchProviderVec patchProvidersInner)
+    {
+        this->box = box;
+        this->patchAcceptersGhost = patchAcceptersGhost;
+        this->patchAcceptersInner = patchAcceptersInner;
+        this->patchProvidersGhost = patchProvidersGhost;
+        this->patchProvidersInner = patchProvidersInner;
+
+        resetPartitionManager(partition);
+
+        long firstSyncPoint =
+            initializer->startStep() * APITraits::SelectNanoSteps<CELL_TYPE>::VALUE +
+            ghostZoneWidth;
+        initPatchLinksAndStepper(firstSyncPoint, this->initializer, stepperType);
+    }
+
+    /**
+     * (Re-)computes the PartitionManager's regions and ghost zone
+     * fragments for the given partition. Needs to be called
+     * collectively as the bounding boxes of all subdomains are
+     * gathered.
+     */
+    void resetPartitionManager(boost::shared_ptr<Partition<DIM> > partition)
     {
         partitionManager->resetRegions(
             box,
             partition,
             rank,
             ghostZoneWidth);
+        resetGhostZones(partition);
+    }
+
+    /**
+     * Computes the PartitionManager's ghost zone fragments, based on
+     * the gathered bounding boxes of all subdomains. Derived classes
+     * may override this to determine neighbors more economically.
+     */
+    virtual void resetGhostZones(boost::shared_ptr<Partition<DIM> > partition)
+    {
         std::vector<CoordBox<DIM> > boundingBoxes =
             gatherBoundingBoxes(partitionManager->ownRegion().boundingBox(), partition);
         partitionManager->resetGhostZones(boundingBoxes);
+    }
 
-        long firstSyncPoint =
-            initializer->startStep() * APITraits::SelectNanoSteps<CELL_TYPE>::VALUE +
-            ghostZoneWidth;
-
+    /**
+     * Sets up the PatchLinks according to the current
+     * PartitionManager and creates a new Stepper which will pull its
+     * initial grid from stepperInitializer. The links will first
+     * synchronize at firstSyncPoint.
+     */
+    template<typename STEPPER>
+    void initPatchLinksAndStepper(
+        long firstSyncPoint,
+        boost::shared_ptr<Initializer<CELL_TYPE> > stepperInitializer,
+        STEPPER * /* stepperType */)
+    {
         // We need to create the patch providers first, as the HPX patch
         // accepters will look up their IDs upon creation:
         PatchProviderVec patchLinkProviders;
@@ -228,7 +293,7 @@ protected:
 
         stepper.reset(new STEPPER(
                           partitionManager,
-                          this->initializer,
+                          stepperInitializer,
                           patchAcceptersGhost + ghostZoneAccepterLinks,
                           patchAcceptersInner,
                           // add external PatchProviders last to allow them to override
@@ -33,12 +33,15 @@ public:
     typedef PatchBufferFixed<GridType, GridType, 2> PatchBufferType2;
     typedef typename ParentType::PatchAccepterVec PatchAccepterVec;
     typedef typename ParentType::PatchProviderVec PatchProviderVec;
+    typedef typename ParentType::PatchAccepterList PatchAccepterList;
+    typedef typename ParentType::PatchProviderList PatchProviderList;
 
     using ParentType::initializer;
     using ParentType::patchAccepters;
     using ParentType::patchProviders;
     using ParentType::partitionManager;
     using ParentType::chronometer;
+    using ParentType::costMap;
     using ParentType::notifyPatchAccepters;
     using ParentType::notifyPatchProviders;
 
@@ -85,24 +88,43 @@ public:
         initGrids();
     }
 
-private:
+protected:
+    /**
+     * Tag for derived classes which need to set up their own state
+     * (e.g. allocate the grids) before calling initGrids() themselves.
+     */
+    class DeferInitGrids
+    {};
+
+    inline VanillaStepper(
+        boost::shared_ptr<PartitionManagerType> partitionManager,
+        boost::shared_ptr<Initializer<CELL_TYPE> > initializer,
+        const PatchAccepterVec& ghostZonePatchAccepters,
+        const PatchAccepterVec& innerSetPatchAccepters,
+        const PatchProviderVec& ghostZonePatchProviders,
+        const PatchProviderVec& innerSetPatchProviders,
+        bool enableFineGrainedParallelism,
+        DeferInitGrids) :
+        ParentType(
+            partitionManager,
+            initializer,
+            ghostZonePatchAccepters,
+            innerSetPatchAccepters,
+            ghostZonePatchProviders,
+            innerSetPatchProviders,
+            enableFineGrainedParallelism)
+    {}
+
     inline void update1()
     {
         using std::swap;
         TimeTotal t(&chronometer);
+        ScopedTrace trace("stepper", "nano_step", -1, 0, globalNanoStep());
         unsigned index = ghostZoneWidth() - --validGhostZoneWidth;
-        const Region<DIM>& region = innerSet(index);
+        updateInnerSet(index);
+
         {
             TimeComputeInner t(&chronometer);
-
-            UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
-                region,
-                Coord<DIM>(),
-                Coord<DIM>(),
-                *oldGrid,
-                &*newGrid,
-                curNanoStep,
-                CONCURRENCY_SPEC(false, enableFineGrainedParallelism));
             swap(oldGrid, newGrid);
 
             ++curNanoStep;
@@ -112,6 +134,48 @@ private:
             }
         }
 
+        finishInnerSetUpdate();
+    }
+
+    /**
+     * Returns the number of nano steps which may be computed en bloc,
+     * i.e. without the need to synchronize the ghost zones or to
+     * notify any of the inner set PatchAccepters or PatchProviders
+     * in between.
+     */
+    inline std::size_t nanoStepsToNextInnerSetEvent(std::size_t maxHop)
+    {
+        std::size_t hop = (std::min)(maxHop, std::size_t(validGhostZoneWidth));
+        std::size_t now = globalNanoStep();
+
+        for (typename PatchAccepterList::iterator i = patchAccepters[ParentType::INNER_SET].begin();
+             i != patchAccepters[ParentType::INNER_SET].end();
+             ++i) {
+            std::size_t next = (*i)->nextRequiredNanoStep();
+            if (next > now) {
+                hop = (std::min)(hop, next - now);
+            }
+        }
+
+        for (typename PatchProviderList::iterator i = patchProviders[ParentType::INNER_SET].begin();
+             i != patchProviders[ParentType::INNER_SET].end();
+             ++i) {
+            std::size_t next = (*i)->nextAvailableNanoStep();
+            if (next > now) {
+                hop = (std::min)(hop, next - now);
+            }
+        }
+
+        return (std::max)(hop, std::size_t(1));
+    }
+
+    /**
+     * Hands the freshly updated inner set to the PatchAccepters,
+     * updates the ghost zone if required and lets the PatchProviders
+     * modify the cells which will be updated next.
+     */
+    inline void finishInnerSetUpdate()
+    {
         notifyPatchAccepters(innerSet(ghostZoneWidth()), ParentType::INNER_SET, globalNanoStep());
 
         if (validGhostZoneWidth == 0) {
@@ -119,11 +183,31 @@ private:
             resetValidGhostZoneWidth();
         }
 
-        index = ghostZoneWidth() - validGhostZoneWidth;
+        unsigned index = ghostZoneWidth() - validGhostZoneWidth;
         const Region<DIM>& nextRegion = innerSet(index);
         notifyPatchProviders(nextRegion, ParentType::INNER_SET, globalNanoStep());
     }
 
+    /**
+     * Updates innerSet(index) from oldGrid to newGrid. Derived
+     * classes may override this to interleave the update with other
+     * tasks.
+     */
+    virtual void updateInnerSet(unsigned index)
+    {
+        TimeComputeInner t(&chronometer);
+
+        UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC> updateFunctor(&costMap);
+        updateFunctor(
+            innerSet(index),
+            Coord<DIM>(),
+            Coord<DIM>(),
+            *oldGrid,
+            &*newGrid,
+            curNanoStep,
+            CONCURRENCY_SPEC(false, enableFineGrainedParallelism));
+    }
+
     inline void initGrids()
     {
         initGridsCommon();
@@ -180,7 +264,8 @@ private:
                 TimeComputeGhost timer(&chronometer);
 
                 const Region<DIM>& region = rim(t + 1);
-                UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC>()(
+                UpdateFunctor<CELL_TYPE, CONCURRENCY_SPEC> updateFunctor(&costMap);
+                updateFunctor(
                     region,
                     Coord<DIM>(),
                     Coord<DIM>(),
@@ -0,0 +1,159 @@
+#ifndef LIBGEODECOMP_PARALLELIZATION_ONLINETUNER_H
+#define LIBGEODECOMP_PARALLELIZATION_ONLINETUNER_H
+
+#include <libgeodecomp/io/logger.h>
+#include <libgeodecomp/misc/chronometer.h>
+#include <libgeodecomp/misc/optimizer.h>
+#include <libgeodecomp/misc/patternoptimizer.h>
+#include <libgeodecomp/misc/simulationparameters.h>
+
+#include <limits>
+#include <stdexcept>
+
+namespace LibGeoDecomp {
+
+/**
+ * The OnlineTuner optimizes the parameters of a live simulation,
+ * instead of conducting a separate tuning phase with throwaway
+ * simulations (see AutoTuningSimulator). Each evaluation of a
+ * parameter set applies the parameters to the simulator and advances
+ * it by a window of time steps. The fitness is the negative average
+ * compute time per step as recorded by the simulator's Chronometer,
+ * so Writers and Steerers don't skew the results.
+ *
+ * SIMULATOR needs to provide tunableParameters(),
+ * applyParameters() and step(SteererFeedback*), which must perform
+ * exactly one time step. As the Optimizer drives the evaluations,
+ * the tuner is to be invoked between time steps from the simulator's
+ * run(), not from step(), e.g. by overriding
+ * SerialSimulator::beforeStep() as OpenMPSimulator does.
+ */
+template<typename SIMULATOR, typename OPTIMIZER_TYPE = PatternOptimizer>
+class OnlineTuner
+{
+public:
+    typedef typename SIMULATOR::SteererFeedback SteererFeedback;
+
+    /**
+     * Evaluates parameter sets by running the live simulation for
+     * windowSteps time steps. Once the simulation has ended, all
+     * parameter sets yield the lowest possible fitness, so that the
+     * Optimizer will stick with the best parameters found so far.
+     */
+    class Evaluator : public Optimizer::Evaluator
+    {
+    public:
+        Evaluator(SIMULATOR *sim, SteererFeedback *feedback, unsigned windowSteps) :
+            sim(sim),
+            feedback(feedback),
+            windowSteps(windowSteps),
+            evaluations(0)
+        {}
+
+        double operator()(const SimulationParameters& params)
+        {
+            sim->applyParameters(params);
+            double startTime = sim->gatherStatistics()[0].template interval<TimeCompute>();
+
+            unsigned steps = 0;
+            for (; (steps < windowSteps) && !simulationEnded(); ++steps) {
+                sim->step(feedback);
+            }
+
+            if (steps == 0) {
+                return -std::numeric_limits<double>::max();
+            }
+
+            ++evaluations;
+            double time = sim->gatherStatistics()[0].template interval<TimeCompute>() - startTime;
+            return -time / steps;
+        }
+
+        bool simulationEnded() const
+        {
+            return
+                feedback->simulationEnded() ||
+                (sim->getStep() >= sim->getInitializer()->maxSteps());
+        }
+
+        unsigned getEvaluations() const
+        {
+            return evaluations;
+        }
+
+    private:
+        SIMULATOR *sim;
+        SteererFeedback *feedback;
+        unsigned windowSteps;
+        unsigned evaluations;
+    };
+
+    explicit
+    OnlineTuner(unsigned windowSteps = 10, unsigned optimizerSteps = 10) :
+        windowSteps(windowSteps),
+        optimizerSteps(optimizerSteps),
+        finished(false),
+        fitness(-std::numeric_limits<double>::max()),
+        evaluations(0)
+    {
+        if (windowSteps == 0) {
+            throw std::invalid_argument("OnlineTuner needs at least one step per evaluation");
+        }
+    }
+
+    /**
+     * Runs the Optimizer, which in turn advances the simulation until
+     * it has converged (or the simulation has ended). The best
+     * parameters found are applied to sim and returned.
+     */
+    SimulationParameters operator()(SIMULATOR *sim, SteererFeedback *feedback)
+    {
+        Evaluator eval(sim, feedback, windowSteps);
+        OPTIMIZER_TYPE optimizer(sim->tunableParameters());
+        SimulationParameters best = optimizer(optimizerSteps, eval);
+
+        sim->applyParameters(best);
+        finished = true;
+        fitness = optimizer.getFitness();
+        evaluations = eval.getEvaluations();
+        LOG(Logger::INFO, "online tuning finished after " << evaluations
+            << " evaluations, fitness: " << fitness << ", parameters: " << best);
+
+        return best;
+    }
+
+    bool isFinished() const
+    {
+        return finished;
+    }
+
+    /**
+     * Restarts tuning before the next time step of the simulator's
+     * run(), e.g. because the model's behavior has changed.
+     */
+    void reset()
+    {
+        finished = false;
+    }
+
+    double getFitness() const
+    {
+        return fitness;
+    }
+
+    unsigned getEvaluations() const
+    {
+        return evaluations;
+    }
+
+private:
+    unsigned windowSteps;
+    unsigned optimizerSteps;
+    bool finished;
+    double fitness;
+    unsigned evaluations;
+};
+
+}
+
+#endif
@@ -6,15 +6,23 @@
 
 #include <libgeodecomp/communication/hpxserializationwrapper.h>
 #include <libgeodecomp/io/writer.h>
+#include <libgeodecomp/misc/simulationparameters.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/parallelization/onlinetuner.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
 #include <libgeodecomp/storage/gridtypeselector.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
 namespace LibGeoDecomp {
 
 /**
  * OpenMPSimulator is based on SerialSimulator, but is capable of
- * threading via OpenMP.
+ * threading via OpenMP. Its threading parameters can be tuned while
+ * the simulation is running, see enableOnlineTuning().
  */
 template<typename CELL_TYPE>
 class OpenMPSimulator : public SerialSimulator<CELL_TYPE>
@@ -27,6 +35,7 @@ public:
     typedef typename APITraits::SelectSoA<CELL_TYPE>::Value SupportsSoA;
     typedef typename GridTypeSelector<CELL_TYPE, Topology, false, SupportsSoA>::Value GridType;
     typedef typename Steerer<CELL_TYPE>::SteererFeedback SteererFeedback;
+    typedef OnlineTuner<OpenMPSimulator<CELL_TYPE> > OnlineTunerType;
 
     static const int DIM = Topology::DIM;
 
@@ -49,17 +58,87 @@ public:
         Initializer<CELL_TYPE> *initializer,
         bool enableFineGrainedParallelism = false) :
         SerialSimulator<CELL_TYPE>(initializer),
-        enableFineGrainedParallelism(enableFineGrainedParallelism)
+        enableFineGrainedParallelism(enableFineGrainedParallelism),
+        numThreads(0)
     {}
 
+    /**
+     * Lets an OnlineTuner adjust the parameters returned by
+     * tunableParameters() during run(): before its next time step,
+     * run() hands control to the tuner, which advances the simulation
+     * by windowSteps time steps per evaluated parameter set until the
+     * Optimizer has converged or the simulation has ended. step()
+     * isn't affected and always performs exactly one time step.
+     */
+    void enableOnlineTuning(unsigned windowSteps = 10, unsigned optimizerSteps = 10)
+    {
+        tuner.reset(new OnlineTunerType(windowSteps, optimizerSteps));
+    }
+
+    /**
+     * Parameters which may be changed between time steps, set to
+     * their current values.
+     */
+    SimulationParameters tunableParameters() const
+    {
+        SimulationParameters params;
+        std::vector<bool> flags;
+        flags << false
+              << true;
+        params.addParameter("EnableFineGrainedParallelism", flags);
+        params["EnableFineGrainedParallelism"].setValue(enableFineGrainedParallelism);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        int maxThreads = omp_get_max_threads();
+        params.addParameter("Threads", 1, maxThreads + 1);
+        params["Threads"].setValue((numThreads ? numThreads : maxThreads) - 1);
+#endif
+
+        return params;
+    }
+
+    void applyParameters(const SimulationParameters& params)
+    {
+        bool fineGrained = params["EnableFineGrainedParallelism"];
+        enableFineGrainedParallelism = fineGrained;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        int threads = params["Threads"];
+        numThreads = threads;
+#endif
+    }
+
 protected:
     bool enableFineGrainedParallelism;
+    // 0 means OpenMP's default number of threads
+    int numThreads;
+    boost::shared_ptr<OnlineTunerType> tuner;
+
+    /**
+     * Hands control to the tuner until it's done.
+     */
+    virtual bool beforeStep(SteererFeedback *feedback)
+    {
+        if (!tuner || tuner->isFinished()) {
+            return false;
+        }
+
+        (*tuner)(this, feedback);
+        return true;
+    }
 
     void nanoStep(unsigned nanoStep)
     {
         using std::swap;
         TimeCompute t(&chronometer);
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+        int defaultThreads = omp_get_max_threads();
+        if (numThreads) {
+            omp_set_num_threads(numThreads);
+        }
+#endif
+
         UpdateFunctor<CELL_TYPE, UpdateFunctorHelpers::ConcurrencyEnableOpenMP>()(
             simArea,
             Coord<DIM>(),
@@ -68,6 +147,13 @@ protected:
             newGrid,
             nanoStep,
             UpdateFunctorHelpers::ConcurrencyEnableOpenMP(true, enableFineGrainedParallelism));
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        if (numThreads) {
+            omp_set_num_threads(defaultThreads);
+        }
+#endif
+
         swap(curGrid, newGrid);
     }
 
@@ -106,6 +106,10 @@ public:
                 break;
             }
 
+            if (beforeStep(&feedback)) {
+                continue;
+            }
+
             step(&feedback);
         }
 
@@ -126,6 +130,17 @@ protected:
     GridType *newGrid;
     Region<DIM> simArea;
 
+    /**
+     * Called by run() before each time step. Derived classes may
+     * advance the simulation on their own here (e.g. to tune their
+     * parameters). In that case they return true and run() re-checks
+     * its exit conditions instead of calling step().
+     */
+    virtual bool beforeStep(SteererFeedback * /* feedback */)
+    {
+        return false;
+    }
+
     virtual void nanoStep(unsigned nanoStep)
     {
         using std::swap;
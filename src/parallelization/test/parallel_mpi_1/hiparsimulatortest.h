@@ -54,6 +54,21 @@ public:
         s.reset();
     }
 
+    void testUpdateGroupOptions()
+    {
+        s->setPatchLinkDepth(3);
+        s->enableZeroCopyPatchLinks();
+        s->enableSparseNeighborDiscovery();
+        TS_ASSERT_EQUALS(std::size_t(3), s->updateGroupOptions.patchLinkDepth);
+        TS_ASSERT(s->updateGroupOptions.zeroCopyPatchLinks);
+        TS_ASSERT(s->updateGroupOptions.sparseNeighborDiscovery);
+
+        s->step();
+        TS_ASSERT_EQUALS(std::size_t(3), s->updateGroup->options.patchLinkDepth);
+        TS_ASSERT_THROWS(s->setPatchLinkDepth(1), std::logic_error&);
+        TS_ASSERT_THROWS(s->enableZeroCopyPatchLinks(false), std::logic_error&);
+    }
+
     void testInitialWeights()
     {
         std::vector<double> rankSpeeds;
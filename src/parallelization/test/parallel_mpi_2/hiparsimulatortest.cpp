@@ -0,0 +1,43 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_2/hiparsimulatortest.h"
+
+static HiParSimulatorTest suite_HiParSimulatorTest;
+
+static CxxTest::List Tests_HiParSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_2/hiparsimulatortest.h", 14, "HiParSimulatorTest", suite_HiParSimulatorTest, Tests_HiParSimulatorTest );
+
+static class TestDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks2D() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 17, "testZeroCopyPatchLinks2D" ) {}
+ void runTest() { suite_HiParSimulatorTest.testZeroCopyPatchLinks2D(); }
+} testDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks2D;
+
+static class TestDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks3D() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 26, "testZeroCopyPatchLinks3D" ) {}
+ void runTest() { suite_HiParSimulatorTest.testZeroCopyPatchLinks3D(); }
+} testDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks3D;
+
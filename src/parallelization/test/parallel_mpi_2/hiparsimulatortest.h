@@ -0,0 +1,71 @@
+#include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/io/parallelmemorywriter.h>
+#include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/misc/testcell.h>
+#include <libgeodecomp/misc/testhelper.h>
+#include <libgeodecomp/parallelization/hiparsimulator.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class HiParSimulatorTest : public CxxTest::TestSuite
+{
+public:
+    void testZeroCopyPatchLinks2D()
+    {
+        for (unsigned ghostZoneWidth = 1; ghostZoneWidth <= 3; ++ghostZoneWidth) {
+            for (unsigned depth = 1; depth <= 2; ++depth) {
+                checkZeroCopyPatchLinks(Coord<2>(31, 27), ghostZoneWidth, depth);
+            }
+        }
+    }
+
+    void testZeroCopyPatchLinks3D()
+    {
+        // TestCell<3> lives on a torus, so some of the ghost zones
+        // wrap around the grid's boundary and can't be sent directly
+        // from the grid:
+        for (unsigned ghostZoneWidth = 1; ghostZoneWidth <= 2; ++ghostZoneWidth) {
+            checkZeroCopyPatchLinks(Coord<3>(13, 11, 9), ghostZoneWidth, 2);
+        }
+    }
+
+private:
+    template<int DIM>
+    void checkZeroCopyPatchLinks(
+        const Coord<DIM>& dim,
+        unsigned ghostZoneWidth,
+        unsigned depth)
+    {
+        typedef TestCell<DIM> CELL;
+        typedef HiParSimulator<CELL, ZCurvePartition<DIM> > SimulatorType;
+        typedef ParallelMemoryWriter<CELL> MemoryWriterType;
+        typedef typename MemoryWriterType::GridType GridType;
+        const unsigned NANO_STEPS = APITraits::SelectNanoSteps<CELL>::VALUE;
+
+        unsigned maxSteps = 7;
+        SimulatorType sim(
+            new TestInitializer<CELL>(dim, maxSteps),
+            0,
+            1,
+            ghostZoneWidth);
+        sim.setPatchLinkDepth(depth);
+        sim.enableZeroCopyPatchLinks();
+        MemoryWriterType *writer = new MemoryWriterType(1);
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned t = 0; t <= maxSteps; ++t) {
+            TS_ASSERT_TEST_GRID2(
+                GridType,
+                writer->getGrids()[t],
+                t * NANO_STEPS,
+                typename);
+        }
+    }
+};
+
+}
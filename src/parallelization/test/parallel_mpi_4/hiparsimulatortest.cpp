@@ -0,0 +1,273 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_HiParSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_mpi_4/hiparsimulatortest.h"
+
+static HiParSimulatorTest suite_HiParSimulatorTest;
+
+static CxxTest::List Tests_HiParSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HiParSimulatorTest( "/root/repo/src/parallelization/test/parallel_mpi_4/hiparsimulatortest.h", 149, "HiParSimulatorTest", suite_HiParSimulatorTest, Tests_HiParSimulatorTest );
+
+static class TestDescription_suite_HiParSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 191, "testStep" ) {}
+ void runTest() { suite_HiParSimulatorTest.testStep(); }
+} testDescription_suite_HiParSimulatorTest_testStep;
+
+static class TestDescription_suite_HiParSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 224, "testRun" ) {}
+ void runTest() { suite_HiParSimulatorTest.testRun(); }
+} testDescription_suite_HiParSimulatorTest_testRun;
+
+static class TestDescription_suite_HiParSimulatorTest_testLoadBalancing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testLoadBalancing() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 263, "testLoadBalancing" ) {}
+ void runTest() { suite_HiParSimulatorTest.testLoadBalancing(); }
+} testDescription_suite_HiParSimulatorTest_testLoadBalancing;
+
+static class TestDescription_suite_HiParSimulatorTest_testCostSampling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testCostSampling() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 297, "testCostSampling" ) {}
+ void runTest() { suite_HiParSimulatorTest.testCostSampling(); }
+} testDescription_suite_HiParSimulatorTest_testCostSampling;
+
+static class TestDescription_suite_HiParSimulatorTest_testCostSamplingWithMultiCoreStepper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testCostSamplingWithMultiCoreStepper() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 302, "testCostSamplingWithMultiCoreStepper" ) {}
+ void runTest() { suite_HiParSimulatorTest.testCostSamplingWithMultiCoreStepper(); }
+} testDescription_suite_HiParSimulatorTest_testCostSamplingWithMultiCoreStepper;
+
+static class TestDescription_suite_HiParSimulatorTest_testCostSamplingWithOverlappingStepper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testCostSamplingWithOverlappingStepper() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 309, "testCostSamplingWithOverlappingStepper" ) {}
+ void runTest() { suite_HiParSimulatorTest.testCostSamplingWithOverlappingStepper(); }
+} testDescription_suite_HiParSimulatorTest_testCostSamplingWithOverlappingStepper;
+
+static class TestDescription_suite_HiParSimulatorTest_testRepartitioningThreshold : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testRepartitioningThreshold() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 314, "testRepartitioningThreshold" ) {}
+ void runTest() { suite_HiParSimulatorTest.testRepartitioningThreshold(); }
+} testDescription_suite_HiParSimulatorTest_testRepartitioningThreshold;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 346, "testSteererCallback" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererCallback(); }
+} testDescription_suite_HiParSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 370, "testSteererFunctionalityBasic" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionalityBasic(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionalityBasic;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 386, "testSteererFunctionality2DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 405, "testSteererFunctionality2DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 424, "testSteererFunctionality2DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 443, "testSteererFunctionality2DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 462, "testSteererFunctionality2DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 481, "testSteererFunctionality2DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality2DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality2DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 500, "testSteererFunctionality3DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 519, "testSteererFunctionality3DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 538, "testSteererFunctionality3DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 557, "testSteererFunctionality3DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 576, "testSteererFunctionality3DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 595, "testSteererFunctionality3DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testSteererFunctionality3DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testSteererFunctionality3DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 614, "testWriterFunctionality2DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 676, "testWriterFunctionality2DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 738, "testWriterFunctionality2DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 800, "testWriterFunctionality2DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 862, "testWriterFunctionality2DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 924, "testWriterFunctionality2DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality2DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality2DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth1() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 986, "testWriterFunctionality3DWithGhostZoneWidth1" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth1(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth1;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth2() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1048, "testWriterFunctionality3DWithGhostZoneWidth2" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth2(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth2;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth3() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1110, "testWriterFunctionality3DWithGhostZoneWidth3" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth3(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth3;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth4() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1184, "testWriterFunctionality3DWithGhostZoneWidth4" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth4(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth4;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth5() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1246, "testWriterFunctionality3DWithGhostZoneWidth5" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth5(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth5;
+
+static class TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth6() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1308, "testWriterFunctionality3DWithGhostZoneWidth6" ) {}
+ void runTest() { suite_HiParSimulatorTest.testWriterFunctionality3DWithGhostZoneWidth6(); }
+} testDescription_suite_HiParSimulatorTest_testWriterFunctionality3DWithGhostZoneWidth6;
+
+static class TestDescription_suite_HiParSimulatorTest_testParallelWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testParallelWriterInvocation() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1370, "testParallelWriterInvocation" ) {}
+ void runTest() { suite_HiParSimulatorTest.testParallelWriterInvocation(); }
+} testDescription_suite_HiParSimulatorTest_testParallelWriterInvocation;
+
+static class TestDescription_suite_HiParSimulatorTest_testOverlappingStepper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testOverlappingStepper() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1425, "testOverlappingStepper" ) {}
+ void runTest() { suite_HiParSimulatorTest.testOverlappingStepper(); }
+} testDescription_suite_HiParSimulatorTest_testOverlappingStepper;
+
+static class TestDescription_suite_HiParSimulatorTest_testMultiCoreStepper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testMultiCoreStepper() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1455, "testMultiCoreStepper" ) {}
+ void runTest() { suite_HiParSimulatorTest.testMultiCoreStepper(); }
+} testDescription_suite_HiParSimulatorTest_testMultiCoreStepper;
+
+static class TestDescription_suite_HiParSimulatorTest_testTemporalBlockingStepper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testTemporalBlockingStepper() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1481, "testTemporalBlockingStepper" ) {}
+ void runTest() { suite_HiParSimulatorTest.testTemporalBlockingStepper(); }
+} testDescription_suite_HiParSimulatorTest_testTemporalBlockingStepper;
+
+static class TestDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1506, "testZeroCopyPatchLinks" ) {}
+ void runTest() { suite_HiParSimulatorTest.testZeroCopyPatchLinks(); }
+} testDescription_suite_HiParSimulatorTest_testZeroCopyPatchLinks;
+
+static class TestDescription_suite_HiParSimulatorTest_testNonPoDCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testNonPoDCell() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1530, "testNonPoDCell" ) {}
+ void runTest() { suite_HiParSimulatorTest.testNonPoDCell(); }
+} testDescription_suite_HiParSimulatorTest_testNonPoDCell;
+
+static class TestDescription_suite_HiParSimulatorTest_testIO : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_HiParSimulatorTest_testIO() : CxxTest::RealTestDescription( Tests_HiParSimulatorTest, suiteDescription_HiParSimulatorTest, 1546, "testIO" ) {}
+ void runTest() { suite_HiParSimulatorTest.testIO(); }
+} testDescription_suite_HiParSimulatorTest_testIO;
+
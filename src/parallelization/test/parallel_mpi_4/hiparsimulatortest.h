@@ -11,6 +11,9 @@
 #include <libgeodecomp/misc/testcell.h>
 #include <libgeodecomp/misc/testhelper.h>
 #include <libgeodecomp/parallelization/hiparsimulator.h>
+#include <libgeodecomp/parallelization/nesting/multicorestepper.h>
+#include <libgeodecomp/parallelization/nesting/overlappingstepper.h>
+#include <libgeodecomp/parallelization/nesting/temporalblockingstepper.h>
 
 #include <boost/shared_ptr.hpp>
 #include <cxxtest/TestSuite.h>
@@ -62,6 +65,87 @@ private:
     std::size_t cellsSeen;
 };
 
+/**
+ * Shifts a fixed number of items from each rank to its successor,
+ * so each call to balance() yields a new partition.
+ */
+class ShiftingBalancer : public LoadBalancer
+{
+public:
+    explicit ShiftingBalancer(std::size_t delta) :
+        delta(delta)
+    {
+        calls = 0;
+    }
+
+    virtual WeightVec balance(const WeightVec& weights, const LoadVec& relativeLoads)
+    {
+        ++calls;
+        WeightVec ret = weights;
+        for (std::size_t i = 0; i < (ret.size() - 1); ++i) {
+            std::size_t d = (std::min)(delta, ret[i]);
+            ret[i]     -= d;
+            ret[i + 1] += d;
+        }
+
+        return ret;
+    }
+
+    static int calls;
+
+private:
+    std::size_t delta;
+};
+
+int ShiftingBalancer::calls = 0;
+
+/**
+ * Cells in the lower left corner of the grid are much more
+ * expensive to update than the rest.
+ */
+class CostlyCell
+{
+public:
+    class API :
+        public APITraits::HasCostSampling,
+        public APITraits::HasOpaqueMPIDataType<CostlyCell>
+    {};
+
+    explicit CostlyCell(int work = 0) :
+        work(work),
+        result(0)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, int /* nanoStep */)
+    {
+        *this = hood[Coord<2>()];
+        for (int i = 0; i < work; ++i) {
+            result += std::sqrt(result + i);
+        }
+    }
+
+    int work;
+    double result;
+};
+
+class CostlyCellInitializer : public SimpleInitializer<CostlyCell>
+{
+public:
+    CostlyCellInitializer() :
+        SimpleInitializer<CostlyCell>(Coord<2>(64, 64), 12)
+    {}
+
+    virtual void grid(GridBase<CostlyCell, 2> *target)
+    {
+        CoordBox<2> box = target->boundingBox();
+        for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
+            bool costly = (i->x() < 16) && (i->y() < 16);
+            target->set(*i, CostlyCell(costly ? 5000 : 10));
+        }
+    }
+};
+
 class HiParSimulatorTest : public CxxTest::TestSuite
 {
 public:
@@ -162,15 +246,103 @@ public:
         TS_ASSERT_EQUALS(dim, grids[t].getDimensions());
 
         if (MPILayer().rank() == 0) {
-            std::string expectedEvents;
-            for (int i = 0; i < 2; ++i) {
-                expectedEvents += "balance() [1415, 1415, 1415, 1416] [1, 1, 1, 1]\n";
+            // relative loads are measured, so we can only check the weights:
+            std::string prefix = "balance() [1415, 1415, 1415, 1416] [";
+            std::stringstream events(MockBalancer::events);
+            std::string line;
+            int counter = 0;
+            while (std::getline(events, line)) {
+                TS_ASSERT_EQUALS(prefix, line.substr(0, prefix.size()));
+                ++counter;
             }
 
-            TS_ASSERT_EQUALS(expectedEvents, MockBalancer::events);
+            TS_ASSERT_EQUALS(2, counter);
         }
     }
 
+    void testLoadBalancing()
+    {
+        std::size_t shift = 200;
+        sim.reset(new SimulatorType(
+                      new TestInitializer<TestCell<2> >(dim, maxSteps, firstStep),
+                      new ShiftingBalancer(shift),
+                      loadBalancingPeriod,
+                      ghostZoneWidth));
+        memoryWriter = new MemoryWriterType(outputPeriod);
+        sim->addWriter(memoryWriter);
+        sim->addWriter(new AccumulatingWriter());
+        sim->run();
+
+        for (unsigned t = firstStep; t <= maxSteps; t += outputPeriod) {
+            unsigned globalNanoStep = t * NANO_STEPS;
+            MemoryWriterType::GridMap& grids = memoryWriter->getGrids();
+            TS_ASSERT_TEST_GRID(
+                MemoryWriterType::GridType,
+                grids[t],
+                globalNanoStep);
+        }
+
+        std::vector<std::size_t> expectedWeights;
+        expectedWeights << 1415 - 2 * shift
+                        << 1415
+                        << 1415
+                        << 1416 + 2 * shift;
+        TS_ASSERT_EQUALS(expectedWeights, sim->updateGroup->getWeights());
+
+        if (MPILayer().rank() == 0) {
+            TS_ASSERT_EQUALS(2, ShiftingBalancer::calls);
+        }
+    }
+
+    void testCostSampling()
+    {
+        checkCostSampling<VanillaStepper<CostlyCell, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> >();
+    }
+
+    void testCostSamplingWithMultiCoreStepper()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        checkCostSampling<MultiCoreStepper<CostlyCell> >();
+#endif
+    }
+
+    void testCostSamplingWithOverlappingStepper()
+    {
+        checkCostSampling<OverlappingStepper<CostlyCell, UpdateFunctorHelpers::ConcurrencyNoP> >();
+    }
+
+    void testRepartitioningThreshold()
+    {
+        HiParSimulator<CostlyCell, ZCurvePartition<2> > sim(
+            new CostlyCellInitializer(),
+            new MockBalancer(),
+            4,
+            1);
+        TS_ASSERT_THROWS(sim.setRepartitioningThreshold(-0.1), std::invalid_argument&);
+
+        // no boundary may move by more than 10 times the average
+        // number of cells per rank, so the costs won't suffice:
+        sim.setRepartitioningThreshold(10);
+        sim.run();
+
+        std::vector<int> sizes = MPILayer().allGather(int(sim.updateGroup->partitionManager->ownRegion().size()));
+        TS_ASSERT_EQUALS(std::vector<int>(4, 1024), sizes);
+
+        std::vector<std::size_t> oldOffsets;
+        oldOffsets << 0 << 1000 << 2000 << 3000 << 4000;
+        std::vector<std::size_t> newOffsets;
+        newOffsets << 0 << 1000 << 2100 << 3000 << 4000;
+
+        sim.setRepartitioningThreshold(0);
+        TS_ASSERT(!sim.exceedsRepartitioningThreshold(oldOffsets, oldOffsets));
+        TS_ASSERT( sim.exceedsRepartitioningThreshold(newOffsets, oldOffsets));
+
+        sim.setRepartitioningThreshold(0.1);
+        TS_ASSERT(!sim.exceedsRepartitioningThreshold(newOffsets, oldOffsets));
+        newOffsets[3] = 2899;
+        TS_ASSERT( sim.exceedsRepartitioningThreshold(newOffsets, oldOffsets));
+    }
+
     void testSteererCallback()
     {
         boost::shared_ptr<MockSteererType::EventsStore> events(new MockSteererType::EventsStore);
@@ -1250,6 +1422,111 @@ public:
         sim->run();
     }
 
+    void testOverlappingStepper()
+    {
+        typedef OverlappingStepper<TestCell<2>, UpdateFunctorHelpers::ConcurrencyNoP> StepperType;
+        typedef HiParSimulator<TestCell<2>, ZCurvePartition<2>, StepperType> SimulatorType;
+
+        // large enough so that each inner set is split into multiple batches
+        Coord<2> dim(400, 300);
+        unsigned maxSteps = 8;
+        SimulatorType sim(
+            new TestInitializer<TestCell<2> >(dim, maxSteps),
+            0,
+            1,
+            3);
+        MemoryWriterType *writer = new MemoryWriterType(4);
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned t = 0; t <= maxSteps; t += 4) {
+            TS_ASSERT_TEST_GRID(
+                MemoryWriterType::GridType,
+                writer->getGrids()[t],
+                t * NANO_STEPS);
+        }
+
+        std::vector<Chronometer> stats = sim.gatherStatistics();
+        if (MPILayer().rank() == 0) {
+            TS_ASSERT_LESS_THAN(0, stats[0].interval<TimeCommunication>());
+        }
+    }
+
+    void testMultiCoreStepper()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+        typedef MultiCoreStepper<TestCell<2> > StepperType;
+        typedef HiParSimulator<TestCell<2>, ZCurvePartition<2>, StepperType> SimulatorType;
+
+        Coord<2> dim(200, 150);
+        unsigned maxSteps = 8;
+        SimulatorType sim(
+            new TestInitializer<TestCell<2> >(dim, maxSteps),
+            0,
+            1,
+            3);
+        MemoryWriterType *writer = new MemoryWriterType(2);
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned t = 0; t <= maxSteps; t += 2) {
+            TS_ASSERT_TEST_GRID(
+                MemoryWriterType::GridType,
+                writer->getGrids()[t],
+                t * NANO_STEPS);
+        }
+#endif
+    }
+
+    void testTemporalBlockingStepper()
+    {
+        typedef TemporalBlockingStepper<TestCell<3>, UpdateFunctorHelpers::ConcurrencyNoP> StepperType;
+        typedef HiParSimulator<TestCell<3>, ZCurvePartition<3>, StepperType> SimulatorType;
+        typedef ParallelMemoryWriter<TestCell<3> > MemoryWriterType3D;
+
+        Coord<3> dim(20, 25, 30);
+        unsigned maxSteps = 8;
+        SimulatorType sim(
+            new TestInitializer<TestCell<3> >(dim, maxSteps),
+            0,
+            1,
+            4);
+        MemoryWriterType3D *writer = new MemoryWriterType3D(4);
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned t = 0; t <= maxSteps; t += 4) {
+            TS_ASSERT_TEST_GRID(
+                MemoryWriterType3D::GridType,
+                writer->getGrids()[t],
+                t * APITraits::SelectNanoSteps<TestCell<3> >::VALUE);
+        }
+    }
+
+    void testZeroCopyPatchLinks()
+    {
+        typedef HiParSimulator<TestCell<2>, ZCurvePartition<2> > SimulatorType;
+
+        Coord<2> dim(90, 70);
+        unsigned maxSteps = 8;
+        SimulatorType sim(
+            new TestInitializer<TestCell<2> >(dim, maxSteps),
+            0,
+            1,
+            3);
+        sim.enableZeroCopyPatchLinks();
+        MemoryWriterType *writer = new MemoryWriterType(2);
+        sim.addWriter(writer);
+        sim.run();
+
+        for (unsigned t = 0; t <= maxSteps; t += 2) {
+            TS_ASSERT_TEST_GRID(
+                MemoryWriterType::GridType,
+                writer->getGrids()[t],
+                t * NANO_STEPS);
+        }
+    }
+
     void testNonPoDCell()
     {
 #ifdef LIBGEODECOMP_WITH_BOOST_SERIALIZATION
@@ -1273,6 +1550,28 @@ public:
     }
 
 private:
+    template<typename STEPPER>
+    void checkCostSampling()
+    {
+        HiParSimulator<CostlyCell, ZCurvePartition<2>, STEPPER> sim(
+            new CostlyCellInitializer(),
+            new MockBalancer(),
+            4,
+            1);
+        sim.run();
+
+        // MockBalancer doesn't change the weights, but the cost
+        // samples still move the boundaries on the curve:
+        std::vector<std::size_t> expectedWeights(4, 1024);
+        TS_ASSERT_EQUALS(expectedWeights, sim.updateGroup->getWeights());
+
+        std::vector<int> sizes = MPILayer().allGather(int(sim.updateGroup->partitionManager->ownRegion().size()));
+        TS_ASSERT_EQUALS(64 * 64, sum(sizes));
+        // the costly corner is first on the curve:
+        TS_ASSERT_LESS_THAN(sizes[0], 512);
+        TS_ASSERT_LESS_THAN(1024, sizes[3]);
+    }
+
     boost::shared_ptr<SimulatorType> sim;
     Coord<2> dim;
     unsigned maxSteps;
@@ -0,0 +1,105 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CacheBlockingSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_openmp_1/cacheblockingsimulatortest.h"
+
+static CacheBlockingSimulatorTest suite_CacheBlockingSimulatorTest;
+
+static CxxTest::List Tests_CacheBlockingSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CacheBlockingSimulatorTest( "/root/repo/src/parallelization/test/parallel_openmp_1/cacheblockingsimulatortest.h", 18, "CacheBlockingSimulatorTest", suite_CacheBlockingSimulatorTest, Tests_CacheBlockingSimulatorTest );
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 43, "testStep" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testStep(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testStep;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testHop1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testHop1() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 56, "testHop1" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testHop1(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testHop1;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testHop2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testHop2() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 68, "testHop2" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testHop2(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testHop2;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testHop3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testHop3() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 78, "testHop3" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testHop3(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testHop3;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 88, "testRun" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testRun(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testRun;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testPeriodicBoundaries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testPeriodicBoundaries() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 97, "testPeriodicBoundaries" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testPeriodicBoundaries(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testPeriodicBoundaries;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_test2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_test2D() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 113, "test2D" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.test2D(); }
+} testDescription_suite_CacheBlockingSimulatorTest_test2D;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testWriterInvocation() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 128, "testWriterInvocation" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testWriterInvocation(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testWriterInvocation;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testStepsToNextEvent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testStepsToNextEvent() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 143, "testStepsToNextEvent" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testStepsToNextEvent(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testStepsToNextEvent;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 156, "testSteererCallback" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testSteererCallback(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testSteererCanTerminateSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testSteererCanTerminateSimulation() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 179, "testSteererCanTerminateSimulation" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testSteererCanTerminateSimulation(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testSteererCanTerminateSimulation;
+
+static class TestDescription_suite_CacheBlockingSimulatorTest_testInvalidParameters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheBlockingSimulatorTest_testInvalidParameters() : CxxTest::RealTestDescription( Tests_CacheBlockingSimulatorTest, suiteDescription_CacheBlockingSimulatorTest, 198, "testInvalidParameters" ) {}
+ void runTest() { suite_CacheBlockingSimulatorTest.testInvalidParameters(); }
+} testDescription_suite_CacheBlockingSimulatorTest_testInvalidParameters;
+
@@ -2,7 +2,10 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <libgeodecomp/io/mocksteerer.h>
 #include <libgeodecomp/io/testinitializer.h>
+#include <libgeodecomp/io/teststeerer.h>
+#include <libgeodecomp/io/testwriter.h>
 #include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/misc/testcell.h>
 #include <libgeodecomp/misc/testhelper.h>
@@ -16,109 +19,209 @@ class CacheBlockingSimulatorTest : public CxxTest::TestSuite
 {
 public:
     typedef TestCell<3, Stencils::Moore<3, 1>, Topologies::Cube<3>::Topology> TestCellType;
+    typedef TestCell<3> TestCellTorus;
+    typedef GridBase<TestCellType, 3> GridBaseType;
+    typedef GridBase<TestCellTorus, 3> GridBaseTorus;
+    typedef GridBase<TestCell<2>, 2> GridBase2D;
+    typedef MockSteerer<TestCell<2> > MockSteererType;
+
+    static const int NANO_STEPS_2D = APITraits::SelectNanoSteps<TestCell<2> >::VALUE;
+    static const int NANO_STEPS_3D = APITraits::SelectNanoSteps<TestCell<3> >::VALUE;
 
     void setUp()
     {
+        dim = Coord<3>(40, 30, 20);
+        startStep = 13;
+        maxSteps = 21;
     }
 
     void tearDown()
     {
-        // sim.reset();
+        sim.reset();
+    }
+
+    void testStep()
+    {
+        init(5);
+
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D);
+        sim->step();
+        TS_ASSERT_EQUALS(startStep + 1, sim->getStep());
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), (startStep + 1) * NANO_STEPS_3D);
+        sim->step();
+        TS_ASSERT_EQUALS(startStep + 2, sim->getStep());
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), (startStep + 2) * NANO_STEPS_3D);
+    }
+
+    void testHop1()
+    {
+        init(5);
+
+        sim->hop(5);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D +  5);
+        sim->hop(5);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D + 10);
+        sim->hop(3);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D + 13);
+    }
+
+    void testHop2()
+    {
+        init(7, Coord<2>(7, 9));
+
+        sim->hop(7);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D +  7);
+        sim->hop(7);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D + 14);
+    }
+
+    void testHop3()
+    {
+        init(1);
+
+        sim->hop(1);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D + 1);
+        sim->hop(1);
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), startStep * NANO_STEPS_3D + 2);
+    }
+
+    void testRun()
+    {
+        init(4, Coord<2>(64, 64));
+
+        sim->run();
+        TS_ASSERT_EQUALS(maxSteps, sim->getStep());
+        TS_ASSERT_TEST_GRID(GridBaseType, *sim->getGrid(), maxSteps * NANO_STEPS_3D);
+    }
+
+    void testPeriodicBoundaries()
+    {
+        // pipelines are limited by the thinnest axis so that halos
+        // won't wrap around more than once:
+        CacheBlockingSimulator<TestCellTorus> sim(
+            new TestInitializer<TestCellTorus>(Coord<3>(20, 15, 4), 10, 0),
+            6,
+            Coord<2>(8, 8));
+        TS_ASSERT_EQUALS(4, sim.maxHop);
+
+        sim.hop(4);
+        TS_ASSERT_TEST_GRID(GridBaseTorus, *sim.getGrid(), 4);
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBaseTorus, *sim.getGrid(), 10 * NANO_STEPS_3D);
     }
 
-    void testPipelinedUpdate()
+    void test2D()
+    {
+        CacheBlockingSimulator<TestCell<2> > sim(
+            new TestInitializer<TestCell<2> >(Coord<2>(17, 12), maxSteps, startStep),
+            8,
+            Coord<1>(5));
+
+        sim.hop(8);
+        TS_ASSERT_TEST_GRID(GridBase2D, *sim.getGrid(), startStep * NANO_STEPS_2D + 8);
+        sim.step();
+        TS_ASSERT_TEST_GRID(GridBase2D, *sim.getGrid(), (startStep + 1) * NANO_STEPS_2D + 8);
+        sim.run();
+        TS_ASSERT_TEST_GRID(GridBase2D, *sim.getGrid(), maxSteps * NANO_STEPS_2D);
+    }
+
+    void testWriterInvocation()
+    {
+        CacheBlockingSimulator<TestCell<2> > sim(
+            new TestInitializer<TestCell<2> >(Coord<2>(17, 12), maxSteps, startStep),
+            20,
+            Coord<1>(8));
+
+        // the pipeline will need to be flushed whenever output is
+        // due, TestWriter verifies the grid at each of these steps:
+        TestWriter<> *writer = new TestWriter<>(4, startStep, maxSteps);
+        sim.addWriter(writer);
+        sim.run();
+        TS_ASSERT(writer->allEventsDone());
+    }
+
+    void testStepsToNextEvent()
+    {
+        init(5);
+        TS_ASSERT_EQUALS(unsigned(maxSteps - startStep), sim->stepsToNextEvent());
+
+        sim->addWriter(new TestWriter<TestCellType>(5, startStep, maxSteps));
+        TS_ASSERT_EQUALS(2u, sim->stepsToNextEvent());
+
+        boost::shared_ptr<MockSteerer<TestCellType>::EventsStore> events(new MockSteerer<TestCellType>::EventsStore);
+        sim->addSteerer(new MockSteerer<TestCellType>(7, events));
+        TS_ASSERT_EQUALS(1u, sim->stepsToNextEvent());
+    }
+
+    void testSteererCallback()
+    {
+        CacheBlockingSimulator<TestCell<2> > sim(
+            new TestInitializer<TestCell<2> >(Coord<2>(17, 12), maxSteps, startStep),
+            20,
+            Coord<1>(8));
+
+        boost::shared_ptr<MockSteererType::EventsStore> events(new MockSteererType::EventsStore);
+        sim.addSteerer(new MockSteererType(5, events));
+
+        MockSteererType::EventsStore expectedEvents;
+        expectedEvents << MockSteererType::Event(13, STEERER_INITIALIZED, 0, true);
+        for (int t = startStep; t < maxSteps; t += 1) {
+            if ((t % 5) == 0) {
+                expectedEvents << MockSteererType::Event(t, STEERER_NEXT_STEP, 0, true);
+            }
+        }
+        expectedEvents << MockSteererType::Event(21, STEERER_ALL_DONE, 0, true);
+
+        sim.run();
+        TS_ASSERT_EQUALS(*events, expectedEvents);
+    }
+
+    void testSteererCanTerminateSimulation()
+    {
+        unsigned eventStep = 15;
+        unsigned endStep = 19;
+        unsigned jumpSteps = 2;
+
+        CacheBlockingSimulator<TestCell<2> > sim(
+            new TestInitializer<TestCell<2> >(Coord<2>(17, 12), maxSteps, startStep),
+            20,
+            Coord<1>(8));
+        sim.addSteerer(new TestSteerer<2>(1, eventStep, NANO_STEPS_2D * jumpSteps, endStep));
+        sim.run();
+
+        TS_ASSERT_TEST_GRID(
+            GridBase2D,
+            *sim.getGrid(),
+            (endStep + 1 + jumpSteps) * NANO_STEPS_2D);
+    }
+
+    void testInvalidParameters()
+    {
+        TS_ASSERT_THROWS(
+            CacheBlockingSimulator<TestCellType>(
+                new TestInitializer<TestCellType>(dim), 0, Coord<2>(16, 16)),
+            std::invalid_argument&);
+        TS_ASSERT_THROWS(
+            CacheBlockingSimulator<TestCellType>(
+                new TestInitializer<TestCellType>(dim), 4, Coord<2>(16, 0)),
+            std::invalid_argument&);
+    }
+
+private:
+    Coord<3> dim;
+    int startStep;
+    int maxSteps;
+    boost::shared_ptr<CacheBlockingSimulator<TestCellType> > sim;
+
+    void init(int pipelineLength, const Coord<2>& wavefrontDim = Coord<2>(16, 16))
     {
-//         init(Coord<3>(40, 1, 20));
-
-//         sim->buffer.atEdge() = sim->curGrid->atEdge();
-//         sim->buffer.fill(sim->buffer.boundingBox(), sim->curGrid->getEdgeCell());
-//         sim->fixBufferOrigin(Coord<2>(0, 0));
-//         int i = 0;
-
-//         for (; i < 2 * pipelineLength - 2; ++i) {
-//             int lastStage = (i >> 1) + 1;
-//             sim->pipelinedUpdate(Coord<2>(0, 0), i, i, 0, lastStage);
-//         }
-//         for (; i < dim.z(); ++i) {
-//             sim->pipelinedUpdate(Coord<2>(0, 0), i, i, 0, pipelineLength);
-//         }
-//         for (; i < (dim.z() + 2 * pipelineLength - 2); ++i) {
-//             int firstStage = ((i - dim.z() + 1) >> 1);
-//             sim->pipelinedUpdate(Coord<2>(0, 0), i, i, firstStage, pipelineLength);
-//         }
-//     }
-
-//     void testUpdateWavefront()
-//     {
-//         init(Coord<3>(40, 30, 20));
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 0);
-//         sim->updateWavefront(Coord<2>(0, 0));
-//         sim->updateWavefront(Coord<2>(1, 0));
-//         sim->updateWavefront(Coord<2>(2, 0));
-
-//         sim->updateWavefront(Coord<2>(0, 1));
-//         sim->updateWavefront(Coord<2>(1, 1));
-//         sim->updateWavefront(Coord<2>(2, 1));
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->newGrid), pipelineLength);
-//     }
-
-//     void testHop1()
-//     {
-//         init(Coord<3>(40, 30, 20));
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  0);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  5);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 10);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 15);
-//     }
-
-//     void testHop2()
-//     {
-//         init(Coord<3>(40, 30, 20), 7);
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  0);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  7);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 14);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid), 21);
-//     }
-
-//     void testHop3()
-//     {
-//         init(Coord<3>(40, 30, 20), 1);
-
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  0);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  1);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  2);
-//         sim->hop();
-//         TS_ASSERT_TEST_GRID(CacheBlockingSimulator<TestCellType>::GridType, *(sim->curGrid),  3);
-//     }
-
-// private:
-//     int pipelineLength;
-//     Coord<3> dim;
-//     boost::shared_ptr<CacheBlockingSimulator<TestCellType> > sim;
-
-//     void init(const Coord<3>& gridDim, int newPipelineLength = 5, const Coord<2> wavefrontDim = Coord<2>(16, 16))
-//     {
-//         pipelineLength = newPipelineLength;
-//         dim = gridDim;
-//         sim.reset(new CacheBlockingSimulator<TestCellType>(
-//                       new TestInitializer<TestCellType>(
-//                           dim,
-//                           10000,
-//                           0),
-//                       pipelineLength,
-//                       wavefrontDim));
+        sim.reset(new CacheBlockingSimulator<TestCellType>(
+                      new TestInitializer<TestCellType>(
+                          dim,
+                          maxSteps,
+                          startStep),
+                      pipelineLength,
+                      wavefrontDim));
     }
 };
 
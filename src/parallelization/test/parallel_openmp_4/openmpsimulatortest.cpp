@@ -0,0 +1,128 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_OpenMPSimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/parallel_openmp_4/openmpsimulatortest.h"
+
+static OpenMPSimulatorTest suite_OpenMPSimulatorTest;
+
+static CxxTest::List Tests_OpenMPSimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_OpenMPSimulatorTest( "/root/repo/src/parallelization/test/parallel_openmp_4/openmpsimulatortest.h", 21, "OpenMPSimulatorTest", suite_OpenMPSimulatorTest, Tests_OpenMPSimulatorTest );
+
+static class TestDescription_suite_OpenMPSimulatorTest_testInitialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testInitialization() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 46, "testInitialization" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testInitialization(); }
+} testDescription_suite_OpenMPSimulatorTest_testInitialization;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testStep : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testStep() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 53, "testStep" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testStep(); }
+} testDescription_suite_OpenMPSimulatorTest_testStep;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testRun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testRun() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 64, "testRun" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testRun(); }
+} testDescription_suite_OpenMPSimulatorTest_testRun;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testWriterInvocation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testWriterInvocation() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 74, "testWriterInvocation" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testWriterInvocation(); }
+} testDescription_suite_OpenMPSimulatorTest_testWriterInvocation;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testDeleteInitializer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testDeleteInitializer() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 81, "testDeleteInitializer" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testDeleteInitializer(); }
+} testDescription_suite_OpenMPSimulatorTest_testDeleteInitializer;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testRegisterWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testRegisterWriter() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 92, "testRegisterWriter" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testRegisterWriter(); }
+} testDescription_suite_OpenMPSimulatorTest_testRegisterWriter;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testOpenMPSimulatorShouldCallBackWriter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testOpenMPSimulatorShouldCallBackWriter() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 101, "testOpenMPSimulatorShouldCallBackWriter" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testOpenMPSimulatorShouldCallBackWriter(); }
+} testDescription_suite_OpenMPSimulatorTest_testOpenMPSimulatorShouldCallBackWriter;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testRunMustResetGridPriorToSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testRunMustResetGridPriorToSimulation() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 119, "testRunMustResetGridPriorToSimulation" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testRunMustResetGridPriorToSimulation(); }
+} testDescription_suite_OpenMPSimulatorTest_testRunMustResetGridPriorToSimulation;
+
+static class TestDescription_suite_OpenMPSimulatorTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_test3D() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 151, "test3D" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.test3D(); }
+} testDescription_suite_OpenMPSimulatorTest_test3D;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testSteererCallback : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testSteererCallback() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 166, "testSteererCallback" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testSteererCallback(); }
+} testDescription_suite_OpenMPSimulatorTest_testSteererCallback;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testSteererCanTerminateSimulation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testSteererCanTerminateSimulation() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 188, "testSteererCanTerminateSimulation" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testSteererCanTerminateSimulation(); }
+} testDescription_suite_OpenMPSimulatorTest_testSteererCanTerminateSimulation;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testTunableParameters : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testTunableParameters() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 204, "testTunableParameters" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testTunableParameters(); }
+} testDescription_suite_OpenMPSimulatorTest_testTunableParameters;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testOnlineTuning : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testOnlineTuning() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 225, "testOnlineTuning" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testOnlineTuning(); }
+} testDescription_suite_OpenMPSimulatorTest_testOnlineTuning;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testStepWithOnlineTuning : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testStepWithOnlineTuning() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 251, "testStepWithOnlineTuning" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testStepWithOnlineTuning(); }
+} testDescription_suite_OpenMPSimulatorTest_testStepWithOnlineTuning;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testOnlineTuningStopsWithSteerer : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testOnlineTuningStopsWithSteerer() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 268, "testOnlineTuningStopsWithSteerer" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testOnlineTuningStopsWithSteerer(); }
+} testDescription_suite_OpenMPSimulatorTest_testOnlineTuningStopsWithSteerer;
+
+static class TestDescription_suite_OpenMPSimulatorTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_OpenMPSimulatorTest_testSoA() : CxxTest::RealTestDescription( Tests_OpenMPSimulatorTest, suiteDescription_OpenMPSimulatorTest, 285, "testSoA" ) {}
+ void runTest() { suite_OpenMPSimulatorTest.testSoA(); }
+} testDescription_suite_OpenMPSimulatorTest_testSoA;
+
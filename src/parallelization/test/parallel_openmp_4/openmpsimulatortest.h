@@ -10,6 +10,10 @@
 #include <libgeodecomp/io/testwriter.h>
 #include <libgeodecomp/parallelization/openmpsimulator.h>
 
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
 using namespace LibGeoDecomp;
 
 namespace LibGeoDecomp {
@@ -197,6 +201,87 @@ public:
             (endStep + 1 + jumpSteps) * NANO_STEPS_2D);
     }
 
+    void testTunableParameters()
+    {
+        SimulationParameters params = simulator->tunableParameters();
+        bool fineGrained = params["EnableFineGrainedParallelism"];
+        TS_ASSERT(!fineGrained);
+
+        params["EnableFineGrainedParallelism"].setValue(1);
+#ifdef LIBGEODECOMP_WITH_THREADS
+        int threads = params["Threads"];
+        TS_ASSERT_EQUALS(omp_get_max_threads(), threads);
+        params["Threads"].setValue(0);
+#endif
+        simulator->applyParameters(params);
+
+        TS_ASSERT(simulator->enableFineGrainedParallelism);
+#ifdef LIBGEODECOMP_WITH_THREADS
+        TS_ASSERT_EQUALS(1, simulator->numThreads);
+#endif
+        TS_ASSERT_EQUALS(params.toString(), simulator->tunableParameters().toString());
+    }
+
+    void testOnlineTuning()
+    {
+        MockWriter<> *w = new MockWriter<>(events);
+        simulator->addWriter(w);
+        simulator->enableOnlineTuning(2, 4);
+        simulator->run();
+
+        TS_ASSERT(simulator->tuner->isFinished());
+        TS_ASSERT_LESS_THAN_EQUALS(1u, simulator->tuner->getEvaluations());
+        TS_ASSERT_LESS_THAN_EQUALS(simulator->tuner->getEvaluations(), 4u);
+        TS_ASSERT_EQUALS(init->maxSteps(), simulator->getStep());
+        TS_ASSERT_TEST_GRID(
+            GridBaseType,
+            *simulator->getGrid(),
+            init->maxSteps() * NANO_STEPS_2D);
+
+        // tuning must not skip any steps:
+        MockWriter<>::EventsStore expectedEvents;
+        expectedEvents << MockWriter<>::Event(startStep, WRITER_INITIALIZED, 0, true);
+        for (unsigned i = startStep + 1; i <= init->maxSteps(); ++i) {
+            expectedEvents << MockWriter<>::Event(i, WRITER_STEP_FINISHED, 0, true);
+        }
+        expectedEvents << MockWriter<>::Event(init->maxSteps(), WRITER_ALL_DONE, 0, true);
+        TS_ASSERT_EQUALS(expectedEvents, *events);
+    }
+
+    void testStepWithOnlineTuning()
+    {
+        simulator->enableOnlineTuning(2, 4);
+
+        for (unsigned i = 1; i <= 3; ++i) {
+            simulator->step();
+            TS_ASSERT_EQUALS(startStep + i, simulator->getStep());
+            TS_ASSERT_TEST_GRID(
+                GridBaseType,
+                *simulator->getGrid(),
+                (startStep + i) * NANO_STEPS_2D);
+        }
+
+        // tuning is left to run():
+        TS_ASSERT(!simulator->tuner->isFinished());
+    }
+
+    void testOnlineTuningStopsWithSteerer()
+    {
+        unsigned eventStep = 15;
+        unsigned endStep = 18;
+        unsigned jumpSteps = 2;
+        simulator->addSteerer(new TestSteerer<2>(1, eventStep, NANO_STEPS_2D * jumpSteps, endStep));
+        simulator->enableOnlineTuning(3, 10);
+        simulator->run();
+
+        TS_ASSERT(simulator->tuner->isFinished());
+        TS_ASSERT_EQUALS(endStep + 1, simulator->getStep());
+        TS_ASSERT_TEST_GRID(
+            GridBaseType,
+            *simulator->getGrid(),
+            (endStep + 1 + jumpSteps) * NANO_STEPS_2D);
+    }
+
     void testSoA()
     {
         typedef GridBase<TestCellSoA, 3> GridBaseType;
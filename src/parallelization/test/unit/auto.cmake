@@ -0,0 +1,14 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}autotuningsimulatorwithoutcudatest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}serialsimulatortest.cpp
+  ${RELATIVE_PATH}simulatortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}autotuningsimulatorwithcudatest.h
+  ${RELATIVE_PATH}autotuningsimulatorwithoutcudatest.h
+  ${RELATIVE_PATH}cudasimulatortest.h
+  ${RELATIVE_PATH}serialsimulatortest.h
+  ${RELATIVE_PATH}simulatortest.h
+)
@@ -7,8 +7,10 @@
 #include <libgeodecomp/misc/simplexoptimizer.h>
 #include <libgeodecomp/misc/simulationfactory.h>
 #include <libgeodecomp/misc/simulationparameters.h>
+#include <libgeodecomp/misc/tempfile.h>
 #include <libgeodecomp/parallelization/autotuningsimulator.h>
 #include <boost/assign/list_of.hpp>
+#include <cstdio>
 #include <sstream>
 
 using namespace LibGeoDecomp;
@@ -150,7 +152,7 @@ public:
             new SimFabTestInitializer(dim, maxSteps));
         ats.simulations.clear();
         ats.addSimulation(
-            "SerialSimulation",
+            "SerialSimulator",
             SerialSimulationFactory<SimFabTestCell>(ats.varStepInitializer));
         std::ostringstream buf;
         ats.addWriter(static_cast<Writer<SimFabTestCell> *>(new TracingWriter<SimFabTestCell>(1, 100, 0, buf)));
@@ -158,9 +160,70 @@ public:
 #endif
     }
 
+    void testCacheHitSkipsTuning()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        std::string filename = TempFile::serial("autotuningsimulator_cache");
+        Coord<3> smallDim(10, 10, 10);
+        {
+            AutoTuningSimulator<SimFabTestCell, PatternOptimizer> ats(
+                new SimFabTestInitializer(smallDim, 4), 10);
+            AutoTuningCache cache(filename);
+            fillCache(&cache, ats, -1000.0);
+        }
+
+        AutoTuningSimulator<SimFabTestCell, PatternOptimizer> ats(
+            new SimFabTestInitializer(smallDim, 4), 10);
+        ats.setCacheFile(filename);
+        ats.run();
+
+        // tuning would have overwritten the fitness values:
+        typedef std::map<const std::string, AutoTuningSimulator<SimFabTestCell, PatternOptimizer>::SimulationPtr> MapType;
+        for (MapType::iterator i = ats.simulations.begin(); i != ats.simulations.end(); ++i) {
+            TS_ASSERT_EQUALS(-1000.0, i->second->fitness);
+        }
+
+        remove(filename.c_str());
+#endif
+    }
+
+    void testStaleCacheEntriesAreDetected()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        std::string filename = TempFile::serial("autotuningsimulator_cache");
+        Coord<3> smallDim(10, 10, 10);
+        AutoTuningSimulator<SimFabTestCell, PatternOptimizer> ats(
+            new SimFabTestInitializer(smallDim, 4), 10);
+        {
+            AutoTuningCache cache(filename);
+            // no machine is this fast:
+            fillCache(&cache, ats, -1e-12);
+        }
+
+        ats.setCacheFile(filename);
+        TS_ASSERT(ats.restoreFromCache());
+        TS_ASSERT(!ats.validateCachedResult("SerialSimulator"));
+
+        remove(filename.c_str());
+#endif
+    }
+
 private:
     Coord<3> dim;
     unsigned maxSteps;
+
+    template<typename SIMULATOR>
+    void fillCache(AutoTuningCache *cache, SIMULATOR& ats, double fitness)
+    {
+        typedef typename std::map<const std::string, typename SIMULATOR::SimulationPtr>::iterator IterType;
+        for (IterType i = ats.simulations.begin(); i != ats.simulations.end(); ++i) {
+            cache->put(
+                ats.cacheKey(),
+                i->first,
+                AutoTuningCache::Entry(i->second->parameters, fitness, 8));
+        }
+        cache->flush();
+    }
 };
 
 }
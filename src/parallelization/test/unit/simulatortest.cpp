@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SimulatorTest_init = false;
+#include "/root/repo/src/parallelization/test/unit/simulatortest.h"
+
+static SimulatorTest suite_SimulatorTest;
+
+static CxxTest::List Tests_SimulatorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SimulatorTest( "/root/repo/src/parallelization/test/unit/simulatortest.h", 14, "SimulatorTest", suite_SimulatorTest, Tests_SimulatorTest );
+
+static class TestDescription_suite_SimulatorTest_testDestruction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SimulatorTest_testDestruction() : CxxTest::RealTestDescription( Tests_SimulatorTest, suiteDescription_SimulatorTest, 17, "testDestruction" ) {}
+ void runTest() { suite_SimulatorTest.testDestruction(); }
+} testDescription_suite_SimulatorTest_testDestruction;
+
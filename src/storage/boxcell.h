@@ -8,6 +8,8 @@
 #include <libgeodecomp/storage/neighborhooditerator.h>
 #include <libgeodecomp/storage/fixedarray.h>
 
+#include <algorithm>
+
 namespace LibGeoDecomp {
 
 /**
@@ -17,6 +19,11 @@ namespace LibGeoDecomp {
  * particles (of type Cargo) which reside in its area in the given
  * CONTAINER type (e.g. LibGeoDecomp::FixedArray or std::vector). Particles can
  * access neighboring particles in a given distance during update().
+ *
+ * Particles are kept sorted: those which reside within the box come
+ * first, followed by those which have left it during the last
+ * update (the outbox). Migration thus only needs to check the
+ * outboxes of the neighboring boxes instead of all their particles.
  */
 template<typename CONTAINER>
 class BoxCell
@@ -49,7 +56,8 @@ public:
         const FloatCoord<DIM>& origin = Coord<DIM>(),
         const FloatCoord<DIM>& dimension = Coord<DIM>()) :
         origin(origin),
-        dimension(dimension)
+        dimension(dimension),
+        numResidents(0)
     {}
 
     inline const_iterator begin() const
@@ -72,6 +80,10 @@ public:
         return particles.end();
     }
 
+    /**
+     * New particles are put into the outbox, so the next update will
+     * move them into the correct box.
+     */
     inline void insert(const Cargo& particle)
     {
         particles << particle;
@@ -120,32 +132,68 @@ public:
         const int nanoStep)
     {
         if (nanoStep == 0) {
-            particles.clear();
-            addContainedParticles(ownNeighbors.begin(), ownNeighbors.end());
+            particles.resize(numResidents);
+            addImmigrants(ownNeighbors);
         }
 
         for (typename Container::iterator i = particles.begin(); i != particles.end(); ++i) {
             i->update(allNeighbors, nanoStep);
         }
+
+        sortOutEmigrants();
     }
 
 private:
     FloatCoord<DIM> origin;
     FloatCoord<DIM> dimension;
     Container particles;
+    std::size_t numResidents;
+
+    /**
+     * Collects all particles from the outboxes of the surrounding
+     * boxes (including this one, as freshly inserted particles are
+     * stored there) which have moved into this box.
+     */
+    template<typename NEIGHBORHOOD_ADAPTER>
+    void addImmigrants(const NEIGHBORHOOD_ADAPTER& adapter)
+    {
+        typedef typename NEIGHBORHOOD_ADAPTER::Iterator::CollectionInterfaceType CollectionInterfaceType;
+        FloatCoord<DIM> oppositeCorner = origin + dimension;
+        CoordBox<DIM> box(Coord<DIM>::diagonal(-1), Coord<DIM>::diagonal(3));
+
+        for (typename CoordBox<DIM>::Iterator i = box.begin(); i != box.end(); ++i) {
+            const BoxCell& neighbor = CollectionInterfaceType()(adapter.hood()[*i]);
 
-    template<typename ITERATOR>
-    void addContainedParticles(const ITERATOR& begin, const ITERATOR& end)
+            for (std::size_t j = neighbor.numResidents; j < neighbor.particles.size(); ++j) {
+                const Cargo& particle = neighbor.particles[j];
+                if (APITraits::SelectPositionChecker<Cargo>::value(particle, origin, oppositeCorner)) {
+                    particles << particle;
+                }
+            }
+        }
+    }
+
+    /**
+     * Moves all particles which have left the box to the end of the
+     * container.
+     */
+    void sortOutEmigrants()
     {
         FloatCoord<DIM> oppositeCorner = origin + dimension;
+        iterator end = particles.end();
+        iterator i = particles.begin();
 
-        for (ITERATOR i = begin; i != end; ++i) {
+        while (i != end) {
             if (APITraits::SelectPositionChecker<Cargo>::value(*i, origin, oppositeCorner)) {
-                particles << *i;
+                ++i;
+            } else {
+                --end;
+                std::swap(*i, *end);
             }
         }
-    }
 
+        numResidents = i - particles.begin();
+    }
 };
 
 }
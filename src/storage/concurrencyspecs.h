@@ -0,0 +1,118 @@
+#ifndef LIBGEODECOMP_STORAGE_CONCURRENCYSPECS_H
+#define LIBGEODECOMP_STORAGE_CONCURRENCYSPECS_H
+
+namespace LibGeoDecomp {
+
+namespace UpdateFunctorHelpers {
+
+/**
+ * The default CONCURRENCY_FUNCTOR for UpdateFunctor: won't request
+ * threading and won't execute any sideband actions.
+ */
+class ConcurrencyNoP
+{
+public:
+    inline
+    explicit ConcurrencyNoP(bool /* unused */ = false, bool /* unused */ = false)
+    {}
+
+    bool enableOpenMP() const
+    {
+        return false;
+    }
+
+    bool enableHPX() const
+    {
+        return false;
+    }
+
+    bool preferStaticScheduling() const
+    {
+        return false;
+    }
+
+    bool preferFineGrainedParallelism() const
+    {
+        return false;
+    }
+};
+
+/**
+ * Unsurprisingly, this class requests the UpdateFunctor to use OpenMP
+ * for parallelization. Flags can optionally steer the granularity and
+ * dynamics of load distribution among the threads.
+ */
+class ConcurrencyEnableOpenMP
+{
+public:
+    inline
+    ConcurrencyEnableOpenMP(bool updatingGhost, bool enableFineGrainedParallelism) :
+        updatingGhost(updatingGhost),
+        enableFineGrainedParallelism(enableFineGrainedParallelism)
+    {}
+
+    bool enableOpenMP() const
+    {
+        return true;
+    }
+
+    bool enableHPX() const
+    {
+        return false;
+    }
+
+    bool preferStaticScheduling() const
+    {
+        return !updatingGhost;
+    }
+
+    bool preferFineGrainedParallelism() const
+    {
+        return enableFineGrainedParallelism;
+    }
+
+private:
+    bool updatingGhost;
+    bool enableFineGrainedParallelism;
+};
+
+/**
+ * Like its counterpart for OpenMP, this class requests an HPX-based parallel update.
+ */
+class ConcurrencyEnableHPX
+{
+public:
+    inline
+    ConcurrencyEnableHPX(bool /* unused */, bool enableFineGrainedParallelism) :
+        enableFineGrainedParallelism(enableFineGrainedParallelism)
+    {}
+
+    bool enableOpenMP() const
+    {
+        return false;
+    }
+
+    bool enableHPX() const
+    {
+        return true;
+    }
+
+    bool preferStaticScheduling() const
+    {
+        return false;
+    }
+
+    bool preferFineGrainedParallelism() const
+    {
+        return enableFineGrainedParallelism;
+    }
+
+private:
+    bool enableFineGrainedParallelism;
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef LIBGEODECOMP_STORAGE_CSRMATRIX_H
+#define LIBGEODECOMP_STORAGE_CSRMATRIX_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/geometry/coord.h>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Compressed sparse row (CSR) representation of a sparse matrix:
+ * columns and values of row i are stored at indices rowOffsets()[i]
+ * to rowOffsets()[i + 1] - 1, sorted by column.
+ *
+ * This is the bulk input format for SellCSigmaSparseMatrixContainer,
+ * UnstructuredGrid::setWeights() and MakeAdjacency(). Unlike a
+ * std::map<Coord<2>, VALUE_TYPE> it doesn't need an allocation per
+ * entry. Conversion from coordinate format (COO) is done by a
+ * counting sort over the rows followed by a sort within each row,
+ * both of which run in parallel if OpenMP is available.
+ *
+ * Entries are expected to be unique. Duplicates are retained, in
+ * unspecified order.
+ */
+template<typename VALUE_TYPE>
+class CSRMatrix
+{
+public:
+    explicit CSRMatrix(int rows = 0, int columns = 0) :
+        myRows(rows),
+        myColumns(columns),
+        myRowOffsets(rows + 1, 0)
+    {}
+
+    /**
+     * Takes over the given arrays (they will be left empty). Columns
+     * don't need to be sorted within rows.
+     */
+    CSRMatrix(
+        int rows,
+        int columns,
+        std::vector<int> *rowOffsets,
+        std::vector<int> *columnIndices,
+        std::vector<VALUE_TYPE> *values) :
+        myRows(rows),
+        myColumns(columns)
+    {
+        using std::swap;
+
+        if ((int(rowOffsets->size()) != (rows + 1)) ||
+            (columnIndices->size() != values->size()) ||
+            (rowOffsets->back() != int(values->size()))) {
+            throw std::invalid_argument("CSRMatrix: array sizes don't match");
+        }
+
+        swap(myRowOffsets, *rowOffsets);
+        swap(myColumnIndices, *columnIndices);
+        swap(myValues, *values);
+
+        for (int row = 0; row < rows; ++row) {
+            for (int i = myRowOffsets[row]; i < myRowOffsets[row + 1]; ++i) {
+                checkBounds(row, myColumnIndices[i]);
+            }
+        }
+
+        sortRows();
+    }
+
+    /**
+     * Builds a CSR matrix from the coordinate format, i.e. entry i
+     * is located at (rowIndices[i], columnIndices[i]).
+     */
+    static CSRMatrix fromCOO(
+        int rows,
+        int columns,
+        const std::vector<int>& rowIndices,
+        const std::vector<int>& columnIndices,
+        const std::vector<VALUE_TYPE>& values)
+    {
+        if ((rowIndices.size() != columnIndices.size()) ||
+            (rowIndices.size() != values.size())) {
+            throw std::invalid_argument("CSRMatrix: COO arrays need to be of equal length");
+        }
+
+        CSRMatrix ret(rows, columns);
+        ret.scatter(rowIndices, columnIndices, values);
+        return ret;
+    }
+
+    /**
+     * Converts the legacy map format, which is already sorted.
+     */
+    static CSRMatrix fromMap(int rows, int columns, const std::map<Coord<2>, VALUE_TYPE>& matrix)
+    {
+        CSRMatrix ret(rows, columns);
+        ret.myColumnIndices.reserve(matrix.size());
+        ret.myValues.reserve(matrix.size());
+
+        for (typename std::map<Coord<2>, VALUE_TYPE>::const_iterator i = matrix.begin();
+             i != matrix.end();
+             ++i) {
+            ret.checkBounds(i->first.x(), i->first.y());
+            ++ret.myRowOffsets[i->first.x() + 1];
+            ret.myColumnIndices.push_back(i->first.y());
+            ret.myValues.push_back(i->second);
+        }
+
+        for (int row = 0; row < rows; ++row) {
+            ret.myRowOffsets[row + 1] += ret.myRowOffsets[row];
+        }
+
+        return ret;
+    }
+
+    /**
+     * Returns A^T, again with sorted rows.
+     */
+    CSRMatrix transposed() const
+    {
+        std::vector<int> rowIndices(nonZeros());
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for (int row = 0; row < myRows; ++row) {
+            for (int i = myRowOffsets[row]; i < myRowOffsets[row + 1]; ++i) {
+                rowIndices[i] = row;
+            }
+        }
+
+        CSRMatrix ret(myColumns, myRows);
+        ret.scatter(myColumnIndices, rowIndices, myValues);
+        return ret;
+    }
+
+    inline int rows() const
+    {
+        return myRows;
+    }
+
+    inline int columns() const
+    {
+        return myColumns;
+    }
+
+    inline std::size_t nonZeros() const
+    {
+        return myValues.size();
+    }
+
+    inline int rowLength(int row) const
+    {
+        return myRowOffsets[row + 1] - myRowOffsets[row];
+    }
+
+    inline const std::vector<int>& rowOffsets() const
+    {
+        return myRowOffsets;
+    }
+
+    inline const std::vector<int>& columnIndices() const
+    {
+        return myColumnIndices;
+    }
+
+    inline const std::vector<VALUE_TYPE>& values() const
+    {
+        return myValues;
+    }
+
+    inline bool operator==(const CSRMatrix& other) const
+    {
+        return
+            (myRows          == other.myRows) &&
+            (myColumns       == other.myColumns) &&
+            (myRowOffsets    == other.myRowOffsets) &&
+            (myColumnIndices == other.myColumnIndices) &&
+            (myValues        == other.myValues);
+    }
+
+    inline bool operator!=(const CSRMatrix& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    int myRows;
+    int myColumns;
+    std::vector<int> myRowOffsets;
+    std::vector<int> myColumnIndices;
+    std::vector<VALUE_TYPE> myValues;
+
+    inline void checkBounds(int row, int column) const
+    {
+        if ((row < 0) || (row >= myRows) || (column < 0) || (column >= myColumns)) {
+            throw std::out_of_range("CSRMatrix: entry lies outside of matrix");
+        }
+    }
+
+    /**
+     * Counting sort of the given entries by row. Threads claim slots
+     * via atomic increments, hence the order within rows is only
+     * restored by sortRows().
+     */
+    void scatter(
+        const std::vector<int>& rowIndices,
+        const std::vector<int>& columnIndices,
+        const std::vector<VALUE_TYPE>& values)
+    {
+        int size = values.size();
+        for (int i = 0; i < size; ++i) {
+            checkBounds(rowIndices[i], columnIndices[i]);
+        }
+
+        std::vector<int> cursor(myRows + 1, 0);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < size; ++i) {
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp atomic
+#endif
+            ++cursor[rowIndices[i] + 1];
+        }
+
+        for (int row = 0; row < myRows; ++row) {
+            cursor[row + 1] += cursor[row];
+        }
+        myRowOffsets = cursor;
+        myColumnIndices.resize(size);
+        myValues.resize(size);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < size; ++i) {
+            int index;
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp atomic capture
+#endif
+            index = cursor[rowIndices[i]]++;
+
+            myColumnIndices[index] = columnIndices[i];
+            myValues[index] = values[i];
+        }
+
+        sortRows();
+    }
+
+    /**
+     * Sorts each row by column. Each thread reuses a single buffer
+     * for all of its rows.
+     */
+    void sortRows()
+    {
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel
+#endif
+        {
+            std::vector<std::pair<int, VALUE_TYPE> > buffer;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            for (int row = 0; row < myRows; ++row) {
+                int begin = myRowOffsets[row];
+                int end = myRowOffsets[row + 1];
+                std::vector<int>::iterator rowEnd = myColumnIndices.begin() + end;
+                if (std::adjacent_find(
+                        myColumnIndices.begin() + begin, rowEnd, std::greater<int>()) == rowEnd) {
+                    continue;
+                }
+
+                buffer.clear();
+                for (int i = begin; i < end; ++i) {
+                    buffer.push_back(std::make_pair(myColumnIndices[i], myValues[i]));
+                }
+                std::sort(buffer.begin(), buffer.end(), CompareColumns());
+
+                for (int i = begin; i < end; ++i) {
+                    myColumnIndices[i] = buffer[i - begin].first;
+                    myValues[i] = buffer[i - begin].second;
+                }
+            }
+        }
+    }
+
+    class CompareColumns
+    {
+    public:
+        inline bool operator()(
+            const std::pair<int, VALUE_TYPE>& a,
+            const std::pair<int, VALUE_TYPE>& b) const
+        {
+            return a.first < b.first;
+        }
+    };
+};
+
+}
+
+#endif
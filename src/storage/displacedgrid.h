@@ -91,6 +91,15 @@ public:
         origin = box.origin;
     }
 
+    /**
+     * see Grid::resizeUninitialized()
+     */
+    inline void resizeUninitialized(const CoordBox<DIM>& box)
+    {
+        delegate.resizeUninitialized(box.dimensions);
+        origin = box.origin;
+    }
+
     inline CELL_TYPE& operator[](const Coord<DIM>& absoluteCoord)
     {
         Coord<DIM> relativeCoord = absoluteCoord - origin;
@@ -272,6 +272,15 @@ public:
         elements = num;
     }
 
+    void resize(std::size_t num)
+    {
+        if (num > SIZE) {
+            throw std::out_of_range("capacity exceeded");
+        }
+
+        elements = num;
+    }
+
     inline std::size_t size() const
     {
         return elements;
@@ -10,6 +10,8 @@
 #include <libgeodecomp/storage/gridbase.h>
 #include <libgeodecomp/storage/selector.h>
 
+#include <new>
+
 namespace LibGeoDecomp {
 
 template<typename CELL_TYPE, typename GRID_TYPE>
@@ -81,6 +83,72 @@ public:
     }
 };
 
+/**
+ * Aligns cells on cache line boundaries. Elements created without an
+ * initial value (e.g. by std::vector::resize()) are value-initialized
+ * by default. Alternatively they may be default-initialized, which
+ * leaves the memory of cells with trivial constructors untouched.
+ * This requires C++11 as older implementations of std::vector don't
+ * forward these calls to the allocator.
+ */
+template<typename T>
+class CellAllocator : public LibFlatArray::aligned_allocator<T, 64>
+{
+public:
+    typedef LibFlatArray::aligned_allocator<T, 64> ParentType;
+    typedef typename ParentType::pointer pointer;
+    typedef typename ParentType::const_reference const_reference;
+
+    template<typename OTHER>
+    struct rebind
+    {
+        typedef CellAllocator<OTHER> other;
+    };
+
+    explicit CellAllocator(bool valueInitialize = true) :
+        valueInitialize(valueInitialize)
+    {}
+
+    template<typename OTHER>
+    CellAllocator(const CellAllocator<OTHER>& other) :
+        valueInitialize(other.valueInitializes())
+    {}
+
+    void construct(pointer p, const_reference val)
+    {
+        ParentType::construct(p, val);
+    }
+
+    void construct(pointer p)
+    {
+        if (valueInitialize) {
+            ::new(static_cast<void*>(p)) T();
+        } else {
+            ::new(static_cast<void*>(p)) T;
+        }
+    }
+
+    bool valueInitializes() const
+    {
+        return valueInitialize;
+    }
+
+    // all instances use the same heap, regardless of their mode of
+    // initialization, so memory may be freed by any of them:
+    bool operator==(const CellAllocator& /* other */) const
+    {
+        return true;
+    }
+
+    bool operator!=(const CellAllocator& /* other */) const
+    {
+        return false;
+    }
+
+private:
+    bool valueInitialize;
+};
+
 }
 
 /**
@@ -96,7 +164,7 @@ public:
     const static int DIM = TOPOLOGY::DIM;
 
     // always align on cache line boundaries
-    typedef typename std::vector<CELL_TYPE, LibFlatArray::aligned_allocator<CELL_TYPE, 64> > CellVector;
+    typedef typename std::vector<CELL_TYPE, GridHelpers::CellAllocator<CELL_TYPE> > CellVector;
 
     typedef TOPOLOGY Topology;
     typedef CELL_TYPE Cell;
@@ -137,6 +205,23 @@ public:
         cellVector.resize(newDim.prod());
     }
 
+    /**
+     * Like resize(), but all cells will be default-initialized, so
+     * the memory of cells with trivial constructors won't be touched.
+     * This allows the pages to be placed on the NUMA nodes of the
+     * threads which write them first (see MultiCoreStepper). Cells
+     * need to be set before they may be read.
+     */
+    inline void resizeUninitialized(const Coord<DIM>& newDim)
+    {
+        CellVector newVector(GridHelpers::CellAllocator<CELL_TYPE>(false));
+        newVector.resize(newDim.prod());
+
+        // buffers are exchanged, but cellVector keeps its allocator
+        cellVector.swap(newVector);
+        dimensions = newDim;
+    }
+
     /**
      * returns a map that is referenced by relative coordinates from the
      * originating coordinate coord.
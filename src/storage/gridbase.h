@@ -5,6 +5,7 @@
 #include <libgeodecomp/geometry/coordbox.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/streak.h>
+#include <libgeodecomp/storage/csrmatrix.h>
 #include <libgeodecomp/storage/memorylocation.h>
 #include <libgeodecomp/storage/selector.h>
 
@@ -137,6 +138,14 @@ public:
         throw std::logic_error("edge weights cannot be set on this grid type");
     }
 
+    /**
+     * Same as above, but for bulk input of large matrices.
+     */
+    virtual void setWeights(std::size_t matrixID, const CSRMatrix<WEIGHT_TYPE>& matrix)
+    {
+        throw std::logic_error("edge weights cannot be set on this grid type");
+    }
+
 protected:
     virtual void saveMemberImplementation(
         char *target,
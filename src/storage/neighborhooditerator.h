@@ -24,7 +24,8 @@ class Adapter
     inline
     explicit Adapter(const typename Iterator::Neighborhood *hood) :
         myBegin(Iterator::begin(*hood)),
-        myEnd(Iterator::end(*hood))
+        myEnd(Iterator::end(*hood)),
+        myHood(hood)
     {}
 
     inline
@@ -39,9 +40,20 @@ class Adapter
         return myEnd;
     }
 
+    /**
+     * Gives containers access to their neighbors one by one, e.g.
+     * so BoxCell can limit its search for immigrating particles.
+     */
+    inline
+    const typename Iterator::Neighborhood& hood() const
+    {
+        return *myHood;
+    }
+
  private:
     Iterator myBegin;
     Iterator myEnd;
+    const typename Iterator::Neighborhood *myHood;
 };
 
 
@@ -60,6 +72,7 @@ public:
     friend class NeighborhoodIteratorTest;
 
     typedef NEIGHBORHOOD Neighborhood;
+    typedef COLLECTION_INTERFACE CollectionInterfaceType;
     typedef typename Neighborhood::Cell Cell;
     typedef typename COLLECTION_INTERFACE::Container::const_iterator CellIterator;
     typedef typename COLLECTION_INTERFACE::Container::value_type Particle;
@@ -41,6 +41,21 @@ public:
         // empty as most implementations won't need it anyway.
     }
 
+    /**
+     * See PatchProvider::progress()
+     */
+    virtual void progress()
+    {}
+
+    /**
+     * Steppers call this after put() and before they modify the
+     * grid which they handed to put(). Implementations which keep
+     * reading from the grid after put() has returned (e.g. zero-copy
+     * PatchLinks) need to block here until they're done.
+     */
+    virtual void release()
+    {}
+
     virtual std::size_t nextRequiredNanoStep() const
     {
         if (requestedNanoSteps.empty()) {
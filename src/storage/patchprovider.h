@@ -61,6 +61,15 @@ public:
     }
 #endif
 
+    /**
+     * Gives implementations which receive their patches
+     * asynchronously a chance to advance pending transmissions.
+     * Steppers may call this periodically while they're busy
+     * computing.
+     */
+    virtual void progress()
+    {}
+
     virtual std::size_t nextAvailableNanoStep() const
     {
         if (storedNanoSteps.empty()) {
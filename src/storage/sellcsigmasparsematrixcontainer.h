@@ -7,6 +7,7 @@
 
 #include <libflatarray/aligned_allocator.hpp>
 #include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/storage/csrmatrix.h>
 
 #include <map>
 #include <vector>
@@ -40,19 +41,142 @@ public:
     int rowIndex;
 };
 
+/**
+ * Copies the row lengths from the CSR matrix, padding rows are empty.
+ */
+template<typename VALUETYPE>
+void getRowLengths(const CSRMatrix<VALUETYPE>& matrix, std::vector<int> *rowLength)
+{
+    const int rows = std::min(int(rowLength->size()), matrix.rows());
+
+    std::fill(rowLength->begin(), rowLength->end(), 0);
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
+    for (int row = 0; row < rows; ++row) {
+        (*rowLength)[row] = matrix.rowLength(row);
+    }
+}
+
+/**
+ * Same as above for the legacy map format.
+ */
+template<typename VALUETYPE>
+void getRowLengths(const std::map<Coord<2>, VALUETYPE>& matrix, std::vector<int> *rowLength)
+{
+    std::fill(rowLength->begin(), rowLength->end(), 0);
+    for (typename std::map<Coord<2>, VALUETYPE>::const_iterator i = matrix.begin();
+         i != matrix.end();
+         ++i) {
+        ++(*rowLength)[i->first.x()];
+    }
+}
+
+/**
+ * Chunk offsets are the prefix sum of chunk sizes, the last entry
+ * holds the total number of values (including padding).
+ */
+inline void setChunkOffsets(const std::vector<int>& chunkLength, int c, std::vector<int> *chunkOffset)
+{
+    (*chunkOffset)[0] = 0;
+    for (std::size_t nChunk = 0; nChunk < chunkLength.size(); ++nChunk) {
+        (*chunkOffset)[nChunk + 1] = (*chunkOffset)[nChunk] + chunkLength[nChunk] * c;
+    }
+}
+
+/**
+ * Scatters the matrix entries into the chunks. realRowToSorted may be
+ * 0 if rows aren't permuted (SIGMA = 1). Padding is set to zero.
+ */
+template<typename VALUETYPE, typename VALUE_VECTOR, typename INDEX_VECTOR>
+void saveValues(
+    const CSRMatrix<VALUETYPE>& matrix,
+    int dimension,
+    int c,
+    const std::vector<int>& chunkOffset,
+    const int *realRowToSorted,
+    VALUE_VECTOR *values,
+    INDEX_VECTOR *column)
+{
+    const int numberOfValues = chunkOffset.back();
+    values->resize(numberOfValues);
+    column->resize(numberOfValues);
+    std::fill(values->begin(), values->end(), 0);
+    std::fill(column->begin(), column->end(), 0);
+
+    const int rows = std::min(dimension, matrix.rows());
+    const std::vector<int>& rowOffsets = matrix.rowOffsets();
+    const std::vector<int>& columnIndices = matrix.columnIndices();
+    const std::vector<VALUETYPE>& matrixValues = matrix.values();
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for (int realRow = 0; realRow < rows; ++realRow) {
+        const int sortedRow = realRowToSorted ? realRowToSorted[realRow] : realRow;
+        const int chunk = sortedRow / c;
+        const int row   = sortedRow % c;
+        int idx = chunkOffset[chunk] + row;
+
+        for (int i = rowOffsets[realRow]; i < rowOffsets[realRow + 1]; ++i, idx += c) {
+            (*values)[idx] = matrixValues[i];
+            (*column)[idx] = columnIndices[i];
+        }
+    }
+}
+
+/**
+ * Same as above for the legacy map format. The map is traversed
+ * sequentially, but we don't need a temporary CSR copy of it.
+ */
+template<typename VALUETYPE, typename VALUE_VECTOR, typename INDEX_VECTOR>
+void saveValues(
+    const std::map<Coord<2>, VALUETYPE>& matrix,
+    int dimension,
+    int c,
+    const std::vector<int>& chunkOffset,
+    const int *realRowToSorted,
+    VALUE_VECTOR *values,
+    INDEX_VECTOR *column)
+{
+    const int numberOfValues = chunkOffset.back();
+    values->resize(numberOfValues);
+    column->resize(numberOfValues);
+    std::fill(values->begin(), values->end(), 0);
+    std::fill(column->begin(), column->end(), 0);
+
+    int currentRow = -1;
+    int idx = 0;
+    for (typename std::map<Coord<2>, VALUETYPE>::const_iterator i = matrix.begin();
+         i != matrix.end();
+         ++i, idx += c) {
+        if (i->first.x() != currentRow) {
+            currentRow = i->first.x();
+            const int sortedRow = realRowToSorted ? realRowToSorted[currentRow] : currentRow;
+            idx = chunkOffset[sortedRow / c] + sortedRow % c;
+        }
+
+        (*values)[idx] = i->second;
+        (*column)[idx] = i->first.y();
+    }
+}
+
 /**
  * Helper class to initialize the sell container from an adjacency matrix.
  * This is a class and not a method, because there are two different implementations,
- * one for SIGMA = 1 and one for SIGMA > 1.
+ * one for SIGMA = 1 and one for SIGMA > 1. MATRIX may be a CSRMatrix or
+ * a std::map<Coord<2>, VALUETYPE>. Rows are independent of each other,
+ * so loops over sorting scopes and chunks (and rows of CSR matrices)
+ * run in parallel if OpenMP is available.
  */
 template<typename VALUETYPE, int C, int SIGMA>
 class InitFromMatrix
 {
 public:
     using SellContainer = SellCSigmaSparseMatrixContainer<VALUETYPE, C, SIGMA>;
-    using Matrix = std::map<Coord<2>, VALUETYPE>;
 
-    void operator()(SellContainer *container, const Matrix& matrix) const
+    template<typename MATRIX>
+    void operator()(SellContainer *container, const MATRIX& matrix) const
     {
         std::vector<int> rowLengthCopy;
 
@@ -61,7 +185,6 @@ public:
         const int numberOfChunks = (matrixRows - 1) / C + 1;
         const int numberOfSigmas = (matrixRows - 1) / SIGMA + 1;
         const int rowsPadded = numberOfChunks * C;
-        int numberOfValues = 0;
 
         // save references to sell data structures
         auto& chunkOffset     = container->chunkOffset;
@@ -69,8 +192,6 @@ public:
         auto& rowLength       = container->rowLength;
         auto& realRowToSorted = container->realRowToSorted;
         auto& chunkRowToReal  = container->chunkRowToReal;
-        auto& values          = container->values;
-        auto& column          = container->column;
 
         // allocate memory
         chunkOffset.resize(numberOfChunks + 1);
@@ -81,12 +202,12 @@ public:
         chunkRowToReal.resize(rowsPadded);
 
         // get row lengths
-        std::fill(begin(rowLength), end(rowLength), 0);
-        for (const auto& pair: matrix) {
-            ++rowLength[pair.first.x()];
-        }
+        getRowLengths(matrix, &rowLength);
 
         // map sorting scope
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
         for (int nSigma = 0; nSigma < numberOfSigmas; ++nSigma) {
             const int numberOfRows = std::min(SIGMA, rowsPadded - nSigma * SIGMA);
             std::vector<SortItem> lengths(numberOfRows);
@@ -105,42 +226,22 @@ public:
         }
 
         // save chunk lengths and offsets
-        chunkOffset[0] = 0;
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
         for (int nChunk = 0; nChunk < numberOfChunks; ++nChunk) {
-            std::vector<int> lengths(C);
-            for (auto i = 0u; i < lengths.size(); ++i) {
-                lengths[i] = rowLength[chunkRowToReal[nChunk * C + i]];
+            int length = 0;
+            for (int i = 0; i < C; ++i) {
+                length = std::max(length, rowLength[chunkRowToReal[nChunk * C + i]]);
             }
-            chunkLength[nChunk] = *std::max_element(begin(lengths), end(lengths));
-            if (nChunk > 0) {
-                chunkOffset[nChunk] = chunkOffset[nChunk - 1] + chunkLength[nChunk - 1] * C;
-            }
-            numberOfValues += chunkLength[nChunk] * C;
+            chunkLength[nChunk] = length;
         }
-        chunkOffset[numberOfChunks] = chunkOffset[numberOfChunks - 1] +
-            chunkLength[numberOfChunks - 1] * C;
+        setChunkOffsets(chunkLength, C, &chunkOffset);
 
         // save values
         rowLength = std::move(rowLengthCopy);
-        values.resize(numberOfValues);
-        column.resize(numberOfValues);
-        std::fill(begin(values), end(values), 0);
-        std::fill(begin(column), end(column), 0);
-        int currentRow = 0;
-        int index = 0;
-        for (const auto& pair: matrix) {
-            if (pair.first.x() != currentRow) {
-                currentRow = pair.first.x();
-                index = 0;
-            }
-            const int chunk = realRowToSorted[pair.first.x()] / C;
-            const int row   = realRowToSorted[pair.first.x()] % C;
-            const int start = chunkOffset[chunk];
-            const int idx   = start + index * C + row;
-            values[idx]     = pair.second;
-            column[idx]     = pair.first.y();
-            ++index;
-        }
+        saveValues(matrix, matrixRows, C, chunkOffset, realRowToSorted.data(),
+                   &container->values, &container->column);
     }
 };
 
@@ -152,22 +253,19 @@ class InitFromMatrix<VALUETYPE, C, 1>
 {
 public:
     using SellContainer = SellCSigmaSparseMatrixContainer<VALUETYPE, C, 1>;
-    using Matrix = std::map<Coord<2>, VALUETYPE>;
 
-    void operator()(SellContainer *container, const Matrix& matrix) const
+    template<typename MATRIX>
+    void operator()(SellContainer *container, const MATRIX& matrix) const
     {
         // calculate size for arrays
         const int matrixRows = container->dimension;
         const int numberOfChunks = (matrixRows - 1) / C + 1;
         const int rowsPadded = numberOfChunks * C;
-        int numberOfValues = 0;
 
         // save references to sell data structures
         auto& chunkOffset = container->chunkOffset;
         auto& chunkLength = container->chunkLength;
         auto& rowLength   = container->rowLength;
-        auto& values      = container->values;
-        auto& column      = container->column;
 
         // allocate memory
         chunkOffset.resize(numberOfChunks + 1);
@@ -175,44 +273,21 @@ public:
         rowLength.resize(rowsPadded);
 
         // get row lengths
-        std::fill(begin(rowLength), end(rowLength), 0);
-        for (const auto& pair: matrix) {
-            ++rowLength[pair.first.x()];
-        }
+        getRowLengths(matrix, &rowLength);
 
         // save chunk lengths and offsets
-        chunkOffset[0] = 0;
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static)
+#endif
         for (int nChunk = 0; nChunk < numberOfChunks; ++nChunk) {
             chunkLength[nChunk] = *std::max_element(rowLength.begin() + nChunk * C,
                                                     rowLength.begin() + (nChunk + 1) * C);
-            if (nChunk > 0) {
-                chunkOffset[nChunk] = chunkOffset[nChunk - 1] + chunkLength[nChunk - 1] * C;
-            }
-            numberOfValues += chunkLength[nChunk] * C;
         }
-        chunkOffset[numberOfChunks] = chunkOffset[numberOfChunks - 1] +
-            chunkLength[numberOfChunks - 1] * C;
+        setChunkOffsets(chunkLength, C, &chunkOffset);
 
         // save values
-        values.resize(numberOfValues);
-        column.resize(numberOfValues);
-        std::fill(begin(values), end(values), 0);
-        std::fill(begin(column), end(column), 0);
-        int currentRow = 0;
-        int index = 0;
-        for (const auto& pair: matrix) {
-            if (pair.first.x() != currentRow) {
-                currentRow = pair.first.x();
-                index = 0;
-            }
-            const int chunk = pair.first.x() / C;
-            const int row   = pair.first.x() % C;
-            const int start = chunkOffset[chunk];
-            const int idx   = start + index * C + row;
-            values[idx]     = pair.second;
-            column[idx]     = pair.first.y();
-            ++index;
-        }
+        saveValues(matrix, matrixRows, C, chunkOffset, static_cast<const int*>(0),
+                   &container->values, &container->column);
     }
 };
 
@@ -313,6 +388,28 @@ public:
         SellHelpers::InitFromMatrix<VALUETYPE, C, SIGMA>()(this, matrix);
     }
 
+    /**
+     * Bulk initialization from a complete matrix in CSR format. This
+     * avoids the per-entry overhead of the std::map above and is
+     * parallelized.
+     */
+    void initFromMatrix(const CSRMatrix<VALUETYPE>& matrix)
+    {
+        SellHelpers::InitFromMatrix<VALUETYPE, C, SIGMA>()(this, matrix);
+    }
+
+    /**
+     * Same as above, but for matrices in coordinate format (COO):
+     * entry i is located at (rows[i], columns[i]).
+     */
+    void initFromMatrix(
+        const std::vector<int>& rows,
+        const std::vector<int>& columns,
+        const std::vector<VALUETYPE>& values)
+    {
+        initFromMatrix(CSRMatrix<VALUETYPE>::fromCOO(dimension, dimension, rows, columns, values));
+    }
+
     inline bool operator==(const SellCSigmaSparseMatrixContainer& other) const
     {
         return ((dimension   == other.dimension)  &&
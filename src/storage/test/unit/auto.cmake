@@ -0,0 +1,78 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}boxcelltest.cpp
+  ${RELATIVE_PATH}collectioninterfacetest.cpp
+  ${RELATIVE_PATH}containercelltest.cpp
+  ${RELATIVE_PATH}coordmaptest.cpp
+  ${RELATIVE_PATH}csrmatrixtest.cpp
+  ${RELATIVE_PATH}defaultarrayfiltertest.cpp
+  ${RELATIVE_PATH}defaultfiltertest.cpp
+  ${RELATIVE_PATH}displacedgridtest.cpp
+  ${RELATIVE_PATH}fixedarraytest.cpp
+  ${RELATIVE_PATH}fixedneighborhoodupdatefunctortest.cpp
+  ${RELATIVE_PATH}gridbasetest.cpp
+  ${RELATIVE_PATH}gridtest.cpp
+  ${RELATIVE_PATH}gridvecconvtest.cpp
+  ${RELATIVE_PATH}imagetest.cpp
+  ${RELATIVE_PATH}linepointerassemblytest.cpp
+  ${RELATIVE_PATH}linepointerneighborhoodtest.cpp
+  ${RELATIVE_PATH}linepointerupdatefunctortest.cpp
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}meshlessadaptertest.cpp
+  ${RELATIVE_PATH}multicontainercelltest.cpp
+  ${RELATIVE_PATH}neighborhooditeratortest.cpp
+  ${RELATIVE_PATH}patchbufferfixedtest.cpp
+  ${RELATIVE_PATH}patchbuffertest.cpp
+  ${RELATIVE_PATH}pointerneighborhoodtest.cpp
+  ${RELATIVE_PATH}proxygridtest.cpp
+  ${RELATIVE_PATH}run_tests.cpp
+  ${RELATIVE_PATH}selectortest.cpp
+  ${RELATIVE_PATH}sellcsigmasparsematrixcontainertest.cpp
+  ${RELATIVE_PATH}soagridtest.cpp
+  ${RELATIVE_PATH}unstructuredgridtest.cpp
+  ${RELATIVE_PATH}unstructuredneighborhoodtest.cpp
+  ${RELATIVE_PATH}unstructuredsoagridtest.cpp
+  ${RELATIVE_PATH}unstructuredupdatefunctortest.cpp
+  ${RELATIVE_PATH}updatefunctortest.cpp
+  ${RELATIVE_PATH}vanillaupdatefunctortest.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}boxcelltest.h
+  ${RELATIVE_PATH}collectioninterfacetest.h
+  ${RELATIVE_PATH}containercelltest.h
+  ${RELATIVE_PATH}coordmaptest.h
+  ${RELATIVE_PATH}csrmatrixtest.h
+  ${RELATIVE_PATH}cudaarraytest.h
+  ${RELATIVE_PATH}cudagridtest.h
+  ${RELATIVE_PATH}cudasoagridtest.h
+  ${RELATIVE_PATH}defaultarrayfiltertest.h
+  ${RELATIVE_PATH}defaultcudaarrayfiltertest.h
+  ${RELATIVE_PATH}defaultcudafiltertest.h
+  ${RELATIVE_PATH}defaultfiltertest.h
+  ${RELATIVE_PATH}displacedgridtest.h
+  ${RELATIVE_PATH}fixedarraytest.h
+  ${RELATIVE_PATH}fixedneighborhoodupdatefunctortest.h
+  ${RELATIVE_PATH}gridbasetest.h
+  ${RELATIVE_PATH}gridtest.h
+  ${RELATIVE_PATH}gridvecconvtest.h
+  ${RELATIVE_PATH}imagetest.h
+  ${RELATIVE_PATH}linepointerassemblytest.h
+  ${RELATIVE_PATH}linepointerneighborhoodtest.h
+  ${RELATIVE_PATH}linepointerupdatefunctortest.h
+  ${RELATIVE_PATH}meshlessadaptertest.h
+  ${RELATIVE_PATH}multicontainercelltest.h
+  ${RELATIVE_PATH}neighborhooditeratortest.h
+  ${RELATIVE_PATH}patchbufferfixedtest.h
+  ${RELATIVE_PATH}patchbuffertest.h
+  ${RELATIVE_PATH}pointerneighborhoodtest.h
+  ${RELATIVE_PATH}proxygridtest.h
+  ${RELATIVE_PATH}selectorcudatest.h
+  ${RELATIVE_PATH}selectortest.h
+  ${RELATIVE_PATH}sellcsigmasparsematrixcontainertest.h
+  ${RELATIVE_PATH}soagridtest.h
+  ${RELATIVE_PATH}unstructuredgridtest.h
+  ${RELATIVE_PATH}unstructuredneighborhoodtest.h
+  ${RELATIVE_PATH}unstructuredsoagridtest.h
+  ${RELATIVE_PATH}unstructuredupdatefunctortest.h
+  ${RELATIVE_PATH}updatefunctortest.h
+  ${RELATIVE_PATH}vanillaupdatefunctortest.h
+)
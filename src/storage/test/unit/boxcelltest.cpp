@@ -0,0 +1,56 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_BoxCellTest_init = false;
+#include "/root/repo/src/storage/test/unit/boxcelltest.h"
+
+static BoxCellTest suite_BoxCellTest;
+
+static CxxTest::List Tests_BoxCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BoxCellTest( "/root/repo/src/storage/test/unit/boxcelltest.h", 72, "BoxCellTest", suite_BoxCellTest, Tests_BoxCellTest );
+
+static class TestDescription_suite_BoxCellTest_testBasic2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoxCellTest_testBasic2D() : CxxTest::RealTestDescription( Tests_BoxCellTest, suiteDescription_BoxCellTest, 107, "testBasic2D" ) {}
+ void runTest() { suite_BoxCellTest.testBasic2D(); }
+} testDescription_suite_BoxCellTest_testBasic2D;
+
+static class TestDescription_suite_BoxCellTest_test2DCellTransport : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoxCellTest_test2DCellTransport() : CxxTest::RealTestDescription( Tests_BoxCellTest, suiteDescription_BoxCellTest, 169, "test2DCellTransport" ) {}
+ void runTest() { suite_BoxCellTest.test2DCellTransport(); }
+} testDescription_suite_BoxCellTest_test2DCellTransport;
+
+static class TestDescription_suite_BoxCellTest_testMisplacedParticlesMigrate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoxCellTest_testMisplacedParticlesMigrate() : CxxTest::RealTestDescription( Tests_BoxCellTest, suiteDescription_BoxCellTest, 228, "testMisplacedParticlesMigrate" ) {}
+ void runTest() { suite_BoxCellTest.testMisplacedParticlesMigrate(); }
+} testDescription_suite_BoxCellTest_testMisplacedParticlesMigrate;
+
+static class TestDescription_suite_BoxCellTest_test3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_BoxCellTest_test3D() : CxxTest::RealTestDescription( Tests_BoxCellTest, suiteDescription_BoxCellTest, 254, "test3D" ) {}
+ void runTest() { suite_BoxCellTest.test3D(); }
+} testDescription_suite_BoxCellTest_test3D;
+
@@ -119,7 +119,13 @@ public:
         }
 
         for (CoordBox<2>::Iterator i = box.begin(); i != box.end(); ++i) {
-            for (int j = 0; j < 4; ++j) {
+            for (int k = 0; k < 4; ++k) {
+                // particles which left their box have been sorted to
+                // the end of the container, so we need to reconstruct
+                // their initial placement from their position:
+                FloatCoord<2> offset = grid2[*i].particles[k].getPos() / 0.95 - cellDim.scale(*i);
+                int j = (offset[0] > 0.5 ? 2 : 0) + (offset[1] > 0.5 ? 1 : 0);
+
                 // a particle should be able to see a field of 5x3
                 // particles (including itself), unless it's situated at
                 // the border of the simulation space:
@@ -155,7 +161,7 @@ public:
                 }
 
                 int expected = fieldDimX * fieldDimY;
-                TS_ASSERT_EQUALS(grid2[*i].particles[j].getNeighbors(), expected);
+                TS_ASSERT_EQUALS(grid2[*i].particles[k].getNeighbors(), expected);
             }
         }
     }
@@ -219,6 +225,32 @@ public:
         }
     }
 
+    void testMisplacedParticlesMigrate()
+    {
+        grid1[Coord<2>(3, 2)].insert(SimpleParticle<2>(FloatCoord<2>(8.5, 7.5), 1.0, 0.5));
+
+        UpdateFunctor<CellType>()(
+            region,
+            Coord<2>(),
+            Coord<2>(),
+            grid1,
+            &grid2,
+            0);
+
+        // the new particle starts in its container's outbox, so it
+        // should have been picked up by the box it's really located in:
+        TS_ASSERT_EQUALS(grid2[Coord<2>(3, 2)].size(), std::size_t(4));
+        TS_ASSERT_EQUALS(grid2[Coord<2>(4, 2)].size(), std::size_t(5));
+
+        int found = 0;
+        for (std::size_t i = 0; i < grid2[Coord<2>(4, 2)].size(); ++i) {
+            if (grid2[Coord<2>(4, 2)][i].getPos() == FloatCoord<2>(8.5, 7.5)) {
+                ++found;
+            }
+        }
+        TS_ASSERT_EQUALS(found, 1);
+    }
+
     void test3D()
     {
         typedef BoxCell<FixedArray<SimpleParticle<3>, 30> > CellType;
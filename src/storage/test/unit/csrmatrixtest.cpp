@@ -0,0 +1,63 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_CSRMatrixTest_init = false;
+#include "/root/repo/src/storage/test/unit/csrmatrixtest.h"
+
+static CSRMatrixTest suite_CSRMatrixTest;
+
+static CxxTest::List Tests_CSRMatrixTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CSRMatrixTest( "/root/repo/src/storage/test/unit/csrmatrixtest.h", 10, "CSRMatrixTest", suite_CSRMatrixTest, Tests_CSRMatrixTest );
+
+static class TestDescription_suite_CSRMatrixTest_testFromCOO : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRMatrixTest_testFromCOO() : CxxTest::RealTestDescription( Tests_CSRMatrixTest, suiteDescription_CSRMatrixTest, 27, "testFromCOO" ) {}
+ void runTest() { suite_CSRMatrixTest.testFromCOO(); }
+} testDescription_suite_CSRMatrixTest_testFromCOO;
+
+static class TestDescription_suite_CSRMatrixTest_testFromMap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRMatrixTest_testFromMap() : CxxTest::RealTestDescription( Tests_CSRMatrixTest, suiteDescription_CSRMatrixTest, 48, "testFromMap" ) {}
+ void runTest() { suite_CSRMatrixTest.testFromMap(); }
+} testDescription_suite_CSRMatrixTest_testFromMap;
+
+static class TestDescription_suite_CSRMatrixTest_testFromArrays : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRMatrixTest_testFromArrays() : CxxTest::RealTestDescription( Tests_CSRMatrixTest, suiteDescription_CSRMatrixTest, 60, "testFromArrays" ) {}
+ void runTest() { suite_CSRMatrixTest.testFromArrays(); }
+} testDescription_suite_CSRMatrixTest_testFromArrays;
+
+static class TestDescription_suite_CSRMatrixTest_testTransposed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRMatrixTest_testTransposed() : CxxTest::RealTestDescription( Tests_CSRMatrixTest, suiteDescription_CSRMatrixTest, 83, "testTransposed" ) {}
+ void runTest() { suite_CSRMatrixTest.testTransposed(); }
+} testDescription_suite_CSRMatrixTest_testTransposed;
+
+static class TestDescription_suite_CSRMatrixTest_testOutOfBounds : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CSRMatrixTest_testOutOfBounds() : CxxTest::RealTestDescription( Tests_CSRMatrixTest, suiteDescription_CSRMatrixTest, 94, "testOutOfBounds" ) {}
+ void runTest() { suite_CSRMatrixTest.testOutOfBounds(); }
+} testDescription_suite_CSRMatrixTest_testOutOfBounds;
+
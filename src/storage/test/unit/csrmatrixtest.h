@@ -0,0 +1,115 @@
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
+#include <libgeodecomp/storage/csrmatrix.h>
+
+#include <cxxtest/TestSuite.h>
+
+using namespace LibGeoDecomp;
+
+namespace LibGeoDecomp {
+
+class CSRMatrixTest : public CxxTest::TestSuite
+{
+public:
+    void setUp()
+    {
+        // 0 1 0 0
+        // 2 0 3 0
+        // 0 0 0 0
+        // 4 0 5 6
+        rows.clear();
+        columns.clear();
+        values.clear();
+        rows    << 3 << 1 << 0 << 3 << 1 << 3;
+        columns << 3 << 2 << 1 << 0 << 0 << 2;
+        values  << 6 << 3 << 1 << 4 << 2 << 5;
+    }
+
+    void testFromCOO()
+    {
+        CSRMatrix<double> matrix = CSRMatrix<double>::fromCOO(4, 4, rows, columns, values);
+
+        std::vector<int> expectedOffsets;
+        std::vector<int> expectedColumns;
+        std::vector<double> expectedValues;
+        expectedOffsets << 0 << 1 << 3 << 3 << 6;
+        expectedColumns << 1 << 0 << 2 << 0 << 2 << 3;
+        expectedValues  << 1 << 2 << 3 << 4 << 5 << 6;
+
+        TS_ASSERT_EQUALS(4, matrix.rows());
+        TS_ASSERT_EQUALS(4, matrix.columns());
+        TS_ASSERT_EQUALS(std::size_t(6), matrix.nonZeros());
+        TS_ASSERT_EQUALS(0, matrix.rowLength(2));
+        TS_ASSERT_EQUALS(3, matrix.rowLength(3));
+        TS_ASSERT_EQUALS(expectedOffsets, matrix.rowOffsets());
+        TS_ASSERT_EQUALS(expectedColumns, matrix.columnIndices());
+        TS_ASSERT_EQUALS(expectedValues,  matrix.values());
+    }
+
+    void testFromMap()
+    {
+        std::map<Coord<2>, double> map;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            map[Coord<2>(rows[i], columns[i])] = values[i];
+        }
+
+        TS_ASSERT_EQUALS(
+            CSRMatrix<double>::fromCOO(4, 4, rows, columns, values),
+            CSRMatrix<double>::fromMap(4, 4, map));
+    }
+
+    void testFromArrays()
+    {
+        std::vector<int> offsets;
+        std::vector<int> unsortedColumns;
+        std::vector<double> unsortedValues;
+        offsets         << 0 << 1 << 3 << 3 << 6;
+        unsortedColumns << 1 << 2 << 0 << 3 << 0 << 2;
+        unsortedValues  << 1 << 3 << 2 << 6 << 4 << 5;
+
+        CSRMatrix<double> matrix(4, 4, &offsets, &unsortedColumns, &unsortedValues);
+        TS_ASSERT_EQUALS(CSRMatrix<double>::fromCOO(4, 4, rows, columns, values), matrix);
+        TS_ASSERT(unsortedValues.empty());
+
+        offsets.clear();
+        offsets << 0 << 1;
+        unsortedColumns.clear();
+        unsortedColumns << 0;
+        unsortedValues.clear();
+        TS_ASSERT_THROWS(
+            CSRMatrix<double>(1, 1, &offsets, &unsortedColumns, &unsortedValues),
+            std::invalid_argument&);
+    }
+
+    void testTransposed()
+    {
+        columns.back() = 4;
+        CSRMatrix<double> matrix = CSRMatrix<double>::fromCOO(4, 5, rows, columns, values);
+        CSRMatrix<double> expected = CSRMatrix<double>::fromCOO(5, 4, columns, rows, values);
+        CSRMatrix<double> transposed = matrix.transposed();
+
+        TS_ASSERT_EQUALS(expected, transposed);
+        TS_ASSERT_EQUALS(matrix, transposed.transposed());
+    }
+
+    void testOutOfBounds()
+    {
+        TS_ASSERT_THROWS(
+            CSRMatrix<double>::fromCOO(3, 4, rows, columns, values),
+            std::out_of_range&);
+        TS_ASSERT_THROWS(
+            CSRMatrix<double>::fromCOO(4, 3, rows, columns, values),
+            std::out_of_range&);
+
+        rows << 0;
+        TS_ASSERT_THROWS(
+            CSRMatrix<double>::fromCOO(4, 4, rows, columns, values),
+            std::invalid_argument&);
+    }
+
+private:
+    std::vector<int> rows;
+    std::vector<int> columns;
+    std::vector<double> values;
+};
+
+}
@@ -40,6 +40,12 @@ public:
         TS_ASSERT_EQUALS(2, b[1]);
         TS_ASSERT_EQUALS(3, b[2]);
 
+        TS_ASSERT_THROWS(b.resize(11), std::out_of_range);
+        b.resize(2);
+        TS_ASSERT_EQUALS(std::size_t(2), b.size());
+        TS_ASSERT_EQUALS(0, b[0]);
+        TS_ASSERT_EQUALS(2, b[1]);
+
         a.clear();
         TS_ASSERT_EQUALS(std::size_t(0), a.size());
     }
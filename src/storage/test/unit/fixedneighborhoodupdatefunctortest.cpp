@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_FixedNeighborhoodUpdateFunctorTest_init = false;
+#include "/root/repo/src/storage/test/unit/fixedneighborhoodupdatefunctortest.h"
+
+static FixedNeighborhoodUpdateFunctorTest suite_FixedNeighborhoodUpdateFunctorTest;
+
+static CxxTest::List Tests_FixedNeighborhoodUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedNeighborhoodUpdateFunctorTest( "/root/repo/src/storage/test/unit/fixedneighborhoodupdatefunctortest.h", 57, "FixedNeighborhoodUpdateFunctorTest", suite_FixedNeighborhoodUpdateFunctorTest, Tests_FixedNeighborhoodUpdateFunctorTest );
+
+static class TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_FixedNeighborhoodUpdateFunctorTest_testBasic() : CxxTest::RealTestDescription( Tests_FixedNeighborhoodUpdateFunctorTest, suiteDescription_FixedNeighborhoodUpdateFunctorTest, 61, "testBasic" ) {}
+ void runTest() { suite_FixedNeighborhoodUpdateFunctorTest.testBasic(); }
+} testDescription_suite_FixedNeighborhoodUpdateFunctorTest_testBasic;
+
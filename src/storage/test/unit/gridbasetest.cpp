@@ -0,0 +1,37 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_GridBaseTest_init = false;
+#include "/root/repo/src/storage/test/unit/gridbasetest.h"
+
+static GridBaseTest suite_GridBaseTest;
+
+static CxxTest::List Tests_GridBaseTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GridBaseTest( "/root/repo/src/storage/test/unit/gridbasetest.h", 8, "GridBaseTest", suite_GridBaseTest, Tests_GridBaseTest );
+
+static class TestDescription_suite_GridBaseTest_testEqualsAndDiffersOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridBaseTest_testEqualsAndDiffersOperator() : CxxTest::RealTestDescription( Tests_GridBaseTest, suiteDescription_GridBaseTest, 11, "testEqualsAndDiffersOperator" ) {}
+ void runTest() { suite_GridBaseTest.testEqualsAndDiffersOperator(); }
+} testDescription_suite_GridBaseTest_testEqualsAndDiffersOperator;
+
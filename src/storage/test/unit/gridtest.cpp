@@ -0,0 +1,176 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_GridTest_init = false;
+#include "/root/repo/src/storage/test/unit/gridtest.h"
+
+static GridTest suite_GridTest;
+
+static CxxTest::List Tests_GridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GridTest( "/root/repo/src/storage/test/unit/gridtest.h", 58, "GridTest", suite_GridTest, Tests_GridTest );
+
+static class TestDescription_suite_GridTest_testDefaultConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testDefaultConstructor() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 83, "testDefaultConstructor" ) {}
+ void runTest() { suite_GridTest.testDefaultConstructor(); }
+} testDescription_suite_GridTest_testDefaultConstructor;
+
+static class TestDescription_suite_GridTest_testCopyConstructorFromGridBase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testCopyConstructorFromGridBase() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 90, "testCopyConstructorFromGridBase" ) {}
+ void runTest() { suite_GridTest.testCopyConstructorFromGridBase(); }
+} testDescription_suite_GridTest_testCopyConstructorFromGridBase;
+
+static class TestDescription_suite_GridTest_testConstructorDefaultInit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testConstructorDefaultInit() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 99, "testConstructorDefaultInit" ) {}
+ void runTest() { suite_GridTest.testConstructorDefaultInit(); }
+} testDescription_suite_GridTest_testConstructorDefaultInit;
+
+static class TestDescription_suite_GridTest_testMultiDimensionalConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testMultiDimensionalConstructor() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 107, "testMultiDimensionalConstructor" ) {}
+ void runTest() { suite_GridTest.testMultiDimensionalConstructor(); }
+} testDescription_suite_GridTest_testMultiDimensionalConstructor;
+
+static class TestDescription_suite_GridTest_testOperatorEqual1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testOperatorEqual1() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 121, "testOperatorEqual1" ) {}
+ void runTest() { suite_GridTest.testOperatorEqual1(); }
+} testDescription_suite_GridTest_testOperatorEqual1;
+
+static class TestDescription_suite_GridTest_testOperatorEqual2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testOperatorEqual2() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 145, "testOperatorEqual2" ) {}
+ void runTest() { suite_GridTest.testOperatorEqual2(); }
+} testDescription_suite_GridTest_testOperatorEqual2;
+
+static class TestDescription_suite_GridTest_testCopyConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testCopyConstructor() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 152, "testCopyConstructor" ) {}
+ void runTest() { suite_GridTest.testCopyConstructor(); }
+} testDescription_suite_GridTest_testCopyConstructor;
+
+static class TestDescription_suite_GridTest_testOperatorSquareBracketsOfCoord : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testOperatorSquareBracketsOfCoord() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 170, "testOperatorSquareBracketsOfCoord" ) {}
+ void runTest() { suite_GridTest.testOperatorSquareBracketsOfCoord(); }
+} testDescription_suite_GridTest_testOperatorSquareBracketsOfCoord;
+
+static class TestDescription_suite_GridTest_testResize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testResize() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 178, "testResize" ) {}
+ void runTest() { suite_GridTest.testResize(); }
+} testDescription_suite_GridTest_testResize;
+
+static class TestDescription_suite_GridTest_testResizeUninitialized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testResizeUninitialized() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 186, "testResizeUninitialized" ) {}
+ void runTest() { suite_GridTest.testResizeUninitialized(); }
+} testDescription_suite_GridTest_testResizeUninitialized;
+
+static class TestDescription_suite_GridTest_testGetNeighborhood : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testGetNeighborhood() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 200, "testGetNeighborhood" ) {}
+ void runTest() { suite_GridTest.testGetNeighborhood(); }
+} testDescription_suite_GridTest_testGetNeighborhood;
+
+static class TestDescription_suite_GridTest_testGetNeighborhoodReferenceReturn : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testGetNeighborhoodReferenceReturn() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 213, "testGetNeighborhoodReferenceReturn" ) {}
+ void runTest() { suite_GridTest.testGetNeighborhoodReferenceReturn(); }
+} testDescription_suite_GridTest_testGetNeighborhoodReferenceReturn;
+
+static class TestDescription_suite_GridTest_testGetNeighborhoodInUpperRightCorner : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testGetNeighborhoodInUpperRightCorner() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 229, "testGetNeighborhoodInUpperRightCorner" ) {}
+ void runTest() { suite_GridTest.testGetNeighborhoodInUpperRightCorner(); }
+} testDescription_suite_GridTest_testGetNeighborhoodInUpperRightCorner;
+
+static class TestDescription_suite_GridTest_testGetSetManyCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testGetSetManyCells() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 244, "testGetSetManyCells" ) {}
+ void runTest() { suite_GridTest.testGetSetManyCells(); }
+} testDescription_suite_GridTest_testGetSetManyCells;
+
+static class TestDescription_suite_GridTest_testToString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testToString() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 263, "testToString" ) {}
+ void runTest() { suite_GridTest.testToString(); }
+} testDescription_suite_GridTest_testToString;
+
+static class TestDescription_suite_GridTest_testEdgeCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testEdgeCell() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 292, "testEdgeCell" ) {}
+ void runTest() { suite_GridTest.testEdgeCell(); }
+} testDescription_suite_GridTest_testEdgeCell;
+
+static class TestDescription_suite_GridTest_testFill2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testFill2D() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 307, "testFill2D" ) {}
+ void runTest() { suite_GridTest.testFill2D(); }
+} testDescription_suite_GridTest_testFill2D;
+
+static class TestDescription_suite_GridTest_testFill3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testFill3D() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 329, "testFill3D" ) {}
+ void runTest() { suite_GridTest.testFill3D(); }
+} testDescription_suite_GridTest_testFill3D;
+
+static class TestDescription_suite_GridTest_testDefaultTopology : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testDefaultTopology() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 353, "testDefaultTopology" ) {}
+ void runTest() { suite_GridTest.testDefaultTopology(); }
+} testDescription_suite_GridTest_testDefaultTopology;
+
+static class TestDescription_suite_GridTest_testTorusTopology : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testTorusTopology() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 374, "testTorusTopology" ) {}
+ void runTest() { suite_GridTest.testTorusTopology(); }
+} testDescription_suite_GridTest_testTorusTopology;
+
+static class TestDescription_suite_GridTest_testFill3d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testFill3d() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 397, "testFill3d" ) {}
+ void runTest() { suite_GridTest.testFill3d(); }
+} testDescription_suite_GridTest_testFill3d;
+
+static class TestDescription_suite_GridTest_testCompare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testCompare() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 412, "testCompare" ) {}
+ void runTest() { suite_GridTest.testCompare(); }
+} testDescription_suite_GridTest_testCompare;
+
+static class TestDescription_suite_GridTest_testLoadSaveMember : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testLoadSaveMember() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 431, "testLoadSaveMember" ) {}
+ void runTest() { suite_GridTest.testLoadSaveMember(); }
+} testDescription_suite_GridTest_testLoadSaveMember;
+
+static class TestDescription_suite_GridTest_testCreationOfZeroSizedGrid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_GridTest_testCreationOfZeroSizedGrid() : CxxTest::RealTestDescription( Tests_GridTest, suiteDescription_GridTest, 487, "testCreationOfZeroSizedGrid" ) {}
+ void runTest() { suite_GridTest.testCreationOfZeroSizedGrid(); }
+} testDescription_suite_GridTest_testCreationOfZeroSizedGrid;
+
@@ -183,6 +183,20 @@ public:
         TS_ASSERT_EQUALS(Coord<2>(12, 34), g.getDimensions());
     }
 
+    void testResizeUninitialized()
+    {
+        Grid<int> g(Coord<2>(4, 3), 1);
+        g.resizeUninitialized(Coord<2>(12, 34));
+        TS_ASSERT_EQUALS(Coord<2>(12, 34), g.getDimensions());
+
+        g[Coord<2>(11, 33)] = 47;
+        TS_ASSERT_EQUALS(47, g[Coord<2>(11, 33)]);
+
+        // later resizes value-initialize new cells again:
+        g.resize(Coord<2>(100, 100));
+        TS_ASSERT_EQUALS(0, g[Coord<2>(99, 99)]);
+    }
+
     void testGetNeighborhood()
     {
         CoordMap<TestCell<2> > hood = testGrid->getNeighborhood(Coord<2>(1,2));
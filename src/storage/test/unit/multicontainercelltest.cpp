@@ -0,0 +1,51 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_MultiContainerCellTest_init = false;
+#include "/root/repo/src/storage/test/unit/multicontainercelltest.h"
+
+static MultiContainerCellTest suite_MultiContainerCellTest;
+
+static CxxTest::List Tests_MultiContainerCellTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MultiContainerCellTest( "/root/repo/src/storage/test/unit/multicontainercelltest.h", 144, "MultiContainerCellTest", suite_MultiContainerCellTest, Tests_MultiContainerCellTest );
+
+static class TestDescription_suite_MultiContainerCellTest_testConstructionAndAccess : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultiContainerCellTest_testConstructionAndAccess() : CxxTest::RealTestDescription( Tests_MultiContainerCellTest, suiteDescription_MultiContainerCellTest, 147, "testConstructionAndAccess" ) {}
+ void runTest() { suite_MultiContainerCellTest.testConstructionAndAccess(); }
+} testDescription_suite_MultiContainerCellTest_testConstructionAndAccess;
+
+static class TestDescription_suite_MultiContainerCellTest_testUpdate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultiContainerCellTest_testUpdate() : CxxTest::RealTestDescription( Tests_MultiContainerCellTest, suiteDescription_MultiContainerCellTest, 172, "testUpdate" ) {}
+ void runTest() { suite_MultiContainerCellTest.testUpdate(); }
+} testDescription_suite_MultiContainerCellTest_testUpdate;
+
+static class TestDescription_suite_MultiContainerCellTest_testBoxCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_MultiContainerCellTest_testBoxCell() : CxxTest::RealTestDescription( Tests_MultiContainerCellTest, suiteDescription_MultiContainerCellTest, 258, "testBoxCell" ) {}
+ void runTest() { suite_MultiContainerCellTest.testBoxCell(); }
+} testDescription_suite_MultiContainerCellTest_testBoxCell;
+
@@ -0,0 +1,50 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_NeighborhoodIteratorTest_init = false;
+#include "/root/repo/src/storage/test/unit/neighborhooditeratortest.h"
+
+static NeighborhoodIteratorTest suite_NeighborhoodIteratorTest;
+
+static CxxTest::List Tests_NeighborhoodIteratorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_NeighborhoodIteratorTest( "/root/repo/src/storage/test/unit/neighborhooditeratortest.h", 10, "NeighborhoodIteratorTest", suite_NeighborhoodIteratorTest, Tests_NeighborhoodIteratorTest );
+
+static class TestDescription_suite_NeighborhoodIteratorTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NeighborhoodIteratorTest_testBasic() : CxxTest::RealTestDescription( Tests_NeighborhoodIteratorTest, suiteDescription_NeighborhoodIteratorTest, 111, "testBasic" ) {}
+ void runTest() { suite_NeighborhoodIteratorTest.testBasic(); }
+} testDescription_suite_NeighborhoodIteratorTest_testBasic;
+
+static class TestDescription_suite_NeighborhoodIteratorTest_testSkippingOfEmptyCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NeighborhoodIteratorTest_testSkippingOfEmptyCells() : CxxTest::RealTestDescription( Tests_NeighborhoodIteratorTest, suiteDescription_NeighborhoodIteratorTest, 242, "testSkippingOfEmptyCells" ) {}
+ void runTest() { suite_NeighborhoodIteratorTest.testSkippingOfEmptyCells(); }
+} testDescription_suite_NeighborhoodIteratorTest_testSkippingOfEmptyCells;
+
+static class TestDescription_suite_NeighborhoodIteratorTest_testSkippingOfAllEmptyCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_NeighborhoodIteratorTest_testSkippingOfAllEmptyCells() : CxxTest::RealTestDescription( Tests_NeighborhoodIteratorTest, suiteDescription_NeighborhoodIteratorTest, 281, "testSkippingOfAllEmptyCells" ) {}
+ void runTest() { suite_NeighborhoodIteratorTest.testSkippingOfAllEmptyCells(); }
+} testDescription_suite_NeighborhoodIteratorTest_testSkippingOfAllEmptyCells;
+
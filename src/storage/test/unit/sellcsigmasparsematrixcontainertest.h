@@ -1,6 +1,7 @@
 #include <libgeodecomp/config.h>
 #include <libgeodecomp/storage/sellcsigmasparsematrixcontainer.h>
 #include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
 
 #include <cxxtest/TestSuite.h>
 
@@ -8,6 +9,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <map>
+#include <vector>
 
 using namespace LibGeoDecomp;
 
@@ -1022,6 +1024,43 @@ public:
         TS_ASSERT(col[11] == 0);
         TS_ASSERT(col[12] == 2);
         TS_ASSERT(col[13] == 0);
+#endif
+    }
+
+    void testInitFromCSRAndCOO()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        std::map<Coord<2>, double> matrix;
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<double> values;
+
+        // insert entries in reverse order so that the COO path has
+        // to sort:
+        for (int row = 49; row >= 0; --row) {
+            for (int column = 49; column >= 0; --column) {
+                if (((row * 7 + column * 3) % 5) == 0) {
+                    matrix[Coord<2>(row, column)] = row + column * 0.1;
+                    rows << row;
+                    columns << column;
+                    values << row + column * 0.1;
+                }
+            }
+        }
+
+        SellCSigmaSparseMatrixContainer<double, 4, 8> expected(50);
+        SellCSigmaSparseMatrixContainer<double, 4, 8> fromCOO(50);
+        SellCSigmaSparseMatrixContainer<double, 4, 8> fromCSR(50);
+        expected.initFromMatrix(matrix);
+        fromCOO.initFromMatrix(rows, columns, values);
+        fromCSR.initFromMatrix(CSRMatrix<double>::fromCOO(50, 50, rows, columns, values));
+
+        TS_ASSERT_EQUALS(expected, fromCOO);
+        TS_ASSERT_EQUALS(expected, fromCSR);
+
+        std::vector<int> invalidRows(rows);
+        invalidRows[0] = 50;
+        TS_ASSERT_THROWS(fromCOO.initFromMatrix(invalidRows, columns, values), std::out_of_range&);
 #endif
     }
 };
@@ -0,0 +1,98 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_SoAGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/soagridtest.h"
+
+static SoAGridTest suite_SoAGridTest;
+
+static CxxTest::List Tests_SoAGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SoAGridTest( "/root/repo/src/storage/test/unit/soagridtest.h", 160, "SoAGridTest", suite_SoAGridTest, Tests_SoAGridTest );
+
+static class TestDescription_suite_SoAGridTest_testBasic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testBasic() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 168, "testBasic" ) {}
+ void runTest() { suite_SoAGridTest.testBasic(); }
+} testDescription_suite_SoAGridTest_testBasic;
+
+static class TestDescription_suite_SoAGridTest_test2d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_test2d() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 193, "test2d" ) {}
+ void runTest() { suite_SoAGridTest.test2d(); }
+} testDescription_suite_SoAGridTest_test2d;
+
+static class TestDescription_suite_SoAGridTest_testGetSetManyCells : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testGetSetManyCells() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 220, "testGetSetManyCells" ) {}
+ void runTest() { suite_SoAGridTest.testGetSetManyCells(); }
+} testDescription_suite_SoAGridTest_testGetSetManyCells;
+
+static class TestDescription_suite_SoAGridTest_testInitialization : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testInitialization() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 251, "testInitialization" ) {}
+ void runTest() { suite_SoAGridTest.testInitialization(); }
+} testDescription_suite_SoAGridTest_testInitialization;
+
+static class TestDescription_suite_SoAGridTest_testDisplacementWithTopologicalCorrectness : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testDisplacementWithTopologicalCorrectness() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 281, "testDisplacementWithTopologicalCorrectness" ) {}
+ void runTest() { suite_SoAGridTest.testDisplacementWithTopologicalCorrectness(); }
+} testDescription_suite_SoAGridTest_testDisplacementWithTopologicalCorrectness;
+
+static class TestDescription_suite_SoAGridTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testSoA() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 308, "testSoA" ) {}
+ void runTest() { suite_SoAGridTest.testSoA(); }
+} testDescription_suite_SoAGridTest_testSoA;
+
+static class TestDescription_suite_SoAGridTest_testSoA2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testSoA2() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 368, "testSoA2" ) {}
+ void runTest() { suite_SoAGridTest.testSoA2(); }
+} testDescription_suite_SoAGridTest_testSoA2;
+
+static class TestDescription_suite_SoAGridTest_testSoAWithOffset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testSoAWithOffset() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 427, "testSoAWithOffset" ) {}
+ void runTest() { suite_SoAGridTest.testSoAWithOffset(); }
+} testDescription_suite_SoAGridTest_testSoAWithOffset;
+
+static class TestDescription_suite_SoAGridTest_testLoadSaveMember2D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testLoadSaveMember2D() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 494, "testLoadSaveMember2D" ) {}
+ void runTest() { suite_SoAGridTest.testLoadSaveMember2D(); }
+} testDescription_suite_SoAGridTest_testLoadSaveMember2D;
+
+static class TestDescription_suite_SoAGridTest_testLoadSaveMember3D : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testLoadSaveMember3D() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 563, "testLoadSaveMember3D" ) {}
+ void runTest() { suite_SoAGridTest.testLoadSaveMember3D(); }
+} testDescription_suite_SoAGridTest_testLoadSaveMember3D;
+
+static class TestDescription_suite_SoAGridTest_testSimulatorCreation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_SoAGridTest_testSimulatorCreation() : CxxTest::RealTestDescription( Tests_SoAGridTest, suiteDescription_SoAGridTest, 632, "testSimulatorCreation" ) {}
+ void runTest() { suite_SoAGridTest.testSimulatorCreation(); }
+} testDescription_suite_SoAGridTest_testSimulatorCreation;
+
@@ -0,0 +1,74 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredGridTest_init = false;
+#include "/root/repo/src/storage/test/unit/unstructuredgridtest.h"
+
+static UnstructuredGridTest suite_UnstructuredGridTest;
+
+static CxxTest::List Tests_UnstructuredGridTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredGridTest( "/root/repo/src/storage/test/unit/unstructuredgridtest.h", 61, "UnstructuredGridTest", suite_UnstructuredGridTest, Tests_UnstructuredGridTest );
+
+static class TestDescription_suite_UnstructuredGridTest_testDefaultConstructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testDefaultConstructor() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 86, "testDefaultConstructor" ) {}
+ void runTest() { suite_UnstructuredGridTest.testDefaultConstructor(); }
+} testDescription_suite_UnstructuredGridTest_testDefaultConstructor;
+
+static class TestDescription_suite_UnstructuredGridTest_testConstructorDefaultInit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testConstructorDefaultInit() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 94, "testConstructorDefaultInit" ) {}
+ void runTest() { suite_UnstructuredGridTest.testConstructorDefaultInit(); }
+} testDescription_suite_UnstructuredGridTest_testConstructorDefaultInit;
+
+static class TestDescription_suite_UnstructuredGridTest_testOperatorEqual1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testOperatorEqual1() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 104, "testOperatorEqual1" ) {}
+ void runTest() { suite_UnstructuredGridTest.testOperatorEqual1(); }
+} testDescription_suite_UnstructuredGridTest_testOperatorEqual1;
+
+static class TestDescription_suite_UnstructuredGridTest_testAssimentOperator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testAssimentOperator() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 122, "testAssimentOperator" ) {}
+ void runTest() { suite_UnstructuredGridTest.testAssimentOperator(); }
+} testDescription_suite_UnstructuredGridTest_testAssimentOperator;
+
+static class TestDescription_suite_UnstructuredGridTest_testSetterGetter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testSetterGetter() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 141, "testSetterGetter" ) {}
+ void runTest() { suite_UnstructuredGridTest.testSetterGetter(); }
+} testDescription_suite_UnstructuredGridTest_testSetterGetter;
+
+static class TestDescription_suite_UnstructuredGridTest_testEdgeCell : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testEdgeCell() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 162, "testEdgeCell" ) {}
+ void runTest() { suite_UnstructuredGridTest.testEdgeCell(); }
+} testDescription_suite_UnstructuredGridTest_testEdgeCell;
+
+static class TestDescription_suite_UnstructuredGridTest_testWeightsMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredGridTest_testWeightsMatrix() : CxxTest::RealTestDescription( Tests_UnstructuredGridTest, suiteDescription_UnstructuredGridTest, 179, "testWeightsMatrix" ) {}
+ void runTest() { suite_UnstructuredGridTest.testWeightsMatrix(); }
+} testDescription_suite_UnstructuredGridTest_testWeightsMatrix;
+
@@ -0,0 +1,92 @@
+#include <libgeodecomp/config.h>
+
+// include MPI header first to skirt troubles with Intel MPI and standard C library
+#ifdef LIBGEODECOMP_WITH_MPI
+#include <mpi.h>
+#endif
+
+// nvcc complains about some type traits if we don't define this macro
+#ifdef __CUDACC__
+#define CXXTEST_NO_COPY_CONST
+#endif
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+
+bool suite_UnstructuredUpdateFunctorTest_init = false;
+#include "/root/repo/src/storage/test/unit/unstructuredupdatefunctortest.h"
+
+static UnstructuredUpdateFunctorTest suite_UnstructuredUpdateFunctorTest;
+
+static CxxTest::List Tests_UnstructuredUpdateFunctorTest = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UnstructuredUpdateFunctorTest( "/root/repo/src/storage/test/unit/unstructuredupdatefunctortest.h", 160, "UnstructuredUpdateFunctorTest", suite_UnstructuredUpdateFunctorTest, Tests_UnstructuredUpdateFunctorTest );
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 163, "testBasicSansUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicSansUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicSansUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 209, "testBasicWithUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 255, "testBasicWithSigmaButSansUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaButSansUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaButSansUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 308, "testBasicWithSigmaAndWithUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testBasicWithSigmaAndWithUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testBasicWithSigmaAndWithUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 360, "testSoA" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoA(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoA;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMA : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMA() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 413, "testSoAWithSIGMA" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMA(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMA;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithOpenMP : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithOpenMP() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 466, "testSoAWithOpenMP" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithOpenMP(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithOpenMP;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithMaskedUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithMaskedUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 522, "testSoAWithMaskedUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithMaskedUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithMaskedUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAAndMaskedUpdateLineX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAAndMaskedUpdateLineX() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 583, "testSoAWithSIGMAAndMaskedUpdateLineX" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testSoAWithSIGMAAndMaskedUpdateLineX(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testSoAWithSIGMAAndMaskedUpdateLineX;
+
+static class TestDescription_suite_UnstructuredUpdateFunctorTest_testRangeBoundaries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_UnstructuredUpdateFunctorTest_testRangeBoundaries() : CxxTest::RealTestDescription( Tests_UnstructuredUpdateFunctorTest, suiteDescription_UnstructuredUpdateFunctorTest, 627, "testRangeBoundaries" ) {}
+ void runTest() { suite_UnstructuredUpdateFunctorTest.testRangeBoundaries(); }
+} testDescription_suite_UnstructuredUpdateFunctorTest_testRangeBoundaries;
+
@@ -78,13 +78,17 @@ public:
     double sum;
 };
 
-template<int SIGMA>
+class MaskedUnstructuredSoATestCellAPI : public APITraits::HasMaskedUpdateLineX
+{};
+
+template<int SIGMA, typename ADDITIONAL_API = EmptyUnstructuredTestCellAPI>
 class SimpleUnstructuredSoATestCell
 {
 public:
     typedef short_vec<double, 4> ShortVec;
 
     class API :
+        public ADDITIONAL_API,
         public APITraits::HasUpdateLineX,
         public APITraits::HasSoA,
         public APITraits::HasUnstructuredTopology,
@@ -114,7 +118,7 @@ public:
                 values.gather(&hoodOld->value(), j.first());
                 tmp += values * weights;
             }
-            tmp.store_aligned(&hoodNew->sum() + i * 4);
+            hoodNew.store(&hoodNew->sum(), i * 4, tmp);
         }
     }
 
@@ -143,6 +147,12 @@ public:
 
 LIBFLATARRAY_REGISTER_SOA(SimpleUnstructuredSoATestCell<1  >, ((double)(sum))((double)(value)))
 LIBFLATARRAY_REGISTER_SOA(SimpleUnstructuredSoATestCell<150>, ((double)(sum))((double)(value)))
+
+typedef SimpleUnstructuredSoATestCell<1,   MaskedUnstructuredSoATestCellAPI> MaskedUnstructuredSoATestCell1;
+typedef SimpleUnstructuredSoATestCell<150, MaskedUnstructuredSoATestCellAPI> MaskedUnstructuredSoATestCell150;
+
+LIBFLATARRAY_REGISTER_SOA(MaskedUnstructuredSoATestCell1,   ((double)(sum))((double)(value)))
+LIBFLATARRAY_REGISTER_SOA(MaskedUnstructuredSoATestCell150, ((double)(sum))((double)(value)))
 #endif
 
 namespace LibGeoDecomp {
@@ -450,6 +460,216 @@ public:
                 TS_ASSERT_EQUALS(0.0, gridNew.get(coord).sum);
             }
         }
+#endif
+    }
+
+    void testSoAWithOpenMP()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+#ifdef LIBGEODECOMP_WITH_THREADS
+        typedef SimpleUnstructuredSoATestCell<1> TestCellType;
+        const int DIM = 150;
+        CoordBox<1> dim(Coord<1>(0), Coord<1>(DIM));
+
+        TestCellType defaultCell(200);
+        TestCellType edgeCell(-1);
+
+        UnstructuredSoAGrid<TestCellType, 1, double, 4, 1> gridOld(dim, defaultCell, edgeCell);
+
+        Region<1> region;
+        region << Streak<1>(Coord<1>(10),   30);
+        region << Streak<1>(Coord<1>(37),   60);
+        // two streaks sharing a chunk:
+        region << Streak<1>(Coord<1>(61),   62);
+        region << Streak<1>(Coord<1>(63),   66);
+        region << Streak<1>(Coord<1>(100), 149);
+
+        // lower triangular matrix, so the cost per row varies
+        std::map<Coord<2>, double> matrix;
+        for (int row = 0; row < DIM; ++row) {
+            for (int col = 0; col < row; ++col) {
+                matrix[Coord<2>(row, col)] = 1;
+            }
+        }
+        gridOld.setWeights(0, matrix);
+
+        UnstructuredUpdateFunctor<TestCellType> functor;
+        APITraits::SelectThreadedUpdate<TestCellType>::Value modelThreadingSpec;
+
+        int threads = omp_get_max_threads();
+        omp_set_num_threads(4);
+
+        for (int updatingGhost = 0; updatingGhost < 2; ++updatingGhost) {
+            UnstructuredSoAGrid<TestCellType, 1, double, 4, 1> gridNew(dim, defaultCell, edgeCell);
+            UpdateFunctorHelpers::ConcurrencyEnableOpenMP concurrencySpec(updatingGhost, false);
+
+            functor(region, gridOld, &gridNew, 0, concurrencySpec, modelThreadingSpec);
+
+            for (Coord<1> coord(0); coord < Coord<1>(DIM); ++coord.x()) {
+                if (region.count(coord)) {
+                    TS_ASSERT_EQUALS(coord.x() * 200.0, gridNew.get(coord).sum);
+                } else {
+                    TS_ASSERT_EQUALS(0.0, gridNew.get(coord).sum);
+                }
+            }
+        }
+
+        omp_set_num_threads(threads);
+#endif
+#endif
+    }
+
+    void testSoAWithMaskedUpdateLineX()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        typedef MaskedUnstructuredSoATestCell1 TestCellType;
+        const int DIM = 150;
+        CoordBox<1> dim(Coord<1>(0), Coord<1>(DIM));
+
+        TestCellType defaultCell(200);
+        TestCellType edgeCell(-1);
+
+        UnstructuredSoAGrid<TestCellType, 1, double, 4, 1> gridOld(dim, defaultCell, edgeCell);
+
+        Region<1> region;
+        region << Streak<1>(Coord<1>(10),   30);
+        region << Streak<1>(Coord<1>(37),   60);
+        // within a single chunk:
+        region << Streak<1>(Coord<1>(61),   62);
+        region << Streak<1>(Coord<1>(69),   71);
+        region << Streak<1>(Coord<1>(100), 149);
+
+        std::map<Coord<2>, double> matrix;
+        for (int row = 0; row < DIM; ++row) {
+            for (int col = 0; col < row; ++col) {
+                matrix[Coord<2>(row, col)] = 1;
+            }
+        }
+        gridOld.setWeights(0, matrix);
+
+        UnstructuredUpdateFunctor<TestCellType> functor;
+        APITraits::SelectThreadedUpdate<TestCellType>::Value modelThreadingSpec;
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        int threads = omp_get_max_threads();
+        omp_set_num_threads(4);
+#endif
+
+        for (int threading = 0; threading < 2; ++threading) {
+            UnstructuredSoAGrid<TestCellType, 1, double, 4, 1> gridNew(dim, defaultCell, edgeCell);
+            if (threading) {
+                UpdateFunctorHelpers::ConcurrencyEnableOpenMP concurrencySpec(true, false);
+                functor(region, gridOld, &gridNew, 0, concurrencySpec, modelThreadingSpec);
+            } else {
+                UpdateFunctorHelpers::ConcurrencyNoP concurrencySpec;
+                functor(region, gridOld, &gridNew, 0, concurrencySpec, modelThreadingSpec);
+            }
+
+            for (Coord<1> coord(0); coord < Coord<1>(DIM); ++coord.x()) {
+                if (region.count(coord)) {
+                    TS_ASSERT_EQUALS(coord.x() * 200.0, gridNew.get(coord).sum);
+                } else {
+                    TS_ASSERT_EQUALS(0.0, gridNew.get(coord).sum);
+                }
+            }
+        }
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+        omp_set_num_threads(threads);
+#endif
+#endif
+    }
+
+    void testSoAWithSIGMAAndMaskedUpdateLineX()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        typedef MaskedUnstructuredSoATestCell150 TestCellType;
+        const int DIM = 150;
+        CoordBox<1> dim(Coord<1>(0), Coord<1>(DIM));
+
+        TestCellType defaultCell(200);
+        TestCellType edgeCell(-1);
+
+        UnstructuredSoAGrid<TestCellType, 1, double, 4, 150> gridOld(dim, defaultCell, edgeCell);
+        UnstructuredSoAGrid<TestCellType, 1, double, 4, 150> gridNew(dim, defaultCell, edgeCell);
+
+        Region<1> region;
+        region << Streak<1>(Coord<1>(10),   30);
+        region << Streak<1>(Coord<1>(37),   60);
+        region << Streak<1>(Coord<1>(61),   62);
+        region << Streak<1>(Coord<1>(100), 149);
+
+        std::map<Coord<2>, double> matrix;
+        for (int row = 0; row < DIM; ++row) {
+            for (int col = 0; col < row; ++col) {
+                matrix[Coord<2>(row, col)] = 1;
+            }
+        }
+        gridOld.setWeights(0, matrix);
+
+        UnstructuredUpdateFunctor<TestCellType> functor;
+        UpdateFunctorHelpers::ConcurrencyNoP concurrencySpec;
+        APITraits::SelectThreadedUpdate<TestCellType>::Value modelThreadingSpec;
+
+        functor(region, gridOld, &gridNew, 0, concurrencySpec, modelThreadingSpec);
+
+        for (Coord<1> coord(0); coord < Coord<1>(DIM); ++coord.x()) {
+            if (region.count(coord)) {
+                // rows are sorted by descending length:
+                TS_ASSERT_EQUALS((149 - coord.x()) * 200.0, gridNew.get(coord).sum);
+            } else {
+                TS_ASSERT_EQUALS(0.0, gridNew.get(coord).sum);
+            }
+        }
+#endif
+    }
+
+    void testRangeBoundaries()
+    {
+#ifdef LIBGEODECOMP_WITH_CPP14
+        typedef SimpleUnstructuredSoATestCell<1> TestCellType;
+        typedef UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<TestCellType> Helper;
+        const int DIM = 150;
+        CoordBox<1> dim(Coord<1>(0), Coord<1>(DIM));
+
+        UnstructuredSoAGrid<TestCellType, 1, double, 4, 1> gridOld(dim);
+        UnstructuredSoAGrid<TestCellType, 1, double, 4, 1> gridNew(dim);
+
+        std::map<Coord<2>, double> matrix;
+        for (int row = 0; row < DIM; ++row) {
+            for (int col = 0; col < row; ++col) {
+                matrix[Coord<2>(row, col)] = 1;
+            }
+        }
+        gridOld.setWeights(0, matrix);
+
+        Region<1> region;
+        TS_ASSERT_EQUALS(std::vector<int>(), Helper(gridOld, &gridNew, region, 0).rangeBoundaries(4));
+
+        // chunk k holds 4 * (4 * k + 3) entries, so the first 27
+        // chunks are about as expensive as the remaining 10:
+        region << Streak<1>(Coord<1>(0), 148);
+        std::vector<int> expected;
+        expected << 0
+                 << 108
+                 << 148;
+        TS_ASSERT_EQUALS(expected, Helper(gridOld, &gridNew, region, 0).rangeBoundaries(2));
+
+        region.clear();
+        region << Streak<1>(Coord<1>(  5),  13)
+               << Streak<1>(Coord<1>( 14),  15)
+               << Streak<1>(Coord<1>( 50),  51)
+               << Streak<1>(Coord<1>( 90), 141);
+        std::vector<int> boundaries = Helper(gridOld, &gridNew, region, 0).rangeBoundaries(7);
+        TS_ASSERT_EQUALS(std::size_t(8), boundaries.size());
+        TS_ASSERT_EQUALS(4,   boundaries.front());
+        TS_ASSERT_EQUALS(144, boundaries.back());
+        for (std::size_t i = 0; i < boundaries.size(); ++i) {
+            TS_ASSERT_EQUALS(0, boundaries[i] % 4);
+            if (i > 0) {
+                TS_ASSERT_LESS_THAN_EQUALS(boundaries[i - 1], boundaries[i]);
+            }
+        }
 #endif
     }
 };
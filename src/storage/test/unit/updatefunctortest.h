@@ -124,6 +124,39 @@ public:
 
 LIBFLATARRAY_REGISTER_SOA(MySoATestCellWithDoubleAndBool, ((double)(temp))((bool)(alive)))
 
+class UnsampledCell
+{
+public:
+    class API :
+        public APITraits::HasCubeTopology<2>
+    {};
+
+    explicit UnsampledCell(int value = 0) :
+        value(value)
+    {}
+
+    template<typename NEIGHBORHOOD>
+    void update(const NEIGHBORHOOD& hood, int nanoStep)
+    {
+        value = hood[Coord<2>()].value + 1;
+    }
+
+    int value;
+};
+
+class SampledCell : public UnsampledCell
+{
+public:
+    class API :
+        public APITraits::HasCostSampling,
+        public APITraits::HasCubeTopology<2>
+    {};
+
+    explicit SampledCell(int value = 0) :
+        UnsampledCell(value)
+    {}
+};
+
 namespace LibGeoDecomp {
 
 template<class STENCIL>
@@ -255,7 +288,57 @@ public:
         }
     }
 
+    void testCostSampling()
+    {
+        CoordBox<2> box(Coord<2>(), Coord<2>(20, 10));
+        Region<2> region;
+        region << Streak<2>(Coord<2>(2, 1), 17)
+               << Streak<2>(Coord<2>(0, 3), 20)
+               << Streak<2>(Coord<2>(5, 8), 6);
+
+        CostMap<2> costs(box, Coord<2>(10, 5));
+        checkCostSampling<SampledCell>(region, &costs);
+        std::vector<double> expectedCells;
+        expectedCells << 18 << 17 << 1 << 0;
+        TS_ASSERT_EQUALS(expectedCells, costs.cells());
+
+        // no map, no samples:
+        checkCostSampling<SampledCell>(region, 0);
+
+        // models which didn't ask for sampling will leave the map untouched:
+        costs.clear();
+        checkCostSampling<UnsampledCell>(region, &costs);
+        TS_ASSERT(costs.empty());
+    }
+
 private:
+    template<typename CELL>
+    void checkCostSampling(const Region<2>& region, CostMap<2> *costs)
+    {
+        typedef Grid<CELL, Topologies::Cube<2>::Topology> GridType;
+        GridType gridOld(Coord<2>(20, 10), CELL(), CELL(-1));
+        GridType gridNew(Coord<2>(20, 10), CELL(), CELL(-1));
+
+        UpdateFunctor<CELL> serialFunctor(costs);
+        serialFunctor(region, Coord<2>(), Coord<2>(), gridOld, &gridNew, 0);
+        UpdateFunctor<CELL, UpdateFunctorHelpers::ConcurrencyEnableOpenMP> threadedFunctor(costs);
+        threadedFunctor(
+            region, Coord<2>(), Coord<2>(), gridNew, &gridOld, 0,
+            UpdateFunctorHelpers::ConcurrencyEnableOpenMP(false, false));
+
+        for (CoordBox<2>::Iterator i = gridOld.boundingBox().begin(); i != gridOld.boundingBox().end(); ++i) {
+            int expected = region.count(*i) ? 2 : 0;
+            TS_ASSERT_EQUALS(expected, gridOld.get(*i).value);
+        }
+
+        if (costs && typename APITraits::SelectCostSampling<CELL>::Value()) {
+            // both updates have been sampled:
+            TS_ASSERT_EQUALS(2.0 * region.size(), sum(costs->cells()));
+            costs->clear();
+            serialFunctor(region, Coord<2>(), Coord<2>(), gridOld, &gridNew, 0);
+        }
+    }
+
     template<typename CELL>
     void checkSelector(const std::string& line, int repeats)
     {
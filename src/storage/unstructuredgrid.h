@@ -82,6 +82,12 @@ public:
         matrices[matrixID].initFromMatrix(matrix);
     }
 
+    void setWeights(std::size_t matrixID, const CSRMatrix<WEIGHT_TYPE>& matrix)
+    {
+        assert(matrixID < MATRICES);
+        matrices[matrixID].initFromMatrix(matrix);
+    }
+
     inline
     const SellCSigmaSparseMatrixContainer<WEIGHT_TYPE, C, SIGMA>& getWeights(const std::size_t matrixID) const
     {
@@ -11,7 +11,9 @@
 #include <libgeodecomp/storage/unstructuredneighborhood.h>
 #include <libgeodecomp/storage/unstructuredsoagrid.h>
 
+#include <algorithm>
 #include <iterator>
+#include <limits>
 #include <utility>
 
 namespace LibGeoDecomp {
@@ -166,6 +168,10 @@ private:
 /**
  * Neighborhood which is used for hoodNew in updateLineX().
  * Provides access to member pointers of the new grid.
+ *
+ * Cells with IDs in [startX, endX) may be written, store() will skip
+ * all others. This enables vectorized updates of chunks which are
+ * only partially covered by a streak.
  */
 template<typename CELL, long DIM_X, long DIM_Y, long DIM_Z, long INDEX>
 class UnstructuredSoANeighborhoodNew
@@ -174,8 +180,13 @@ public:
     using SoAAccessor = LibFlatArray::soa_accessor<CELL, DIM_X, DIM_Y, DIM_Z, INDEX>;
 
     inline explicit
-    UnstructuredSoANeighborhoodNew(SoAAccessor *acc) :
-        accessor(acc)
+    UnstructuredSoANeighborhoodNew(
+        SoAAccessor *acc,
+        int startX = 0,
+        int endX = std::numeric_limits<int>::max()) :
+        accessor(acc),
+        startX(startX),
+        endX(endX)
     {}
 
     inline
@@ -203,8 +214,35 @@ public:
         (*accessor) << cell;
     }
 
+    /**
+     * Stores vec to base[index] to base[index + ARITY - 1], where
+     * base points to a member array of the new grid, e.g.
+     * &hoodNew->sum(). Lanes of cells outside of [startX, endX) are
+     * left untouched. index needs to be aligned just like for
+     * short_vec::store_aligned().
+     */
+    template<typename VALUE, typename SHORT_VEC>
+    inline
+    void store(VALUE *base, int index, const SHORT_VEC& vec) const
+    {
+        if ((index >= startX) && ((index + SHORT_VEC::ARITY) <= endX)) {
+            vec.store_aligned(base + index);
+            return;
+        }
+
+        alignas(64) VALUE buffer[SHORT_VEC::ARITY];
+        vec.store_aligned(buffer);
+        int begin = (std::max)(startX - index, 0);
+        int end = (std::min)(endX - index, int(SHORT_VEC::ARITY));
+        for (int i = begin; i < end; ++i) {
+            base[index + i] = buffer[i];
+        }
+    }
+
 private:
     SoAAccessor *accessor;      /**< accessor to new grid */
+    int startX;                 /**< first cell which may be written */
+    int endX;                   /**< end of cells which may be written */
 };
 
 /**
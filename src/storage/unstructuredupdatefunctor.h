@@ -9,19 +9,28 @@
 #ifdef LIBGEODECOMP_WITH_HPX
 #include <hpx/async.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#endif
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
 #endif
 
 #include <boost/iterator/counting_iterator.hpp>
 
 #include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/stdcontaineroverloads.h>
 #include <libgeodecomp/geometry/streak.h>
 #include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/storage/concurrencyspecs.h>
 #include <libgeodecomp/storage/fixedarray.h>
 #include <libgeodecomp/storage/unstructuredsoagrid.h>
 #include <libgeodecomp/storage/unstructuredneighborhood.h>
 #include <libgeodecomp/storage/unstructuredsoaneighborhood.h>
 #include <libgeodecomp/storage/updatefunctormacros.h>
 
+#include <vector>
+
 namespace LibGeoDecomp {
 
 namespace UnstructuredUpdateFunctorHelpers {
@@ -29,8 +38,23 @@ namespace UnstructuredUpdateFunctorHelpers {
 /**
  * Functor to be used from with LibFlatArray from within
  * UnstructuredUpdateFunctor. Hides much of the boilerplate code.
+ *
+ * If the CONCURRENCY_FUNCTOR asks for threading, the Region is cut
+ * into ranges whose boundaries are multiples of C, so no two threads
+ * will ever write to the same chunk. The ranges are balanced by the
+ * number of (padded) non-zero entries in the SELL-C-SIGMA matrices,
+ * not by the number of rows, as the cost of a chunk is dominated by
+ * its chunkLength.
+ *
+ * Streaks which start or end in the middle of a chunk are passed to
+ * updateLineX() as a whole if the model is flagged with
+ * APITraits::HasMaskedUpdateLineX. Otherwise the partial chunks are
+ * updated one cell at a time via update().
  */
-template<typename CELL>
+template<
+    typename CELL,
+    typename CONCURRENCY_FUNCTOR = UpdateFunctorHelpers::ConcurrencyNoP,
+    typename ANY_THREADED_UPDATE = typename APITraits::SelectThreadedUpdate<CELL>::Value>
 class UnstructuredGridSoAUpdateHelper
 {
 public:
@@ -42,15 +66,25 @@ public:
     static const auto DIM = Topology::DIM;
     using Grid = UnstructuredSoAGrid<CELL, MATRICES, ValueType, C, SIGMA>;
 
+    /**
+     * With dynamic scheduling we hand out a couple of ranges per
+     * thread to even out the load.
+     */
+    static const std::size_t DYNAMIC_RANGES_PER_THREAD = 4;
+
     UnstructuredGridSoAUpdateHelper(
         const Grid& gridOld,
         Grid *gridNew,
         const Region<DIM>& region,
-        unsigned nanoStep) :
+        unsigned nanoStep,
+        const CONCURRENCY_FUNCTOR& concurrencySpec = CONCURRENCY_FUNCTOR(),
+        const ANY_THREADED_UPDATE& modelThreadingSpec = ANY_THREADED_UPDATE()) :
         gridOld(gridOld),
         gridNew(gridNew),
         region(region),
-        nanoStep(nanoStep)
+        nanoStep(nanoStep),
+        concurrencySpec(concurrencySpec),
+        modelThreadingSpec(modelThreadingSpec)
     {}
 
     template<
@@ -60,59 +94,122 @@ public:
         LibFlatArray::soa_accessor<CELL1, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1>& oldAccessor,
         LibFlatArray::soa_accessor<CELL2, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2>& newAccessor) const
     {
-        // fixme: threading!
-        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
-            // Assumption: Cell has both (updateLineX and update())
-
-            // loop peeling: streak's start might point to middle of chunks
-            // if so: vectorization cannot be done -> solution: additionally
-            // update the first and last chunk of complete streak scalar by
-            // calling update() instead
-            int startX = i->origin.x();
-            if ((startX % C) != 0) {
-                UnstructuredSoAScalarNeighborhood<CELL, MATRICES, ValueType, C, SIGMA>
-                    hoodOld(gridOld, startX);
-                const int cellsToUpdate = C - (startX % C);
-                FixedArray<CELL, C> cells;
-                Streak<1> cellStreak(Coord<1>(startX), startX + cellsToUpdate);
-
-                // update SoA grid: copy cells to local buffer, update, copy data back to grid
-                gridNew->get(cellStreak, cells.begin());
-                // call update
-                for (int i = 0; i < cellsToUpdate; ++i, ++hoodOld) {
-                    cells[i].update(hoodOld, nanoStep);
-                }
-                // fixme: woah, avoid these copies!
-                gridNew->set(cellStreak, cells.begin());
+#ifdef LIBGEODECOMP_WITH_THREADS
+        if (concurrencySpec.enableOpenMP() &&
+            !modelThreadingSpec.hasOpenMP() &&
+            (omp_get_max_threads() > 1) &&
+            !omp_in_parallel()) {
+            std::size_t numRanges = omp_get_max_threads();
+            if (!concurrencySpec.preferStaticScheduling()) {
+                numRanges *= DYNAMIC_RANGES_PER_THREAD;
+            }
 
-                startX += cellsToUpdate;
+            std::vector<Streak<DIM> > pieces;
+            std::vector<std::size_t> offsets;
+            splitStreaks(rangeBoundaries(numRanges), &pieces, &offsets);
+            int ranges = offsets.size() - 1;
+
+            if (concurrencySpec.preferStaticScheduling()) {
+#pragma omp parallel for schedule(static)
+                for (int i = 0; i < ranges; ++i) {
+                    updateRange(pieces, offsets[i], offsets[i + 1], oldAccessor, newAccessor);
+                }
+            } else {
+#pragma omp parallel for schedule(dynamic)
+                for (int i = 0; i < ranges; ++i) {
+                    updateRange(pieces, offsets[i], offsets[i + 1], oldAccessor, newAccessor);
+                }
             }
 
-            // call updateLineX with adjusted indices
-            UnstructuredSoANeighborhood<CELL, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1,
-                                        MATRICES, ValueType, C, SIGMA>
-                hoodOld(oldAccessor, gridOld, startX);
+            return;
+        }
+#endif
 
-            UnstructuredSoANeighborhoodNew<CELL, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2> hoodNew(&newAccessor);
-            CELL::updateLineX(hoodNew, i->endX, hoodOld, nanoStep);
-
-            // call scalar updates for last chunk
-            if ((i->endX % C) != 0) {
-                const int cellsToUpdate = i->endX % C;
-                UnstructuredSoAScalarNeighborhood<CELL, MATRICES, ValueType, C, SIGMA>
-                    hoodOld(gridOld, i->endX - cellsToUpdate);
-                std::array<CELL, C> cells;
-                Streak<1> cellStreak(Coord<1>(i->endX - cellsToUpdate), i->endX);
-
-                // update SoA grid: copy cells to local buffer, update, copy data back to grid
-                gridNew->get(cellStreak, cells.begin());
-                // call update
-                for (int i = 0; i < cellsToUpdate; ++i, ++hoodOld) {
-                    cells[i].update(hoodOld, nanoStep);
+#ifdef LIBGEODECOMP_WITH_HPX
+        if (concurrencySpec.enableHPX() && !modelThreadingSpec.hasHPX()) {
+            std::vector<Streak<DIM> > pieces;
+            std::vector<std::size_t> offsets;
+            splitStreaks(
+                rangeBoundaries(DYNAMIC_RANGES_PER_THREAD * hpx::get_os_thread_count()),
+                &pieces,
+                &offsets);
+
+            hpx::parallel::for_each(
+                hpx::parallel::par,
+                boost::make_counting_iterator(std::size_t(0)),
+                boost::make_counting_iterator(offsets.size() - 1),
+                [&](std::size_t i) {
+                    updateRange(pieces, offsets[i], offsets[i + 1], oldAccessor, newAccessor);
+                });
+
+            return;
+        }
+#endif
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            updateStreak(*i, oldAccessor, newAccessor);
+        }
+    }
+
+    /**
+     * Cuts the Region into numRanges ranges of roughly equal cost.
+     * Range i comprises all cells with IDs in [ret[i], ret[i + 1]).
+     * All boundaries are multiples of C. Ranges may be empty if the
+     * Region is too small to be split any further.
+     */
+    std::vector<int> rangeBoundaries(std::size_t numRanges) const
+    {
+        std::vector<int> ret;
+        if (region.empty() || (numRanges == 0)) {
+            return ret;
+        }
+
+        long total = 0;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            total += cost(i->origin.x(), i->endX);
+        }
+
+        CoordBox<DIM> box = region.boundingBox();
+        ret << (box.origin.x() / C) * C;
+        long accumulatedCost = 0;
+        std::size_t nextRange = 1;
+
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            int begin = i->origin.x();
+            long streakCost = cost(begin, i->endX);
+
+            for (; nextRange < numRanges; ++nextRange) {
+                long target = total * long(nextRange) / long(numRanges);
+                if ((accumulatedCost + streakCost) < target) {
+                    break;
                 }
-                gridNew->set(cellStreak, cells.begin());
+
+                // find the first chunk boundary at which the target is met:
+                int lower = begin / C;
+                int upper = (i->endX + C - 1) / C;
+                while (lower < upper) {
+                    int middle = (lower + upper) / 2;
+                    int cut = (std::min)(middle * C, i->endX);
+                    if ((accumulatedCost + cost(begin, cut)) < target) {
+                        lower = middle + 1;
+                    } else {
+                        upper = middle;
+                    }
+                }
+
+                ret << (std::max)(lower * C, ret.back());
             }
+
+            accumulatedCost += streakCost;
+        }
+
+        int end = (box.origin.x() + box.dimensions.x() + C - 1) / C * C;
+        while (ret.size() <= numRanges) {
+            ret << end;
         }
+        ret.back() = end;
+
+        return ret;
     }
 
 private:
@@ -120,6 +217,184 @@ private:
     Grid *gridNew;
     const Region<DIM>& region;
     unsigned nanoStep;
+    CONCURRENCY_FUNCTOR concurrencySpec;
+    ANY_THREADED_UPDATE modelThreadingSpec;
+
+    /**
+     * Estimated cost of updating cells [begin, end): each row costs
+     * one unit plus the padded number of non-zero entries of all
+     * chunks it touches. Chunks which are only touched partially
+     * are counted in full.
+     */
+    inline long cost(int begin, int end) const
+    {
+        if (end <= begin) {
+            return 0;
+        }
+
+        long ret = end - begin;
+        for (std::size_t m = 0; m < MATRICES; ++m) {
+            const std::vector<int>& chunkOffsets = gridOld.getWeights(m).chunkOffsetVec();
+            std::size_t lastChunk = (std::min)(std::size_t((end + C - 1) / C), chunkOffsets.size() - 1);
+            ret += chunkOffsets[lastChunk] - chunkOffsets[begin / C];
+        }
+
+        return ret;
+    }
+
+    /**
+     * Cuts the Region's Streaks at the given boundaries. Streaks
+     * pieces[offsets[i]] to pieces[offsets[i + 1] - 1] make up range i.
+     */
+    inline void splitStreaks(
+        const std::vector<int>& boundaries,
+        std::vector<Streak<DIM> > *pieces,
+        std::vector<std::size_t> *offsets) const
+    {
+        *offsets << 0;
+        if (boundaries.empty()) {
+            return;
+        }
+
+        std::size_t range = 0;
+        for (typename Region<DIM>::StreakIterator i = region.beginStreak(); i != region.endStreak(); ++i) {
+            int begin = i->origin.x();
+
+            while (begin < i->endX) {
+                while (begin >= boundaries[range + 1]) {
+                    *offsets << pieces->size();
+                    ++range;
+                }
+
+                int end = (std::min)(i->endX, boundaries[range + 1]);
+                *pieces << Streak<DIM>(Coord<DIM>(begin), end);
+                begin = end;
+            }
+        }
+
+        while (offsets->size() < boundaries.size()) {
+            *offsets << pieces->size();
+        }
+    }
+
+    template<
+        typename CELL1, long MY_DIM_X1, long MY_DIM_Y1, long MY_DIM_Z1, long INDEX1,
+        typename CELL2, long MY_DIM_X2, long MY_DIM_Y2, long MY_DIM_Z2, long INDEX2>
+    inline void updateRange(
+        const std::vector<Streak<DIM> >& pieces,
+        std::size_t begin,
+        std::size_t end,
+        const LibFlatArray::soa_accessor<CELL1, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1>& oldAccessor,
+        const LibFlatArray::soa_accessor<CELL2, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2>& newAccessor) const
+    {
+        // each thread needs its own accessor as hoodNew may move it:
+        LibFlatArray::soa_accessor<CELL2, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2> myNewAccessor = newAccessor;
+
+        for (std::size_t i = begin; i != end; ++i) {
+            updateStreak(pieces[i], oldAccessor, myNewAccessor);
+        }
+    }
+
+    template<
+        typename CELL1, long MY_DIM_X1, long MY_DIM_Y1, long MY_DIM_Z1, long INDEX1,
+        typename CELL2, long MY_DIM_X2, long MY_DIM_Y2, long MY_DIM_Z2, long INDEX2>
+    inline void updateStreak(
+        const Streak<DIM>& streak,
+        const LibFlatArray::soa_accessor<CELL1, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1>& oldAccessor,
+        LibFlatArray::soa_accessor<CELL2, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2>& newAccessor) const
+    {
+        typedef typename APITraits::SelectMaskedUpdateLineX<CELL>::Value MaskedUpdateLineXFlag;
+        updateStreak(streak, oldAccessor, newAccessor, MaskedUpdateLineXFlag());
+    }
+
+    template<
+        typename CELL1, long MY_DIM_X1, long MY_DIM_Y1, long MY_DIM_Z1, long INDEX1,
+        typename CELL2, long MY_DIM_X2, long MY_DIM_Y2, long MY_DIM_Z2, long INDEX2>
+    inline void updateStreak(
+        const Streak<DIM>& streak,
+        const LibFlatArray::soa_accessor<CELL1, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1>& oldAccessor,
+        LibFlatArray::soa_accessor<CELL2, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2>& newAccessor,
+        // does cell mask its stores in updateLineX()?
+        APITraits::TrueType) const
+    {
+        // partial chunks at either end are computed in full, hoodNew
+        // will discard the results for cells outside of the streak:
+        int endX = (streak.endX + C - 1) / C * C;
+
+        UnstructuredSoANeighborhood<CELL, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1,
+                                    MATRICES, ValueType, C, SIGMA>
+            hoodOld(oldAccessor, gridOld, streak.origin.x());
+
+        UnstructuredSoANeighborhoodNew<CELL, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2>
+            hoodNew(&newAccessor, streak.origin.x(), streak.endX);
+        CELL::updateLineX(hoodNew, endX, hoodOld, nanoStep);
+    }
+
+    template<
+        typename CELL1, long MY_DIM_X1, long MY_DIM_Y1, long MY_DIM_Z1, long INDEX1,
+        typename CELL2, long MY_DIM_X2, long MY_DIM_Y2, long MY_DIM_Z2, long INDEX2>
+    inline void updateStreak(
+        const Streak<DIM>& streak,
+        const LibFlatArray::soa_accessor<CELL1, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1>& oldAccessor,
+        LibFlatArray::soa_accessor<CELL2, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2>& newAccessor,
+        // does cell mask its stores in updateLineX()?
+        APITraits::FalseType) const
+    {
+        // Assumption: Cell has both (updateLineX and update())
+
+        // loop peeling: streak's start might point to middle of chunks
+        // if so: vectorization cannot be done -> solution: additionally
+        // update the first and last chunk of complete streak scalar by
+        // calling update() instead
+        int startX = streak.origin.x();
+        int endX = streak.endX;
+        if ((startX % C) != 0) {
+            int peeledEndX = (std::min)(endX, (startX / C + 1) * C);
+            updateScalar(startX, peeledEndX);
+            startX = peeledEndX;
+        }
+
+        // call updateLineX with adjusted indices
+        int vectorEndX = (std::max)(startX, endX - (endX % C));
+        if (startX < vectorEndX) {
+            UnstructuredSoANeighborhood<CELL, MY_DIM_X1, MY_DIM_Y1, MY_DIM_Z1, INDEX1,
+                                        MATRICES, ValueType, C, SIGMA>
+                hoodOld(oldAccessor, gridOld, startX);
+
+            UnstructuredSoANeighborhoodNew<CELL, MY_DIM_X2, MY_DIM_Y2, MY_DIM_Z2, INDEX2> hoodNew(&newAccessor);
+            CELL::updateLineX(hoodNew, vectorEndX, hoodOld, nanoStep);
+        }
+
+        // call scalar updates for last chunk
+        if (vectorEndX < endX) {
+            updateScalar(vectorEndX, endX);
+        }
+    }
+
+    /**
+     * Updates cells [startX, endX), which have to reside within a
+     * single chunk, via update(). As update() works on whole CELL
+     * objects, these cells are copied out of the SoA grid and back
+     * again. This affects at most two partial chunks per streak and
+     * only models which aren't flagged with
+     * APITraits::HasMaskedUpdateLineX; flagged models skip this
+     * path, see UnstructuredSoANeighborhoodNew::store().
+     */
+    inline void updateScalar(int startX, int endX) const
+    {
+        UnstructuredSoAScalarNeighborhood<CELL, MATRICES, ValueType, C, SIGMA>
+            hoodOld(gridOld, startX);
+        FixedArray<CELL, C> cells;
+        Streak<1> cellStreak(Coord<1>(startX), endX);
+        const int cellsToUpdate = endX - startX;
+
+        // update SoA grid: copy cells to local buffer, update, copy data back to grid
+        gridNew->get(cellStreak, cells.begin());
+        for (int i = 0; i < cellsToUpdate; ++i, ++hoodOld) {
+            cells[i].update(hoodOld, nanoStep);
+        }
+        gridNew->set(cellStreak, cells.begin());
+    }
 };
 
 }
@@ -277,12 +552,14 @@ public:
     {
         gridOld.callback(
             gridNew,
-            // fixme: is missing concurrencySpec, modelThreadingSpec
-            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<CELL>(
-                gridOld,
-                gridNew,
-                region,
-                nanoStep));
+            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<
+                CELL, CONCURRENCY_FUNCTOR, ANY_THREADED_UPDATE>(
+                    gridOld,
+                    gridNew,
+                    region,
+                    nanoStep,
+                    concurrencySpec,
+                    modelThreadingSpec));
     }
 };
 
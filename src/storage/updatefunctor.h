@@ -9,8 +9,11 @@
 #endif
 
 #include <libgeodecomp/communication/mpilayer.h>
+#include <libgeodecomp/geometry/costmap.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/misc/scopedtimer.h>
+#include <libgeodecomp/storage/concurrencyspecs.h>
 #include <libgeodecomp/storage/fixedneighborhoodupdatefunctor.h>
 #include <libgeodecomp/storage/linepointerassembly.h>
 #include <libgeodecomp/storage/linepointerupdatefunctor.h>
@@ -267,112 +270,6 @@ public:
 #endif
 };
 
-/**
- * The default CONCURRENCY_FUNCTOR for UpdateFunctor: won't request
- * threading and won't execute any sideband actions.
- */
-class ConcurrencyNoP
-{
-public:
-    inline
-    explicit ConcurrencyNoP(bool /* unused */ = false, bool /* unused */ = false)
-    {}
-
-    bool enableOpenMP() const
-    {
-        return false;
-    }
-
-    bool enableHPX() const
-    {
-        return false;
-    }
-
-    bool preferStaticScheduling() const
-    {
-        return false;
-    }
-
-    bool preferFineGrainedParallelism() const
-    {
-        return false;
-    }
-};
-
-/**
- * Unsurprisingly, this class requests the UpdateFunctor to use OpenMP
- * for parallelization. Flags can optionally steer the granularity and
- * dynamics of load distribution among the threads.
- */
-class ConcurrencyEnableOpenMP
-{
-public:
-    inline
-    ConcurrencyEnableOpenMP(bool updatingGhost, bool enableFineGrainedParallelism) :
-        updatingGhost(updatingGhost),
-        enableFineGrainedParallelism(enableFineGrainedParallelism)
-    {}
-
-    bool enableOpenMP() const
-    {
-        return true;
-    }
-
-    bool enableHPX() const
-    {
-        return false;
-    }
-
-    bool preferStaticScheduling() const
-    {
-        return !updatingGhost;
-    }
-
-    bool preferFineGrainedParallelism() const
-    {
-        return enableFineGrainedParallelism;
-    }
-
-private:
-    bool updatingGhost;
-    bool enableFineGrainedParallelism;
-};
-
-/**
- * Like its counterpart for OpenMP, this class requests an HPX-based parallel update.
- */
-class ConcurrencyEnableHPX
-{
-public:
-    inline
-    ConcurrencyEnableHPX(bool /* unused */, bool enableFineGrainedParallelism) :
-        enableFineGrainedParallelism(enableFineGrainedParallelism)
-    {}
-
-    bool enableOpenMP() const
-    {
-        return false;
-    }
-
-    bool enableHPX() const
-    {
-        return true;
-    }
-
-    bool preferStaticScheduling() const
-    {
-        return false;
-    }
-
-    bool preferFineGrainedParallelism() const
-    {
-        return enableFineGrainedParallelism;
-    }
-
-private:
-    bool enableFineGrainedParallelism;
-};
-
 }
 
 /**
@@ -383,6 +280,11 @@ private:
  *
  * The CONCURRENCY_FUNCTOR can be used to control threading and to
  * execute sideband functions (e.g. MPI pacing).
+ *
+ * Models flagged with APITraits::HasCostSampling get each streak
+ * timed individually, the timings are recorded in the CostMap which
+ * was handed to the c-tor. For all other models the CostMap is
+ * ignored and the update is dispatched directly.
  */
 template<typename CELL, typename CONCURRENCY_FUNCTOR = UpdateFunctorHelpers::ConcurrencyNoP>
 class UpdateFunctor
@@ -392,6 +294,10 @@ public:
 
     static const int DIM = Topology::DIM;
 
+    explicit UpdateFunctor(CostMap<DIM> *costMap = 0) :
+        costMap(costMap)
+    {}
+
     template<typename GRID1, typename GRID2>
     void operator()(
         const Region<DIM>& region,
@@ -401,6 +307,25 @@ public:
         GRID2 *gridNew,
         unsigned nanoStep,
         const CONCURRENCY_FUNCTOR& concurrencySpec = UpdateFunctorHelpers::ConcurrencyNoP())
+    {
+        update(
+            region, sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec,
+            typename APITraits::SelectCostSampling<CELL>::Value());
+    }
+
+private:
+    CostMap<DIM> *costMap;
+
+    template<typename GRID1, typename GRID2, typename CONCURRENCY>
+    void update(
+        const Region<DIM>& region,
+        const Coord<DIM>& sourceOffset,
+        const Coord<DIM>& targetOffset,
+        const GRID1& gridOld,
+        GRID2 *gridNew,
+        unsigned nanoStep,
+        const CONCURRENCY& concurrencySpec,
+        APITraits::FalseType)
     {
         UpdateFunctorHelpers::Selector<CELL>()(
             region, sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec,
@@ -410,9 +335,73 @@ public:
             typename APITraits::SelectTopology<CELL>::Value(),
             typename APITraits::SelectThreadedUpdate<CELL>::Value());
     }
+
+    /**
+     * Splits the region into streaks so each can be timed on its
+     * own. With OpenMP the threads take turns on the region's planes
+     * (same as in the macros of UpdateFunctorHelpers), so sampling
+     * doesn't serialize the update.
+     */
+    template<typename GRID1, typename GRID2>
+    void update(
+        const Region<DIM>& region,
+        const Coord<DIM>& sourceOffset,
+        const Coord<DIM>& targetOffset,
+        const GRID1& gridOld,
+        GRID2 *gridNew,
+        unsigned nanoStep,
+        const CONCURRENCY_FUNCTOR& concurrencySpec,
+        APITraits::TrueType)
+    {
+        if (!costMap) {
+            update(
+                region, sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec,
+                APITraits::FalseType());
+            return;
+        }
+
+        typedef typename Region<DIM>::StreakIterator Iter;
+#ifdef LIBGEODECOMP_WITH_THREADS
+        if (concurrencySpec.enableOpenMP()) {
+#pragma omp parallel for schedule(dynamic)
+            for (std::size_t c = 0; c < region.numPlanes(); ++c) {
+                Iter end = region.planeStreakIterator(c + 1);
+                for (Iter i = region.planeStreakIterator(c + 0); i != end; ++i) {
+                    updateStreak(
+                        *i, sourceOffset, targetOffset, gridOld, gridNew, nanoStep,
+                        UpdateFunctorHelpers::ConcurrencyNoP());
+                }
+            }
+            return;
+        }
+#endif
+
+        for (Iter i = region.beginStreak(); i != region.endStreak(); ++i) {
+            updateStreak(*i, sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec);
+        }
+    }
+
+    template<typename GRID1, typename GRID2, typename CONCURRENCY>
+    void updateStreak(
+        const Streak<DIM>& streak,
+        const Coord<DIM>& sourceOffset,
+        const Coord<DIM>& targetOffset,
+        const GRID1& gridOld,
+        GRID2 *gridNew,
+        unsigned nanoStep,
+        const CONCURRENCY& concurrencySpec)
+    {
+        Region<DIM> region;
+        region << streak;
+
+        double startTime = ScopedTimer::time();
+        update(
+            region, sourceOffset, targetOffset, gridOld, gridNew, nanoStep, concurrencySpec,
+            APITraits::FalseType());
+        costMap->addSample(streak, ScopedTimer::time() - startTime);
+    }
 };
 
 }
 
 #endif
-
@@ -0,0 +1,5 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cu
+)
+set(HEADERS ${HEADERS}
+)
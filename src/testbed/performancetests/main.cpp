@@ -1,9 +1,15 @@
 #include <libgeodecomp/config.h>
 #include <libgeodecomp/misc/apitraits.h>
+#include <libgeodecomp/io/clonableinitializerwrapper.h>
 #include <libgeodecomp/io/simpleinitializer.h>
+#if defined(LIBGEODECOMP_WITH_BOOST_ASIO) && defined(LIBGEODECOMP_WITH_THREADS)
+#include <libgeodecomp/io/remotesteerer/streamclient.h>
+#include <libgeodecomp/io/remotesteerer/streamserver.h>
+#endif
 #include <libgeodecomp/misc/chronometer.h>
 #include <libgeodecomp/geometry/convexpolytope.h>
 #include <libgeodecomp/geometry/coord.h>
+#include <libgeodecomp/geometry/csradjacency.h>
 #include <libgeodecomp/geometry/floatcoord.h>
 #include <libgeodecomp/geometry/region.h>
 #include <libgeodecomp/geometry/stencils.h>
@@ -11,12 +17,17 @@
 #include <libgeodecomp/geometry/partitions/hilbertpartition.h>
 #include <libgeodecomp/geometry/partitions/stripingpartition.h>
 #include <libgeodecomp/geometry/partitions/zcurvepartition.h>
+#include <libgeodecomp/loadbalancer/oozebalancer.h>
+#include <libgeodecomp/misc/cacheblockingsimulationfactory.h>
+#include <libgeodecomp/storage/boxcell.h>
+#include <libgeodecomp/storage/fixedarray.h>
 #include <libgeodecomp/storage/grid.h>
 #include <libgeodecomp/storage/linepointerassembly.h>
 #include <libgeodecomp/storage/linepointerupdatefunctor.h>
 #include <libgeodecomp/storage/updatefunctor.h>
 #include <libgeodecomp/parallelization/openmpsimulator.h>
 #include <libgeodecomp/parallelization/serialsimulator.h>
+#include <libgeodecomp/parallelization/nesting/temporalblockingstepper.h>
 #include <libgeodecomp/testbed/performancetests/cpubenchmark.h>
 #include <libgeodecomp/storage/unstructuredgrid.h>
 #include <libgeodecomp/storage/unstructuredneighborhood.h>
@@ -376,6 +387,12 @@ private:
     int expansionWidth;
 };
 
+/**
+ * ADJACENCY may be RegionBasedAdjacency (gold) or CSRAdjacency
+ * (platinum), the latter allows Region::expandWithAdjacency() to
+ * copy neighbor lists in bulk.
+ */
+template<typename ADJACENCY>
 class RegionExpandWithAdjacency : public CPUBenchmark
 {
 public:
@@ -395,7 +412,7 @@ public:
 
     std::string species()
     {
-        return "gold";
+        return speciesName(static_cast<ADJACENCY*>(0));
     }
 
     static std::map<int, ConvexPolytope<FloatCoord<2> > > genGrid(int numCells)
@@ -473,7 +490,7 @@ public:
         std::map<int, ConvexPolytope<FloatCoord<2> > > cells = mapIDs(rawCells, idStreakLength);
 
         // II. Extract Adjacency List from Cells
-        RegionBasedAdjacency adjacency;
+        ADJACENCY adjacency;
         std::vector<int> ids;
 
         for (std::map<int, ConvexPolytope<FloatCoord<2> > >::iterator  i = cells.begin(); i != cells.end(); ++i) {
@@ -523,6 +540,16 @@ public:
 private:
     std::map<int, ConvexPolytope<FloatCoord<2> > > rawCells;
 
+    static std::string speciesName(RegionBasedAdjacency*)
+    {
+        return "gold";
+    }
+
+    static std::string speciesName(CSRAdjacency*)
+    {
+        return "platinum";
+    }
+
     static std::map<int, ConvexPolytope<FloatCoord<2> > > mapIDs(
         const std::map<int, ConvexPolytope<FloatCoord<2> > >& rawCells, int idStreakLength)
     {
@@ -802,6 +829,341 @@ public:
     }
 };
 
+/**
+ * Reference for the OozeBalancer benchmark: this is how the
+ * OozeBalancer used to compute its expected optimal distribution,
+ * materializing the load of each individual item.
+ */
+class OozeBalancerVanilla : public CPUBenchmark
+{
+public:
+    std::string family()
+    {
+        return "OozeBalancer";
+    }
+
+    std::string species()
+    {
+        return "vanilla";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        LoadBalancer::WeightVec weights = genWeights(rawDim[0], rawDim[1]);
+        LoadBalancer::LoadVec relativeLoads = genLoads(rawDim[0]);
+        double seconds = 0;
+        double sum = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            LoadBalancer::LoadVec ret = expectedOptimalDistribution(weights, relativeLoads);
+            sum += ret[0];
+        }
+
+        if (sum == 4711) {
+            std::cout << "pure debug statement to prevent the compiler from optimizing away the previous function";
+        }
+
+        return seconds;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+
+    static LoadBalancer::WeightVec genWeights(int numNodes, int itemsPerNode)
+    {
+        LoadBalancer::WeightVec ret(numNodes);
+        for (int i = 0; i < numNodes; ++i) {
+            ret[i] = itemsPerNode / 2 + (i * 7919) % itemsPerNode;
+        }
+
+        return ret;
+    }
+
+    static LoadBalancer::LoadVec genLoads(int numNodes)
+    {
+        LoadBalancer::LoadVec ret(numNodes);
+        for (int i = 0; i < numNodes; ++i) {
+            ret[i] = 0.5 + (i % 13) * 0.1;
+        }
+
+        return ret;
+    }
+
+private:
+    LoadBalancer::LoadVec expectedOptimalDistribution(
+        const LoadBalancer::WeightVec& weights,
+        const LoadBalancer::LoadVec& relativeLoads)
+    {
+        unsigned n = weights.size();
+        double targetLoadPerNode = LibGeoDecomp::sum(relativeLoads) / n;
+
+        LoadBalancer::LoadVec ret(n, 0);
+        LoadBalancer::LoadVec loadPerItem;
+        for (unsigned i = 0; i < n; i++) {
+            if (weights[i]) {
+                LoadBalancer::LoadVec add(weights[i], relativeLoads[i] / weights[i]);
+                append(loadPerItem, add);
+            }
+        }
+        LoadBalancer::LoadVec remFractPerItem(LibGeoDecomp::sum(weights), 1.0);
+
+        for (unsigned nodeC = 0; nodeC < n - 1; nodeC++) {
+            double remLoad = targetLoadPerNode;
+
+            for (unsigned itemC = 0; itemC < loadPerItem.size(); itemC++) {
+                if (remFractPerItem[itemC] == 0) {
+                    continue;
+                }
+
+                double l = remFractPerItem[itemC] * loadPerItem[itemC];
+                if (l <= remLoad) {
+                    ret[nodeC] += remFractPerItem[itemC];
+                    remFractPerItem[itemC] = 0;
+                    remLoad -= l;
+                } else {
+                    double consumedFract = remLoad / loadPerItem[itemC];
+                    ret[nodeC] += consumedFract;
+                    remFractPerItem[itemC] -= consumedFract;
+                    remLoad = 0;
+                }
+
+                if (remLoad == 0) {
+                    break;
+                }
+            }
+        }
+
+        ret.back() += LibGeoDecomp::sum(remFractPerItem);
+
+        return ret;
+    }
+};
+
+/**
+ * Measures a complete OozeBalancer::balance() call, which includes
+ * the computation of the expected optimal distribution, see above.
+ */
+class OozeBalancerGold : public CPUBenchmark
+{
+public:
+    std::string family()
+    {
+        return "OozeBalancer";
+    }
+
+    std::string species()
+    {
+        return "gold";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        LoadBalancer::WeightVec weights = OozeBalancerVanilla::genWeights(rawDim[0], rawDim[1]);
+        LoadBalancer::LoadVec relativeLoads = OozeBalancerVanilla::genLoads(rawDim[0]);
+        OozeBalancer balancer;
+        double seconds = 0;
+        double sum = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            LoadBalancer::WeightVec ret = balancer.balance(weights, relativeLoads);
+            sum += ret[0];
+        }
+
+        if (sum == 4711) {
+            std::cout << "pure debug statement to prevent the compiler from optimizing away the previous function";
+        }
+
+        return seconds;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+};
+
+/**
+ * Particle for the BoxCell benchmarks below: it doesn't interact
+ * with its neighbors but simply drifts, so that the time spent for
+ * migrating particles between boxes dominates.
+ */
+class DriftingParticle
+{
+public:
+    class API : public APITraits::HasCubeTopology<3>
+    {};
+
+    explicit DriftingParticle(
+        const FloatCoord<3>& pos = FloatCoord<3>(),
+        const FloatCoord<3>& velocity = FloatCoord<3>()) :
+        pos(pos),
+        velocity(velocity)
+    {}
+
+    template<class HOOD>
+    inline void update(const HOOD& /* hood */, const int /* nanoStep */)
+    {
+        pos += velocity;
+    }
+
+    inline const FloatCoord<3>& getPos() const
+    {
+        return pos;
+    }
+
+private:
+    FloatCoord<3> pos;
+    FloatCoord<3> velocity;
+};
+
+/**
+ * Reference for the BoxCell benchmark: this is how BoxCell used to
+ * migrate particles, by checking each particle of every neighboring
+ * box on each step.
+ */
+class RescanningBoxCell
+{
+public:
+    typedef FixedArray<DriftingParticle, 30> Container;
+
+    class API :
+        public APITraits::HasCubeTopology<3>,
+        public APITraits::HasStencil<Stencils::Moore<3, 1> >
+    {};
+
+    inline explicit RescanningBoxCell(
+        const FloatCoord<3>& origin = FloatCoord<3>(),
+        const FloatCoord<3>& dimension = FloatCoord<3>()) :
+        origin(origin),
+        dimension(dimension)
+    {}
+
+    inline void insert(const DriftingParticle& particle)
+    {
+        particles << particle;
+    }
+
+    inline std::size_t size() const
+    {
+        return particles.size();
+    }
+
+    template<class HOOD>
+    inline void update(const HOOD& hood, const int nanoStep)
+    {
+        *this = hood[Coord<3>()];
+        FloatCoord<3> oppositeCorner = origin + dimension;
+
+        if (nanoStep == 0) {
+            particles.clear();
+            CoordBox<3> box(Coord<3>::diagonal(-1), Coord<3>::diagonal(3));
+
+            for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+                const Container& neighbors = hood[*i].particles;
+
+                for (Container::const_iterator j = neighbors.begin(); j != neighbors.end(); ++j) {
+                    if (APITraits::SelectPositionChecker<DriftingParticle>::value(*j, origin, oppositeCorner)) {
+                        particles << *j;
+                    }
+                }
+            }
+        }
+
+        for (Container::iterator i = particles.begin(); i != particles.end(); ++i) {
+            i->update(hood, nanoStep);
+        }
+    }
+
+private:
+    FloatCoord<3> origin;
+    FloatCoord<3> dimension;
+    Container particles;
+};
+
+template<typename CELL>
+class BoxCellBenchmark : public CPUBenchmark
+{
+public:
+    std::string family()
+    {
+        return "BoxCell";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        typedef typename APITraits::SelectTopology<CELL>::Value Topology;
+        Grid<CELL, Topology> gridOld(dim);
+        Grid<CELL, Topology> gridNew(dim);
+        CoordBox<3> box(Coord<3>(), dim);
+        Region<3> region;
+        region << box;
+        int maxT = 20;
+
+        for (CoordBox<3>::Iterator i = box.begin(); i != box.end(); ++i) {
+            FloatCoord<3> origin = *i;
+            gridOld[*i] = CELL(origin, FloatCoord<3>(1, 1, 1));
+
+            for (int j = 0; j < 8; ++j) {
+                FloatCoord<3> offset(
+                    0.25 + 0.5 * (j & 1),
+                    0.25 + 0.5 * ((j >> 1) & 1),
+                    0.25 + 0.5 * ((j >> 2) & 1));
+                // roughly one in ten particles migrates per step:
+                FloatCoord<3> velocity(
+                    0.01 * ((i->x() + j) % 3 - 1),
+                    0.01 * ((i->y() + j) % 3 - 1),
+                    0.01 * ((i->z() + j) % 3 - 1));
+                gridOld[*i].insert(DriftingParticle(origin + offset, velocity));
+            }
+        }
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            for (int step = 0; step < maxT; step += 2) {
+                UpdateFunctor<CELL>()(region, Coord<3>(), Coord<3>(), gridOld, &gridNew, 0);
+                UpdateFunctor<CELL>()(region, Coord<3>(), Coord<3>(), gridNew, &gridOld, 0);
+            }
+        }
+
+        if (gridOld[Coord<3>(1, 1, 1)].size() == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        return seconds;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+};
+
+class BoxCellVanilla : public BoxCellBenchmark<RescanningBoxCell>
+{
+public:
+    std::string species()
+    {
+        return "vanilla";
+    }
+};
+
+class BoxCellGold : public BoxCellBenchmark<BoxCell<FixedArray<DriftingParticle, 30> > >
+{
+public:
+    std::string species()
+    {
+        return "gold";
+    }
+};
+
 class Jacobi3DVanilla : public CPUBenchmark
 {
 public:
@@ -1175,6 +1537,77 @@ public:
     }
 };
 
+/**
+ * Compares the VanillaStepper to the TemporalBlockingStepper, which
+ * reuses cached data across the nano steps between two ghost zone
+ * synchronizations.
+ */
+template<typename STEPPER>
+class Jacobi3DStepper : public CPUBenchmark
+{
+public:
+    explicit Jacobi3DStepper(const std::string& species) :
+        mySpecies(species)
+    {}
+
+    std::string family()
+    {
+        return "Jacobi3DStepper";
+    }
+
+    std::string species()
+    {
+        return mySpecies;
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        typedef typename STEPPER::Topology Topology;
+
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int maxT = 16;
+        unsigned ghostZoneWidth = 4;
+        boost::shared_ptr<NoOpInitializer<JacobiCellClassic> > init(
+            new NoOpInitializer<JacobiCellClassic>(dim, maxT));
+        CoordBox<3> box = init->gridBox();
+
+        std::vector<std::size_t> weights(1, box.dimensions.prod());
+        boost::shared_ptr<Partition<3> > partition(
+            new StripingPartition<3>(Coord<3>(), box.dimensions, 0, weights));
+        boost::shared_ptr<PartitionManager<Topology> > partitionManager(
+            new PartitionManager<Topology>());
+        partitionManager->resetRegions(box, partition, 0, ghostZoneWidth);
+        partitionManager->resetGhostZones(std::vector<CoordBox<3> >(1, box));
+
+        STEPPER stepper(partitionManager, init);
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            stepper.update(maxT);
+        }
+
+        if (stepper.grid().get(Coord<3>(1, 1, 1)).temp == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        double updates = 1.0 * maxT * dim.prod();
+        double gLUPS = 1e-9 * updates / seconds;
+
+        return gLUPS;
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+
+private:
+    std::string mySpecies;
+};
+
 class JacobiCellFixedHood
 {
 public:
@@ -1248,6 +1681,50 @@ public:
     }
 };
 
+class Jacobi3DCacheBlocking : public CPUBenchmark
+{
+public:
+    std::string family()
+    {
+        return "Jacobi3D";
+    }
+
+    std::string species()
+    {
+        return "bronze";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        int maxT = 20;
+
+        // take the pipeline parameters the factory would hand to the
+        // optimizer as a starting point:
+        boost::shared_ptr<ClonableInitializer<JacobiCellFixedHood> > init(
+            ClonableInitializerWrapper<NoOpInitializer<JacobiCellFixedHood> >::wrap(dim, maxT));
+        CacheBlockingSimulationFactory<JacobiCellFixedHood> factory(init);
+        boost::shared_ptr<Simulator<JacobiCellFixedHood> > sim(factory());
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            sim->run();
+        }
+
+        double updates = 1.0 * maxT * dim.prod();
+        double gLUPS = 1e-9 * updates / seconds;
+
+        return gLUPS;
+    }
+
+    std::string unit()
+    {
+        return "GLUPS";
+    }
+};
+
 class QuadM128
 {
 public:
@@ -2639,7 +3116,7 @@ public:
     }
 };
 
-template<class PARTITION>
+template<class PARTITION, int DIM = 2>
 class PartitionBenchmark : public CPUBenchmark
 {
 public:
@@ -2659,22 +3136,26 @@ public:
 
     double performance(std::vector<int> rawDim)
     {
-        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
         double duration = 0;
-        Coord<2> accu;
-        Coord<2> realDim(dim.x(), dim.y());
+        Coord<DIM> accu;
+        Coord<DIM> origin;
+        Coord<DIM> realDim;
+        for (int d = 0; d < DIM; ++d) {
+            origin[d] = 100 * (d + 1);
+            realDim[d] = rawDim[d];
+        }
 
         {
             ScopedTimer t(&duration);
 
-            PARTITION h(Coord<2>(100, 200), realDim);
+            PARTITION h(origin, realDim);
             typename PARTITION::Iterator end = h.end();
             for (typename PARTITION::Iterator i = h.begin(); i != end; ++i) {
                 accu += *i;
             }
         }
 
-        if (accu == Coord<2>()) {
+        if (accu == Coord<DIM>()) {
             throw std::runtime_error("oops, partition iteration went bad!");
         }
 
@@ -2690,6 +3171,79 @@ private:
     std::string name;
 };
 
+/**
+ * Measures how long it takes to retrieve the regions of all nodes
+ * from a space-filling curve. The vanilla version assembles them
+ * from the curve's iterators, the gold version uses getRegion().
+ */
+template<class PARTITION, int DIM>
+class PartitionRegionBenchmark : public CPUBenchmark
+{
+public:
+    static const std::size_t NUM_NODES = 64;
+
+    PartitionRegionBenchmark(const std::string& name, bool useIterators) :
+        name(name),
+        useIterators(useIterators)
+    {}
+
+    std::string species()
+    {
+        return useIterators ? "vanilla" : "gold";
+    }
+
+    std::string family()
+    {
+        return name;
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        double duration = 0;
+        Coord<DIM> origin;
+        Coord<DIM> realDim;
+        for (int d = 0; d < DIM; ++d) {
+            origin[d] = 100 * (d + 1);
+            realDim[d] = rawDim[d];
+        }
+
+        std::size_t numCells = realDim.prod();
+        std::vector<std::size_t> weights(NUM_NODES, numCells / NUM_NODES);
+        weights.back() += numCells % NUM_NODES;
+        PARTITION partition(origin, realDim, 0, weights);
+        std::size_t accu = 0;
+
+        {
+            ScopedTimer t(&duration);
+
+            std::size_t start = 0;
+            for (std::size_t i = 0; i < NUM_NODES; ++i) {
+                if (useIterators) {
+                    accu += Region<DIM>(partition[start], partition[start + weights[i]]).size();
+                } else {
+                    accu += partition.getRegion(i).size();
+                }
+                start += weights[i];
+            }
+        }
+
+        if (accu != numCells) {
+            throw std::runtime_error("oops, partition regions went bad!");
+        }
+
+        return duration;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+
+private:
+    std::string name;
+    bool useIterators;
+};
+
 #ifdef LIBGEODECOMP_WITH_CPP14
 typedef double ValueType;
 static const std::size_t MATRICES = 1;
@@ -2762,6 +3316,7 @@ public:
     class API :
         public APITraits::HasSoA,
         public APITraits::HasUpdateLineX,
+        public APITraits::HasMaskedUpdateLineX,
         public APITraits::HasUnstructuredTopology,
         public APITraits::HasSellType<ValueType>,
         public APITraits::HasSellMatrices<MATRICES>,
@@ -2795,7 +3350,7 @@ public:
                 values.gather(&hoodOld->value(), j.first());
                 tmp += values * weights;
             }
-            tmp.store_aligned(&hoodNew->sum() + i * C);
+            hoodNew.store(&hoodNew->sum(), i * C, tmp);
         }
     }
 
@@ -2955,6 +3510,64 @@ class SellMatrixInitializer : public CPUBenchmark
     }
 };
 
+/**
+ * Same as SellMatrixInitializer, but feeds the matrix in coordinate
+ * format (COO) instead of a std::map, which avoids one allocation
+ * per entry. Timing includes the conversion to CSR.
+ */
+class SellMatrixInitializerCOO : public CPUBenchmark
+{
+    public:
+    std::string family()
+    {
+        return "SELLInit";
+    }
+
+    std::string species()
+    {
+        return "gold";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+        const Coord<1> dim1d(dim.x());
+        const int size = dim.x();
+        UnstructuredGrid<SPMVMCell, MATRICES, ValueType, C, SIGMA> grid(dim1d);
+        std::vector<int> rows;
+        std::vector<int> columns;
+        std::vector<ValueType> values;
+
+        // setup matrix: ~1 % non zero entries
+        for (int row = 0; row < size; ++row) {
+            for (int col = 0; col < size / 100; ++col) {
+                rows << row;
+                columns << col * 100;
+                values << 5.0;
+            }
+        }
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            grid.setWeights(0, CSRMatrix<ValueType>::fromCOO(size, size, rows, columns, values));
+        }
+
+        if (grid.get(Coord<1>(1)).sum == 4711) {
+            std::cout << "this statement just serves to prevent the compiler from"
+                      << "optimizing away the loops above\n";
+        }
+
+        return seconds;
+    }
+
+    std::string unit()
+    {
+        return "s";
+    }
+};
+
 class SparseMatrixVectorMultiplication : public CPUBenchmark
 {
 private:
@@ -3032,10 +3645,15 @@ private:
         GRID *gridNew,
         unsigned nanoStep)
     {
+        typedef UpdateFunctorHelpers::ConcurrencyEnableOpenMP Concurrency;
         gridOld.callback(
             gridNew,
-            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<CELL>(
-                gridOld, gridNew, region, nanoStep));
+            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<CELL, Concurrency>(
+                gridOld,
+                gridNew,
+                region,
+                nanoStep,
+                Concurrency(false, false)));
     }
 
 public:
@@ -3095,13 +3713,15 @@ private:
     void updateFunctor(const Region<1>& region, const GRID& gridOld,
                        GRID *gridNew, unsigned nanoStep)
     {
+        typedef UpdateFunctorHelpers::ConcurrencyEnableOpenMP Concurrency;
         gridOld.callback(
             gridNew,
-            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<CELL>(
+            UnstructuredUpdateFunctorHelpers::UnstructuredGridSoAUpdateHelper<CELL, Concurrency>(
                 gridOld,
                 gridNew,
                 region,
-                nanoStep));
+                nanoStep,
+                Concurrency(false, false)));
     }
 
 public:
@@ -3258,10 +3878,140 @@ public:
 #endif
 #endif
 
+#if defined(LIBGEODECOMP_WITH_BOOST_ASIO) && defined(LIBGEODECOMP_WITH_THREADS)
+
+/**
+ * Measures the throughput of the RemoteSteerer's binary data
+ * streaming (StreamServer to StreamClient) via the loopback device.
+ */
+class RemoteSteererStreaming : public CPUBenchmark
+{
+public:
+    class Receiver
+    {
+    public:
+        Receiver(RemoteSteererHelpers::StreamClient *client, int numFrames) :
+            client(client),
+            numFrames(numFrames)
+        {}
+
+        void operator()()
+        {
+            RemoteSteererHelpers::StreamFrameHeader header;
+            std::vector<char> payload;
+            for (int i = 0; i < numFrames; ++i) {
+                if (!client->receive(&header, &payload)) {
+                    throw std::runtime_error("stream closed prematurely");
+                }
+            }
+        }
+
+    private:
+        RemoteSteererHelpers::StreamClient *client;
+        int numFrames;
+    };
+
+    std::string family()
+    {
+        return "RemoteSteererStreaming";
+    }
+
+    std::string species()
+    {
+        return "gold";
+    }
+
+    double performance(std::vector<int> rawDim)
+    {
+        using namespace RemoteSteererHelpers;
+        int port = 47150;
+        int numFrames = 20;
+        Coord<3> dim(rawDim[0], rawDim[1], rawDim[2]);
+
+        StreamFrameHeader header;
+        header.magic = StreamFrameHeader::MAGIC;
+        header.subscription = 0;
+        header.step = 0;
+        header.elementSize = sizeof(double);
+        for (int d = 0; d < 3; ++d) {
+            header.origin[d] = 0;
+            header.dimensions[d] = dim[d];
+        }
+        header.payloadSize = dim.prod() * sizeof(double);
+        StreamServer::FramePtr frame(new std::vector<char>(sizeof(header) + header.payloadSize));
+        std::copy(
+            reinterpret_cast<char*>(&header),
+            reinterpret_cast<char*>(&header) + sizeof(header),
+            frame->begin());
+
+        StreamServer server(port, 4);
+        StreamClient client(port);
+        client.subscribe("value", 1, 1, CoordBox<3>(Coord<3>(), dim));
+
+        StringVec requests;
+        while (requests.empty()) {
+            boost::this_thread::yield();
+            requests = server.retrieveRequests();
+        }
+        int id = StringOps::atoi(StringOps::tokenize(requests[0], " ")[1]);
+
+        double seconds = 0;
+        {
+            ScopedTimer t(&seconds);
+
+            boost::thread receiverThread(Receiver(&client, numFrames));
+            for (int i = 0; i < numFrames; ++i) {
+                while (!server.ready(id)) {
+                    boost::this_thread::yield();
+                }
+                server.post(id, frame);
+            }
+            receiverThread.join();
+        }
+
+        return 1e-9 * numFrames * header.payloadSize / seconds;
+    }
+
+    std::string unit()
+    {
+        return "GB/s";
+    }
+};
+
+#endif
+
 #ifdef LIBGEODECOMP_WITH_CUDA
 void cudaTests(std::string name, std::string revision, int cudaDevice);
 #endif
 
+template<typename ADJACENCY>
+void runRegionExpandWithAdjacency(
+    LibFlatArray::evaluate& eval,
+    const std::map<int, ConvexPolytope<FloatCoord<2> > >& cells,
+    std::vector<int> params)
+{
+    params[1] = 0; // skip cells
+    params[2] = 1; // expansion width
+    params[3] = -1; // id streak lenght
+    eval(RegionExpandWithAdjacency<ADJACENCY>(cells), params);
+    params[1] = 5000; // skip cells
+    params[3] = 500; // id streak lenght
+    eval(RegionExpandWithAdjacency<ADJACENCY>(cells), params);
+
+    params[1] = 100;
+    params[2] = 50;
+    params[3] = 100;
+    eval(RegionExpandWithAdjacency<ADJACENCY>(cells), params);
+
+    params[2] = 20;
+    params[3] = 10;
+    eval(RegionExpandWithAdjacency<ADJACENCY>(cells), params);
+
+    params[2] = 10;
+    params[3] = 2;
+    eval(RegionExpandWithAdjacency<ADJACENCY>(cells), params);
+}
+
 int main(int argc, char **argv)
 {
     if ((argc < 3) || (argc == 4) || (argc > 5)) {
@@ -3301,6 +4051,10 @@ int main(int argc, char **argv)
         eval(SellMatrixInitializer(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(SellMatrixInitializerCOO(), toVector(sizes[i]));
+    }
+
     for (std::size_t i = 0; i < sizes.size(); ++i) {
         eval(SparseMatrixVectorMultiplication(), toVector(sizes[i]));
     }
@@ -3356,28 +4110,11 @@ int main(int argc, char **argv)
     {
         std::vector<int> params(4);
         int numCells = 2000000;
-        std::map<int, ConvexPolytope<FloatCoord<2> > > cells = RegionExpandWithAdjacency::genGrid(numCells);
+        std::map<int, ConvexPolytope<FloatCoord<2> > > cells =
+            RegionExpandWithAdjacency<RegionBasedAdjacency>::genGrid(numCells);
         params[0] = numCells;
-        params[1] = 0; // skip cells
-        params[2] = 1; // expansion width
-        params[3] = -1; // id streak lenght
-        eval(RegionExpandWithAdjacency(cells), params);
-        params[1] = 5000; // skip cells
-        params[3] = 500; // id streak lenght
-        eval(RegionExpandWithAdjacency(cells), params);
-
-        params[1] = 100;
-        params[2] = 50;
-        params[3] = 100;
-        eval(RegionExpandWithAdjacency(cells), params);
-
-        params[2] = 20;
-        params[3] = 10;
-        eval(RegionExpandWithAdjacency(cells), params);
-
-        params[2] = 10;
-        params[3] = 2;
-        eval(RegionExpandWithAdjacency(cells), params);
+        runRegionExpandWithAdjacency<RegionBasedAdjacency>(eval, cells, params);
+        runRegionExpandWithAdjacency<CSRAdjacency>(eval, cells, params);
     }
 
     eval(CoordEnumerationVanilla(), toVector(Coord<3>( 128,  128,  128)));
@@ -3394,6 +4131,21 @@ int main(int argc, char **argv)
 
     eval(FloatCoordAccumulationGold(), toVector(Coord<3>(2048, 2048, 2048)));
 
+    eval(OozeBalancerVanilla(), toVector(Coord<3>(  64, 100000, 1)));
+    eval(OozeBalancerVanilla(), toVector(Coord<3>( 256,  10000, 1)));
+    eval(OozeBalancerVanilla(), toVector(Coord<3>(1024,   1000, 1)));
+
+    eval(OozeBalancerGold(), toVector(Coord<3>(  64, 100000, 1)));
+    eval(OozeBalancerGold(), toVector(Coord<3>( 256,  10000, 1)));
+    eval(OozeBalancerGold(), toVector(Coord<3>(1024,   1000, 1)));
+    eval(OozeBalancerGold(), toVector(Coord<3>(1 << 20, 1 << 30, 1)));
+
+    eval(BoxCellVanilla(), toVector(Coord<3>( 32,  32,  32)));
+    eval(BoxCellVanilla(), toVector(Coord<3>( 64,  64,  64)));
+
+    eval(BoxCellGold(), toVector(Coord<3>( 32,  32,  32)));
+    eval(BoxCellGold(), toVector(Coord<3>( 64,  64,  64)));
+
     sizes << Coord<3>(22, 22, 22)
           << Coord<3>(64, 64, 64)
           << Coord<3>(68, 68, 68)
@@ -3418,10 +4170,20 @@ int main(int argc, char **argv)
         eval(Jacobi3DClassic(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        typedef UpdateFunctorHelpers::ConcurrencyNoP Concurrency;
+        eval(Jacobi3DStepper<VanillaStepper<JacobiCellClassic, Concurrency> >("vanilla"), toVector(sizes[i]));
+        eval(Jacobi3DStepper<TemporalBlockingStepper<JacobiCellClassic, Concurrency> >("gold"), toVector(sizes[i]));
+    }
+
     for (std::size_t i = 0; i < sizes.size(); ++i) {
         eval(Jacobi3DFixedHood(), toVector(sizes[i]));
     }
 
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        eval(Jacobi3DCacheBlocking(), toVector(sizes[i]));
+    }
+
     for (std::size_t i = 0; i < sizes.size(); ++i) {
         eval(Jacobi3DStreakUpdate(), toVector(sizes[i]));
     }
@@ -3451,9 +4213,30 @@ int main(int argc, char **argv)
     std::vector<int> dim = toVector(Coord<3>(32 * 1024, 32 * 1024, 1));
     eval(PartitionBenchmark<HIndexingPartition   >("PartitionHIndexing"), dim);
     eval(PartitionBenchmark<StripingPartition<2> >("PartitionStriping"),  dim);
-    eval(PartitionBenchmark<HilbertPartition     >("PartitionHilbert"),   dim);
+    eval(PartitionBenchmark<HilbertPartition<2>  >("PartitionHilbert"),   dim);
     eval(PartitionBenchmark<ZCurvePartition<2>   >("PartitionZCurve"),    dim);
 
+    dim = toVector(Coord<3>(256, 256, 256));
+    eval(PartitionBenchmark<HilbertPartition<3>, 3>("PartitionHilbert3D"), dim);
+    eval(PartitionBenchmark<ZCurvePartition<3>,  3>("PartitionZCurve3D"),  dim);
+
+    dim = toVector(Coord<3>(8 * 1024, 8 * 1024, 1));
+    eval(PartitionRegionBenchmark<HilbertPartition<2>, 2>("PartitionRegionHilbert", true),  dim);
+    eval(PartitionRegionBenchmark<HilbertPartition<2>, 2>("PartitionRegionHilbert", false), dim);
+    eval(PartitionRegionBenchmark<ZCurvePartition<2>,  2>("PartitionRegionZCurve",  true),  dim);
+    eval(PartitionRegionBenchmark<ZCurvePartition<2>,  2>("PartitionRegionZCurve",  false), dim);
+
+    dim = toVector(Coord<3>(256, 256, 256));
+    eval(PartitionRegionBenchmark<HilbertPartition<3>, 3>("PartitionRegionHilbert3D", true),  dim);
+    eval(PartitionRegionBenchmark<HilbertPartition<3>, 3>("PartitionRegionHilbert3D", false), dim);
+    eval(PartitionRegionBenchmark<ZCurvePartition<3>,  3>("PartitionRegionZCurve3D",  true),  dim);
+    eval(PartitionRegionBenchmark<ZCurvePartition<3>,  3>("PartitionRegionZCurve3D",  false), dim);
+
+#if defined(LIBGEODECOMP_WITH_BOOST_ASIO) && defined(LIBGEODECOMP_WITH_THREADS)
+    eval(RemoteSteererStreaming(), toVector(Coord<3>( 64,  64,  64)));
+    eval(RemoteSteererStreaming(), toVector(Coord<3>(128, 128, 128)));
+#endif
+
 #ifdef LIBGEODECOMP_WITH_CUDA
     cudaTests(name, revision, cudaDevice);
 #endif
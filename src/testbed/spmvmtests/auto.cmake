@@ -0,0 +1,8 @@
+set(SOURCES ${SOURCES}
+  ${RELATIVE_PATH}main.cpp
+  ${RELATIVE_PATH}mmio.cpp
+)
+set(HEADERS ${HEADERS}
+  ${RELATIVE_PATH}matrixloader.h
+  ${RELATIVE_PATH}mmio.h
+)
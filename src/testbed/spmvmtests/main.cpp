@@ -7,8 +7,10 @@
  *
  * Use the accompanying fetch_matrices.sh to download/extract these.
  *
- * We're using the Matrix Market IO library for matrix parsing:
+ * We're using the Matrix Market IO library for parsing the header:
  * http://math.nist.gov/MatrixMarket/mmio-c.html
+ * The entries are read by MatrixLoader, which also caches matrices
+ * in a binary format (FILE.mtx.stored.bin) for subsequent runs.
  *
  */
 #include <libgeodecomp/config.h>
@@ -23,6 +25,7 @@
 #include <libgeodecomp/storage/unstructuredsoagrid.h>
 #include <libgeodecomp/storage/unstructuredsoaneighborhood.h>
 #include <libgeodecomp/storage/unstructuredupdatefunctor.h>
+#include <libgeodecomp/testbed/spmvmtests/matrixloader.h>
 #include <libgeodecomp/testbed/spmvmtests/mmio.h>
 
 #include <libflatarray/short_vec.hpp>
@@ -193,32 +196,6 @@ private:
     std::vector<int>        column;
     std::vector<int>        rowLen;
 
-    void initFromMatrix(const std::map<Coord<2>, VALUE_TYPE>& matrix)
-    {
-        const int nonZero = matrix.size();
-        if (!nonZero) {
-            throw std::logic_error("Matrix should at least have one non-zero entry");
-        }
-
-        values.resize(nonZero);
-        column.resize(nonZero);
-        rowLen.resize(dimension + 1);
-
-        int currentRow = 0;
-        int cnt = 0;
-        rowLen[0] = 0;
-        for (const auto& pair : matrix) {
-            if (currentRow != pair.first.x()) {
-                currentRow = pair.first.x();
-                rowLen[currentRow] = cnt;
-            }
-            values[cnt] = pair.second;
-            column[cnt] = pair.first.y();
-            ++cnt;
-        }
-        rowLen[dimension] = cnt;
-    }
-
 public:
     inline
     explicit CRSInitializer(int dim) :
@@ -245,42 +222,19 @@ public:
 
     void init(const std::string& fileName)
     {
-        std::map<Coord<2>, VALUE_TYPE> adjacency;
-
-        // read matrix into adjacency (this may take some time ...)
-        // using this C API provided by matrix market
-        MM_typecode matcode;
-        int M, N, nz;
-        FILE *f = fopen(fileName.c_str(), "r");
-        if (!f) {
-            LOG(FATAL, "CRSInitializer failed to open file " << fileName);
-            throw std::logic_error("fopen() failed");
-        }
-
-        if (mm_read_banner(f, &matcode) != 0) {
-            throw std::logic_error("Could not process Matrix Market banner");
-        }
-
-        if (mm_read_mtx_crd_size(f, &M, &N, &nz) != 0) {
-            throw std::logic_error("Could not dimensions of matrix");
-        }
-
-        if (dimension != M || dimension != N) {
+        // the NZ values used for the GFLOP/s figures below count the
+        // stored entries only, so symmetric matrices aren't expanded:
+        CSRMatrix<double> matrix = MatrixLoader::readCached(fileName, false);
+        if (dimension != matrix.rows() || dimension != matrix.columns()) {
             throw std::logic_error("Size mismatch");
         }
-
-        for (int i = 0; i < nz; ++i) {
-            int m, n;
-            double tmp;
-            if (fscanf(f, "%d %d %lg\n", &m, &n, &tmp) != 3) {
-                throw std::logic_error("Failed to parse mtx format");
-            }
-            adjacency[Coord<2>(m - 1, n - 1)] = tmp;
+        if (!matrix.nonZeros()) {
+            throw std::logic_error("Matrix should at least have one non-zero entry");
         }
 
-        fclose(f);
-
-        initFromMatrix(adjacency);
+        values.assign(matrix.values().begin(), matrix.values().end());
+        column = matrix.columnIndices();
+        rowLen = matrix.rowOffsets();
     }
 };
 
@@ -308,42 +262,13 @@ public:
 
     virtual void grid(GridBase<CELL, 1> *grid)
     {
-        // setup sparse matrix
-        std::map<Coord<2>, double> weights;
-
-        // read matrix into weights (this may take some time ...)
-        // using this C API provided by matrix market
-        MM_typecode matcode;
-        int M, N, nz;
-        FILE *f = fopen(fileName.c_str(), "r");
-        if (!f) {
-            LOG(FATAL, "SparseMatrixInitializerMM failed to open file " << fileName);
-            throw std::logic_error("fopen() failed");
-        }
-
-        if (mm_read_banner(f, &matcode) != 0) {
-            throw std::logic_error("Could not process Matrix Market banner");
-        }
-
-        if (mm_read_mtx_crd_size(f, &M, &N, &nz) != 0) {
-            throw std::logic_error("Could not dimensions of matrix");
-        }
-
-        if (size != M || size != N) {
+        // setup sparse matrix, see CRSInitializer::init() for why
+        // symmetric matrices aren't expanded:
+        CSRMatrix<double> weights = MatrixLoader::readCached(fileName, false);
+        if (size != weights.rows() || size != weights.columns()) {
             throw std::logic_error("Size mismatch");
         }
 
-        for (int i = 0; i < nz; ++i) {
-            int m, n;
-            double tmp;
-            if (fscanf(f, "%d %d %lg\n", &m, &n, &tmp) != 3) {
-                throw std::logic_error("Failed to parse mtx format");
-            }
-            weights[Coord<2>(m - 1, n - 1)] = tmp;
-        }
-
-        fclose(f);
-
         grid->setWeights(0, weights);
 
         // setup rhs: not needed, since the grid is intialized with default cells
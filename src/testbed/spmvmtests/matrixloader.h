@@ -0,0 +1,386 @@
+#ifndef LIBGEODECOMP_TESTBED_SPMVMTESTS_MATRIXLOADER_H
+#define LIBGEODECOMP_TESTBED_SPMVMTESTS_MATRIXLOADER_H
+
+#include <libgeodecomp/config.h>
+#include <libgeodecomp/storage/csrmatrix.h>
+#include <libgeodecomp/testbed/spmvmtests/mmio.h>
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#include <omp.h>
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace LibGeoDecomp {
+
+/**
+ * Reads sparse matrices from Matrix Market files (coordinate format,
+ * real/integer/pattern entries, general/symmetric/skew-symmetric
+ * storage) or from a raw binary dump. The banner is handled by
+ * mmio, but the entries are parsed from a memory mapping of the
+ * file: each thread gets a range of lines, so that neither an
+ * fscanf() nor a std::map insert per entry is required.
+ *
+ * The binary format is: int rows, int columns, int nonZeros,
+ * followed by int rowIndices[nonZeros], int columnIndices[nonZeros]
+ * and double values[nonZeros], all in native byte order.
+ */
+class MatrixLoader
+{
+public:
+    /**
+     * Mirrors the off-diagonal entries of (skew-)symmetric matrices
+     * unless expandSymmetric is false, in which case only the stored
+     * triangle is returned.
+     */
+    static CSRMatrix<double> readMatrixMarket(const std::string& fileName, bool expandSymmetric = true)
+    {
+        MM_typecode matcode;
+        int rows;
+        int columns;
+        int nonZeros;
+
+        FILE *f = fopen(fileName.c_str(), "r");
+        if (!f) {
+            throw std::runtime_error("MatrixLoader failed to open file " + fileName);
+        }
+        if (mm_read_banner(f, &matcode) != 0) {
+            fclose(f);
+            throw std::logic_error("Could not process Matrix Market banner");
+        }
+        if (!mm_is_coordinate(matcode) || mm_is_complex(matcode) || mm_is_hermitian(matcode)) {
+            fclose(f);
+            throw std::logic_error("Only real/integer/pattern matrices in coordinate format are supported");
+        }
+        if (mm_read_mtx_crd_size(f, &rows, &columns, &nonZeros) != 0) {
+            fclose(f);
+            throw std::logic_error("Could not read dimensions of matrix");
+        }
+        long offset = ftell(f);
+        fclose(f);
+
+        MappedFile file(fileName);
+        std::vector<int> rowIndices(nonZeros);
+        std::vector<int> columnIndices(nonZeros);
+        std::vector<double> values(nonZeros);
+        parseEntries(
+            file.data() + offset,
+            file.data() + file.size(),
+            mm_is_pattern(matcode),
+            &rowIndices,
+            &columnIndices,
+            &values);
+
+        if (expandSymmetric && (mm_is_symmetric(matcode) || mm_is_skew(matcode))) {
+            double sign = mm_is_skew(matcode) ? -1 : 1;
+            for (int i = 0; i < nonZeros; ++i) {
+                if (rowIndices[i] != columnIndices[i]) {
+                    rowIndices.push_back(columnIndices[i]);
+                    columnIndices.push_back(rowIndices[i]);
+                    values.push_back(sign * values[i]);
+                }
+            }
+        }
+
+        return CSRMatrix<double>::fromCOO(rows, columns, rowIndices, columnIndices, values);
+    }
+
+    static CSRMatrix<double> readBinary(const std::string& fileName)
+    {
+        MappedFile file(fileName);
+        int header[3];
+        if (file.size() < sizeof(header)) {
+            throw std::logic_error("Binary matrix file " + fileName + " is truncated");
+        }
+        std::memcpy(header, file.data(), sizeof(header));
+
+        std::size_t nonZeros = header[2];
+        if (file.size() != (sizeof(header) + nonZeros * (2 * sizeof(int) + sizeof(double)))) {
+            throw std::logic_error("Binary matrix file " + fileName + " has unexpected size");
+        }
+
+        const char *cursor = file.data() + sizeof(header);
+        std::vector<int> rowIndices(nonZeros);
+        std::vector<int> columnIndices(nonZeros);
+        std::vector<double> values(nonZeros);
+        cursor = copyFrom(cursor, &rowIndices);
+        cursor = copyFrom(cursor, &columnIndices);
+        cursor = copyFrom(cursor, &values);
+
+        return CSRMatrix<double>::fromCOO(header[0], header[1], rowIndices, columnIndices, values);
+    }
+
+    static void writeBinary(const std::string& fileName, const CSRMatrix<double>& matrix)
+    {
+        std::vector<int> rowIndices(matrix.nonZeros());
+        for (int row = 0; row < matrix.rows(); ++row) {
+            for (int i = matrix.rowOffsets()[row]; i < matrix.rowOffsets()[row + 1]; ++i) {
+                rowIndices[i] = row;
+            }
+        }
+
+        int header[3] = { matrix.rows(), matrix.columns(), int(matrix.nonZeros()) };
+        std::ofstream file(fileName.c_str(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        write(file, rowIndices);
+        write(file, matrix.columnIndices());
+        write(file, matrix.values());
+
+        if (!file) {
+            throw std::runtime_error("MatrixLoader failed to write file " + fileName);
+        }
+    }
+
+    /**
+     * Reads the binary cache (fileName + ".bin", or ".stored.bin"
+     * for unexpanded symmetric matrices) if present, otherwise parses
+     * the Matrix Market file and saves the result in the cache so
+     * that subsequent runs can skip parsing. The cache is keyed only
+     * by name, so delete it if the source file changes.
+     */
+    static CSRMatrix<double> readCached(const std::string& fileName, bool expandSymmetric = true)
+    {
+        std::string cacheName = fileName + (expandSymmetric ? ".bin" : ".stored.bin");
+        if (std::ifstream(cacheName.c_str())) {
+            return readBinary(cacheName);
+        }
+
+        CSRMatrix<double> ret = readMatrixMarket(fileName, expandSymmetric);
+        writeBinary(cacheName, ret);
+        return ret;
+    }
+
+private:
+    /**
+     * Read-only mapping of a whole file, unmapped on destruction.
+     */
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::string& fileName) :
+            myData(0),
+            mySize(0)
+        {
+            int fd = open(fileName.c_str(), O_RDONLY);
+            if (fd == -1) {
+                throw std::runtime_error("MatrixLoader failed to open file " + fileName);
+            }
+
+            struct stat info;
+            if (fstat(fd, &info) != 0) {
+                close(fd);
+                throw std::runtime_error("MatrixLoader failed to stat file " + fileName);
+            }
+            mySize = info.st_size;
+
+            if (mySize > 0) {
+                void *buf = mmap(0, mySize, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (buf == MAP_FAILED) {
+                    close(fd);
+                    throw std::runtime_error("MatrixLoader failed to map file " + fileName);
+                }
+                myData = static_cast<const char*>(buf);
+                madvise(buf, mySize, MADV_SEQUENTIAL);
+            }
+            close(fd);
+        }
+
+        ~MappedFile()
+        {
+            if (myData) {
+                munmap(const_cast<char*>(myData), mySize);
+            }
+        }
+
+        const char *data() const
+        {
+            return myData;
+        }
+
+        std::size_t size() const
+        {
+            return mySize;
+        }
+
+    private:
+        const char *myData;
+        std::size_t mySize;
+
+        MappedFile(const MappedFile&);
+        void operator=(const MappedFile&);
+    };
+
+    /**
+     * Entries are parsed in three passes: each thread counts the
+     * data lines in its chunk, a prefix sum over these counts yields
+     * each thread's write offset, then all threads parse their
+     * chunks directly into the output arrays.
+     */
+    static void parseEntries(
+        const char *begin,
+        const char *end,
+        bool pattern,
+        std::vector<int> *rowIndices,
+        std::vector<int> *columnIndices,
+        std::vector<double> *values)
+    {
+        int numChunks = 1;
+#ifdef LIBGEODECOMP_WITH_THREADS
+        numChunks = omp_get_max_threads();
+#endif
+        std::vector<const char*> chunkBegin(numChunks + 1, end);
+        chunkBegin[0] = begin;
+        for (int i = 1; i < numChunks; ++i) {
+            const char *cursor = begin + (end - begin) * i / numChunks;
+            cursor = (std::max)(cursor, chunkBegin[i - 1]);
+            chunkBegin[i] = nextLine(cursor, end);
+        }
+
+        std::vector<int> chunkOffset(numChunks + 1, 0);
+
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int i = 0; i < numChunks; ++i) {
+            int count = 0;
+            for (const char *line = chunkBegin[i]; line < chunkBegin[i + 1]; line = nextLine(line, end)) {
+                count += isDataLine(line, end);
+            }
+            chunkOffset[i + 1] = count;
+        }
+
+        for (int i = 0; i < numChunks; ++i) {
+            chunkOffset[i + 1] += chunkOffset[i];
+        }
+        if (chunkOffset[numChunks] != int(values->size())) {
+            throw std::logic_error("Number of entries doesn't match Matrix Market header");
+        }
+
+        bool failed = false;
+#ifdef LIBGEODECOMP_WITH_THREADS
+#pragma omp parallel for schedule(static, 1) reduction(||:failed)
+#endif
+        for (int i = 0; i < numChunks; ++i) {
+            int index = chunkOffset[i];
+            for (const char *line = chunkBegin[i]; line < chunkBegin[i + 1]; line = nextLine(line, end)) {
+                if (!isDataLine(line, end)) {
+                    continue;
+                }
+
+                if (!parseLine(
+                        line,
+                        end,
+                        pattern,
+                        &(*rowIndices)[index],
+                        &(*columnIndices)[index],
+                        &(*values)[index])) {
+                    failed = true;
+                    break;
+                }
+                ++index;
+            }
+        }
+
+        if (failed) {
+            throw std::logic_error("Failed to parse mtx format");
+        }
+    }
+
+    static const char *nextLine(const char *cursor, const char *end)
+    {
+        const char *newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+        return newline ? (newline + 1) : end;
+    }
+
+    static bool isDataLine(const char *line, const char *end)
+    {
+        for (; line < end; ++line) {
+            switch (*line) {
+            case ' ':
+            case '\t':
+            case '\r':
+                continue;
+            case '\n':
+            case '%':
+                return false;
+            default:
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Copies the line to a NUL-terminated buffer as the mapping
+     * itself isn't terminated. Converts indices from Matrix Market's
+     * 1-based to 0-based.
+     */
+    static bool parseLine(
+        const char *line,
+        const char *end,
+        bool pattern,
+        int *row,
+        int *column,
+        double *value)
+    {
+        char buffer[256];
+        std::size_t length = (std::min)(std::size_t(nextLine(line, end) - line), sizeof(buffer) - 1);
+        std::memcpy(buffer, line, length);
+        buffer[length] = 0;
+
+        char *cursor = buffer;
+        char *next;
+        *row = std::strtol(cursor, &next, 10) - 1;
+        if (next == cursor) {
+            return false;
+        }
+        cursor = next;
+        *column = std::strtol(cursor, &next, 10) - 1;
+        if (next == cursor) {
+            return false;
+        }
+        if (pattern) {
+            *value = 1;
+            return true;
+        }
+        cursor = next;
+        *value = std::strtod(cursor, &next);
+
+        return next != cursor;
+    }
+
+    template<typename T>
+    static const char *copyFrom(const char *cursor, std::vector<T> *target)
+    {
+        std::size_t bytes = target->size() * sizeof(T);
+        if (bytes) {
+            std::memcpy(&(*target)[0], cursor, bytes);
+        }
+        return cursor + bytes;
+    }
+
+    template<typename T>
+    static void write(std::ofstream& file, const std::vector<T>& source)
+    {
+        if (!source.empty()) {
+            file.write(reinterpret_cast<const char*>(&source[0]), source.size() * sizeof(T));
+        }
+    }
+};
+
+}
+
+#endif